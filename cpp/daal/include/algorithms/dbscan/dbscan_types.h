@@ -54,7 +54,9 @@ const int undefined = -2;
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default: performance-oriented method */
+    defaultDense = 0, /*!< Default: performance-oriented method */
+    gridDense    = 1  /*!< Method for low-dimensional data that searches the neighborhoods in the cells of a uniform grid.
+                           Supported in the batch processing mode for the Euclidean, Manhattan and Minkowski distances */
 };
 
 /**
@@ -63,8 +65,12 @@ enum Method
  */
 enum DistanceType
 {
-    euclidean, /*!< Euclidean distance */
-    lastDistanceType = euclidean
+    euclidean        = 0, /*!< Euclidean distance */
+    manhattan        = 1, /*!< Manhattan distance, the sum of the absolute differences of the features */
+    minkowski        = 2, /*!< Minkowski distance of the power specified by Parameter::minkowskiPower */
+    cosine           = 3, /*!< Cosine distance, one minus the cosine similarity of the observations.
+                               Not supported in the distributed processing mode */
+    lastDistanceType = cosine
 };
 
 /**
@@ -558,6 +564,9 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     size_t rightBlocks; /*!< Number of blocks that will process observations with value of selected
                                        split feature greater than selected split value */
 
+    DistanceType distanceType; /*!< Metric used to find the neighborhoods of the observations */
+    double minkowskiPower;     /*!< Power of the Minkowski distance, not less than 1 */
+
     services::Status check() const DAAL_C11_OVERRIDE;
 };
 /* [Parameter source code] */
@@ -0,0 +1,130 @@
+/* file: decision_forest_classification_low_latency_predictor.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the class defining the low latency predictor of the decision forest classification model.
+//--
+*/
+#ifndef __DECISION_FOREST_CLASSIFICATION_LOW_LATENCY_PREDICTOR_H__
+#define __DECISION_FOREST_CLASSIFICATION_LOW_LATENCY_PREDICTOR_H__
+
+#include "algorithms/decision_forest/decision_forest_classification_model.h"
+#include "algorithms/decision_forest/decision_forest_classification_predict_types.h"
+#include "data_management/data/numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace classification
+{
+namespace prediction
+{
+/**
+ * \brief Contains version 1.0 of Intel(R) oneAPI Data Analytics Library interface.
+ */
+namespace interface1
+{
+/**
+ * @ingroup decision_forest_classification_prediction
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__DECISION_FOREST__CLASSIFICATION__PREDICTION__LOWLATENCYPREDICTOR"></a>
+ * \brief Computes the predictions of the decision forest classification model for single rows and small batches.
+ *        The rows are processed on the calling thread, without numeric tables and memory allocations.
+ *        The features are treated as continuous ones unless their types are given on construction.
+ *        Use \ref prediction::interface2::Batch "prediction::Batch" for large data sets.
+ *        The predictor uses the internal buffer, so one object must not be used by several threads simultaneously.
+ *
+ * \par References
+ *      - \ref classification::interface1::Model "classification::Model" class
+ */
+class DAAL_EXPORT LowLatencyPredictor
+{
+public:
+    /**
+     * Constructs the predictor for the decision forest classification model
+     * \param[in] model         Trained model, the predictor keeps a reference to it
+     * \param[in] nClasses      Number of classes the model was trained for
+     * \param[in] votingMethod  Method of the trees votes aggregation
+     */
+    LowLatencyPredictor(const ModelPtr & model, size_t nClasses, VotingMethod votingMethod = weighted);
+
+    /**
+     * Constructs the predictor for the decision forest classification model trained on the data with categorical features
+     * \param[in] model         Trained model, the predictor keeps a reference to it
+     * \param[in] featureTypes  Numeric table whose dictionary defines the types of the features, e.g. the training data set.
+     *                          Only the feature types are read from it
+     * \param[in] nClasses      Number of classes the model was trained for
+     * \param[in] votingMethod  Method of the trees votes aggregation
+     */
+    LowLatencyPredictor(const ModelPtr & model, const data_management::NumericTablePtr & featureTypes, size_t nClasses,
+                        VotingMethod votingMethod = weighted);
+
+    ~LowLatencyPredictor();
+
+    /**
+     * Computes the labels and the probabilities of the classes for the rows of dense row-major data
+     * \param[in]  x              Data of nRows x getNumberOfFeatures() size
+     * \param[in]  nRows          Number of rows
+     * \param[out] labels         Array of nRows predicted labels, can be null if only probabilities are required
+     * \param[out] probabilities  Array of nRows x nClasses probabilities, can be null if only labels are required
+     * \return Status of computations
+     */
+    services::Status predict(const float * x, size_t nRows, float * labels, float * probabilities = NULL);
+
+    /**
+     * \copydoc predict(const float *, size_t, float *, float *)
+     */
+    services::Status predict(const double * x, size_t nRows, double * labels, double * probabilities = NULL);
+
+    /**
+     * Returns the number of features in the rows processed by the predictor
+     * \return Number of features
+     */
+    size_t getNumberOfFeatures() const;
+
+    /**
+     * Returns the status of the predictor construction
+     * \return Status
+     */
+    services::Status getStatus() const { return _status; }
+
+    class PredictorImpl;
+
+protected:
+    PredictorImpl * _impl;
+    services::Status _status;
+
+private:
+    LowLatencyPredictor(const LowLatencyPredictor &);
+    LowLatencyPredictor & operator=(const LowLatencyPredictor &);
+};
+/** @} */
+} // namespace interface1
+using interface1::LowLatencyPredictor;
+
+} // namespace prediction
+} // namespace classification
+} // namespace decision_forest
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -359,11 +359,12 @@ public:
  *                                                          for the decision_forest prediction algorithm
  *      - \ref classifier::prediction::ModelInputId         Identifiers of input Model objects of the decision_forest prediction algorithm
  *      - \ref classifier::prediction::ResultId             Identifiers of decision_forest prediction results
+ *      - \ref ResultId                                     Identifiers of additional decision_forest prediction results
  *
  * \par References
  *      - \ref interface1::Model "Model" class
  *      - \ref classifier::prediction::interface1::Input "classifier::prediction::Input" class
- *      - \ref classifier::prediction::interface1::Result "classifier::prediction::Result" class
+ *      - \ref interface1::Result "Result" class
  */
 template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
 class DAAL_EXPORT Batch : public classifier::prediction::Batch
@@ -373,7 +374,7 @@ public:
 
     typedef algorithms::decision_forest::classification::prediction::Input InputType;
     typedef algorithms::decision_forest::classification::prediction::Parameter ParameterType;
-    typedef typename super::ResultType ResultType;
+    typedef algorithms::decision_forest::classification::prediction::Result ResultType;
 
     InputType input; /*!< %Input objects of the algorithm */
 
@@ -411,6 +412,24 @@ public:
     */
     const ParameterType & parameter() const { return *static_cast<const ParameterType *>(_par); }
 
+    /**
+     * Returns the structure that contains the result of the Decision forest prediction algorithm
+     * \return Structure that contains the result of the prediction
+     */
+    ResultPtr getResult() { return Result::cast(_result); }
+
+    /**
+     * Registers user-allocated memory to store the result of the Decision forest prediction algorithm
+     * \param[in] result  Structure to store the result of the prediction
+     */
+    services::Status setResult(const ResultPtr & result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        _result = result;
+        _res    = _result.get();
+        return services::Status();
+    }
+
     /**
      * Returns method of the algorithm
      * \return Method of the algorithm
@@ -429,7 +448,7 @@ protected:
 
     services::Status allocateResult() DAAL_C11_OVERRIDE
     {
-        services::Status s = _result->allocate<algorithmFPType>(&input, _par, 0);
+        services::Status s = static_cast<ResultType *>(_result.get())->template allocate<algorithmFPType>(&input, _par, 0);
         _res               = _result.get();
         return s;
     }
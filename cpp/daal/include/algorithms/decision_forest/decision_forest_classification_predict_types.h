@@ -57,6 +57,26 @@ enum VotingMethod
     unweighted,
     lastResultId = unweighted
 };
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__DECISION_FOREST__CLASSIFICATION__PREDICTION__RESULTID"></a>
+ * Available identifiers of the results of the prediction in addition to classifier::prediction::ResultId
+ */
+enum ResultId
+{
+    featureContributions = classifier::prediction::lastResultId + 1 /*!< Contributions of the features to the class probabilities (SHAP values)
+                                                                         followed by the bias term, for each class if the number of classes
+                                                                         is greater than 2 and for the second class otherwise */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__DECISION_FOREST__CLASSIFICATION__PREDICTION__RESULTTOCOMPUTEID"></a>
+ * Available identifiers to specify the result to compute
+ */
+enum ResultToComputeId
+{
+    computeFeatureContributions = 0x00000001ULL /*!< Compute the contributions of the features to the class probabilities */
+};
 /**
  * \brief Contains version 1.0 of the Intel(R) oneAPI Data Analytics Library interface.
  */
@@ -124,16 +144,79 @@ public:
 /* [Parameter source code] */
 struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
 {
-    Parameter(size_t nClasses, VotingMethod votingMethod = weighted) : daal::algorithms::classifier::Parameter(nClasses), votingMethod(votingMethod)
+    Parameter(size_t nClasses, VotingMethod votingMethod = weighted)
+        : daal::algorithms::classifier::Parameter(nClasses), votingMethod(votingMethod), resultsToCompute(0)
     {}
     VotingMethod votingMethod;
     services::Status check() const DAAL_C11_OVERRIDE;
+    DAAL_UINT64 resultsToCompute; /*!< 64 bit integer flag that indicates the results to compute in addition to resultsToEvaluate */
 };
 /* [Parameter source code] */
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__DECISION_FOREST__CLASSIFICATION__PREDICTION__RESULT"></a>
+ * \brief Provides interface for the result of decision forest model-based prediction
+ */
+class DAAL_EXPORT Result : public classifier::prediction::Result
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(Result)
+    Result();
+
+    using classifier::prediction::Result::get;
+    using classifier::prediction::Result::set;
+
+    /**
+     * Returns the result of decision forest model-based prediction
+     * \param[in] id    Identifier of the result
+     * \return          Result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(ResultId id) const;
+
+    /**
+     * Sets the result of decision forest model-based prediction
+     * \param[in] id      Identifier of the result
+     * \param[in] value   Result
+     */
+    void set(ResultId id, const data_management::NumericTablePtr & value);
+
+    /**
+     * Allocates memory for storing prediction results of decision forest algorithm
+     * \tparam  algorithmFPType     Data type for storing prediction results
+     * \param[in] input     Pointer to the input objects of the classification algorithm
+     * \param[in] parameter Pointer to the parameters of the classification algorithm
+     * \param[in] method    Computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
+
+    /**
+     * Checks the correctness of prediction results of decision forest algorithm
+     * \param[in] input     Pointer to the the input object
+     * \param[in] parameter Pointer to the algorithm parameters
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    using classifier::prediction::Result::check;
+
+    /** \private */
+    template <typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive * arch)
+    {
+        return classifier::prediction::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<Result> ResultPtr;
+typedef services::SharedPtr<const Result> ResultConstPtr;
+
 } // namespace interface1
 using interface1::Input;
 using interface1::Parameter;
+using interface1::Result;
+using interface1::ResultPtr;
+using interface1::ResultConstPtr;
 } // namespace prediction
 /** @} */
 } // namespace classification
@@ -88,8 +88,18 @@ enum ModelInputId
  */
 enum ResultId
 {
-    prediction   = algorithms::regression::prediction::prediction, /*!< Result of decision tree model-based prediction */
-    lastResultId = prediction
+    prediction           = algorithms::regression::prediction::prediction, /*!< Result of decision tree model-based prediction */
+    featureContributions = prediction + 1, /*!< Contributions of the features to the predictions (SHAP values) followed by the bias term */
+    lastResultId         = featureContributions
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__DECISION_FOREST__REGRESSION__PREDICTION__RESULTTOCOMPUTEID"></a>
+ * Available identifiers to specify the result to compute
+ */
+enum ResultToComputeId
+{
+    computeFeatureContributions = 0x00000001ULL /*!< Compute the contributions of the features to the predictions */
 };
 
 /**
@@ -97,6 +107,21 @@ enum ResultId
  */
 namespace interface1
 {
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__DECISION_FOREST__REGRESSION__PREDICTION__PARAMETER"></a>
+ * \brief Parameters of the decision forest prediction algorithm
+ *
+ * \snippet decision_forest/decision_forest_regression_predict_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
+{
+    Parameter() : daal::algorithms::Parameter(), resultsToCompute(0) {}
+    Parameter(const Parameter & o) : daal::algorithms::Parameter(o), resultsToCompute(o.resultsToCompute) {}
+    DAAL_UINT64 resultsToCompute; /*!< 64 bit integer flag that indicates the results to compute in addition to the prediction */
+};
+/* [Parameter source code] */
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__DECISION_FOREST__REGRESSSION__PREDICTION__INPUT"></a>
  * \brief Provides an interface for input objects for making decision forest model-based prediction
@@ -199,6 +224,7 @@ typedef services::SharedPtr<Result> ResultPtr;
 typedef services::SharedPtr<const Result> ResultConstPtr;
 
 } // namespace interface1
+using interface1::Parameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
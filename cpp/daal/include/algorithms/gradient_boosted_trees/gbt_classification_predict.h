@@ -231,11 +231,12 @@ public:
  *                                                          for the gradient boosted trees prediction algorithm
  *      - \ref classifier::prediction::ModelInputId         Identifiers of input Model objects of the algorithm
  *      - \ref classifier::prediction::ResultId             Identifiers of prediction results
+ *      - \ref ResultId                                     Identifiers of additional prediction results
  *
  * \par References
  *      - \ref interface1::Model "Model" class
  *      - \ref classifier::prediction::interface1::Input "classifier::prediction::Input" class
- *      - \ref classifier::prediction::interface1::Result "classifier::prediction::Result" class
+ *      - \ref interface2::Result "Result" class
  */
 template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
 class DAAL_EXPORT Batch : public classifier::prediction::Batch
@@ -245,7 +246,7 @@ public:
 
     typedef algorithms::gbt::classification::prediction::Input InputType;
     typedef algorithms::gbt::classification::prediction::Parameter ParameterType;
-    typedef typename super::ResultType ResultType;
+    typedef algorithms::gbt::classification::prediction::Result ResultType;
 
     InputType input; /*!< %Input objects of the algorithm */
 
@@ -278,6 +279,24 @@ public:
     */
     const ParameterType & parameter() const { return *static_cast<const ParameterType *>(_par); }
 
+    /**
+     * Returns the structure that contains the result of the gradient boosted trees prediction algorithm
+     * \return Structure that contains the result of the prediction
+     */
+    ResultPtr getResult() { return Result::cast(_result); }
+
+    /**
+     * Registers user-allocated memory to store the result of the gradient boosted trees prediction algorithm
+     * \param[in] result  Structure to store the result of the prediction
+     */
+    services::Status setResult(const ResultPtr & result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        _result = result;
+        _res    = _result.get();
+        return services::Status();
+    }
+
     /**
      * Gets input objects for the gradient boosted trees prediction algorithm
      * \return %Input objects for the Gradient Boosted Trees prediction algorithm
@@ -302,7 +321,7 @@ protected:
 
     services::Status allocateResult() DAAL_C11_OVERRIDE
     {
-        services::Status s = _result->allocate<algorithmFPType>(&input, _par, 0);
+        services::Status s = static_cast<ResultType *>(_result.get())->template allocate<algorithmFPType>(&input, _par, 0);
         _res               = _result.get();
         return s;
     }
@@ -311,6 +330,7 @@ protected:
     {
         _in = &input;
         _ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
+        _result.reset(new ResultType());
     }
 
 private:
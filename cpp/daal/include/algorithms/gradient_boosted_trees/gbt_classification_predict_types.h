@@ -53,7 +53,29 @@ namespace prediction
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default method */
+    defaultDense = 0, /*!< Default method */
+    quickScorer  = 1  /*!< QuickScorer method, models with categorical features or trees deeper than 16 levels use the default method */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__CLASSIFICATION__PREDICTION__RESULTID"></a>
+ * Available identifiers of the results of the prediction in addition to classifier::prediction::ResultId
+ */
+enum ResultId
+{
+    featureContributions = classifier::prediction::lastResultId + 1, /*!< Contributions of the features to the raw boosted values (SHAP values)
+                                                                          followed by the bias term, for each class if the number of classes
+                                                                          is greater than 2 and for the second class otherwise */
+    lastResultId = featureContributions
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__CLASSIFICATION__PREDICTION__RESULTTOCOMPUTEID"></a>
+ * Available identifiers to specify the result to compute
+ */
+enum ResultToComputeId
+{
+    computeFeatureContributions = 0x00000001ULL /*!< Compute the contributions of the features to the raw boosted values */
 };
 
 /**
@@ -91,9 +113,10 @@ namespace interface2
 /* [Parameter source code] */
 struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
 {
-    Parameter(size_t nClasses = 2) : daal::algorithms::classifier::Parameter(nClasses), nIterations(0) {}
-    Parameter(const Parameter & o) : daal::algorithms::classifier::Parameter(o), nIterations(o.nIterations) {}
-    size_t nIterations; /*!< Number of iterations of the trained model to be used for prediction */
+    Parameter(size_t nClasses = 2) : daal::algorithms::classifier::Parameter(nClasses), nIterations(0), resultsToCompute(0) {}
+    Parameter(const Parameter & o) : daal::algorithms::classifier::Parameter(o), nIterations(o.nIterations), resultsToCompute(o.resultsToCompute) {}
+    size_t nIterations;           /*!< Number of iterations of the trained model to be used for prediction */
+    DAAL_UINT64 resultsToCompute; /*!< 64 bit integer flag that indicates the results to compute in addition to resultsToEvaluate */
 };
 /* [Parameter source code] */
 } // namespace interface2
@@ -157,8 +180,73 @@ public:
 };
 
 } // namespace interface1
+
+namespace interface2
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__CLASSIFICATION__PREDICTION__RESULT"></a>
+ * \brief Provides interface for the result of gradient boosted trees model-based prediction
+ */
+class DAAL_EXPORT Result : public classifier::prediction::Result
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(Result)
+    Result();
+
+    using classifier::prediction::Result::get;
+    using classifier::prediction::Result::set;
+
+    /**
+     * Returns the result of gradient boosted trees model-based prediction
+     * \param[in] id    Identifier of the result
+     * \return          Result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(ResultId id) const;
+
+    /**
+     * Sets the result of gradient boosted trees model-based prediction
+     * \param[in] id      Identifier of the result
+     * \param[in] value   Result
+     */
+    void set(ResultId id, const data_management::NumericTablePtr & value);
+
+    /**
+     * Allocates memory for storing prediction results of gradient boosted trees algorithm
+     * \tparam  algorithmFPType     Data type for storing prediction results
+     * \param[in] input     Pointer to the input objects of the classification algorithm
+     * \param[in] parameter Pointer to the parameters of the classification algorithm
+     * \param[in] method    Computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
+
+    /**
+     * Checks the correctness of prediction results of gradient boosted trees algorithm
+     * \param[in] input     Pointer to the the input object
+     * \param[in] parameter Pointer to the algorithm parameters
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    using classifier::prediction::Result::check;
+
+    /** \private */
+    template <typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive * arch)
+    {
+        return classifier::prediction::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<Result> ResultPtr;
+typedef services::SharedPtr<const Result> ResultConstPtr;
+} // namespace interface2
+
 using interface2::Parameter;
 using interface1::Input;
+using interface2::Result;
+using interface2::ResultPtr;
+using interface2::ResultConstPtr;
 } // namespace prediction
 /** @} */
 } // namespace classification
@@ -69,6 +69,27 @@ enum LossFunctionType
     custom        /* custom function type */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__INPUTID"></a>
+ * \brief Available identifiers of input objects for model-based training
+ */
+enum InputId
+{
+    validationData = classifier::training::lastInputId + 1, /*!< %Validation data set, used with early stopping only */
+    validationLabels,                                       /*!< Labels of the validation data set */
+    lastInputId = validationLabels
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__MODELINPUTID"></a>
+ * \brief Available identifiers of input models for model-based training
+ */
+enum ModelInputId
+{
+    initialModel     = lastInputId + 1, /*!< Trained model the boosting is continued from, optional */
+    lastModelInputId = initialModel
+};
+
 enum ResultNumericTableId
 {
     variableImportanceByWeight = classifier::training::lastResultId + 1,
@@ -126,6 +147,56 @@ struct DAAL_EXPORT Parameter : public classifier::Parameter, public daal::algori
 
 namespace interface1
 {
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__INPUT"></a>
+ * \brief %Input objects for model-based training
+ */
+class DAAL_EXPORT Input : public classifier::training::Input
+{
+public:
+    Input();
+    Input(const Input & other) : classifier::training::Input(other) {}
+
+    using classifier::training::Input::get;
+    using classifier::training::Input::set;
+
+    /**
+     * Returns an input object for model-based training
+     * \param[in] id   Identifier of the input object, \ref InputId
+     * \return         %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(gbt::classification::training::InputId id) const;
+
+    /**
+     * Sets an input object for model-based training
+     * \param[in] id    Identifier of the input object, \ref InputId
+     * \param[in] value Pointer to the input object
+     */
+    void set(gbt::classification::training::InputId id, const data_management::NumericTablePtr & value);
+
+    /**
+     * Returns an input model for model-based training
+     * \param[in] id   Identifier of the input model, \ref ModelInputId
+     * \return         %Input model that corresponds to the given identifier
+     */
+    gbt::classification::ModelPtr get(ModelInputId id) const;
+
+    /**
+     * Sets an input model for model-based training
+     * \param[in] id    Identifier of the input model, \ref ModelInputId
+     * \param[in] value Pointer to the model
+     */
+    void set(ModelInputId id, const gbt::classification::ModelPtr & value);
+
+    /**
+     * Checks the correctness of the input object
+     * \param[in] parameter Pointer to the structure of the algorithm parameters
+     * \param[in] method    Computation method
+     * \return Status of checking
+     */
+    services::Status check(const daal::algorithms::Parameter * parameter, int method) const DAAL_C11_OVERRIDE;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__RESULT"></a>
  * \brief Provides methods to access the result obtained with the compute() method
@@ -200,6 +271,7 @@ typedef services::SharedPtr<Result> ResultPtr;
 
 } // namespace interface1
 using interface2::Parameter;
+using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
 
@@ -57,7 +57,8 @@ namespace prediction
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default method */
+    defaultDense = 0, /*!< Default method */
+    quickScorer  = 1  /*!< QuickScorer method, models with categorical features or trees deeper than 16 levels use the default method */
 };
 
 /**
@@ -86,8 +87,18 @@ enum ModelInputId
  */
 enum ResultId
 {
-    prediction   = algorithms::regression::prediction::prediction, /*!< Result of gradient boosted trees model-based prediction */
-    lastResultId = prediction
+    prediction           = algorithms::regression::prediction::prediction, /*!< Result of gradient boosted trees model-based prediction */
+    featureContributions = prediction + 1, /*!< Contributions of the features to the predictions (SHAP values) followed by the bias term */
+    lastResultId         = featureContributions
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__PREDICTION__RESULTTOCOMPUTEID"></a>
+ * Available identifiers to specify the result to compute
+ */
+enum ResultToComputeId
+{
+    computeFeatureContributions = 0x00000001ULL /*!< Compute the contributions of the features to the predictions */
 };
 
 /**
@@ -104,9 +115,10 @@ namespace interface1
 /* [Parameter source code] */
 struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 {
-    Parameter() : daal::algorithms::Parameter(), nIterations(0) {}
-    Parameter(const Parameter & o) : daal::algorithms::Parameter(o), nIterations(o.nIterations) {}
-    size_t nIterations; /*!< Number of iterations of the trained model to be uses for prediction*/
+    Parameter() : daal::algorithms::Parameter(), nIterations(0), resultsToCompute(0) {}
+    Parameter(const Parameter & o) : daal::algorithms::Parameter(o), nIterations(o.nIterations), resultsToCompute(o.resultsToCompute) {}
+    size_t nIterations;           /*!< Number of iterations of the trained model to be uses for prediction*/
+    DAAL_UINT64 resultsToCompute; /*!< 64 bit integer flag that indicates the results to compute in addition to the prediction */
 };
 /* [Parameter source code] */
 
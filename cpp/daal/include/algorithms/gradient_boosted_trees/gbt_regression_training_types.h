@@ -83,7 +83,19 @@ enum InputId
 {
     data              = algorithms::regression::training::data,               /*!< %Input data table */
     dependentVariable = algorithms::regression::training::dependentVariables, /*!< %Values of the dependent variable for the input data */
-    lastInputId       = dependentVariable
+    validationData    = algorithms::regression::training::lastInputId + 1,    /*!< %Validation data set, used with early stopping only */
+    validationDependentVariable,                                              /*!< %Values of the dependent variable for the validation data set */
+    lastInputId = validationDependentVariable
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__MODELINPUTID"></a>
+ * \brief Available identifiers of input models for model-based training
+ */
+enum ModelInputId
+{
+    initialModel     = lastInputId + 1, /*!< Trained model the boosting is continued from, optional */
+    lastModelInputId = initialModel
 };
 
 /**
@@ -158,6 +170,20 @@ public:
      */
     void set(InputId id, const data_management::NumericTablePtr & value);
 
+    /**
+     * Returns an input model for model-based training
+     * \param[in] id    Identifier of the input model
+     * \return          %Input model that corresponds to the given identifier
+     */
+    gbt::regression::ModelPtr get(ModelInputId id) const;
+
+    /**
+     * Sets an input model for model-based training
+     * \param[in] id      Identifier of the input model
+     * \param[in] value   Pointer to the model
+     */
+    void set(ModelInputId id, const gbt::regression::ModelPtr & value);
+
     /**
     * Checks an input object for the gradient boosted trees algorithm
     * \param[in] par     Algorithm parameter
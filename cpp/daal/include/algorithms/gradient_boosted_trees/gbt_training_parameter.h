@@ -77,6 +77,18 @@ enum VariableImportanceModes
     gain       = 0x010ULL
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__TRAINING__VALIDATION_METRIC"></a>
+ * \brief Metric computed on the validation data set to stop the training early
+ */
+enum ValidationMetric
+{
+    lossMetric              = 0,         /*!< Loss function of the training: squared loss for regression, cross-entropy for classification */
+    meanAbsoluteError       = 1,         /*!< Mean absolute error, regression only */
+    classificationError     = 2,         /*!< Fraction of misclassified observations, classification only */
+    defaultValidationMetric = lossMetric /*!< Default validation metric */
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) oneAPI Data Analytics Library interface
  */
@@ -120,6 +132,13 @@ public:
     size_t minBinSize;                  /*!< Used with 'inexact' split finding method only.
                                                  Minimal number of observations in a bin. Default is 5 */
     int internalOptions;                /*!< Internal options */
+    size_t gradientBits;                /*!< Used with 'inexact' split finding method only.
+                                                 Number of bits the gradients and hessians are quantized to
+                                                 when the histograms are computed: 8 or 16. Default is 0 (no quantization) */
+    size_t earlyStoppingRounds;         /*!< Training stops when the validation metric has not improved for this number of iterations,
+                                                 the model is truncated to the iteration with the best metric value.
+                                                 Requires the validation data set. Default is 0 (no early stopping) */
+    ValidationMetric validationMetric;  /*!< Metric computed on the validation data set. Default is the loss function */
 };
 /* [Parameter source code] */
 } // namespace interface1
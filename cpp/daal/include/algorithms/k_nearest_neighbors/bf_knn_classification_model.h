@@ -72,6 +72,21 @@ enum VoteWeights
                            than neighbors that are further away */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__BF_KNN_CLASSIFICATION__DISTANCETYPE"></a>
+ * \brief Metrics used to find the nearest neighbors
+ */
+enum DistanceType
+{
+    euclidean        = 0, /*!< Euclidean distance */
+    manhattan        = 1, /*!< Manhattan distance, the sum of the absolute differences of the features */
+    minkowski        = 2, /*!< Minkowski distance of the power specified by Parameter::minkowskiPower */
+    cosine           = 3, /*!< Cosine distance, one minus the cosine similarity of the observations */
+    innerProduct     = 4, /*!< Inner product of the observations taken with the minus sign, so the nearest neighbors
+                               are the observations with the largest inner products */
+    lastDistanceType = innerProduct
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) oneAPI Data Analytics Library interface.
  */
@@ -102,7 +117,12 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
           dataUseInModel(dataUse),
           resultsToCompute(resToCompute),
           voteWeights(vote),
-          engine(engines::mcg59::Batch<>::create())
+          engine(engines::mcg59::Batch<>::create()),
+          nLists(0),
+          nProbes(8),
+          nQuantizerIterations(10),
+          distanceType(euclidean),
+          minkowskiPower(2.0)
     {
         this->resultsToEvaluate = resToEvaluate;
     }
@@ -117,7 +137,12 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
           dataUseInModel(other.dataUseInModel),
           resultsToCompute(other.resultsToCompute),
           voteWeights(other.voteWeights),
-          engine(other.engine->clone())
+          engine(other.engine->clone()),
+          nLists(other.nLists),
+          nProbes(other.nProbes),
+          nQuantizerIterations(other.nQuantizerIterations),
+          distanceType(other.distanceType),
+          minkowskiPower(other.minkowskiPower)
     {
         this->resultsToEvaluate = other.resultsToEvaluate;
     }
@@ -137,6 +162,11 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
             voteWeights                                      = other.voteWeights;
             resultsToCompute                                 = other.resultsToCompute;
             this->resultsToEvaluate                          = other.resultsToEvaluate;
+            nLists                                           = other.nLists;
+            nProbes                                          = other.nProbes;
+            nQuantizerIterations                             = other.nQuantizerIterations;
+            distanceType                                     = other.distanceType;
+            minkowskiPower                                   = other.minkowskiPower;
         }
         return *this;
     }
@@ -151,6 +181,13 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
     DAAL_UINT64 resultsToCompute;  /*!< 64 bit integer flag that indicates the results to compute */
     VoteWeights voteWeights;       /*!< Weight function used in prediction */
     engines::EnginePtr engine;     /*!< Engine for random choosing elements from training dataset */
+    size_t nLists;                 /*!< Number of inverted lists built by the ivfFlat training method.
+                                        If it is 0, the square root of the number of training observations is used */
+    size_t nProbes;                /*!< Number of the nearest inverted lists scanned by the ivfFlat prediction method.
+                                        Larger values increase the recall of the search at the cost of its speed */
+    size_t nQuantizerIterations;   /*!< Number of k-means iterations performed by the ivfFlat training method to find the centroids of the lists */
+    DistanceType distanceType;     /*!< Metric used to find the nearest neighbors. The ivfFlat method supports the Euclidean distance only */
+    double minkowskiPower;         /*!< Power of the Minkowski distance, not less than 1 */
 };
 /* [Parameter source code] */
 
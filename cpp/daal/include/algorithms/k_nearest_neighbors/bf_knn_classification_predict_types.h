@@ -55,7 +55,8 @@ namespace prediction
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default method */
+    defaultDense = 0, /*!< Default method */
+    ivfFlat      = 1  /*!< Approximate search that scans the nearest inverted lists of the model trained with training::ivfFlat method */
 };
 
 /**
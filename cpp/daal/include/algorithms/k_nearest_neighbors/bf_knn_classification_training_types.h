@@ -55,7 +55,8 @@ namespace training
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default method */
+    defaultDense = 0, /*!< Default method */
+    ivfFlat      = 1  /*!< Builds the inverted file index over k-means clusters of the training data for approximate search */
 };
 
 /**
@@ -30,9 +30,11 @@
 #include "data_management/compression/zlibcompression.h"
 #include "data_management/features/compatibility.h"
 #include "data_management/data_source/csv_feature_manager.h"
+#include "data_management/data_source/data_block_prefetcher.h"
 #include "data_management/data_source/data_source.h"
 #include "data_management/data_source/data_source_utils.h"
 #include "data_management/data_source/file_data_source.h"
+#include "data_management/data_source/parallel_file_data_source.h"
 #include "data_management/data_source/string_data_source.h"
 #include "data_management/data/aos_numeric_table.h"
 #include "data_management/data/csr_numeric_table.h"
@@ -261,19 +263,23 @@
 #include "algorithms/decision_tree/decision_tree_regression_training_batch.h"
 #include "algorithms/decision_tree/decision_tree_regression_training_types.h"
 #include "algorithms/decision_tree/decision_tree_regression_predict_types.h"
+#include "algorithms/decision_forest/decision_forest_classification_low_latency_predictor.h"
 #include "algorithms/decision_forest/decision_forest_classification_model.h"
 #include "algorithms/decision_forest/decision_forest_classification_model_builder.h"
 #include "algorithms/decision_forest/decision_forest_classification_predict.h"
 #include "algorithms/decision_forest/decision_forest_classification_training_batch.h"
+#include "algorithms/decision_forest/decision_forest_regression_low_latency_predictor.h"
 #include "algorithms/decision_forest/decision_forest_regression_model.h"
 #include "algorithms/decision_forest/decision_forest_regression_predict.h"
 #include "algorithms/decision_forest/decision_forest_regression_training_batch.h"
 #include "algorithms/decision_forest/decision_forest_regression_training_types.h"
+#include "algorithms/gradient_boosted_trees/gbt_classification_low_latency_predictor.h"
 #include "algorithms/gradient_boosted_trees/gbt_classification_model.h"
 #include "algorithms/gradient_boosted_trees/gbt_classification_model_builder.h"
 #include "algorithms/gradient_boosted_trees/gbt_classification_predict.h"
 #include "algorithms/gradient_boosted_trees/gbt_classification_training_batch.h"
 #include "algorithms/gradient_boosted_trees/gbt_classification_training_types.h"
+#include "algorithms/gradient_boosted_trees/gbt_regression_low_latency_predictor.h"
 #include "algorithms/gradient_boosted_trees/gbt_regression_model.h"
 #include "algorithms/gradient_boosted_trees/gbt_regression_model_builder.h"
 #include "algorithms/gradient_boosted_trees/gbt_regression_predict.h"
@@ -387,13 +387,22 @@ protected:
         }
         arch->set((char *)_offsets, getNumberOfColumns() * sizeof(size_t));
 
+        size_t size = getNumberOfRows();
+
         if (onDeserialize)
         {
+            /* The archive over a shared buffer lets the table refer to the data instead of copying it */
+            services::SharedPtr<byte> view = arch->template getArrayView<byte>(size * _structSize);
+            if (view)
+            {
+                freeDataMemoryImpl();
+                _ptr       = view;
+                _memStatus = userAllocated;
+                return services::Status();
+            }
             allocateDataMemoryImpl();
         }
 
-        size_t size = getNumberOfRows();
-
         arch->set((char *)_ptr.get(), size * _structSize);
 
         return services::Status();
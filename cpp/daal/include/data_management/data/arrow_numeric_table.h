@@ -262,63 +262,56 @@ private:
 
         nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
 
+        if (ncols == 1)
+        {
+            /* The block of rows of the single column is a slice of the column, so it can refer to the Arrow buffer */
+            const T * const ptr = getSingleChunkPtr<T>(0, idx, nrows);
+            if (ptr)
+            {
+                block.setPtr(const_cast<T * const>(ptr), 1, nrows);
+                return services::Status();
+            }
+        }
+
         if (!block.resizeBuffer(ncols, nrows))
         {
             return services::Status(services::ErrorMemoryAllocationFailed);
         }
 
-        T lbuf[32];
-        size_t di        = 32;
-        T * const buffer = block.getBlockPtr();
-
-        for (size_t i = 0; i < nrows; i += di)
+        services::Collection<internal::ColumnChunk> chunks;
+        for (size_t j = 0; j < ncols; ++j)
         {
-            if (i + di > nrows)
-            {
-                di = nrows - i;
-            }
+            const NumericTableFeature & f = (*_ddict)[j];
+
+            const std::shared_ptr<const arrow::ChunkedArray> columnChunkedArrayPtr = getColumnChunkedArrayPtr(j);
+            DAAL_ASSERT(columnChunkedArrayPtr);
+            const std::shared_ptr<const arrow::ChunkedArray> sliceChunkedArrayPtr = columnChunkedArrayPtr->Slice(idx, nrows);
+            DAAL_ASSERT(sliceChunkedArrayPtr);
+            const arrow::ChunkedArray & sliceChunkedArray = *sliceChunkedArrayPtr;
+            const int chunkCount                          = sliceChunkedArray.num_chunks();
+            DAAL_ASSERT(chunkCount > 0);
 
-            for (size_t j = 0; j < ncols; ++j)
+            size_t offset = 0;
+            for (int chunk = 0; chunk < chunkCount; ++chunk)
             {
-                const NumericTableFeature & f = (*_ddict)[j];
-
-                const std::shared_ptr<const arrow::ChunkedArray> columnChunkedArrayPtr = getColumnChunkedArrayPtr(j);
-                DAAL_ASSERT(columnChunkedArrayPtr);
-                const std::shared_ptr<const arrow::ChunkedArray> sliceChunkedArrayPtr = columnChunkedArrayPtr->Slice(idx + i, di);
-                DAAL_ASSERT(sliceChunkedArrayPtr);
-                const arrow::ChunkedArray & sliceChunkedArray = *sliceChunkedArrayPtr;
-                const int chunkCount                          = sliceChunkedArray.num_chunks();
-                DAAL_ASSERT(chunkCount > 0);
-                if (chunkCount == 1)
-                {
-                    const char * const ptr = getPtr(sliceChunkedArray.chunk(0), f);
-                    DAAL_ASSERT(ptr);
-                    internal::getVectorUpCast(f.indexType, internal::getConversionDataType<T>())(di, ptr, lbuf);
-                }
-                else
-                {
-                    size_t offset = 0;
-                    for (int chunk = 0; chunk < chunkCount; ++chunk)
-                    {
-                        const std::shared_ptr<const arrow::Array> arrayPtr = sliceChunkedArray.chunk(chunk);
-                        DAAL_ASSERT(arrayPtr);
-                        const int64_t chunkLength = arrayPtr->length();
-                        DAAL_ASSERT(chunkLength > 0);
-                        const char * const ptr = getPtr(arrayPtr, f);
-                        DAAL_ASSERT(ptr);
-                        internal::getVectorUpCast(f.indexType, internal::getConversionDataType<T>())(chunkLength, ptr, &(lbuf[offset]));
-                        offset += chunkLength;
-                    }
-                    DAAL_ASSERT(offset == di);
-                }
+                const std::shared_ptr<const arrow::Array> arrayPtr = sliceChunkedArray.chunk(chunk);
+                DAAL_ASSERT(arrayPtr);
+                const int64_t chunkLength = arrayPtr->length();
+                if (chunkLength == 0) continue;
 
-                for (size_t ii = 0; ii < di; ++ii)
+                const internal::ColumnChunk columnChunk = { getPtr(arrayPtr, f), offset, (size_t)chunkLength, j, f.indexType, f.typeSize };
+                DAAL_ASSERT(columnChunk.ptr);
+                if (!chunks.safe_push_back(columnChunk))
                 {
-                    buffer[(i + ii) * ncols + j] = lbuf[ii];
+                    return services::Status(services::ErrorMemoryAllocationFailed);
                 }
+                offset += chunkLength;
             }
+            DAAL_ASSERT(offset == nrows);
         }
 
+        internal::convertColumnChunksToRows(chunks.data(), chunks.size(), nrows, ncols, internal::getConversionDataType<T>(), block.getBlockPtr());
+
         return services::Status();
     }
 
@@ -353,20 +346,9 @@ private:
 
         nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
 
-        const NumericTableFeature & f = (*_ddict)[featIdx];
-
-        const std::shared_ptr<const arrow::ChunkedArray> columnChunkedArrayPtr = getColumnChunkedArrayPtr(featIdx);
-        DAAL_ASSERT(columnChunkedArrayPtr);
-        const std::shared_ptr<const arrow::ChunkedArray> sliceChunkedArrayPtr = columnChunkedArrayPtr->Slice(idx, nrows);
-        DAAL_ASSERT(sliceChunkedArrayPtr);
-        const arrow::ChunkedArray & sliceChunkedArray = *sliceChunkedArrayPtr;
-        const int chunkCount                          = sliceChunkedArray.num_chunks();
-        DAAL_ASSERT(chunkCount > 0);
-
-        if (features::internal::getIndexNumType<T>() == f.indexType && chunkCount == 1)
+        const T * const ptr = getSingleChunkPtr<T>(featIdx, idx, nrows);
+        if (ptr)
         {
-            const T * const ptr = getPtr<T>(sliceChunkedArray.chunk(0), f);
-            DAAL_ASSERT(ptr);
             block.setPtr(const_cast<T * const>(ptr), 1, nrows);
         }
         else
@@ -378,6 +360,16 @@ private:
 
             if (!(block.getRWFlag() & (int)readOnly)) return services::Status();
 
+            const NumericTableFeature & f = (*_ddict)[featIdx];
+
+            const std::shared_ptr<const arrow::ChunkedArray> columnChunkedArrayPtr = getColumnChunkedArrayPtr(featIdx);
+            DAAL_ASSERT(columnChunkedArrayPtr);
+            const std::shared_ptr<const arrow::ChunkedArray> sliceChunkedArrayPtr = columnChunkedArrayPtr->Slice(idx, nrows);
+            DAAL_ASSERT(sliceChunkedArrayPtr);
+            const arrow::ChunkedArray & sliceChunkedArray = *sliceChunkedArrayPtr;
+            const int chunkCount                          = sliceChunkedArray.num_chunks();
+            DAAL_ASSERT(chunkCount > 0);
+
             if (chunkCount == 1)
             {
                 const char * const ptr = getPtr(sliceChunkedArray.chunk(0), f);
@@ -399,7 +391,7 @@ private:
                     internal::getVectorUpCast(f.indexType, internal::getConversionDataType<T>())(chunkLength, ptr, destPtr + offset);
                     offset += chunkLength;
                 }
-                DAAL_ASSERT(offset == di);
+                DAAL_ASSERT(offset == nrows);
             }
         }
         return services::Status();
@@ -417,6 +409,25 @@ private:
         return services::Status();
     }
 
+    /**
+     *  Returns pointer to the values of the rows of the column if they are stored in a single Arrow chunk of type T,
+     *  NULL otherwise
+     */
+    template <typename T>
+    const T * getSingleChunkPtr(size_t featIdx, size_t idx, size_t nrows)
+    {
+        const NumericTableFeature & f = (*_ddict)[featIdx];
+        if (features::internal::getIndexNumType<T>() != f.indexType) return NULL;
+
+        const std::shared_ptr<const arrow::ChunkedArray> columnChunkedArrayPtr = getColumnChunkedArrayPtr(featIdx);
+        DAAL_ASSERT(columnChunkedArrayPtr);
+        const std::shared_ptr<const arrow::ChunkedArray> sliceChunkedArrayPtr = columnChunkedArrayPtr->Slice(idx, nrows);
+        DAAL_ASSERT(sliceChunkedArrayPtr);
+        if (sliceChunkedArrayPtr->num_chunks() != 1) return NULL;
+
+        return getPtr<T>(sliceChunkedArrayPtr->chunk(0), f);
+    }
+
     template <typename T = char>
     const T * getPtr(const arrow::Array & array, const NumericTableFeature & f, int bufferIndex = 1) const
     {
@@ -166,6 +166,21 @@ public:
     int getUpdateVersion() DAAL_C11_OVERRIDE { return _updateVersion; }
 
 protected:
+    /* Every value is stored at the offset aligned to DAAL_MALLOC_DEFAULT_ALIGNMENT, except in the archives of version 2016.0.0 */
+    inline size_t alignValueUp(size_t value)
+    {
+        if (_majorVersion == 2016 && _minorVersion == 0 && _updateVersion == 0)
+        {
+            return value;
+        }
+
+        size_t alignm1 = DAAL_MALLOC_DEFAULT_ALIGNMENT - 1;
+
+        size_t alignedValue = value + alignm1;
+        alignedValue &= ~alignm1;
+        return alignedValue;
+    }
+
     int _majorVersion;
     int _minorVersion;
     int _updateVersion;
@@ -460,20 +475,6 @@ protected:
         blockOffset[currentWriteBlock]        = 0;
     }
 
-    inline size_t alignValueUp(size_t value)
-    {
-        if (_majorVersion == 2016 && _minorVersion == 0 && _updateVersion == 0)
-        {
-            return value;
-        }
-
-        size_t alignm1 = DAAL_MALLOC_DEFAULT_ALIGNMENT - 1;
-
-        size_t alignedValue = value + alignm1;
-        alignedValue &= ~alignm1;
-        return alignedValue;
-    }
-
     services::SharedPtr<services::ErrorCollection> _errors;
 
 private:
@@ -496,6 +497,107 @@ private:
     DataArchive & operator=(const DataArchive &);
 };
 
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__READONLYDATAARCHIVE"></a>
+ *  \brief Implements the abstract DataArchiveIface interface over an external read-only buffer with the serialized data,
+ *  for example, a memory mapped file with the archive copied by InputDataArchive::copyArchiveToArray().
+ *  The buffer is not copied. Arrays of the numeric tables restored from the archive refer to the buffer,
+ *  so the tables keep it alive and must not be modified.
+ */
+class ReadOnlyDataArchive : public DataArchiveImpl
+{
+public:
+    /**
+     *  Constructor of a data archive over the data in a byte array
+     *  \param[in]  ptr  Pointer to the array that represents the data, the archive shares its ownership
+     *  \param[in]  size Size of the data array
+     */
+    ReadOnlyDataArchive(const services::SharedPtr<byte> & ptr, size_t size)
+        : _errors(new services::ErrorCollection()), _buffer(ptr), _size(ptr ? size : 0), _readOffset(0)
+    {}
+
+    ~ReadOnlyDataArchive() DAAL_C11_OVERRIDE {}
+
+    void write(byte * /*ptr*/, size_t /*size*/) DAAL_C11_OVERRIDE { this->_errors->add(services::ErrorDataArchiveInternal); }
+
+    void read(byte * ptr, size_t size) DAAL_C11_OVERRIDE
+    {
+        const size_t alignedSize = alignValueUp(size);
+        if (_size < _readOffset + alignedSize)
+        {
+            this->_errors->add(services::ErrorDataArchiveInternal);
+            return;
+        }
+
+        int result = daal::services::internal::daal_memcpy_s(ptr, size, _buffer.get() + _readOffset, size);
+        if (result)
+        {
+            this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+            return;
+        }
+        _readOffset += alignedSize;
+    }
+
+    /**
+     *  Skips the next size bytes of the archive and returns the pointer to them that shares the ownership of the buffer
+     *  \param[in]  size Number of bytes to skip
+     *  \return Pointer to the skipped bytes, empty if they are not aligned to DAAL_MALLOC_DEFAULT_ALIGNMENT
+     */
+    services::SharedPtr<byte> readView(size_t size)
+    {
+        const size_t alignedSize = alignValueUp(size);
+        byte * const ptr         = _buffer.get() + _readOffset;
+        if (_size < _readOffset + alignedSize || (size_t)ptr % DAAL_MALLOC_DEFAULT_ALIGNMENT != 0)
+        {
+            return services::SharedPtr<byte>();
+        }
+
+        _readOffset += alignedSize;
+        return services::SharedPtr<byte>(_buffer, _buffer.get(), ptr);
+    }
+
+    size_t getSizeOfArchive() const DAAL_C11_OVERRIDE { return _size; }
+
+    services::SharedPtr<byte> getArchiveAsArraySharedPtr() const DAAL_C11_OVERRIDE { return _buffer; }
+
+    byte * getArchiveAsArray() DAAL_C11_OVERRIDE { return _buffer.get(); }
+
+    std::string getArchiveAsString() DAAL_C11_OVERRIDE { return std::string((char *)_buffer.get(), _size); }
+
+    size_t copyArchiveToArray(byte * ptr, size_t maxLength) const DAAL_C11_OVERRIDE
+    {
+        if (_size == 0 || _size > maxLength)
+        {
+            return _size;
+        }
+
+        int result = daal::services::internal::daal_memcpy_s(ptr, maxLength, _buffer.get(), _size);
+        if (result)
+        {
+            this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+            return 0;
+        }
+        return _size;
+    }
+
+    /**
+     * Returns errors during the computation
+     * \return Errors during the computation
+     */
+    services::SharedPtr<services::ErrorCollection> getErrors() { return _errors; }
+
+protected:
+    services::SharedPtr<services::ErrorCollection> _errors;
+
+private:
+    services::SharedPtr<byte> _buffer;
+    size_t _size;
+    size_t _readOffset;
+
+    ReadOnlyDataArchive(const ReadOnlyDataArchive &);
+    ReadOnlyDataArchive & operator=(const ReadOnlyDataArchive &);
+};
+
 /**
  *  <a name="DAAL-CLASS-DATA_MANAGEMENT__COMPRESSEDDATAARCHIVE"></a>
  *  \brief Abstract interface class that defines methods to access and modify a serialized object.
@@ -856,6 +958,17 @@ public:
         }
     }
 
+    /**
+     *  Used by the objects that share the serialization and deserialization code.
+     *  The archive being written provides no views of the data
+     *  \return Empty pointer
+     */
+    template <typename T>
+    services::SharedPtr<T> getArrayView(size_t /*size*/)
+    {
+        return services::SharedPtr<T>();
+    }
+
     /**
      *  Performs data serialization creating a data segment
      *  \param[in]   ptr  Pointer to the serializable object
@@ -1003,7 +1116,7 @@ public:
     /**
      *  Constructor of an output data archive from an input data archive
      */
-    OutputDataArchive(InputDataArchive & arch) : _errors(new services::ErrorCollection())
+    OutputDataArchive(InputDataArchive & arch) : _errors(new services::ErrorCollection()), _viewArch(NULL)
     {
         _arch = new DataArchive(arch.getDataArchive());
         archiveHeader();
@@ -1014,7 +1127,7 @@ public:
      *  The new OutputDataArchive object will own the provided pointer
      *  and free it when it gets deleted.
      */
-    OutputDataArchive(DataArchiveIface * arch) : _errors(new services::ErrorCollection())
+    OutputDataArchive(DataArchiveIface * arch) : _errors(new services::ErrorCollection()), _viewArch(NULL)
     {
         _arch = arch;
         archiveHeader();
@@ -1023,7 +1136,7 @@ public:
     /**
      *  Constructor of an output data archive from a byte array
      */
-    OutputDataArchive(byte * ptr, size_t size) : _errors(new services::ErrorCollection())
+    OutputDataArchive(byte * ptr, size_t size) : _errors(new services::ErrorCollection()), _viewArch(NULL)
     {
         _arch = new DataArchive(ptr, size);
         archiveHeader();
@@ -1032,13 +1145,27 @@ public:
     /**
      *  Constructor of an output data archive from a byte array of compressed data
      */
-    OutputDataArchive(daal::data_management::DecompressorImpl * decompressor, byte * ptr, size_t size) : _errors(new services::ErrorCollection())
+    OutputDataArchive(daal::data_management::DecompressorImpl * decompressor, byte * ptr, size_t size)
+        : _errors(new services::ErrorCollection()), _viewArch(NULL)
     {
         _arch = new DecompressedDataArchive(decompressor);
         _arch->write(ptr, size);
         archiveHeader();
     }
 
+    /**
+     *  Constructor of an output data archive over a byte array without copying it, for example, over a memory mapped file.
+     *  The numeric tables restored from the archive refer to the array and share its ownership, they must not be modified
+     *  \param[in]  ptr  Pointer to the array with the serialized data aligned to DAAL_MALLOC_DEFAULT_ALIGNMENT
+     *  \param[in]  size Size of the array
+     */
+    OutputDataArchive(const services::SharedPtr<byte> & ptr, size_t size) : _errors(new services::ErrorCollection())
+    {
+        _viewArch = new ReadOnlyDataArchive(ptr, size);
+        _arch     = _viewArch;
+        archiveHeader();
+    }
+
     ~OutputDataArchive() DAAL_C11_OVERRIDE { delete _arch; }
 
     /**
@@ -1135,6 +1262,25 @@ public:
         }
     }
 
+    /**
+     *  Performs data deserialization of an array of values of the basic datatype without copying
+     *  if the archive is constructed over a shared byte array.
+     *  The array is skipped in the archive only if the view is returned
+     *  \tparam  T         Basic datatype
+     *  \param[in]   size  Number of values in the array
+     *  \return Read-only view of the array that shares the ownership of the archive buffer,
+     *          empty if the archive copies the data or the array is not aligned
+     */
+    template <typename T>
+    services::SharedPtr<T> getArrayView(size_t size) const
+    {
+        if (!_viewArch)
+        {
+            return services::SharedPtr<T>();
+        }
+        return services::reinterpretPointerCast<T, byte>(_viewArch->readView(size * sizeof(T)));
+    }
+
     /**
      *  Performs data deserialization creating a data segment
      *  \param[in]   ptr  Pointer to the serializable object
@@ -1232,6 +1378,7 @@ public:
 protected:
     DataArchiveIface * _arch;
     services::SharedPtr<services::ErrorCollection> _errors;
+    ReadOnlyDataArchive * _viewArch; /* The same object as _arch if the archive does not copy the data, NULL otherwise */
 
 private:
     OutputDataArchive(const OutputDataArchive &);
@@ -1242,6 +1389,7 @@ private:
 } // namespace interface1
 using interface1::DataArchiveIface;
 using interface1::DataArchive;
+using interface1::ReadOnlyDataArchive;
 using interface1::CompressedDataArchive;
 using interface1::DecompressedDataArchive;
 using interface1::InputDataArchive;
@@ -810,13 +810,22 @@ protected:
     {
         NumericTable::serialImpl<Archive, onDeserialize>(archive);
 
+        size_t size = getNumberOfColumns() * getNumberOfRows();
+
         if (onDeserialize)
         {
+            /* The archive over a shared buffer lets the table refer to the data instead of copying it */
+            services::SharedPtr<byte> view = archive->template getArrayView<byte>(size * sizeof(DataType));
+            if (view)
+            {
+                freeDataMemoryImpl();
+                _ptr       = view;
+                _memStatus = userAllocated;
+                return services::Status();
+            }
             allocateDataMemoryImpl();
         }
 
-        size_t size = getNumberOfColumns() * getNumberOfRows();
-
         archive->set((DataType *)_ptr.get(), size);
 
         return services::Status();
@@ -142,6 +142,33 @@ private:
 template <typename T>
 DAAL_EXPORT void vectorAssignValueToArray(T * const ptr, const size_t n, const T value);
 
+/**
+ *  <a name="DAAL-STRUCT-DATAMANAGEMENT-INTERNAL__COLUMNCHUNK"></a>
+ *  \brief Contiguous part of a column: values of the consecutive rows stored in an array of one type
+ */
+struct ColumnChunk
+{
+    const char * ptr; /*!< Pointer to the value of the first row of the chunk */
+    size_t firstRow;  /*!< Index of the first row of the chunk in the block of rows */
+    size_t nRows;     /*!< Number of rows in the chunk */
+    size_t column;    /*!< Index of the column */
+    int indexType;    /*!< Type of the values, features::IndexNumType */
+    size_t typeSize;  /*!< Size of a value in bytes */
+};
+
+/**
+ *  Converts the chunks of the columns into the block of rows stored in the row-major layout.
+ *  Large blocks are split into the blocks of rows that are converted in parallel
+ *  \param[in]  chunks    Chunks of the columns, every row of every column belongs to exactly one chunk
+ *  \param[in]  nChunks   Number of chunks
+ *  \param[in]  nRows     Number of rows in the block
+ *  \param[in]  nColumns  Number of columns in the block
+ *  \param[in]  dstType   Type of the values in the block
+ *  \param[out] dst       Pointer to the block of rows
+ */
+DAAL_EXPORT void convertColumnChunksToRows(const ColumnChunk * chunks, size_t nChunks, size_t nRows, size_t nColumns, ConversionDataType dstType,
+                                           void * dst);
+
 /** @} */
 
 } // namespace internal
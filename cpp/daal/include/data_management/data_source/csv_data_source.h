@@ -254,17 +254,11 @@ public:
             return 0;
         }
 
-        if (_parseHeader && !_firstRowRead)
+        s = skipHeader();
+        if (!s)
         {
-            // Skip header
-            s = readLine();
-            if (!s)
-            {
-                this->_status.add(services::throwIfPossible(s));
-                return 0;
-            }
-
-            _firstRowRead = true;
+            this->_status.add(services::throwIfPossible(s));
+            return 0;
         }
 
         size_t j = 0;
@@ -387,6 +381,21 @@ protected:
         return services::Status();
     }
 
+    services::Status skipHeader()
+    {
+        if (_parseHeader && !_firstRowRead)
+        {
+            services::Status s = readLine();
+            if (!s)
+            {
+                return s;
+            }
+
+            _firstRowRead = true;
+        }
+        return services::Status();
+    }
+
     bool enlargeBuffer()
     {
         int newRawLineBufferLen = _rawLineBufferLen * 2;
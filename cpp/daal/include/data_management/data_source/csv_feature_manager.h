@@ -28,6 +28,7 @@
 #include "data_management/features/shortcuts.h"
 #include "data_management/data_source/data_source.h"
 #include "data_management/data_source/internal/csv_feature_utils.h"
+#include "data_management/data_source/internal/csv_parallel_parser.h"
 #include "data_management/data_source/modifiers/csv/shortcuts.h"
 #include "data_management/data_source/modifiers/csv/internal/engine.h"
 
@@ -300,6 +301,25 @@ public:
     }
 };
 
+namespace internal
+{
+/**
+ *  Converts one line of CSV text into a row of the numeric table when the function of every token is either
+ *  the function of continuous features or ModifierIface::nullFunc. Only the continuous tokens are written, into the columns given by auxVect
+ *  \param[in]  text      Pointer to the line, not necessarily null-terminated
+ *  \param[in]  size      Size of the line in bytes without end-of-line symbols
+ *  \param[in]  delimiter Delimiter of the tokens in a line
+ *  \param[in]  funcList  Function of every token of a line
+ *  \param[in]  auxVect   Auxiliary data of every token of a line
+ *  \param[in]  nTokens   Number of tokens to convert
+ *  \param[in]  contFunc  Function of continuous features, ModifierIface::contFunc as seen by the caller
+ *  \param[out] row       Pointer to the row of the numeric table
+ */
+DAAL_EXPORT void parseCsvRow(const char * text, size_t size, char delimiter, const functionT * funcList, const FeatureAuxData * auxVect, size_t nTokens,
+                             functionT contFunc, DAAL_DATA_TYPE * row);
+
+} // namespace internal
+
 namespace interface1
 {
 /**
@@ -327,6 +347,11 @@ public:
      */
     void setDelimiter(char delimiter) { _delimiter = delimiter; }
 
+    /**
+     *  Returns the character used as a delimiter for parsing CSV data
+     */
+    char getDelimiter() const { return _delimiter; }
+
 public:
     /**
      * Gets number of columns which must be allocated in numeric table
@@ -457,6 +482,13 @@ public:
         DAAL_ASSERT(dictionary);
         DAAL_ASSERT(rawRowData);
 
+        if (isFastParsingAvailable())
+        {
+            internal::parseCsvRow(rawRowData, rawDataSize, _delimiter, funcList.data(), auxVect.data(), getNumberOfFastParsedTokens(),
+                                  &ModifierIface::contFunc, rowBuffer.data());
+            return;
+        }
+
         size_t i = 0;
         internal::CSVRowTokenizer tokenizer(rawRowData, rawDataSize, _delimiter);
 
@@ -479,6 +511,28 @@ public:
         }
     }
 
+    /**
+     *  Checks whether rows can be converted in parallel, i.e. no feature modifiers are set and every feature is either
+     *  continuous or filtered out, and returns the mapping of the tokens of a row to the columns of the numeric table
+     *  \param[out] columnIndices  Index of the numeric table column for every token of a row,
+     *                             internal::csvSkippedToken if the token is filtered out
+     *  \return True if rows can be converted in parallel, false otherwise
+     */
+    bool getParallelParsingColumns(services::Collection<size_t> & columnIndices) const
+    {
+        columnIndices.clear();
+        if (!isFastParsingAvailable())
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < getNumberOfFastParsedTokens(); i++)
+        {
+            columnIndices.push_back((funcList[i] == ModifierIface::contFunc) ? auxVect[i].idx : internal::csvSkippedToken);
+        }
+        return true;
+    }
+
     /**
      * Finalizes CSV data parsing
      * \param[in]  dictionary  Pointer to the dictionary
@@ -549,6 +603,26 @@ protected:
     services::Collection<FeatureAuxData> auxVect;
 
 private:
+    /* The tokens of the rows are converted directly, bypassing the functions of the features, if no feature modifiers are set
+       and every feature is either continuous or filtered out. The check is cheap compared with the conversion of a row */
+    bool isFastParsingAvailable() const
+    {
+        if (_modifiersManager)
+        {
+            return false;
+        }
+        for (size_t i = 0; i < getNumberOfFastParsedTokens(); i++)
+        {
+            if (funcList[i] != ModifierIface::contFunc && funcList[i] != ModifierIface::nullFunc)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    size_t getNumberOfFastParsedTokens() const { return (_numberOfTokens < funcList.size()) ? _numberOfTokens : funcList.size(); }
+
     size_t _numberOfTokens;
     BlockDescriptor<DAAL_DATA_TYPE> _currentRowBlock;
 
@@ -0,0 +1,124 @@
+/* file: data_block_prefetcher.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the class that loads blocks of a data source in the background.
+//--
+*/
+
+#ifndef __DATA_BLOCK_PREFETCHER_H__
+#define __DATA_BLOCK_PREFETCHER_H__
+
+#include "services/base.h"
+#include "services/collection.h"
+#include "services/error_handling.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data_source/data_source.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+/**
+ * @ingroup data_sources
+ * @{
+ */
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__DATABLOCKPREFETCHER"></a>
+ *  \brief Loads blocks of rows from a data source into a ring of numeric tables in a task of the threading layer,
+ *         so that the next blocks are read while the current block is processed. With the sequential threading layer
+ *         the blocks are loaded when they are requested
+ */
+class DAAL_EXPORT DataBlockPrefetcher : public Base
+{
+public:
+    /**
+     *  Starts loading the blocks of the data source into the provided numeric tables
+     *  \param[in] dataSource  Data source to load the blocks from. It must not be accessed until the prefetcher is destroyed
+     *  \param[in] blockRows   Maximal number of rows in a block
+     *  \param[in] tables      Numeric tables to load the blocks into. The number of tables bounds the memory used by the prefetcher:
+     *                         one table is processed by the caller while the others are filled in the background
+     */
+    DataBlockPrefetcher(DataSource & dataSource, size_t blockRows, const services::Collection<NumericTablePtr> & tables);
+
+    /**
+     *  Starts loading the blocks of the data source into the homogeneous numeric tables allocated by the prefetcher
+     *  \param[in] dataSource  Data source to load the blocks from. It must not be accessed until the prefetcher is destroyed
+     *  \param[in] blockRows   Maximal number of rows in a block
+     *  \param[in] nTables     Number of numeric tables in the ring, at least two
+     */
+    DataBlockPrefetcher(DataSource & dataSource, size_t blockRows, size_t nTables);
+
+    /**
+     *  Stops loading and waits for the loading task to finish
+     */
+    virtual ~DataBlockPrefetcher();
+
+    /**
+     *  Waits for the next block of rows. The numeric table returned by the previous call is given back to the ring,
+     *  so it must not be used after this call
+     *  \return Numeric table with the next block, empty pointer if the data source is exhausted or loading failed
+     */
+    NumericTablePtr next();
+
+    /**
+     *  Returns errors that occurred during loading
+     *  \return Status of the prefetcher
+     */
+    services::Status status() const;
+
+private:
+    class Impl;
+    Impl * _impl;
+
+    DataBlockPrefetcher(const DataBlockPrefetcher &);
+    DataBlockPrefetcher & operator=(const DataBlockPrefetcher &);
+};
+
+/**
+ *  Computes an online algorithm over all blocks of the data source. The next blocks are loaded in the background
+ *  while compute() of the algorithm processes the current block
+ *  \param[in]     prefetcher  Prefetcher that provides the blocks of rows
+ *  \param[in,out] algorithm   Online algorithm
+ *  \param[in]     setInput    Functor called with the numeric table of every block to set the input of the algorithm
+ *  \return Status of the computation
+ */
+template <typename Algorithm, typename SetInput>
+services::Status computeOnline(DataBlockPrefetcher & prefetcher, Algorithm & algorithm, const SetInput & setInput)
+{
+    services::Status s;
+    for (NumericTablePtr block = prefetcher.next(); block; block = prefetcher.next())
+    {
+        setInput(block);
+        s |= algorithm.compute();
+        if (!s) return s;
+    }
+    return prefetcher.status();
+}
+/** @} */
+} // namespace interface1
+
+using interface1::DataBlockPrefetcher;
+using interface1::computeOnline;
+
+} // namespace data_management
+} // namespace daal
+
+#endif
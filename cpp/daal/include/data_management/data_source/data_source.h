@@ -511,9 +511,10 @@ protected:
         if (nt->getNumberOfColumns() < nFeatures)
         {
             nt->getDictionarySharedPtr()->setNumberOfFeatures(nFeatures);
+            nt->resize(0);
         }
 
-        nt->resize(0);
+        /* Memory of the numeric table is reused when it has enough rows, e.g. when blocks are loaded into the same table */
         nt->resize(linesToLoad);
 
         const size_t nCols = nt->getNumberOfColumns();
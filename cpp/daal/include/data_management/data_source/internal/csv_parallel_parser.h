@@ -0,0 +1,112 @@
+/* file: csv_parallel_parser.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef __DATA_SOURCE_INTERNAL_CSV_PARALLEL_PARSER_H__
+#define __DATA_SOURCE_INTERNAL_CSV_PARALLEL_PARSER_H__
+
+#include "services/collection.h"
+#include "services/daal_defines.h"
+#include "services/error_handling.h"
+#include "data_management/data/numeric_table.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+/**
+ *  Index of the numeric table column that marks a CSV token as not loaded into the numeric table
+ */
+const size_t csvSkippedToken = (size_t)-1;
+
+/**
+ *  Read-only view of a file mapped into the address space of the process, implementation is hidden in the library
+ */
+class MappedFile;
+
+/**
+ *  Maps the whole file into memory
+ *  \param[in] fileName  Name of the file to map
+ *  \return Pointer to the mapped file, NULL if the file cannot be mapped, e.g. it is empty or is not a regular file
+ */
+DAAL_EXPORT MappedFile * openMappedFile(const char * fileName);
+
+/**
+ *  Unmaps the file and releases the memory allocated by openMappedFile()
+ *  \param[in] file  Pointer to the mapped file
+ */
+DAAL_EXPORT void closeMappedFile(MappedFile * file);
+
+/**
+ *  Returns pointer to the first byte of the mapped file
+ *  \param[in] file  Pointer to the mapped file
+ */
+DAAL_EXPORT const char * getMappedFileData(const MappedFile * file);
+
+/**
+ *  Returns the size of the mapped file in bytes
+ *  \param[in] file  Pointer to the mapped file
+ */
+DAAL_EXPORT size_t getMappedFileSize(const MappedFile * file);
+
+/**
+ *  <a name="DAAL-STRUCT-DATA_MANAGEMENT__INTERNAL__CSVCHUNKS"></a>
+ *  \brief Partition of a CSV text into chunks which start and end at line boundaries
+ */
+struct CsvChunks
+{
+    services::Collection<size_t> byteOffsets; /*!< Offsets of the chunk borders in the text, number of chunks plus one elements */
+    services::Collection<size_t> rowOffsets;  /*!< Indices of the first line of every chunk, number of chunks plus one elements */
+
+    size_t getNumberOfChunks() const { return byteOffsets.size() ? byteOffsets.size() - 1 : 0; }
+
+    size_t getNumberOfRows() const { return rowOffsets.size() ? rowOffsets[rowOffsets.size() - 1] : 0; }
+};
+
+/**
+ *  Splits the CSV text into chunks at line boundaries and counts the lines of every chunk in parallel.
+ *  Like the sequential data source, the partition ends at the first empty line, which is considered as read
+ *  \param[in]  text      Pointer to the CSV text, not necessarily null-terminated
+ *  \param[in]  size      Size of the text in bytes
+ *  \param[in]  maxRows   Maximal number of lines to include into the partition
+ *  \param[out] chunks    Resulting partition
+ *  \param[out] nBytes    Number of bytes of the text covered by the partition
+ *  \return Status of the operation
+ */
+DAAL_EXPORT services::Status splitCsvIntoChunks(const char * text, size_t size, size_t maxRows, CsvChunks & chunks, size_t & nBytes);
+
+/**
+ *  Converts the lines of the partitioned CSV text into rows of the numeric table in parallel.
+ *  Row order is the order of lines in the text.
+ *  Basic statistics of the numeric table are computed over the parsed rows
+ *  \param[in]  text           Pointer to the CSV text
+ *  \param[in]  chunks         Partition of the text computed by splitCsvIntoChunks()
+ *  \param[in]  delimiter      Delimiter of the tokens in a line
+ *  \param[in]  columnIndices  Index of the numeric table column for every token of a line, csvSkippedToken if the token is not loaded
+ *  \param[out] nt             Numeric table to store the result of parsing
+ *  \param[in]  rowOffset      Index of the numeric table row at which to store the first parsed line
+ *  \return Status of the operation
+ */
+DAAL_EXPORT services::Status parseCsvChunks(const char * text, const CsvChunks & chunks, char delimiter,
+                                            const services::Collection<size_t> & columnIndices, NumericTable & nt, size_t rowOffset);
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
+
+#endif
@@ -0,0 +1,302 @@
+/* file: parallel_file_data_source.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the file data source class that loads CSV files in parallel.
+//--
+*/
+
+#ifndef __PARALLEL_FILE_DATA_SOURCE_H__
+#define __PARALLEL_FILE_DATA_SOURCE_H__
+
+#include "data_management/data_source/file_data_source.h"
+#include "data_management/data_source/csv_feature_manager.h"
+#include "data_management/data_source/internal/csv_parallel_parser.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+/* The rows are converted sequentially by the feature managers other than CSVFeatureManager */
+template <typename FeatureManager>
+inline bool getParallelParsingColumns(const FeatureManager & /*featureManager*/, services::Collection<size_t> & /*columnIndices*/,
+                                      char & /*delimiter*/)
+{
+    return false;
+}
+
+inline bool getParallelParsingColumns(const CSVFeatureManager & featureManager, services::Collection<size_t> & columnIndices, char & delimiter)
+{
+    delimiter = featureManager.getDelimiter();
+    return featureManager.getParallelParsingColumns(columnIndices);
+}
+
+} // namespace internal
+
+namespace interface1
+{
+/**
+ * @ingroup data_sources
+ * @{
+ */
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__PARALLELFILEDATASOURCE"></a>
+ *  \brief Specifies methods to access data stored in files. The file is mapped into memory and the rows of a data block
+ *         are converted in parallel when every feature is continuous or filtered out, otherwise they are read as by FileDataSource
+ *  \tparam FeatureManager         The type of feature manager that specifies how to extract numerical data from CSV
+ *  \tparam SummaryStatisticsType  The floating point type to compute summary statics for numeric table
+ */
+template <typename FeatureManager, typename SummaryStatisticsType = DAAL_SUMMARY_STATISTICS_TYPE>
+class ParallelFileDataSource : public FileDataSource<FeatureManager, SummaryStatisticsType>
+{
+private:
+    typedef FileDataSource<FeatureManager, SummaryStatisticsType> super;
+
+protected:
+    using super::_rawLineBuffer;
+    using super::_rawLineBufferLen;
+    using super::_rawLineLength;
+    using super::_status;
+    using super::_dict;
+    using super::_fileName;
+    using super::_file;
+    using super::_fileBuffer;
+
+public:
+    /**
+     *  Main constructor for a Data Source
+     *  \param[in]  fileName                        Name of the file that stores data
+     *  \param[in]  doAllocateNumericTable          Flag that specifies whether a Numeric Table
+     *                                              associated with a File Data Source is allocated inside the Data Source
+     *  \param[in]  doCreateDictionaryFromContext   Flag that specifies whether a Data %Dictionary
+     *                                              is created from the context of the File Data Source
+     *  \param[in]  initialMaxRows                  Initial value of maximum number of rows in Numeric Table allocated in loadDataBlock() method
+     */
+    ParallelFileDataSource(const std::string & fileName,
+                           DataSourceIface::NumericTableAllocationFlag doAllocateNumericTable    = DataSource::notAllocateNumericTable,
+                           DataSourceIface::DictionaryCreationFlag doCreateDictionaryFromContext = DataSource::notDictionaryFromContext,
+                           size_t initialMaxRows                                                 = 10)
+        : super(fileName, doAllocateNumericTable, doCreateDictionaryFromContext, initialMaxRows), _mappedFile(NULL), _mappedFilePos(0)
+    {
+        mapFile();
+    }
+
+    /**
+     *  Main constructor for a Data Source
+     *  \param[in]  fileName        Name of the file that stores data
+     *  \param[in]  options         Options of data source
+     *  \param[in]  initialMaxRows  Initial value of maximum number of rows in Numeric Table allocated in loadDataBlock() method
+     */
+    ParallelFileDataSource(const std::string & fileName, CsvDataSourceOptions options, size_t initialMaxRows = 10)
+        : super(fileName, options, initialMaxRows), _mappedFile(NULL), _mappedFilePos(0)
+    {
+        mapFile();
+    }
+
+    virtual ~ParallelFileDataSource()
+    {
+        if (_mappedFile) internal::closeMappedFile(_mappedFile);
+    }
+
+public:
+    using super::loadDataBlock;
+
+    services::Status createDictionaryFromContext() DAAL_C11_OVERRIDE
+    {
+        if (!_mappedFile)
+        {
+            return super::createDictionaryFromContext();
+        }
+        services::Status s = CsvDataSource<FeatureManager, SummaryStatisticsType>::createDictionaryFromContext();
+        _mappedFilePos     = 0;
+        return s;
+    }
+
+    size_t loadDataBlock(NumericTable * nt) DAAL_C11_OVERRIDE
+    {
+        services::Collection<size_t> columnIndices;
+        char delimiter = ',';
+        if (!isParallelLoadAvailable(nt, columnIndices, delimiter))
+        {
+            return super::loadDataBlock(nt);
+        }
+
+        services::Status s = super::skipHeader();
+        internal::CsvChunks chunks;
+        size_t nBytes = 0;
+        if (s)
+        {
+            const char * text = internal::getMappedFileData(_mappedFile) + _mappedFilePos;
+            const size_t size = internal::getMappedFileSize(_mappedFile) - _mappedFilePos;
+            s                 = internal::splitCsvIntoChunks(text, size, size, chunks, nBytes);
+        }
+        if (s)
+        {
+            s = super::resetNumericTable(nt, chunks.getNumberOfRows());
+        }
+        if (s)
+        {
+            s = parseMappedRows(chunks, nBytes, columnIndices, delimiter, nt, 0);
+        }
+        if (!s)
+        {
+            this->_status.add(services::throwIfPossible(s));
+            return 0;
+        }
+        return chunks.getNumberOfRows();
+    }
+
+    size_t loadDataBlock(size_t maxRows, size_t rowOffset, size_t fullRows, NumericTable * nt) DAAL_C11_OVERRIDE
+    {
+        services::Collection<size_t> columnIndices;
+        char delimiter = ',';
+        if (!isParallelLoadAvailable(nt, columnIndices, delimiter))
+        {
+            return super::loadDataBlock(maxRows, rowOffset, fullRows, nt);
+        }
+
+        if (rowOffset + maxRows > fullRows)
+        {
+            this->_status.add(services::throwIfPossible(services::ErrorIncorrectDataRange));
+            return 0;
+        }
+
+        services::Status s = super::resetNumericTable(nt, fullRows);
+        internal::CsvChunks chunks;
+        size_t nBytes = 0;
+        if (s)
+        {
+            s = super::skipHeader();
+        }
+        if (s)
+        {
+            const char * text = internal::getMappedFileData(_mappedFile) + _mappedFilePos;
+            const size_t size = internal::getMappedFileSize(_mappedFile) - _mappedFilePos;
+            s                 = internal::splitCsvIntoChunks(text, size, maxRows, chunks, nBytes);
+        }
+        if (s)
+        {
+            s = parseMappedRows(chunks, nBytes, columnIndices, delimiter, nt, rowOffset);
+        }
+        if (!s)
+        {
+            this->_status.add(services::throwIfPossible(s));
+            return 0;
+        }
+        return rowOffset + chunks.getNumberOfRows();
+    }
+
+protected:
+    bool iseof() const DAAL_C11_OVERRIDE
+    {
+        if (!_mappedFile)
+        {
+            return super::iseof();
+        }
+        return _mappedFilePos >= internal::getMappedFileSize(_mappedFile);
+    }
+
+    services::Status readLine() DAAL_C11_OVERRIDE
+    {
+        if (!_mappedFile)
+        {
+            return super::readLine();
+        }
+
+        const char * data = internal::getMappedFileData(_mappedFile);
+        const size_t size = internal::getMappedFileSize(_mappedFile);
+
+        size_t lineEnd = _mappedFilePos;
+        while (lineEnd < size && data[lineEnd] != '\n')
+        {
+            lineEnd++;
+        }
+
+        size_t lineLength = lineEnd - _mappedFilePos;
+        while (lineLength >= (size_t)_rawLineBufferLen)
+        {
+            if (!super::enlargeBuffer()) return services::Status(services::ErrorMemoryAllocationFailed);
+        }
+
+        if (lineLength > 0 && services::internal::daal_memcpy_s(_rawLineBuffer, _rawLineBufferLen, data + _mappedFilePos, lineLength))
+        {
+            return services::Status(services::ErrorMemoryCopyFailedInternal);
+        }
+        _mappedFilePos = (lineEnd < size) ? lineEnd + 1 : size;
+
+        while (lineLength > 0 && _rawLineBuffer[lineLength - 1] == '\r')
+        {
+            lineLength--;
+        }
+        _rawLineLength                 = (int)lineLength;
+        _rawLineBuffer[_rawLineLength] = '\0';
+        return services::Status();
+    }
+
+private:
+    /* Files that cannot be mapped, e.g. empty ones, are read sequentially as by FileDataSource */
+    void mapFile()
+    {
+        if (!_status || !_file)
+        {
+            return;
+        }
+        _mappedFile = internal::openMappedFile(_fileName.c_str());
+        if (_mappedFile)
+        {
+            fclose(_file);
+            _file = NULL;
+            daal::services::daal_free(_fileBuffer);
+            _fileBuffer = NULL;
+        }
+    }
+
+    bool isParallelLoadAvailable(NumericTable * nt, services::Collection<size_t> & columnIndices, char & delimiter)
+    {
+        if (!_mappedFile || !super::checkDictionary() || !super::checkInputNumericTable(nt))
+        {
+            return false;
+        }
+        return internal::getParallelParsingColumns(super::getFeatureManager(), columnIndices, delimiter);
+    }
+
+    services::Status parseMappedRows(const internal::CsvChunks & chunks, size_t nBytes, const services::Collection<size_t> & columnIndices,
+                                     char delimiter, NumericTable * nt, size_t rowOffset)
+    {
+        const char * text  = internal::getMappedFileData(_mappedFile) + _mappedFilePos;
+        services::Status s = internal::parseCsvChunks(text, chunks, delimiter, columnIndices, *nt, rowOffset);
+        _mappedFilePos += nBytes;
+        super::getFeatureManager().finalize(_dict.get());
+        return s;
+    }
+
+    internal::MappedFile * _mappedFile;
+    size_t _mappedFilePos;
+};
+/** @} */
+
+} // namespace interface1
+
+using interface1::ParallelFileDataSource;
+
+} // namespace data_management
+} // namespace daal
+
+#endif
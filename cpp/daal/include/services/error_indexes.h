@@ -370,7 +370,8 @@ enum ErrorID
     ErrorDFBootstrapOOBIncompatible = -20001, /*!< Parameter 'bootstrap' is incompatible with requested OOB result (no out-of-bag observations) */
 
     // K-Nearest Neighbors errors: -21000..21999
-    ErrorKNNInternal = -21000, /*!< K-Nearest Neighbors internal error */
+    ErrorKNNInternal                = -21000, /*!< K-Nearest Neighbors internal error */
+    ErrorKNNIncompatibleModelMethod = -21001, /*!< Prediction method is not compatible with the training method of the model */
 
     // GBT error: -30000..-30099
     ErrorGbtIncorrectNumberOfTrees             = -30000, /*!< Number of trees in the model is not consistent with the number of classes */
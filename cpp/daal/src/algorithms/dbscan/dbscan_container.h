@@ -93,6 +93,10 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
                                ntWeights.get(), ntAssignments.get(), ntNClusters.get(), ntCoreIndices.get(), ntCoreObservations.get(), par);
         }
     }
+    else if (par->distanceType != euclidean)
+    {
+        return services::Status(services::ErrorDeviceSupportNotImplemented);
+    }
     else
     {
         // memorySavingMode flag is not applicable for DBSCAN on GPU
@@ -23,6 +23,7 @@
 
 #include "src/algorithms/dbscan/dbscan_container.h"
 #include "src/algorithms/dbscan/dbscan_dense_default_batch_impl.i"
+#include "src/algorithms/dbscan/dbscan_dense_grid_batch_impl.i"
 
 namespace daal
 {
@@ -33,10 +34,12 @@ namespace dbscan
 namespace interface1
 {
 template class BatchContainer<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
+template class BatchContainer<DAAL_FPTYPE, gridDense, DAAL_CPU>;
 } // namespace interface1
 namespace internal
 {
 template class DBSCANBatchKernel<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
+template class DBSCANBatchKernel<DAAL_FPTYPE, gridDense, DAAL_CPU>;
 } // namespace internal
 } // namespace dbscan
 } // namespace algorithms
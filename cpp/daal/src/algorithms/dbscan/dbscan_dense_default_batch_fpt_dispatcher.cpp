@@ -28,6 +28,7 @@ namespace daal
 namespace algorithms
 {
 __DAAL_INSTANTIATE_DISPATCH_CONTAINER_SYCL(dbscan::BatchContainer, batch, DAAL_FPTYPE, dbscan::defaultDense)
+__DAAL_INSTANTIATE_DISPATCH_CONTAINER_SYCL(dbscan::BatchContainer, batch, DAAL_FPTYPE, dbscan::gridDense)
 
 namespace dbscan
 {
@@ -48,6 +49,21 @@ Batch<DAAL_FPTYPE, dbscan::defaultDense>::Batch(const BatchType & other) : input
     initialize();
 }
 
+template <>
+Batch<DAAL_FPTYPE, dbscan::gridDense>::Batch(DAAL_FPTYPE epsilon, size_t minObservations)
+{
+    _par = new ParameterType(epsilon, minObservations);
+    initialize();
+}
+
+using GridBatchType = Batch<DAAL_FPTYPE, dbscan::gridDense>;
+template <>
+Batch<DAAL_FPTYPE, dbscan::gridDense>::Batch(const GridBatchType & other) : input(other.input)
+{
+    _par = new ParameterType(other.parameter());
+    initialize();
+}
+
 } // namespace interface1
 } // namespace dbscan
 } // namespace algorithms
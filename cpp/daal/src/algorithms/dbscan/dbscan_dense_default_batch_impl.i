@@ -125,81 +125,6 @@ Status DBSCANBatchKernel<algorithmFPType, method, cpu>::processNeighborhoodParal
     return safeStat.detach();
 }
 
-template <typename algorithmFPType, Method method, CpuType cpu>
-Status DBSCANBatchKernel<algorithmFPType, method, cpu>::processResultsToCompute(DAAL_UINT64 resultsToCompute, int * const isCore,
-                                                                                const NumericTable * ntData, NumericTable * ntCoreIndices,
-                                                                                NumericTable * ntCoreObservations)
-{
-    const size_t nRows     = ntData->getNumberOfRows();
-    const size_t nFeatures = ntData->getNumberOfColumns();
-
-    size_t nCoreObservations = 0;
-
-    for (size_t i = 0; i < nRows; i++)
-    {
-        if (!isCore[i])
-        {
-            continue;
-        }
-        nCoreObservations++;
-    }
-
-    if (nCoreObservations == 0)
-    {
-        return Status();
-    }
-
-    if (resultsToCompute & computeCoreIndices)
-    {
-        DAAL_CHECK_STATUS_VAR(ntCoreIndices->resize(nCoreObservations));
-        WriteRows<int, cpu> coreIndicesRows(ntCoreIndices, 0, nCoreObservations);
-        DAAL_CHECK_BLOCK_STATUS(coreIndicesRows);
-        int * const coreIndices = coreIndicesRows.get();
-
-        size_t pos = 0;
-        for (size_t i = 0; i < nRows; i++)
-        {
-            if (!isCore[i])
-            {
-                continue;
-            }
-            coreIndices[pos] = i;
-            pos++;
-        }
-    }
-
-    if (resultsToCompute & computeCoreObservations)
-    {
-        DAAL_CHECK_STATUS_VAR(ntCoreObservations->resize(nCoreObservations));
-        WriteRows<algorithmFPType, cpu> coreObservationsRows(ntCoreObservations, 0, nCoreObservations);
-        DAAL_CHECK_BLOCK_STATUS(coreObservationsRows);
-        algorithmFPType * const coreObservations = coreObservationsRows.get();
-
-        size_t pos = 0;
-        int result = 0;
-        for (size_t i = 0; i < nRows; i++)
-        {
-            if (!isCore[i])
-            {
-                continue;
-            }
-            ReadRows<algorithmFPType, cpu> dataRows(const_cast<NumericTable *>(ntData), i, 1);
-            DAAL_CHECK_BLOCK_STATUS(dataRows);
-            const algorithmFPType * const data = dataRows.get();
-
-            result |= daal::services::internal::daal_memcpy_s(&(coreObservations[pos * nFeatures]), sizeof(algorithmFPType) * nFeatures, data,
-                                                              sizeof(algorithmFPType) * nFeatures);
-            pos++;
-        }
-        if (result)
-        {
-            return Status(services::ErrorMemoryCopyFailedInternal);
-        }
-    }
-
-    return Status();
-}
-
 template <typename algorithmFPType, Method method, CpuType cpu>
 Status DBSCANBatchKernel<algorithmFPType, method, cpu>::computeNoMemSave(const NumericTable * ntData, const NumericTable * ntWeights,
                                                                          NumericTable * ntAssignments, NumericTable * ntNClusters,
@@ -211,14 +136,16 @@ Status DBSCANBatchKernel<algorithmFPType, method, cpu>::computeNoMemSave(const N
 
     const algorithmFPType epsilon         = par->epsilon;
     const algorithmFPType minObservations = par->minObservations;
-    const algorithmFPType minkowskiPower  = (algorithmFPType)2.0;
+    const algorithmFPType minkowskiPower  = par->minkowskiPower;
+
+    const PairwiseDistanceType distanceType = static_cast<PairwiseDistanceType>(par->distanceType);
 
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, sizeof(Neighborhood<algorithmFPType, cpu>));
 
     TArray<Neighborhood<algorithmFPType, cpu>, cpu> neighs(nRows);
     DAAL_CHECK_MALLOC(neighs.get());
 
-    NeighborhoodEngine<method, algorithmFPType, cpu> nEngine(ntData, ntData, ntWeights, epsilon, minkowskiPower);
+    NeighborhoodEngine<method, algorithmFPType, cpu> nEngine(ntData, ntData, ntWeights, epsilon, distanceType, minkowskiPower);
     DAAL_CHECK_STATUS_VAR(nEngine.queryFull(neighs.get()));
 
     WriteRows<int, cpu> assignRows(ntAssignments, 0, nRows);
@@ -263,7 +190,8 @@ Status DBSCANBatchKernel<algorithmFPType, method, cpu>::computeNoMemSave(const N
 
     if (par->resultsToCompute & (computeCoreIndices | computeCoreObservations))
     {
-        DAAL_CHECK_STATUS_VAR(processResultsToCompute(par->resultsToCompute, isCore, ntData, ntCoreIndices, ntCoreObservations));
+        s = processResultsToCompute<algorithmFPType, cpu>(par->resultsToCompute, isCore, ntData, ntCoreIndices, ntCoreObservations);
+        DAAL_CHECK_STATUS_VAR(s);
     }
 
     const size_t nBlocks   = neighs.size();
@@ -291,11 +219,13 @@ Status DBSCANBatchKernel<algorithmFPType, method, cpu>::computeMemSave(const Num
 
     const algorithmFPType epsilon         = par->epsilon;
     const algorithmFPType minObservations = par->minObservations;
-    const algorithmFPType minkowskiPower  = (algorithmFPType)2.0;
+    const algorithmFPType minkowskiPower  = par->minkowskiPower;
+
+    const PairwiseDistanceType distanceType = static_cast<PairwiseDistanceType>(par->distanceType);
 
     const size_t nRows = ntData->getNumberOfRows();
 
-    NeighborhoodEngine<method, algorithmFPType, cpu> nEngine(ntData, ntData, ntWeights, epsilon, minkowskiPower);
+    NeighborhoodEngine<method, algorithmFPType, cpu> nEngine(ntData, ntData, ntWeights, epsilon, distanceType, minkowskiPower);
 
     WriteRows<int, cpu> assignRows(ntAssignments, 0, nRows);
     DAAL_CHECK_BLOCK_STATUS(assignRows);
@@ -378,7 +308,8 @@ Status DBSCANBatchKernel<algorithmFPType, method, cpu>::computeMemSave(const Num
 
     if (par->resultsToCompute & (computeCoreIndices | computeCoreObservations))
     {
-        DAAL_CHECK_STATUS_VAR(processResultsToCompute(par->resultsToCompute, isCore, ntData, ntCoreIndices, ntCoreObservations));
+        s = processResultsToCompute<algorithmFPType, cpu>(par->resultsToCompute, isCore, ntData, ntCoreIndices, ntCoreObservations);
+        DAAL_CHECK_STATUS_VAR(s);
     }
 
     return s;
@@ -24,6 +24,7 @@
 #include "algorithms/algorithm.h"
 #include "data_management/data/numeric_table.h"
 #include "src/services/service_data_utils.h"
+#include "src/services/daal_strings.h"
 
 #include "src/threading/threading.h"
 #include "algorithms/dbscan/dbscan_types.h"
@@ -702,7 +703,11 @@ Status DBSCANDistrStep6Kernel<algorithmFPType, method, cpu>::computeNoMemSave(co
 
     const algorithmFPType epsilon         = par->epsilon;
     const algorithmFPType minObservations = par->minObservations;
-    const algorithmFPType minkowskiPower  = (algorithmFPType)2.0;
+    DAAL_CHECK_EX(par->distanceType != cosine, services::ErrorMethodNotSupported, services::ParameterName, distanceTypeStr());
+
+    const algorithmFPType minkowskiPower  = par->minkowskiPower;
+
+    const PairwiseDistanceType distanceType = static_cast<PairwiseDistanceType>(par->distanceType);
 
     NumericTablePtr ntData;
     NumericTablePtr ntHaloData;
@@ -773,10 +778,11 @@ Status DBSCANDistrStep6Kernel<algorithmFPType, method, cpu>::computeNoMemSave(co
         haloAssignments[i] = 0;
     }
 
-    NeighborhoodEngine<method, algorithmFPType, cpu> nEngine(ntData.get(), ntData.get(), ntWeights.get(), epsilon, minkowskiPower);
+    NeighborhoodEngine<method, algorithmFPType, cpu> nEngine(ntData.get(), ntData.get(), ntWeights.get(), epsilon, distanceType, minkowskiPower);
     DAAL_CHECK_STATUS_VAR(nEngine.queryFull(neighs.get()));
 
-    NeighborhoodEngine<method, algorithmFPType, cpu> nHaloEngine(ntData.get(), ntHaloData.get(), ntHaloWeights.get(), epsilon, minkowskiPower);
+    NeighborhoodEngine<method, algorithmFPType, cpu> nHaloEngine(ntData.get(), ntHaloData.get(), ntHaloWeights.get(), epsilon, distanceType,
+                                                                 minkowskiPower);
     DAAL_CHECK_STATUS_VAR(nHaloEngine.queryFull(haloNeighs.get()));
 
     DAAL_CHECK_STATUS_VAR(ntClusterStructure->resize(nRows));
@@ -885,7 +891,11 @@ Status DBSCANDistrStep6Kernel<algorithmFPType, method, cpu>::computeMemSave(cons
 
     const algorithmFPType epsilon         = par->epsilon;
     const algorithmFPType minObservations = par->minObservations;
-    const algorithmFPType minkowskiPower  = (algorithmFPType)2.0;
+    DAAL_CHECK_EX(par->distanceType != cosine, services::ErrorMethodNotSupported, services::ParameterName, distanceTypeStr());
+
+    const algorithmFPType minkowskiPower  = par->minkowskiPower;
+
+    const PairwiseDistanceType distanceType = static_cast<PairwiseDistanceType>(par->distanceType);
 
     NumericTablePtr ntData;
     NumericTablePtr ntHaloData;
@@ -949,8 +959,9 @@ Status DBSCANDistrStep6Kernel<algorithmFPType, method, cpu>::computeMemSave(cons
         haloAssignments[i] = 0;
     }
 
-    NeighborhoodEngine<method, algorithmFPType, cpu> nEngine(ntData.get(), ntData.get(), ntWeights.get(), epsilon, minkowskiPower);
-    NeighborhoodEngine<method, algorithmFPType, cpu> nHaloEngine(ntData.get(), ntHaloData.get(), ntHaloWeights.get(), epsilon, minkowskiPower);
+    NeighborhoodEngine<method, algorithmFPType, cpu> nEngine(ntData.get(), ntData.get(), ntWeights.get(), epsilon, distanceType, minkowskiPower);
+    NeighborhoodEngine<method, algorithmFPType, cpu> nHaloEngine(ntData.get(), ntHaloData.get(), ntHaloWeights.get(), epsilon, distanceType,
+                                                                 minkowskiPower);
 
     DAAL_CHECK_STATUS_VAR(ntClusterStructure->resize(nRows));
 
@@ -0,0 +1,591 @@
+/* file: dbscan_dense_grid_batch_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the grid-based DBSCAN method.
+//  The observations are bucketed into the cells of a uniform grid with the
+//  diagonal not exceeding epsilon. All the observations of a cell are neighbors
+//  of each other, so a cell heavy enough makes all its observations core ones,
+//  and the neighbors are searched only in the close non-empty cells.
+//--
+*/
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "src/algorithms/service_sort.h"
+#include "src/services/service_data_utils.h"
+#include "src/services/daal_strings.h"
+
+#include "src/threading/threading.h"
+#include "algorithms/dbscan/dbscan_types.h"
+#include "src/algorithms/dbscan/dbscan_utils.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace dbscan
+{
+namespace internal
+{
+#define __DBSCAN_GRID_ROWS_BLOCK_SIZE  4096
+#define __DBSCAN_GRID_CELLS_BLOCK_SIZE 4096
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Non-empty cells of the uniform grid sorted in the lexicographical order of their
+// coordinates. The observations are copied in the order of the cells they belong to,
+// so the observations of a cell are stored contiguously.
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class CellGrid
+{
+public:
+    CellGrid() : _nRows(0), _nFeatures(0), _nCells(0), _zeroEpsilon(false), _maxOffset(0), _maxGap(0) {}
+
+    CellGrid(const CellGrid &) = delete;
+    CellGrid & operator=(const CellGrid &) = delete;
+
+    services::Status build(const algorithmFPType * data, const algorithmFPType * weights, size_t nRows, size_t nFeatures, algorithmFPType epsilon,
+                           algorithmFPType p)
+    {
+        _nRows     = nRows;
+        _nFeatures = nFeatures;
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, nFeatures);
+
+        _zeroEpsilon = (epsilon == algorithmFPType(0));
+        if (_zeroEpsilon)
+        {
+            /* Only the equal observations are neighbors, so the cells are the groups of the equal observations */
+            DAAL_CHECK_STATUS_VAR(sortCells(data));
+        }
+        else
+        {
+            DAAL_CHECK_STATUS_VAR(buildCells(data, epsilon, p));
+        }
+
+        const size_t * const order = _order.get();
+        const size_t nBlocks       = nRows / __DBSCAN_GRID_ROWS_BLOCK_SIZE + !!(nRows % __DBSCAN_GRID_ROWS_BLOCK_SIZE);
+
+        _data.reset(nRows * nFeatures);
+        _weights.reset(nRows);
+        DAAL_CHECK_MALLOC(_data.get() && _weights.get());
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t begin = iBlock * __DBSCAN_GRID_ROWS_BLOCK_SIZE;
+            const size_t end   = services::internal::min<cpu, size_t>(begin + __DBSCAN_GRID_ROWS_BLOCK_SIZE, nRows);
+            for (size_t pos = begin; pos < end; pos++)
+            {
+                const algorithmFPType * const x = data + order[pos] * nFeatures;
+                for (size_t j = 0; j < nFeatures; j++) _data[pos * nFeatures + j] = x[j];
+                _weights[pos] = weights ? weights[order[pos]] : algorithmFPType(1);
+            }
+        });
+
+        return services::Status();
+    }
+
+    size_t getNumberOfRows() const { return _nRows; }
+    size_t getNumberOfFeatures() const { return _nFeatures; }
+    size_t getNumberOfCells() const { return _nCells; }
+
+    /* Range of the positions of the observations in the cell */
+    size_t cellBegin(size_t iCell) const { return _cellStarts[iCell]; }
+    size_t cellEnd(size_t iCell) const { return _cellStarts[iCell + 1]; }
+
+    /* Calls visit(jCell) for every cell jCell that can contain neighbors of the observations of the cell iCell, the cell itself included.
+       The neighbor cells are enumerated on the fly, so they take no memory */
+    template <typename Visitor>
+    void forEachNeighborCell(size_t iCell, const Visitor & visit) const
+    {
+        if (_zeroEpsilon)
+            visit(iCell);
+        else
+            visitNeighborCells(iCell, 0, 0, _nCells, algorithmFPType(0), visit);
+    }
+
+    const algorithmFPType * getRow(size_t pos) const { return _data.get() + pos * _nFeatures; }
+    algorithmFPType getWeight(size_t pos) const { return _weights[pos]; }
+
+    /* Index of the observation in the input data */
+    size_t getIndex(size_t pos) const { return _order[pos]; }
+
+private:
+    template <typename KeyType>
+    static int compareCoords(const KeyType * coords1, const KeyType * coords2, size_t nFeatures)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            if (coords1[j] != coords2[j]) return (coords1[j] < coords2[j]) ? -1 : 1;
+        }
+        return 0;
+    }
+
+    /* Buckets the observations into the cells with the diagonal not exceeding epsilon */
+    services::Status buildCells(const algorithmFPType * data, algorithmFPType epsilon, algorithmFPType p)
+    {
+        const size_t nRows     = _nRows;
+        const size_t nFeatures = _nFeatures;
+
+        TArray<algorithmFPType, cpu> minValues(nFeatures);
+        TArray<algorithmFPType, cpu> maxValues(nFeatures);
+        DAAL_CHECK_MALLOC(minValues.get() && maxValues.get());
+        for (size_t j = 0; j < nFeatures; j++) minValues[j] = maxValues[j] = data[j];
+        for (size_t i = 1; i < nRows; i++)
+        {
+            const algorithmFPType * const x = data + i * nFeatures;
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                minValues[j] = (x[j] < minValues[j]) ? x[j] : minValues[j];
+                maxValues[j] = (x[j] > maxValues[j]) ? x[j] : maxValues[j];
+            }
+        }
+
+        /* The diagonal of a cell is slightly shorter than epsilon, so rounding errors do not break the neighborhood within a cell */
+        const algorithmFPType shrink = algorithmFPType(1) - algorithmFPType(64) * EpsilonVal<algorithmFPType>::get();
+        const algorithmFPType side   = epsilon * shrink / Math<algorithmFPType, cpu>::sPowx(algorithmFPType(nFeatures), algorithmFPType(1) / p);
+
+        /* The cells with the coordinates that differ by more than _maxOffset can not contain neighbors */
+        const algorithmFPType relativeEpsilon = epsilon / side;
+        _maxOffset                            = int(relativeEpsilon) + 1;
+        _maxGap                               = Math<algorithmFPType, cpu>::sPowx(relativeEpsilon, p);
+
+        _gapPowers.reset(_maxOffset + 1);
+        DAAL_CHECK_MALLOC(_gapPowers.get());
+        for (int i = 0; i <= _maxOffset; i++) _gapPowers[i] = Math<algorithmFPType, cpu>::sPowx(algorithmFPType(i), p);
+
+        const algorithmFPType invSide = algorithmFPType(1) / side;
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            DAAL_CHECK_EX((maxValues[j] - minValues[j]) * invSide + algorithmFPType(_maxOffset + 2) < algorithmFPType(MaxVal<int>::get()),
+                          services::ErrorIncorrectParameter, services::ParameterName, epsilonStr());
+        }
+
+        TArray<int, cpu> pointCoordsArray(nRows * nFeatures);
+        DAAL_CHECK_MALLOC(pointCoordsArray.get());
+        int * const pointCoords = pointCoordsArray.get();
+
+        const size_t nBlocks = nRows / __DBSCAN_GRID_ROWS_BLOCK_SIZE + !!(nRows % __DBSCAN_GRID_ROWS_BLOCK_SIZE);
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t begin = iBlock * __DBSCAN_GRID_ROWS_BLOCK_SIZE;
+            const size_t end   = services::internal::min<cpu, size_t>(begin + __DBSCAN_GRID_ROWS_BLOCK_SIZE, nRows);
+            for (size_t i = begin; i < end; i++)
+            {
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    pointCoords[i * nFeatures + j] = int((data[i * nFeatures + j] - minValues[j]) * invSide);
+                }
+            }
+        });
+
+        DAAL_CHECK_STATUS_VAR(sortCells(pointCoords));
+
+        _cellCoords.reset(_nCells * nFeatures);
+        DAAL_CHECK_MALLOC(_cellCoords.get());
+        for (size_t iCell = 0; iCell < _nCells; iCell++)
+        {
+            const int * const coords = pointCoords + _order[_cellStarts[iCell]] * nFeatures;
+            for (size_t j = 0; j < nFeatures; j++) _cellCoords[iCell * nFeatures + j] = coords[j];
+        }
+        return services::Status();
+    }
+
+    /* Sorts the observations by the keys of their cells and finds the first observation of each cell */
+    template <typename KeyType>
+    services::Status sortCells(const KeyType * keys)
+    {
+        const size_t nRows     = _nRows;
+        const size_t nFeatures = _nFeatures;
+
+        _order.reset(nRows);
+        DAAL_CHECK_MALLOC(_order.get());
+        size_t * const order = _order.get();
+        for (size_t i = 0; i < nRows; i++) order[i] = i;
+        daal::algorithms::internal::introSort<cpu>(order, order + nRows, [=](size_t i1, size_t i2) -> bool {
+            return compareCoords(keys + i1 * nFeatures, keys + i2 * nFeatures, nFeatures) < 0;
+        });
+
+        _nCells = (nRows > 0);
+        for (size_t pos = 1; pos < nRows; pos++)
+        {
+            _nCells += (compareCoords(keys + order[pos - 1] * nFeatures, keys + order[pos] * nFeatures, nFeatures) != 0);
+        }
+
+        _cellStarts.reset(_nCells + 1);
+        DAAL_CHECK_MALLOC(_cellStarts.get());
+        size_t iCell = 0;
+        for (size_t pos = 0; pos < nRows; pos++)
+        {
+            if (pos > 0 && compareCoords(keys + order[pos - 1] * nFeatures, keys + order[pos] * nFeatures, nFeatures) == 0) continue;
+            _cellStarts[iCell++] = pos;
+        }
+        _cellStarts[_nCells] = nRows;
+        return services::Status();
+    }
+
+    /* First cell in [begin, end) with the coordinate not less than value, the cells in the range differ starting from the feature only */
+    size_t lowerBound(size_t begin, size_t end, size_t iFeature, int value) const
+    {
+        while (begin < end)
+        {
+            const size_t middle = begin + (end - begin) / 2;
+            if (_cellCoords[middle * _nFeatures + iFeature] < value)
+                begin = middle + 1;
+            else
+                end = middle;
+        }
+        return begin;
+    }
+
+    /* Visits the cells in [begin, end) that can contain neighbors of the observations of the cell iCell.
+       The sorted cells form an implicit prefix tree, so only the non-empty cells are enumerated */
+    template <typename Visitor>
+    void visitNeighborCells(size_t iCell, size_t iFeature, size_t begin, size_t end, algorithmFPType gap, const Visitor & visit) const
+    {
+        const int center = _cellCoords[iCell * _nFeatures + iFeature];
+        size_t cur       = lowerBound(begin, end, iFeature, center - _maxOffset);
+        const size_t last = lowerBound(cur, end, iFeature, center + _maxOffset + 1);
+        while (cur < last)
+        {
+            const int value   = _cellCoords[cur * _nFeatures + iFeature];
+            const size_t next = lowerBound(cur, last, iFeature, value + 1);
+
+            /* Minimal distance between the cells along the feature in the units of the cell side */
+            const int offset                 = (value > center ? value - center : center - value) - 1;
+            const algorithmFPType featureGap = gap + (offset > 0 ? _gapPowers[offset] : algorithmFPType(0));
+            if (featureGap <= _maxGap)
+            {
+                if (iFeature + 1 == _nFeatures)
+                    visit(cur);
+                else
+                    visitNeighborCells(iCell, iFeature + 1, cur, next, featureGap, visit);
+            }
+            cur = next;
+        }
+    }
+
+    size_t _nRows;
+    size_t _nFeatures;
+    size_t _nCells;
+    bool _zeroEpsilon; /* Only the equal observations are neighbors */
+    int _maxOffset;
+    algorithmFPType _maxGap;                  /* Maximal sum of the powers of the gaps between the neighbor cells */
+    TArray<algorithmFPType, cpu> _gapPowers;  /* Powers of the gaps between the cells in the units of the cell side */
+    TArray<size_t, cpu> _order;               /* Indices of the observations in the order of the cells */
+    TArray<size_t, cpu> _cellStarts;          /* Position of the first observation of each cell */
+    TArray<int, cpu> _cellCoords;             /* Coordinates of the cells */
+    TArray<algorithmFPType, cpu> _data;       /* Observations in the order of the cells */
+    TArray<algorithmFPType, cpu> _weights;    /* Weights of the observations in the order of the cells */
+};
+
+/* Finds the root of the set of the cells with path halving */
+inline size_t findCellsRoot(size_t * const parents, size_t iCell)
+{
+    while (parents[iCell] != iCell)
+    {
+        parents[iCell] = parents[parents[iCell]];
+        iCell          = parents[iCell];
+    }
+    return iCell;
+}
+
+/* Finds the root of the set of the cells without modifying the parents */
+inline size_t findCellsRootNoCompression(const size_t * const parents, size_t iCell)
+{
+    while (parents[iCell] != iCell) iCell = parents[iCell];
+    return iCell;
+}
+
+/* Checks if the cells contain a pair of the core observations within epsilon from each other */
+template <typename algorithmFPType, CpuType cpu>
+bool hasCloseCoreObservations(const CellGrid<algorithmFPType, cpu> & grid, const int * const isCore, size_t iCell, size_t jCell,
+                              PairwiseDistanceType distanceType, algorithmFPType minkowskiPower, algorithmFPType threshold)
+{
+    const size_t nFeatures = grid.getNumberOfFeatures();
+    for (size_t iPos = grid.cellBegin(iCell); iPos < grid.cellEnd(iCell); iPos++)
+    {
+        if (!isCore[iPos]) continue;
+        const algorithmFPType * const x = grid.getRow(iPos);
+        for (size_t jPos = grid.cellBegin(jCell); jPos < grid.cellEnd(jCell); jPos++)
+        {
+            if (isCore[jPos] && computeDistance<algorithmFPType, cpu>(distanceType, x, grid.getRow(jPos), nFeatures, minkowskiPower) <= threshold)
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status DBSCANBatchKernel<algorithmFPType, gridDense, cpu>::findCoreObservations(const CellGrid<algorithmFPType, cpu> & grid,
+                                                                                 PairwiseDistanceType distanceType, algorithmFPType minkowskiPower,
+                                                                                 algorithmFPType threshold, algorithmFPType minObservations,
+                                                                                 int * const isCore)
+{
+    const size_t nFeatures = grid.getNumberOfFeatures();
+    const size_t nCells    = grid.getNumberOfCells();
+
+    daal::threader_for(nCells, nCells, [&](size_t iCell) {
+        const size_t begin = grid.cellBegin(iCell);
+        const size_t end   = grid.cellEnd(iCell);
+
+        algorithmFPType cellWeight = 0;
+        for (size_t pos = begin; pos < end; pos++) cellWeight += grid.getWeight(pos);
+
+        if (cellWeight >= minObservations)
+        {
+            for (size_t pos = begin; pos < end; pos++) isCore[pos] = 1;
+            return;
+        }
+
+        for (size_t pos = begin; pos < end; pos++)
+        {
+            const algorithmFPType * const x = grid.getRow(pos);
+            algorithmFPType weight          = cellWeight;
+            grid.forEachNeighborCell(iCell, [&](size_t jCell) {
+                if (jCell == iCell) return;
+                for (size_t jPos = grid.cellBegin(jCell); jPos < grid.cellEnd(jCell) && weight < minObservations; jPos++)
+                {
+                    if (computeDistance<algorithmFPType, cpu>(distanceType, x, grid.getRow(jPos), nFeatures, minkowskiPower) <= threshold)
+                    {
+                        weight += grid.getWeight(jPos);
+                    }
+                }
+            });
+            isCore[pos] = (weight >= minObservations);
+        }
+    });
+
+    return Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status DBSCANBatchKernel<algorithmFPType, gridDense, cpu>::connectCoreCells(const CellGrid<algorithmFPType, cpu> & grid,
+                                                                             PairwiseDistanceType distanceType, algorithmFPType minkowskiPower,
+                                                                             algorithmFPType threshold, const int * const isCore,
+                                                                             size_t * const cellCluster, size_t & nClusters)
+{
+    const size_t nCells = grid.getNumberOfCells();
+
+    /* All the core observations of a cell are neighbors, so they belong to the same cluster */
+    TArray<int, cpu> hasCoreArray(nCells);
+    DAAL_CHECK_MALLOC(hasCoreArray.get());
+    int * const hasCore = hasCoreArray.get();
+    daal::threader_for(nCells, nCells, [&](size_t iCell) {
+        hasCore[iCell] = 0;
+        for (size_t pos = grid.cellBegin(iCell); pos < grid.cellEnd(iCell) && !hasCore[iCell]; pos++) hasCore[iCell] = isCore[pos];
+    });
+
+    TArray<size_t, cpu> parentsArray(nCells);
+    DAAL_CHECK_MALLOC(parentsArray.get());
+    size_t * const parents = parentsArray.get();
+    for (size_t iCell = 0; iCell < nCells; iCell++) parents[iCell] = iCell;
+
+    /* The connected pairs of the cells are collected for a block of the cells at once and merged after the block is processed,
+       so the memory does not depend on the number of the neighbor cells */
+    daal::tls<Queue<size_t, cpu> *> tlsPairs([=]() { return new Queue<size_t, cpu>; });
+    SafeStatus safeStat;
+    const size_t nBlocks = nCells / __DBSCAN_GRID_CELLS_BLOCK_SIZE + !!(nCells % __DBSCAN_GRID_CELLS_BLOCK_SIZE);
+    for (size_t iBlock = 0; iBlock < nBlocks && safeStat.ok(); iBlock++)
+    {
+        const size_t blockBegin = iBlock * __DBSCAN_GRID_CELLS_BLOCK_SIZE;
+        const size_t blockSize  = services::internal::min<cpu, size_t>(__DBSCAN_GRID_CELLS_BLOCK_SIZE, nCells - blockBegin);
+        daal::threader_for(blockSize, blockSize, [&](size_t i) {
+            const size_t iCell = blockBegin + i;
+            if (!hasCore[iCell]) return;
+            Queue<size_t, cpu> * const pairs = tlsPairs.local();
+            DAAL_CHECK_MALLOC_THR(pairs);
+            /* The parents are not modified while the block is processed, so the cells already merged are skipped safely */
+            const size_t iRoot = findCellsRootNoCompression(parents, iCell);
+            grid.forEachNeighborCell(iCell, [&](size_t jCell) {
+                if (jCell <= iCell || !hasCore[jCell] || findCellsRootNoCompression(parents, jCell) == iRoot) return;
+                if (hasCloseCoreObservations<algorithmFPType, cpu>(grid, isCore, iCell, jCell, distanceType, minkowskiPower, threshold))
+                {
+                    safeStat |= pairs->push(iCell);
+                    safeStat |= pairs->push(jCell);
+                }
+            });
+        });
+
+        tlsPairs.reduce([&](Queue<size_t, cpu> * pairs) {
+            if (!pairs) return;
+            while (!pairs->empty())
+            {
+                const size_t iRoot = findCellsRoot(parents, pairs->pop());
+                const size_t jRoot = findCellsRoot(parents, pairs->pop());
+                parents[iRoot > jRoot ? iRoot : jRoot] = (iRoot < jRoot ? iRoot : jRoot);
+            }
+            pairs->reset();
+        });
+    }
+    tlsPairs.reduce([](Queue<size_t, cpu> * pairs) { delete pairs; });
+    DAAL_CHECK_SAFE_STATUS();
+
+    /* The clusters are numbered in the order of their first core observations in the input data, as the default method does */
+    const size_t nRows = grid.getNumberOfRows();
+    TArray<size_t, cpu> firstCoreArray(nCells);
+    TArray<size_t, cpu> rootsArray(nCells);
+    DAAL_CHECK_MALLOC(firstCoreArray.get() && rootsArray.get());
+    size_t * const firstCore = firstCoreArray.get();
+    size_t * const roots     = rootsArray.get();
+    service_memset_seq<size_t, cpu>(firstCore, nRows, nCells);
+
+    size_t nRoots = 0;
+    for (size_t iCell = 0; iCell < nCells; iCell++)
+    {
+        if (!hasCore[iCell]) continue;
+        const size_t iRoot = findCellsRoot(parents, iCell);
+        if (firstCore[iRoot] == nRows) roots[nRoots++] = iRoot;
+        for (size_t pos = grid.cellBegin(iCell); pos < grid.cellEnd(iCell); pos++)
+        {
+            if (isCore[pos] && grid.getIndex(pos) < firstCore[iRoot]) firstCore[iRoot] = grid.getIndex(pos);
+        }
+    }
+    daal::algorithms::internal::introSort<cpu>(roots, roots + nRoots,
+                                               [=](size_t iRoot, size_t jRoot) -> bool { return firstCore[iRoot] < firstCore[jRoot]; });
+
+    /* The cells without core observations get the number of the cells that exceeds the number of the clusters */
+    service_memset_seq<size_t, cpu>(cellCluster, nCells, nCells);
+    for (size_t iCluster = 0; iCluster < nRoots; iCluster++) cellCluster[roots[iCluster]] = iCluster;
+    for (size_t iCell = 0; iCell < nCells; iCell++)
+    {
+        if (hasCore[iCell]) cellCluster[iCell] = cellCluster[findCellsRoot(parents, iCell)];
+    }
+    nClusters = nRoots;
+
+    return Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status DBSCANBatchKernel<algorithmFPType, gridDense, cpu>::assignObservations(const CellGrid<algorithmFPType, cpu> & grid,
+                                                                               PairwiseDistanceType distanceType, algorithmFPType minkowskiPower,
+                                                                               algorithmFPType threshold, const int * const isCore,
+                                                                               const size_t * const cellCluster, size_t nClusters,
+                                                                               int * const assignments)
+{
+    const size_t nFeatures = grid.getNumberOfFeatures();
+    const size_t nCells    = grid.getNumberOfCells();
+
+    daal::threader_for(nCells, nCells, [&](size_t iCell) {
+        for (size_t pos = grid.cellBegin(iCell); pos < grid.cellEnd(iCell); pos++)
+        {
+            if (isCore[pos])
+            {
+                assignments[grid.getIndex(pos)] = int(cellCluster[iCell]);
+                continue;
+            }
+
+            /* A border observation gets the smallest cluster among the clusters of the core observations within epsilon,
+               as it happens in the default method that expands the clusters one by one */
+            const algorithmFPType * const x = grid.getRow(pos);
+            size_t cluster                  = cellCluster[iCell];
+            grid.forEachNeighborCell(iCell, [&](size_t jCell) {
+                if (cellCluster[jCell] >= cluster) return;
+                for (size_t jPos = grid.cellBegin(jCell); jPos < grid.cellEnd(jCell); jPos++)
+                {
+                    if (isCore[jPos]
+                        && computeDistance<algorithmFPType, cpu>(distanceType, x, grid.getRow(jPos), nFeatures, minkowskiPower) <= threshold)
+                    {
+                        cluster = cellCluster[jCell];
+                        break;
+                    }
+                }
+            });
+            assignments[grid.getIndex(pos)] = (cluster < nClusters) ? int(cluster) : noise;
+        }
+    });
+
+    return Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status DBSCANBatchKernel<algorithmFPType, gridDense, cpu>::compute(const NumericTable * ntData, const NumericTable * ntWeights,
+                                                                    NumericTable * ntAssignments, NumericTable * ntNClusters,
+                                                                    NumericTable * ntCoreIndices, NumericTable * ntCoreObservations,
+                                                                    const Parameter * par)
+{
+    DAAL_CHECK_EX(par->distanceType != cosine, services::ErrorMethodNotSupported, services::ParameterName, distanceTypeStr());
+    DAAL_CHECK_EX(par->epsilon >= 0, services::ErrorIncorrectParameter, services::ParameterName, epsilonStr());
+
+    const size_t nRows     = ntData->getNumberOfRows();
+    const size_t nFeatures = ntData->getNumberOfColumns();
+
+    const algorithmFPType epsilon         = par->epsilon;
+    const algorithmFPType minObservations = par->minObservations;
+    const algorithmFPType minkowskiPower  = par->minkowskiPower;
+
+    const PairwiseDistanceType distanceType = static_cast<PairwiseDistanceType>(par->distanceType);
+    const algorithmFPType threshold         = getDistanceThreshold<algorithmFPType, cpu>(distanceType, epsilon, minkowskiPower);
+
+    /* Power of the Lp norm the distance is based on */
+    const algorithmFPType p =
+        (distanceType == manhattanDistance) ? algorithmFPType(1) : ((distanceType == minkowskiDistance) ? minkowskiPower : algorithmFPType(2));
+
+    ReadRows<algorithmFPType, cpu> dataRows(const_cast<NumericTable *>(ntData), 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(dataRows);
+
+    ReadRows<algorithmFPType, cpu> weightsRows;
+    if (ntWeights)
+    {
+        weightsRows.set(const_cast<NumericTable *>(ntWeights), 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(weightsRows);
+    }
+
+    CellGrid<algorithmFPType, cpu> grid;
+    DAAL_CHECK_STATUS_VAR(grid.build(dataRows.get(), weightsRows.get(), nRows, nFeatures, epsilon, p));
+
+    /* Flags of the core observations in the order of the grid */
+    TArray<int, cpu> isCoreArray(nRows);
+    DAAL_CHECK_MALLOC(isCoreArray.get());
+    int * const isCore = isCoreArray.get();
+    DAAL_CHECK_STATUS_VAR(findCoreObservations(grid, distanceType, minkowskiPower, threshold, minObservations, isCore));
+
+    TArray<size_t, cpu> cellClusterArray(grid.getNumberOfCells());
+    DAAL_CHECK_MALLOC(cellClusterArray.get());
+    size_t nClusters = 0;
+    DAAL_CHECK_STATUS_VAR(connectCoreCells(grid, distanceType, minkowskiPower, threshold, isCore, cellClusterArray.get(), nClusters));
+
+    WriteRows<int, cpu> assignRows(ntAssignments, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(assignRows);
+    DAAL_CHECK_STATUS_VAR(
+        assignObservations(grid, distanceType, minkowskiPower, threshold, isCore, cellClusterArray.get(), nClusters, assignRows.get()));
+
+    WriteRows<int, cpu> nClustersRows(ntNClusters, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nClustersRows);
+    nClustersRows.get()[0] = nClusters;
+
+    if (par->resultsToCompute & (computeCoreIndices | computeCoreObservations))
+    {
+        TArray<int, cpu> isCoreInDataArray(nRows);
+        DAAL_CHECK_MALLOC(isCoreInDataArray.get());
+        int * const isCoreInData = isCoreInDataArray.get();
+        for (size_t pos = 0; pos < nRows; pos++) isCoreInData[grid.getIndex(pos)] = isCore[pos];
+
+        return processResultsToCompute<algorithmFPType, cpu>(par->resultsToCompute, isCoreInData, ntData, ntCoreIndices, ntCoreObservations);
+    }
+
+    return Status();
+}
+
+} // namespace internal
+} // namespace dbscan
+} // namespace algorithms
+} // namespace daal
@@ -58,9 +58,44 @@ private:
     services::Status processNeighborhoodParallel(size_t clusterId, int * const assignments, const Neighborhood<algorithmFPType, cpu> & neigh,
                                                  daal::tls<Queue<size_t, cpu> *> & tls, TArray<Neighborhood<algorithmFPType, cpu>, cpu> & neighs,
                                                  algorithmFPType minObservations, int * const isCore, size_t nestedLevel);
+};
+
+template <typename algorithmFPType, CpuType cpu>
+class CellGrid;
+
+template <typename algorithmFPType, CpuType cpu>
+class DBSCANBatchKernel<algorithmFPType, gridDense, cpu> : public Kernel
+{
+public:
+    /* The grid-based method keeps no neighborhoods in memory, so memorySavingMode does not change it */
+    services::Status computeNoMemSave(const NumericTable * ntData, const NumericTable * ntWeights, NumericTable * ntAssignments,
+                                      NumericTable * ntNClusters, NumericTable * ntCoreIndices, NumericTable * ntCoreObservations,
+                                      const Parameter * par)
+    {
+        return compute(ntData, ntWeights, ntAssignments, ntNClusters, ntCoreIndices, ntCoreObservations, par);
+    }
+
+    services::Status computeMemSave(const NumericTable * ntData, const NumericTable * ntWeights, NumericTable * ntAssignments,
+                                    NumericTable * ntNClusters, NumericTable * ntCoreIndices, NumericTable * ntCoreObservations,
+                                    const Parameter * par)
+    {
+        return compute(ntData, ntWeights, ntAssignments, ntNClusters, ntCoreIndices, ntCoreObservations, par);
+    }
+
+private:
+    services::Status compute(const NumericTable * ntData, const NumericTable * ntWeights, NumericTable * ntAssignments, NumericTable * ntNClusters,
+                             NumericTable * ntCoreIndices, NumericTable * ntCoreObservations, const Parameter * par);
+
+    services::Status findCoreObservations(const CellGrid<algorithmFPType, cpu> & grid, PairwiseDistanceType distanceType,
+                                          algorithmFPType minkowskiPower, algorithmFPType threshold, algorithmFPType minObservations,
+                                          int * const isCore);
+
+    services::Status connectCoreCells(const CellGrid<algorithmFPType, cpu> & grid, PairwiseDistanceType distanceType, algorithmFPType minkowskiPower,
+                                      algorithmFPType threshold, const int * const isCore, size_t * const cellCluster, size_t & nClusters);
 
-    services::Status processResultsToCompute(DAAL_UINT64 resultsToCompute, int * const isCore, const NumericTable * ntData,
-                                             NumericTable * ntCoreIndices, NumericTable * ntCoreObservations);
+    services::Status assignObservations(const CellGrid<algorithmFPType, cpu> & grid, PairwiseDistanceType distanceType,
+                                        algorithmFPType minkowskiPower, algorithmFPType threshold, const int * const isCore,
+                                        const size_t * const cellCluster, size_t nClusters, int * const assignments);
 };
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -40,7 +40,16 @@ namespace interface1
  *  Constructs parameters of the DBSCAN algorithm
  */
 Parameter::Parameter()
-    : epsilon(0.5), minObservations(5), memorySavingMode(false), resultsToCompute(0), blockIndex(0), nBlocks(1), leftBlocks(1), rightBlocks(1)
+    : epsilon(0.5),
+      minObservations(5),
+      memorySavingMode(false),
+      resultsToCompute(0),
+      blockIndex(0),
+      nBlocks(1),
+      leftBlocks(1),
+      rightBlocks(1),
+      distanceType(euclidean),
+      minkowskiPower(2.0)
 {}
 
 /**
@@ -56,7 +65,9 @@ Parameter::Parameter(double _epsilon, size_t _minObservations)
       blockIndex(0),
       nBlocks(1),
       leftBlocks(1),
-      rightBlocks(1)
+      rightBlocks(1),
+      distanceType(euclidean),
+      minkowskiPower(2.0)
 {}
 
 /**
@@ -71,13 +82,18 @@ Parameter::Parameter(const Parameter & other)
       blockIndex(other.blockIndex),
       nBlocks(other.nBlocks),
       leftBlocks(other.leftBlocks),
-      rightBlocks(other.rightBlocks)
+      rightBlocks(other.rightBlocks),
+      distanceType(other.distanceType),
+      minkowskiPower(other.minkowskiPower)
 {}
 
 services::Status Parameter::check() const
 {
     DAAL_CHECK_EX(epsilon >= 0, services::ErrorIncorrectParameter, services::ParameterName, epsilonStr());
     DAAL_CHECK_EX(minObservations > 0, services::ErrorIncorrectParameter, services::ParameterName, minObservationsStr());
+    DAAL_CHECK_EX(distanceType <= lastDistanceType, services::ErrorIncorrectParameter, services::ParameterName, distanceTypeStr());
+    DAAL_CHECK_EX(distanceType != minkowski || minkowskiPower >= 1.0, services::ErrorIncorrectParameter, services::ParameterName,
+                  minkowskiPowerStr());
     return services::Status();
 }
 
@@ -33,6 +33,7 @@
 #include "src/data_management/service_numeric_table.h"
 #include "src/externals/service_math.h"
 #include "src/algorithms/service_kernel_math.h"
+#include "src/services/service_unique_ptr.h"
 #include "src/algorithms/service_error_handling.h"
 
 using namespace daal::internal;
@@ -391,11 +392,58 @@ struct NTask
     daal::tls<TlsNTask<FPType, cpu> *> * tlsNTask;
 };
 
+// Epsilon in the scale of the values computed by the metric, e.g. squared for the Euclidean distance
+template <typename FPType, CpuType cpu>
+FPType getDistanceThreshold(PairwiseDistanceType distanceType, FPType eps, FPType p)
+{
+    switch (distanceType)
+    {
+    case manhattanDistance:
+    case cosineDistance: return eps;
+    case minkowskiDistance: return Math<FPType, cpu>::sPowx(eps, p);
+    default: return eps * eps;
+    }
+}
+
+// Distance between two observations in the same scale as the values computed by the metric
+template <typename FPType, CpuType cpu>
+FPType computeDistance(PairwiseDistanceType distanceType, const FPType * a, const FPType * b, size_t dim, FPType p)
+{
+    switch (distanceType)
+    {
+    case manhattanDistance:
+    {
+        FPType sum = FPType(0);
+        for (size_t i = 0; i < dim; i++) sum += Math<FPType, cpu>::sFabs(a[i] - b[i]);
+        return sum;
+    }
+    case minkowskiDistance:
+    {
+        FPType sum = FPType(0);
+        for (size_t i = 0; i < dim; i++) sum += Math<FPType, cpu>::sPowx(Math<FPType, cpu>::sFabs(a[i] - b[i]), p);
+        return sum;
+    }
+    case cosineDistance:
+    {
+        FPType ab = FPType(0), aa = FPType(0), bb = FPType(0);
+        for (size_t i = 0; i < dim; i++)
+        {
+            ab += a[i] * b[i];
+            aa += a[i] * a[i];
+            bb += b[i] * b[i];
+        }
+        return (aa > FPType(0) && bb > FPType(0)) ? FPType(1) - ab / Math<FPType, cpu>::sSqrt(aa * bb) : FPType(1);
+    }
+    default: return distancePow2<FPType, cpu>(a, b, dim);
+    }
+}
+
 template <Method, typename FPType, CpuType cpu>
 class NeighborhoodEngine
 {
 public:
-    NeighborhoodEngine(const NumericTable * inTable, const NumericTable * outTable, const NumericTable * weights, FPType eps, FPType p);
+    NeighborhoodEngine(const NumericTable * inTable, const NumericTable * outTable, const NumericTable * weights, FPType eps,
+                       PairwiseDistanceType distanceType, FPType p);
 
     services::Status queryFull(Neighborhood<FPType, cpu> * neighs, bool doReset = false);
 
@@ -408,8 +456,9 @@ class NeighborhoodEngine<defaultDense, FPType, cpu>
     DAAL_NEW_DELETE();
 
 public:
-    NeighborhoodEngine(const NumericTable * inTable, const NumericTable * outTable, const NumericTable * weights, FPType eps, FPType p)
-        : _inTable(inTable), _outTable(outTable), _weights(weights), _eps(eps), _p(p)
+    NeighborhoodEngine(const NumericTable * inTable, const NumericTable * outTable, const NumericTable * weights, FPType eps,
+                       PairwiseDistanceType distanceType, FPType p)
+        : _inTable(inTable), _outTable(outTable), _weights(weights), _eps(eps), _distanceType(distanceType), _p(p)
     {}
 
     ~NeighborhoodEngine() {}
@@ -443,14 +492,13 @@ public:
             return services::Status();
         }
 
-        const size_t dim    = _inTable->getNumberOfColumns();
-        const size_t outDim = _outTable->getNumberOfColumns();
-        DAAL_ASSERT(outDim >= dim);
+        DAAL_ASSERT(_outTable->getNumberOfColumns() >= _inTable->getNumberOfColumns());
 
-        EuclideanDistances<FPType, cpu> metric(*_inTable, *_outTable);
-        DAAL_CHECK_STATUS_VAR(metric.init());
+        UniquePtr<PairwiseDistances<FPType, cpu>, cpu> metric(createPairwiseDistances<FPType, cpu>(_distanceType, *_inTable, *_outTable, _p));
+        DAAL_CHECK_MALLOC(metric.get());
+        DAAL_CHECK_STATUS_VAR(metric->init());
 
-        const FPType epsP = Math<FPType, cpu>::sPowx(_eps, _p);
+        const FPType epsP = getDistanceThreshold<FPType, cpu>(_distanceType, _eps, _p);
 
         const size_t inBlockSize = 128;
         const size_t nInBlocks   = inRows / inBlockSize + (inRows % inBlockSize > 0);
@@ -508,7 +556,7 @@ public:
                 }
                 const FPType * const weights = weightsRows.get() ? weightsRows.get() : onesWeights;
 
-                metric.computeBatch(inData, outData, i1, iSize, j1, jSize, local);
+                DAAL_CHECK_STATUS_THR(metric->computeBatch(inData, outData, i1, iSize, j1, jSize, local));
 
                 for (size_t i = 0; i < iSize; i++)
                 {
@@ -562,7 +610,7 @@ public:
             }
         }
 
-        FPType epsP = Math<FPType, cpu>::sPowx(_eps, _p);
+        const FPType epsP = getDistanceThreshold<FPType, cpu>(_distanceType, _eps, _p);
 
         size_t outBlockSize = 256;
         size_t nOutBlocks   = outRows / outBlockSize + (outRows % outBlockSize > 0);
@@ -594,7 +642,7 @@ public:
             {
                 for (size_t j = 0; j < jSize; j++)
                 {
-                    FPType dist = distancePow2<FPType, cpu>(queryRows[i].get(), &outData[j * outDim], dim);
+                    FPType dist = computeDistance<FPType, cpu>(_distanceType, queryRows[i].get(), &outData[j * outDim], dim, _p);
                     if (dist <= epsP)
                     {
                         DAAL_CHECK_MALLOC_THR(!localNeighs[i].add(j + j1, (weights ? weights[j] : (FPType)1.0)));
@@ -631,9 +679,84 @@ private:
     const NumericTable * _weights;
 
     FPType _eps;
+    PairwiseDistanceType _distanceType;
     FPType _p;
 };
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status processResultsToCompute(DAAL_UINT64 resultsToCompute, int * const isCore, const NumericTable * ntData, NumericTable * ntCoreIndices,
+                                         NumericTable * ntCoreObservations)
+{
+    const size_t nRows     = ntData->getNumberOfRows();
+    const size_t nFeatures = ntData->getNumberOfColumns();
+
+    size_t nCoreObservations = 0;
+
+    for (size_t i = 0; i < nRows; i++)
+    {
+        if (!isCore[i])
+        {
+            continue;
+        }
+        nCoreObservations++;
+    }
+
+    if (nCoreObservations == 0)
+    {
+        return services::Status();
+    }
+
+    if (resultsToCompute & computeCoreIndices)
+    {
+        DAAL_CHECK_STATUS_VAR(ntCoreIndices->resize(nCoreObservations));
+        WriteRows<int, cpu> coreIndicesRows(ntCoreIndices, 0, nCoreObservations);
+        DAAL_CHECK_BLOCK_STATUS(coreIndicesRows);
+        int * const coreIndices = coreIndicesRows.get();
+
+        size_t pos = 0;
+        for (size_t i = 0; i < nRows; i++)
+        {
+            if (!isCore[i])
+            {
+                continue;
+            }
+            coreIndices[pos] = i;
+            pos++;
+        }
+    }
+
+    if (resultsToCompute & computeCoreObservations)
+    {
+        DAAL_CHECK_STATUS_VAR(ntCoreObservations->resize(nCoreObservations));
+        WriteRows<algorithmFPType, cpu> coreObservationsRows(ntCoreObservations, 0, nCoreObservations);
+        DAAL_CHECK_BLOCK_STATUS(coreObservationsRows);
+        algorithmFPType * const coreObservations = coreObservationsRows.get();
+
+        size_t pos = 0;
+        int result = 0;
+        for (size_t i = 0; i < nRows; i++)
+        {
+            if (!isCore[i])
+            {
+                continue;
+            }
+            ReadRows<algorithmFPType, cpu> dataRows(const_cast<NumericTable *>(ntData), i, 1);
+            DAAL_CHECK_BLOCK_STATUS(dataRows);
+            const algorithmFPType * const data = dataRows.get();
+
+            result |= daal::services::internal::daal_memcpy_s(&(coreObservations[pos * nFeatures]), sizeof(algorithmFPType) * nFeatures, data,
+                                                              sizeof(algorithmFPType) * nFeatures);
+            pos++;
+        }
+        if (result)
+        {
+            return services::Status(services::ErrorMemoryCopyFailedInternal);
+        }
+    }
+
+    return services::Status();
+}
+
 template <typename FPType, CpuType cpu>
 FPType findKthStatistic(FPType * values, size_t nElements, size_t k)
 {
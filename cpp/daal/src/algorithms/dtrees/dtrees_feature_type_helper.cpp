@@ -98,9 +98,15 @@ bool FeatureTypes::findInBuf(size_t iFeature) const
 IndexedFeatures::~IndexedFeatures()
 {
     if (_data) daal::services::daal_free(_data);
+    if (_sparseRowOffsets) daal::services::daal_free(_sparseRowOffsets);
+    if (_sparseColIndices) daal::services::daal_free(_sparseColIndices);
+    if (_sparseBins) daal::services::daal_free(_sparseBins);
     delete[] _entries;
-    _data    = nullptr;
-    _entries = nullptr;
+    _data             = nullptr;
+    _sparseRowOffsets = nullptr;
+    _sparseColIndices = nullptr;
+    _sparseBins       = nullptr;
+    _entries          = nullptr;
 }
 
 IndexedFeatures::FeatureEntry::~FeatureEntry()
@@ -153,6 +159,27 @@ services::Status IndexedFeatures::alloc(size_t nC, size_t nR)
     return services::Status();
 }
 
+services::Status IndexedFeatures::allocSparse(size_t nC, size_t nR, size_t nNonZeros)
+{
+    if (_sparseRowOffsets) services::daal_free(_sparseRowOffsets);
+    if (_sparseColIndices) services::daal_free(_sparseColIndices);
+    if (_sparseBins) services::daal_free(_sparseBins);
+    _sparseRowOffsets = (size_t *)services::daal_calloc(sizeof(size_t) * (nR + 1));
+    _sparseColIndices = (IndexType *)services::daal_calloc(sizeof(IndexType) * (nNonZeros ? nNonZeros : 1));
+    _sparseBins       = (IndexType *)services::daal_calloc(sizeof(IndexType) * (nNonZeros ? nNonZeros : 1));
+    DAAL_CHECK_MALLOC(_sparseRowOffsets && _sparseColIndices && _sparseBins);
+    if (_entries)
+    {
+        delete[] _entries;
+        _entries = nullptr;
+    }
+    _entries = new FeatureEntry[nC];
+    DAAL_CHECK_MALLOC(_entries);
+    _nCols = nC;
+    _nRows = nR;
+    return services::Status();
+}
+
 } /* namespace internal */
 } /* namespace dtrees */
 } /* namespace algorithms */
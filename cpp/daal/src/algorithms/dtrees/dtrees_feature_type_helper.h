@@ -93,18 +93,35 @@ public:
         DAAL_NEW_DELETE();
         IndexType numIndices     = 0;       //number of indices or bins
         ModelFPType * binBorders = nullptr; //right bin borders
+        IndexType zeroBin        = 0;       //bin of the zero value, used for the entries missing in sparse data
 
         services::Status allocBorders();
         ~FeatureEntry();
     };
 
 public:
-    IndexedFeatures() : _data(nullptr), _entries(nullptr), _sizeOfIndex(sizeof(IndexType)), _nCols(0), _nRows(0), _capacity(0), _maxNumIndices(0) {}
+    IndexedFeatures()
+        : _data(nullptr),
+          _entries(nullptr),
+          _sizeOfIndex(sizeof(IndexType)),
+          _nCols(0),
+          _nRows(0),
+          _capacity(0),
+          _maxNumIndices(0),
+          _sparseRowOffsets(nullptr),
+          _sparseColIndices(nullptr),
+          _sparseBins(nullptr)
+    {}
     ~IndexedFeatures();
 
     template <typename algorithmFPType, CpuType cpu>
     services::Status init(const NumericTable & nt, const FeatureTypes * featureTypes = nullptr, const BinParams * pBimPrm = nullptr);
 
+    //creates the index of the data in CSR format: the bins are kept for the non-zero entries only,
+    //the missing entries of the feature belong to its zero bin
+    template <typename algorithmFPType, CpuType cpu>
+    services::Status initSparse(CSRNumericTableIface & nt, size_t nRows, size_t nCols, const BinParams & binParams);
+
     //get max number of indices for that feature
     IndexType numIndices(size_t iCol) const { return _entries[iCol].numIndices; }
 
@@ -129,11 +146,41 @@ public:
     //for low-level optimization
     const IndexType * data(size_t iFeature) const { return (IndexType *)(((char *)_data) + _nRows * iFeature * _sizeOfIndex); }
 
+    //returns true if the index is created for the data in CSR format
+    bool isSparse() const { return !!_sparseBins; }
+
+    //returns the bin of the feature value in the row of the sparse data
+    IndexType sparseBin(size_t iCol, size_t iRow) const
+    {
+        DAAL_ASSERT(isSparse());
+        const IndexType * first = _sparseColIndices + _sparseRowOffsets[iRow];
+        const IndexType * last  = _sparseColIndices + _sparseRowOffsets[iRow + 1];
+        while (first < last)
+        {
+            const IndexType * mid = first + (last - first) / 2;
+            if (*mid < IndexType(iCol))
+                first = mid + 1;
+            else
+                last = mid;
+        }
+        const IndexType * end = _sparseColIndices + _sparseRowOffsets[iRow + 1];
+        return ((first < end) && (*first == IndexType(iCol))) ? _sparseBins[first - _sparseColIndices] : _entries[iCol].zeroBin;
+    }
+
+    //bin of the zero value of the feature of the sparse data
+    IndexType zeroBin(size_t iCol) const { return _entries[iCol].zeroBin; }
+
+    //zero-based offsets of the rows, column indices and bins of the non-zero entries of the sparse data
+    const size_t * sparseRowOffsets() const { return _sparseRowOffsets; }
+    const IndexType * sparseColIndices() const { return _sparseColIndices; }
+    const IndexType * sparseBins() const { return _sparseBins; }
+
     size_t nRows() const { return _nRows; }
     size_t nCols() const { return _nCols; }
 
 protected:
     services::Status alloc(size_t nCols, size_t nRows);
+    services::Status allocSparse(size_t nCols, size_t nRows, size_t nNonZeros);
 
 protected:
     IndexType * _data;
@@ -143,6 +190,9 @@ protected:
     size_t _nCols;
     size_t _capacity;
     size_t _maxNumIndices;
+    size_t * _sparseRowOffsets;
+    IndexType * _sparseColIndices;
+    IndexType * _sparseBins;
 };
 
 } /* namespace internal */
@@ -26,6 +26,7 @@
 #include "src/algorithms/service_sort.h"
 #include "src/algorithms/dtrees/service_array.h"
 #include "src/externals/service_memory.h"
+#include "src/services/service_utils.h"
 
 namespace daal
 {
@@ -339,6 +340,133 @@ services::Status IndexedFeatures::init(const NumericTable & nt, const FeatureTyp
     return safeStat.detach();
 }
 
+template <typename algorithmFPType>
+struct SparseFeatureIdx
+{
+    algorithmFPType key;
+    size_t val;
+    bool operator<(const SparseFeatureIdx & o) const { return key < o.key; }
+};
+
+//Calls func(value, iFirst, iLast, count) for every group of equal values of the sparse column in increasing order.
+//[iFirst, iLast) is the range of the non-zero entries of the group in the sorted index,
+//the missing entries of the column are added to the group of zeros
+template <typename algorithmFPType, typename Func>
+void forEachValueGroup(const SparseFeatureIdx<algorithmFPType> * index, size_t nNonZeros, size_t nMissing, Func func)
+{
+    bool bZerosDone = !nMissing;
+    size_t i        = 0;
+    while (i < nNonZeros || !bZerosDone)
+    {
+        if (!bZerosDone && (i == nNonZeros || !(index[i].key < algorithmFPType(0))))
+        {
+            size_t j = i;
+            for (; j < nNonZeros && index[j].key == algorithmFPType(0); ++j)
+                ;
+            func(algorithmFPType(0), i, j, nMissing + j - i);
+            bZerosDone = true;
+            i          = j;
+            continue;
+        }
+        size_t j = i + 1;
+        for (; j < nNonZeros && index[j].key == index[i].key; ++j)
+            ;
+        func(index[i].key, i, j, j - i);
+        i = j;
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status IndexedFeatures::initSparse(CSRNumericTableIface & nt, size_t nRows, size_t nCols, const BinParams & binParams)
+{
+    daal::internal::ReadRowsCSR<algorithmFPType, cpu> block(nt, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(block);
+    const algorithmFPType * const values = block.values();
+    const size_t * const colIndices      = block.cols();
+    const size_t * const rowOffsets      = block.rows();
+    const size_t nNonZeros               = rowOffsets[nRows] - rowOffsets[0];
+
+    _maxNumIndices     = 0;
+    services::Status s = allocSparse(nCols, nRows, nNonZeros);
+    if (!s) return s;
+
+    //one-based indices of CSR format are converted to zero-based ones, the features of every row are counted
+    TVector<size_t, cpu, DefaultAllocator<cpu> > colOffsets(nCols + 1, 0);
+    DAAL_CHECK_MALLOC(colOffsets.get());
+    for (size_t iRow = 0; iRow < nRows; ++iRow)
+    {
+        _sparseRowOffsets[iRow] = rowOffsets[iRow] - rowOffsets[0];
+        for (size_t k = rowOffsets[iRow] - rowOffsets[0]; k < rowOffsets[iRow + 1] - rowOffsets[0]; ++k)
+        {
+            //sparse bins are looked up with binary search, so the column indices of the row have to increase
+            const bool bValidCol = (colIndices[k] >= 1) && (colIndices[k] <= nCols);
+            const bool bSorted   = (k == _sparseRowOffsets[iRow]) || (colIndices[k] > colIndices[k - 1]);
+            DAAL_CHECK(bValidCol && bSorted, services::ErrorIncorrectDataRange);
+            _sparseColIndices[k] = IndexType(colIndices[k] - 1);
+            ++colOffsets[colIndices[k]];
+        }
+    }
+    _sparseRowOffsets[nRows] = nNonZeros;
+    for (size_t iCol = 0; iCol < nCols; ++iCol) colOffsets[iCol + 1] += colOffsets[iCol];
+
+    //values of every feature are gathered together with the positions of the entries
+    typedef SparseFeatureIdx<algorithmFPType> FeatureIdx;
+    TVector<FeatureIdx, cpu, DefaultAllocator<cpu> > indexArr(nNonZeros ? nNonZeros : 1);
+    TVector<size_t, cpu, DefaultAllocator<cpu> > fillArr(nCols);
+    DAAL_CHECK_MALLOC(indexArr.get() && fillArr.get());
+    FeatureIdx * const index = indexArr.get();
+    size_t * const fill      = fillArr.get();
+    for (size_t iCol = 0; iCol < nCols; ++iCol) fill[iCol] = colOffsets[iCol];
+    for (size_t k = 0; k < nNonZeros; ++k)
+    {
+        FeatureIdx & entry = index[fill[_sparseColIndices[k]]++];
+        entry.key          = values[k];
+        entry.val          = k;
+    }
+
+    const size_t minBinSize = (nRows <= binParams.maxBins) ? 1 : services::internal::max<cpu, size_t>(nRows / binParams.maxBins, binParams.minBinSize);
+
+    SafeStatus safeStat;
+    daal::threader_for(nCols, nCols, [&](size_t iCol) {
+        FeatureIdx * const colIndex = index + colOffsets[iCol];
+        const size_t nColNonZeros   = colOffsets[iCol + 1] - colOffsets[iCol];
+        const size_t nMissing       = nRows - nColNonZeros;
+        if (nColNonZeros > 1) daal::algorithms::internal::qSortByKey<FeatureIdx, cpu>(nColNonZeros, colIndex);
+
+        size_t nGroups = 0;
+        forEachValueGroup(colIndex, nColNonZeros, nMissing, [&](algorithmFPType, size_t, size_t, size_t) { ++nGroups; });
+
+        //a bin is closed when it holds enough rows, the last group of values always closes the last bin
+        FeatureEntry & entry = _entries[iCol];
+        entry.numIndices     = services::internal::min<cpu, size_t>(nGroups, binParams.maxBins);
+        services::Status st  = entry.allocBorders();
+        DAAL_CHECK_STATUS_THR(st);
+
+        IndexType iBin    = 0;
+        size_t iGroup     = 0;
+        size_t nRowsInBin = 0;
+        forEachValueGroup(colIndex, nColNonZeros, nMissing, [&](algorithmFPType value, size_t iFirst, size_t iLast, size_t count) {
+            for (size_t i = iFirst; i < iLast; ++i) _sparseBins[colIndex[i].val] = iBin;
+            if (value == algorithmFPType(0)) entry.zeroBin = iBin;
+            nRowsInBin += count;
+            const bool bLastGroup = (++iGroup == nGroups);
+            if (bLastGroup || ((nRowsInBin >= minBinSize) && (size_t(iBin) + 1 < size_t(entry.numIndices))))
+            {
+                entry.binBorders[iBin++] = value;
+                nRowsInBin               = 0;
+            }
+        });
+        entry.numIndices = iBin;
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    for (size_t iCol = 0; iCol < nCols; ++iCol)
+    {
+        if (_maxNumIndices < size_t(_entries[iCol].numIndices)) _maxNumIndices = _entries[iCol].numIndices;
+    }
+    return s;
+}
+
 } /* namespace internal */
 } /* namespace dtrees */
 } /* namespace algorithms */
@@ -487,7 +487,9 @@ public:
 
     const int * getNodeSampleCount(size_t i) const
     {
-        return _nNodeSampleTables ? ((const data_management::HomogenNumericTable<int> *)(*_nNodeSampleTables)[i].get())->getArray() : nullptr;
+        if (!_nNodeSampleTables || i >= _nNodeSampleTables->size()) return nullptr;
+        const data_management::HomogenNumericTable<int> * pTbl = (const data_management::HomogenNumericTable<int> *)(*_nNodeSampleTables)[i].get();
+        return pTbl ? pTbl->getArray() : nullptr;
     }
 
     const double * getProbas(size_t i) const
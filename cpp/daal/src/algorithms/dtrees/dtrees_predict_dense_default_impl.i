@@ -75,6 +75,46 @@ const typename TreeType::NodeType::Base * findNode(const dtrees::internal::Tree
     return pNode;
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Common service function. Returns the feature value of the observation given in CSR format:
+// values and one-based colIndices of its non-zero entries, the column indices increase
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+algorithmFPType getSparseValue(const algorithmFPType * values, const size_t * colIndices, size_t nNonZeros, size_t iFeature)
+{
+    const size_t iCol = iFeature + 1;
+    size_t first = 0, last = nNonZeros;
+    while (first < last)
+    {
+        const size_t mid = first + (last - first) / 2;
+        if (colIndices[mid] < iCol)
+            first = mid + 1;
+        else
+            last = mid;
+    }
+    return ((first < nNonZeros) && (colIndices[first] == iCol)) ? values[first] : algorithmFPType(0);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Common service function. Finds node corresponding to the given observation in CSR format
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, typename TreeType, CpuType cpu>
+const typename TreeType::NodeType::Base * findNodeSparse(const dtrees::internal::Tree & t, const algorithmFPType * values, const size_t * colIndices,
+                                                         size_t nNonZeros)
+{
+    const TreeType & tree                           = static_cast<const TreeType &>(t);
+    const typename TreeType::NodeType::Base * pNode = tree.top();
+    for (; pNode && pNode->isSplit();)
+    {
+        auto pSplit               = TreeType::NodeType::castSplit(pNode);
+        const algorithmFPType val = getSparseValue<algorithmFPType, cpu>(values, colIndices, nNonZeros, pSplit->featureIdx);
+        const int sn = (pSplit->featureUnordered ? (int(val) != int(pSplit->featureValue)) :
+                                                   daal::services::internal::SignBit<algorithmFPType, cpu>::get(pSplit->featureValue - val));
+        pNode = pSplit->kid[sn];
+    }
+    return pNode;
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Common service function. Finds a node corresponding to the given observation
 //////////////////////////////////////////////////////////////////////////////////////////
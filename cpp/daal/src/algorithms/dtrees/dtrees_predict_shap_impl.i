@@ -0,0 +1,390 @@
+/* file: dtrees_predict_shap_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the computation of feature contributions (SHAP values)
+//  to the predictions of the tree ensembles.
+//--
+*/
+/*
+//  REFERENCES
+//
+//  1. Scott M. Lundberg, Gabriel G. Erion, Su-In Lee
+//     Consistent Individualized Feature Attribution for Tree Ensembles,
+//     arXiv:1802.03888, 2018
+*/
+
+#ifndef __DTREES_PREDICT_SHAP_IMPL_I__
+#define __DTREES_PREDICT_SHAP_IMPL_I__
+
+#include "src/algorithms/dtrees/dtrees_model_impl.h"
+#include "src/algorithms/dtrees/dtrees_feature_type_helper.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_memory.h"
+#include "src/services/service_arrays.h"
+#include "src/services/service_defines.h"
+#include "src/threading/threading.h"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace dtrees
+{
+namespace prediction
+{
+namespace internal
+{
+using namespace dtrees::internal;
+//////////////////////////////////////////////////////////////////////////////////////////
+// Element of the path from the root of the tree to the current node
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType>
+struct ShapPathElement
+{
+    int featureIndex;             //feature of the split, -1 for the root
+    algorithmFPType zeroFraction; //fraction of the training samples that follow the path at the split
+    algorithmFPType oneFraction;  //1 if the observation follows the path at the split, 0 otherwise
+    algorithmFPType pweight;      //proportion of the subsets of the path features of the given size
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Path-dependent TreeSHAP algorithm [1]. Computes the contributions of the features to the
+// response of a tree in O(L * D^2) time, L is the number of leaves, D is the depth of the tree.
+//
+// TreeType provides the access to the nodes of the tree, the root has zero index:
+//     bool isLeaf(size_t iNode, size_t lvl), size_t left(size_t iNode), size_t right(size_t iNode),
+//     int featureIndex(size_t iNode), ModelFPType featureValue(size_t iNode),
+//     ModelFPType response(size_t iNode), size_t cover(size_t iNode)
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, typename TreeType, CpuType cpu>
+class TreeShap
+{
+public:
+    typedef ShapPathElement<algorithmFPType> PathElement;
+
+    //Number of the path elements required to explain the tree of the given depth
+    static size_t pathSize(size_t depth) { return (depth + 2) * (depth + 3) / 2; }
+
+    static size_t depth(const TreeType & t, size_t iNode = 0, size_t lvl = 0)
+    {
+        if (t.isLeaf(iNode, lvl)) return lvl;
+        const size_t leftDepth  = depth(t, t.left(iNode), lvl + 1);
+        const size_t rightDepth = depth(t, t.right(iNode), lvl + 1);
+        return (leftDepth > rightDepth) ? leftDepth : rightDepth;
+    }
+
+    //Mean response of the tree on the training data set
+    static algorithmFPType expectedValue(const TreeType & t, size_t iNode = 0, size_t lvl = 0)
+    {
+        if (t.isLeaf(iNode, lvl)) return algorithmFPType(t.response(iNode));
+        const size_t iLeft                 = t.left(iNode);
+        const size_t iRight                = t.right(iNode);
+        const algorithmFPType leftFraction = fraction(t, iLeft, iRight);
+        return leftFraction * expectedValue(t, iLeft, lvl + 1) + (algorithmFPType(1) - leftFraction) * expectedValue(t, iRight, lvl + 1);
+    }
+
+    //Adds the contributions of the features to the response of the tree multiplied by the factor to phi,
+    //path is the buffer of pathSize(depth(t)) elements
+    static void explain(const TreeType & t, const FeatureTypes & featTypes, const algorithmFPType * x, algorithmFPType factor, PathElement * path,
+                        algorithmFPType * phi)
+    {
+        explainNode(t, featTypes, x, factor, 0, 0, path, 0, algorithmFPType(1), algorithmFPType(1), -1, phi);
+    }
+
+protected:
+    //Fraction of the training samples of the parent node that go to the son
+    static algorithmFPType fraction(const TreeType & t, size_t iSon, size_t iSibling)
+    {
+        const algorithmFPType sonCover = algorithmFPType(t.cover(iSon));
+        const algorithmFPType cover    = sonCover + algorithmFPType(t.cover(iSibling));
+        return (cover > 0) ? sonCover / cover : algorithmFPType(0.5);
+    }
+
+    static void extendPath(PathElement * path, size_t depth, algorithmFPType zeroFraction, algorithmFPType oneFraction, int featureIndex)
+    {
+        path[depth].featureIndex  = featureIndex;
+        path[depth].zeroFraction  = zeroFraction;
+        path[depth].oneFraction   = oneFraction;
+        path[depth].pweight       = depth ? algorithmFPType(0) : algorithmFPType(1);
+        const algorithmFPType div = algorithmFPType(1) / algorithmFPType(depth + 1);
+        for (size_t i = depth; i-- > 0;)
+        {
+            path[i + 1].pweight += oneFraction * path[i].pweight * algorithmFPType(i + 1) * div;
+            path[i].pweight = zeroFraction * path[i].pweight * algorithmFPType(depth - i) * div;
+        }
+    }
+
+    //Undoes the extension of the path by its element iPath
+    static void unwindPath(PathElement * path, size_t depth, size_t iPath)
+    {
+        const algorithmFPType oneFraction  = path[iPath].oneFraction;
+        const algorithmFPType zeroFraction = path[iPath].zeroFraction;
+        algorithmFPType nextOnePortion     = path[depth].pweight;
+        for (size_t i = depth; i-- > 0;)
+        {
+            if (oneFraction != 0)
+            {
+                const algorithmFPType pweight = path[i].pweight;
+                path[i].pweight               = nextOnePortion * algorithmFPType(depth + 1) / (algorithmFPType(i + 1) * oneFraction);
+                nextOnePortion                = pweight - path[i].pweight * zeroFraction * algorithmFPType(depth - i) / algorithmFPType(depth + 1);
+            }
+            else
+            {
+                path[i].pweight = path[i].pweight * algorithmFPType(depth + 1) / (zeroFraction * algorithmFPType(depth - i));
+            }
+        }
+        for (size_t i = iPath; i < depth; ++i)
+        {
+            path[i].featureIndex = path[i + 1].featureIndex;
+            path[i].zeroFraction = path[i + 1].zeroFraction;
+            path[i].oneFraction  = path[i + 1].oneFraction;
+        }
+    }
+
+    //Total weight of the path unwound by its element iPath, the path itself is not modified
+    static algorithmFPType unwoundPathSum(const PathElement * path, size_t depth, size_t iPath)
+    {
+        const algorithmFPType oneFraction  = path[iPath].oneFraction;
+        const algorithmFPType zeroFraction = path[iPath].zeroFraction;
+        algorithmFPType nextOnePortion     = path[depth].pweight;
+        algorithmFPType total              = 0;
+        for (size_t i = depth; i-- > 0;)
+        {
+            if (oneFraction != 0)
+            {
+                const algorithmFPType pweight = nextOnePortion * algorithmFPType(depth + 1) / (algorithmFPType(i + 1) * oneFraction);
+                total += pweight;
+                nextOnePortion = path[i].pweight - pweight * zeroFraction * algorithmFPType(depth - i) / algorithmFPType(depth + 1);
+            }
+            else if (zeroFraction != 0)
+            {
+                total += path[i].pweight * algorithmFPType(depth + 1) / (zeroFraction * algorithmFPType(depth - i));
+            }
+        }
+        return total;
+    }
+
+    static void explainNode(const TreeType & t, const FeatureTypes & featTypes, const algorithmFPType * x, algorithmFPType factor, size_t iNode,
+                            size_t lvl, PathElement * parentPath, size_t depth, algorithmFPType zeroFraction, algorithmFPType oneFraction,
+                            int featureIndex, algorithmFPType * phi)
+    {
+        //the path of the node is stored in the buffer next to the path of its parent
+        PathElement * path = parentPath + depth + 1;
+        for (size_t i = 0; i < depth; ++i) path[i] = parentPath[i];
+        extendPath(path, depth, zeroFraction, oneFraction, featureIndex);
+
+        if (t.isLeaf(iNode, lvl))
+        {
+            const algorithmFPType response = factor * algorithmFPType(t.response(iNode));
+            for (size_t i = 1; i <= depth; ++i)
+            {
+                const algorithmFPType w = unwoundPathSum(path, depth, i);
+                phi[path[i].featureIndex] += w * (path[i].oneFraction - path[i].zeroFraction) * response;
+            }
+            return;
+        }
+
+        const int iFeature                 = t.featureIndex(iNode);
+        const algorithmFPType featureValue = algorithmFPType(t.featureValue(iNode));
+        const bool bRight = featTypes.isUnordered(iFeature) ? (int(x[iFeature]) != int(featureValue)) : (x[iFeature] > featureValue);
+        const size_t iHot  = bRight ? t.right(iNode) : t.left(iNode);
+        const size_t iCold = bRight ? t.left(iNode) : t.right(iNode);
+        const algorithmFPType hotZeroFraction = fraction(t, iHot, iCold);
+
+        //the split on the feature that is already in the path is undone to be redone at this node
+        algorithmFPType incomingZeroFraction = 1;
+        algorithmFPType incomingOneFraction  = 1;
+        size_t iPath                         = 1;
+        for (; (iPath <= depth) && (path[iPath].featureIndex != iFeature); ++iPath)
+            ;
+        if (iPath <= depth)
+        {
+            incomingZeroFraction = path[iPath].zeroFraction;
+            incomingOneFraction  = path[iPath].oneFraction;
+            unwindPath(path, depth, iPath);
+            --depth;
+        }
+
+        explainNode(t, featTypes, x, factor, iHot, lvl + 1, path, depth + 1, hotZeroFraction * incomingZeroFraction, incomingOneFraction, iFeature,
+                    phi);
+        explainNode(t, featTypes, x, factor, iCold, lvl + 1, path, depth + 1, (algorithmFPType(1) - hotZeroFraction) * incomingZeroFraction,
+                    algorithmFPType(0), iFeature, phi);
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Access to the nodes of DecisionTreeTable by TreeSHAP algorithm
+//////////////////////////////////////////////////////////////////////////////////////////
+struct DecisionTreeShapView
+{
+    const DecisionTreeNode * nodes;
+    const int * nodeSampleCount;
+
+    bool isLeaf(size_t iNode, size_t /*lvl*/) const { return !nodes[iNode].isSplit(); }
+    size_t left(size_t iNode) const { return size_t(nodes[iNode].leftIndexOrClass); }
+    size_t right(size_t iNode) const { return size_t(nodes[iNode].leftIndexOrClass) + 1; }
+    int featureIndex(size_t iNode) const { return nodes[iNode].featureIndex; }
+    ModelFPType featureValue(size_t iNode) const { return nodes[iNode].featureValue(); }
+    ModelFPType response(size_t iNode) const { return nodes[iNode].featureValueOrResponse; }
+    size_t cover(size_t iNode) const { return size_t(nodeSampleCount[iNode]); }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Access to the nodes of the classification DecisionTreeTable by TreeSHAP algorithm, the response
+// of a leaf is the probability of the given class: the fraction of the class in the leaf if the
+// class probabilities are given, 1 if the leaf votes for the class and 0 otherwise if they are not
+//////////////////////////////////////////////////////////////////////////////////////////
+struct DecisionTreeClassShapView : public DecisionTreeShapView
+{
+    const double * probas;
+    size_t nClasses;
+    size_t iClass;
+
+    ModelFPType response(size_t iNode) const
+    {
+        return probas ? ModelFPType(probas[iNode * nClasses + iClass]) : ModelFPType(size_t(nodes[iNode].leftIndexOrClass) == iClass);
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Computes the contributions of the features to the weighted sum of the responses of the trees.
+// The row i of the result contains the contributions of the features of the observation i
+// followed by the expected value of the prediction (bias), they sum up to the prediction.
+// The values are written to the columns of the result starting from iFirstColumn, the other
+// columns are not modified, that allows to store the contributions to several predictions.
+// The work is split into the blocks of rows, the trees are split into blocks as well
+// if the number of the row blocks is not enough to load all the threads.
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, typename TreeType, CpuType cpu>
+services::Status computeContributions(const TreeType * aTree, size_t nTrees, const FeatureTypes & featTypes, const NumericTable * x,
+                                      algorithmFPType factor, NumericTable * contributions, size_t iFirstColumn = 0)
+{
+    typedef TreeShap<algorithmFPType, TreeType, cpu> TreeShapType;
+    typedef typename TreeShapType::PathElement PathElement;
+
+    const size_t nRows        = x->getNumberOfRows();
+    const size_t nCols        = x->getNumberOfColumns();
+    const size_t nOut         = nCols + 1;
+    const size_t nResCols     = contributions->getNumberOfColumns();
+    const size_t nRowsInBlock = 64;
+    const size_t nThreads     = daal::threader_get_threads_number();
+    DAAL_ASSERT(nTrees);
+    DAAL_ASSERT(iFirstColumn + nOut <= nResCols);
+    if (!nRows) return services::Status();
+
+    TArray<algorithmFPType, cpu> aExpectedValue(nTrees);
+    TArray<size_t, cpu> aDepth(nTrees);
+    DAAL_CHECK_MALLOC(aExpectedValue.get() && aDepth.get());
+    daal::threader_for(nTrees, nTrees, [&](size_t iTree) {
+        aExpectedValue[iTree] = TreeShapType::expectedValue(aTree[iTree]);
+        aDepth[iTree]         = TreeShapType::depth(aTree[iTree]);
+    });
+    algorithmFPType bias = 0;
+    size_t maxDepth      = 0;
+    for (size_t iTree = 0; iTree < nTrees; ++iTree)
+    {
+        bias += factor * aExpectedValue[iTree];
+        if (aDepth[iTree] > maxDepth) maxDepth = aDepth[iTree];
+    }
+    const size_t pathSize = TreeShapType::pathSize(maxDepth);
+
+    const size_t nRowBlocks = nRows / nRowsInBlock + !!(nRows % nRowsInBlock);
+    size_t nTreeBlocks      = (nRowBlocks < nThreads) ? (nThreads / nRowBlocks + !!(nThreads % nRowBlocks)) : 1;
+    if (nTreeBlocks > nTrees) nTreeBlocks = nTrees;
+    const size_t nTreesInBlock = nTrees / nTreeBlocks + !!(nTrees % nTreeBlocks);
+    nTreeBlocks                = nTrees / nTreesInBlock + !!(nTrees % nTreesInBlock);
+
+    //the contributions of the tree blocks are accumulated separately, the number of rows is small in this case
+    TArrayCalloc<algorithmFPType, cpu> aPartial(nTreeBlocks > 1 ? nTreeBlocks * nRows * nOut : 0);
+    DAAL_CHECK_MALLOC(nTreeBlocks == 1 || aPartial.get());
+
+    SafeStatus safeStat;
+    daal::threader_for(nRowBlocks * nTreeBlocks, nRowBlocks * nTreeBlocks, [&](size_t iTask) {
+        const size_t iBlock         = iTask / nTreeBlocks;
+        const size_t iTreeBlock     = iTask % nTreeBlocks;
+        const size_t iStartRow      = iBlock * nRowsInBlock;
+        const size_t nRowsToProcess = (iBlock == nRowBlocks - 1) ? nRows - iStartRow : nRowsInBlock;
+        const size_t iFirstTree     = iTreeBlock * nTreesInBlock;
+        const size_t iLastTree      = (iTreeBlock == nTreeBlocks - 1) ? nTrees : iFirstTree + nTreesInBlock;
+
+        ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(x), iStartRow, nRowsToProcess);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+        TArray<PathElement, cpu> path(pathSize);
+        DAAL_CHECK_MALLOC_THR(path.get());
+
+        WriteRows<algorithmFPType, cpu> resBD;
+        algorithmFPType * phi = nullptr;
+        size_t phiStride      = nOut;
+        if (nTreeBlocks == 1)
+        {
+            resBD.set(contributions, iStartRow, nRowsToProcess);
+            DAAL_CHECK_BLOCK_STATUS_THR(resBD);
+            phi       = resBD.get() + iFirstColumn;
+            phiStride = nResCols;
+            for (size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
+                services::internal::service_memset_seq<algorithmFPType, cpu>(phi + iRow * phiStride, algorithmFPType(0), nOut);
+        }
+        else
+        {
+            phi = aPartial.get() + (iTreeBlock * nRows + iStartRow) * nOut;
+        }
+
+        //the tree is explained for all the rows of the block while it is in cache
+        for (size_t iTree = iFirstTree; iTree < iLastTree; ++iTree)
+        {
+            for (size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
+                TreeShapType::explain(aTree[iTree], featTypes, xBD.get() + iRow * nCols, factor, path.get(), phi + iRow * phiStride);
+        }
+        if (nTreeBlocks == 1)
+        {
+            for (size_t iRow = 0; iRow < nRowsToProcess; ++iRow) phi[iRow * phiStride + nCols] = bias;
+        }
+    });
+    services::Status s = safeStat.detach();
+    if (!s || nTreeBlocks == 1) return s;
+
+    WriteRows<algorithmFPType, cpu> resBD(contributions, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(resBD);
+    algorithmFPType * res = resBD.get();
+    daal::threader_for(nRows, nRows, [&](size_t iRow) {
+        algorithmFPType * phi = res + iRow * nResCols + iFirstColumn;
+        services::internal::service_memset<algorithmFPType, cpu>(phi, 0, nOut);
+        for (size_t iTreeBlock = 0; iTreeBlock < nTreeBlocks; ++iTreeBlock)
+        {
+            const algorithmFPType * partialPhi = aPartial.get() + (iTreeBlock * nRows + iRow) * nOut;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nCols; ++j) phi[j] += partialPhi[j];
+        }
+        phi[nCols] = bias;
+    });
+    return s;
+}
+
+} /* namespace internal */
+} /* namespace prediction */
+} /* namespace dtrees */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
@@ -0,0 +1,194 @@
+/* file: df_classification_low_latency_predictor.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the low latency predictor of the decision forest classification model
+//--
+*/
+
+#include "algorithms/decision_forest/decision_forest_classification_low_latency_predictor.h"
+#include "src/algorithms/dtrees/forest/classification/df_classification_model_impl.h"
+#include "src/algorithms/dtrees/forest/df_low_latency_predictor_impl.h"
+#include "src/services/service_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace classification
+{
+namespace prediction
+{
+namespace interface1
+{
+using decision_forest::internal::LOW_LATENCY_BLOCK_SIZE;
+
+class LowLatencyPredictor::PredictorImpl
+{
+public:
+    PredictorImpl(const ModelPtr & model, size_t nClasses, VotingMethod votingMethod)
+        : _model(model), _nClasses(nClasses), _votingMethod(votingMethod)
+    {}
+
+    services::Status init(const data_management::NumericTable * featureTypes)
+    {
+        const decision_forest::classification::internal::ModelImpl * const pModel =
+            static_cast<const decision_forest::classification::internal::ModelImpl *>(_model.get());
+        DAAL_CHECK(_nClasses > 1, services::ErrorIncorrectNumberOfClasses);
+        DAAL_CHECK(_votingMethod == weighted || _votingMethod == unweighted, services::ErrorIncorrectParameter);
+
+        _votes.reset(LOW_LATENCY_BLOCK_SIZE * _nClasses);
+        DAAL_CHECK_MALLOC(_votes.get());
+        DAAL_CHECK_STATUS_VAR(_scorer.init(*pModel, pModel->getNumberOfFeatures(), featureTypes));
+
+        /* Probabilities of the classes in the leaves are used by the weighted voting only */
+        const size_t nTrees = _scorer.getNumberOfTrees();
+        _probas.reset(nTrees);
+        DAAL_CHECK_MALLOC(_probas.get());
+        for (size_t iTree = 0; iTree < nTrees; ++iTree) _probas[iTree] = (_votingMethod == weighted) ? pModel->getProbas(iTree) : nullptr;
+        return services::Status();
+    }
+
+    template <typename algorithmFPType>
+    services::Status predict(const algorithmFPType * x, size_t nRows, algorithmFPType * labels, algorithmFPType * probabilities)
+    {
+        DAAL_CHECK(x && (labels || probabilities), services::ErrorNullPtr);
+        const size_t nFeatures = _scorer.getNumberOfFeatures();
+        for (size_t iStart = 0; iStart < nRows; iStart += LOW_LATENCY_BLOCK_SIZE)
+        {
+            const size_t nBlockRows = (nRows - iStart < LOW_LATENCY_BLOCK_SIZE) ? nRows - iStart : LOW_LATENCY_BLOCK_SIZE;
+            algorithmFPType * const votes = reinterpret_cast<algorithmFPType *>(_votes.get());
+            vote(x + iStart * nFeatures, nBlockRows, votes);
+            for (size_t iRow = 0; iRow < nBlockRows; ++iRow)
+            {
+                const algorithmFPType * const val = votes + iRow * _nClasses;
+                if (labels) labels[iStart + iRow] = algorithmFPType(services::internal::getMaxElementIndex<algorithmFPType, sse2>(val, _nClasses));
+                if (probabilities)
+                {
+                    algorithmFPType * const prob = probabilities + (iStart + iRow) * _nClasses;
+                    for (size_t iClass = 0; iClass < _nClasses; ++iClass) prob[iClass] = val[iClass];
+                }
+            }
+        }
+        return services::Status();
+    }
+
+    size_t getNumberOfFeatures() const { return _scorer.getNumberOfFeatures(); }
+
+private:
+    // Computes the normalized votes of the trees for the classes, in the same way as prediction::Batch does
+    template <typename algorithmFPType>
+    void vote(const algorithmFPType * x, size_t nRows, algorithmFPType * votes) const
+    {
+        services::internal::service_memset_seq<algorithmFPType, sse2>(votes, algorithmFPType(0), nRows * _nClasses);
+        const size_t nTrees                     = _scorer.getNumberOfTrees();
+        const algorithmFPType inverseTreesCount = algorithmFPType(1) / algorithmFPType(nTrees);
+        const dtrees::internal::DecisionTreeNode * leaves[LOW_LATENCY_BLOCK_SIZE];
+        for (size_t iTree = 0; iTree < nTrees; ++iTree)
+        {
+            const dtrees::internal::DecisionTreeNode * const top = _scorer.getNodes(iTree);
+            const double * const probas                          = _probas[iTree];
+            // all the rows are scored by the tree while it stays in cache
+            _scorer.findLeaves(iTree, x, nRows, leaves);
+            for (size_t iRow = 0; iRow < nRows; ++iRow)
+            {
+                const dtrees::internal::DecisionTreeNode * const pNode = leaves[iRow];
+                algorithmFPType * const val                            = votes + iRow * _nClasses;
+                if (probas)
+                {
+                    const double * const leafProbas = probas + (pNode - top) * _nClasses;
+                    for (size_t iClass = 0; iClass < _nClasses; ++iClass) val[iClass] += leafProbas[iClass];
+                }
+                else
+                {
+                    val[pNode->leftIndexOrClass] += inverseTreesCount;
+                }
+            }
+        }
+
+        for (size_t iRow = 0; iRow < nRows; ++iRow)
+        {
+            algorithmFPType * const val = votes + iRow * _nClasses;
+            algorithmFPType sum(0);
+            for (size_t iClass = 0; iClass < _nClasses; ++iClass) sum += val[iClass];
+            if (sum <= algorithmFPType(0)) continue;
+            for (size_t iClass = 0; iClass < _nClasses; ++iClass) val[iClass] /= sum;
+        }
+    }
+
+private:
+    ModelPtr _model;
+    size_t _nClasses;
+    VotingMethod _votingMethod;
+    decision_forest::internal::LowLatencyScorer _scorer;
+    /* Probabilities of the classes in the leaves of the trees, null for unweighted voting */
+    daal::internal::TArray<const double *, sse2> _probas;
+    /* Votes for the block of rows, large enough for both float and double */
+    daal::internal::TArray<double, sse2> _votes;
+};
+
+LowLatencyPredictor::LowLatencyPredictor(const ModelPtr & model, size_t nClasses, VotingMethod votingMethod)
+    : LowLatencyPredictor(model, data_management::NumericTablePtr(), nClasses, votingMethod)
+{}
+
+LowLatencyPredictor::LowLatencyPredictor(const ModelPtr & model, const data_management::NumericTablePtr & featureTypes, size_t nClasses,
+                                         VotingMethod votingMethod)
+    : _impl(nullptr)
+{
+    if (!model.get())
+    {
+        _status |= services::ErrorNullModel;
+    }
+    else
+    {
+        _impl = new PredictorImpl(model, nClasses, votingMethod);
+        _status |= _impl->init(featureTypes.get());
+    }
+    services::throwIfPossible(_status);
+}
+
+LowLatencyPredictor::~LowLatencyPredictor()
+{
+    delete _impl;
+}
+
+services::Status LowLatencyPredictor::predict(const float * x, size_t nRows, float * labels, float * probabilities)
+{
+    DAAL_CHECK(_status.ok(), services::ErrorModelNotFullInitialized);
+    return _impl->predict(x, nRows, labels, probabilities);
+}
+
+services::Status LowLatencyPredictor::predict(const double * x, size_t nRows, double * labels, double * probabilities)
+{
+    DAAL_CHECK(_status.ok(), services::ErrorModelNotFullInitialized);
+    return _impl->predict(x, nRows, labels, probabilities);
+}
+
+size_t LowLatencyPredictor::getNumberOfFeatures() const
+{
+    return _impl ? _impl->getNumberOfFeatures() : 0;
+}
+
+} // namespace interface1
+} // namespace prediction
+} // namespace classification
+} // namespace decision_forest
+} // namespace algorithms
+} // namespace daal
@@ -60,10 +60,13 @@ public:
      *  \param a[in]    Matrix of input variables X
      *  \param m[in]    decision forest model obtained on training stage
      *  \param r[out]   Prediction results
+     *  \param prob[out]   Probabilities of the classes
+     *  \param contributions[out]  Contributions of the features to the probabilities of the classes
      *  \param par[in]  decision forest algorithm parameters
      */
-    services::Status compute(services::HostAppIface * const pHostApp, const NumericTable * a, const decision_forest::classification::Model * const m,
-                             NumericTable * const r, NumericTable * const prob, const size_t nClasses, const VotingMethod votingMethod);
+    services::Status compute(services::HostAppIface * const pHostApp, const NumericTable * a, const decision_forest::classification::ModelPtr & m,
+                             NumericTable * const r, NumericTable * const prob, NumericTable * const contributions, const size_t nClasses,
+                             const VotingMethod votingMethod);
     PredictClassificationTask<algorithmFpType, cpu> * _task;
 
 private:
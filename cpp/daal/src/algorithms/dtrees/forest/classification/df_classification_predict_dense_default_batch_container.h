@@ -68,12 +68,12 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     auto & context    = services::internal::getDefaultContext();
     auto & deviceInfo = context.getInfoDevice();
 
-    const Input * const input                     = static_cast<Input *>(_in);
-    classifier::prediction::Result * const result = static_cast<classifier::prediction::Result *>(_res);
+    const Input * const input = static_cast<Input *>(_in);
+    Result * const result     = static_cast<Result *>(_res);
     const decision_forest::classification::prediction::Parameter * const par =
         dynamic_cast<decision_forest::classification::prediction::Parameter *>(_par);
-    const decision_forest::classification::Model * const m =
-        static_cast<decision_forest::classification::Model *>(input->get(classifier::prediction::model).get());
+    const decision_forest::classification::ModelPtr m =
+        services::staticPointerCast<decision_forest::classification::Model, classifier::Model>(input->get(classifier::prediction::model));
 
     const NumericTable * const a = static_cast<NumericTable *>(input->get(classifier::prediction::data).get());
     NumericTable * const r =
@@ -82,6 +82,8 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     NumericTable * const prob = ((par->resultsToEvaluate & classifier::ResultToComputeId::computeClassProbabilities) ?
                                      result->get(classifier::prediction::probabilities).get() :
                                      nullptr);
+    NumericTable * const contributions =
+        ((par->resultsToCompute & computeFeatureContributions) ? result->get(featureContributions).get() : nullptr);
 
     const daal::services::Environment::env & env = *_env;
 
@@ -89,13 +91,15 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     if (!deviceInfo.isCpu)
     {
+        if (contributions) return services::Status(services::ErrorMethodNotSupported);
         __DAAL_CALL_KERNEL_SYCL(env, internal::PredictKernelOneAPI, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
-                                daal::services::internal::hostApp(*const_cast<Input *>(input)), a, m, r, prob, par->nClasses, votingMethod);
+                                daal::services::internal::hostApp(*const_cast<Input *>(input)), a, m.get(), r, prob, par->nClasses, votingMethod);
     }
     else
     {
         __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
-                           daal::services::internal::hostApp(*const_cast<Input *>(input)), a, m, r, prob, par->nClasses, votingMethod);
+                           daal::services::internal::hostApp(*const_cast<Input *>(input)), a, m, r, prob, contributions, par->nClasses,
+                           votingMethod);
     }
 }
 } // namespace interface3
@@ -33,6 +33,7 @@
 #include "src/data_management/service_numeric_table.h"
 #include "src/externals/service_memory.h"
 #include "src/algorithms/dtrees/dtrees_predict_dense_default_impl.i"
+#include "src/algorithms/dtrees/dtrees_predict_shap_impl.i"
 #include "src/algorithms/service_error_handling.h"
 #include "src/services/service_arrays.h"
 #include "algorithms/decision_forest/decision_forest_classification_model.h"
@@ -62,10 +63,20 @@ typedef int32_t featureIndexType;
 #define _MIN_TREES_FOR_THREADING                 100
 #define _SCALE_FACTOR_FOR_VECT_PARALLEL_COMPUTE  0.3 /* scale tree size to chose whethever vectorized or not compute path in parallel mode */
 #define _MIN_NUMBER_OF_ROWS_FOR_VECT_SEQ_COMPUTE 32  /* min number of rows to be predicted by vectorized compute path in sequential mode */
+#define _ARENA_TREE_ALIGNMENT                    16  /* number of nodes the offsets of the trees in the arena are multiple of, keeps roots cache line aligned */
+
+/* Node of the forest arena. The fields used on every step of the traversal are stored together */
+template <typename algorithmFPType>
+struct ArenaNode
+{
+    algorithmFPType featureValue;      /* split: feature value */
+    featureIndexType featureIndex;     /* split: index of the feature, leaf: -1 */
+    leftOrClassType leftIndexOrClass;  /* split: left node index in the tree, leaf: class index */
+};
 
 template <typename algorithmFPType, CpuType cpu>
 DAAL_FORCEINLINE void fillResults(const size_t nClasses, const enum VotingMethod votingMethod, const size_t blockSize, const double * const probas,
-                                  const leftOrClassType * const classes, const uint32_t * const leafsIndexes, algorithmFPType * const resPtr)
+                                  const ArenaNode<algorithmFPType> * const nodes, const uint32_t * const leafsIndexes, algorithmFPType * const resPtr)
 {
     if (votingMethod == VotingMethod::unweighted || probas == nullptr)
     {
@@ -73,7 +84,7 @@ DAAL_FORCEINLINE void fillResults(const size_t nClasses, const enum VotingMethod
         PRAGMA_VECTOR_ALWAYS
         for (size_t i = 0; i < blockSize; ++i)
         {
-            const size_t cl = classes[leafsIndexes[i]];
+            const size_t cl = nodes[leafsIndexes[i]].leftIndexOrClass;
             ++resPtr[i * nClasses + cl];
         }
     }
@@ -100,6 +111,7 @@ class PredictClassificationTask
 protected:
     typedef dtrees::internal::TreeImpClassification<> TreeType;
     typedef dtrees::prediction::internal::TileDimensions<algorithmFPType> DimType;
+    typedef ArenaNode<algorithmFPType> ArenaNodeType;
     typedef daal::tls<algorithmFPType *> ClassesCounterTlsBase;
     class ClassesCounterTls : public ClassesCounterTlsBase
     {
@@ -125,23 +137,24 @@ public:
           _votingMethod(lastResultId),
           _sumTreeSize(0),
           _cachedData(nullptr),
-          _cachedModel(nullptr),
           _averageTreeSize(0),
           _cachedNClasses(0)
     {}
 
-    void setParams(const NumericTable * const x, NumericTable * const y, NumericTable * const prob, const dtrees::internal::ModelImpl * const m,
-                   const size_t nClasses, const VotingMethod votingMethod)
+    void setParams(const NumericTable * const x, NumericTable * const y, NumericTable * const prob,
+                   const decision_forest::classification::ModelPtr & m, const size_t nClasses, const VotingMethod votingMethod)
     {
         _data         = x;
         _res          = y;
         _prob         = prob;
-        _model        = m;
+        _modelPtr     = m;
+        _model        = static_cast<const daal::algorithms::decision_forest::classification::internal::ModelImpl *>(m.get());
         _nClasses     = nClasses;
         _votingMethod = votingMethod;
     }
 
     Status run(services::HostAppIface * pHostApp);
+    Status runContributions(NumericTable * const contributions);
 
 protected:
     void predictByTrees(const size_t iFirstTree, const size_t nTrees, const algorithmFPType * const x, algorithmFPType * const resPtr,
@@ -150,14 +163,16 @@ protected:
     void predictByTreesWithoutConversion(const size_t iFirstTree, const size_t nTrees, const algorithmFPType * const x, double * const prob,
                                          const size_t nTreesTotal);
 
-    void predictByTree(const algorithmFPType * const x, const size_t sizeOfBlock, const size_t nCols, const featureIndexType * const tFI,
-                       const leftOrClassType * const tLC, const algorithmFPType * const tFV, algorithmFPType * const prob, const size_t iTree);
+    void predictByTree(const algorithmFPType * const x, const size_t sizeOfBlock, const size_t nCols, const ArenaNodeType * const nodes,
+                       algorithmFPType * const prob, const size_t iTree);
+
+    void predictByTreeCommon(const algorithmFPType * const x, const size_t sizeOfBlock, const size_t nCols, const ArenaNodeType * const nodes,
+                             algorithmFPType * const prob, const size_t iTree);
 
-    void predictByTreeCommon(const algorithmFPType * const x, const size_t sizeOfBlock, const size_t nCols, const featureIndexType * const fi,
-                             const leftOrClassType * const lc, const algorithmFPType * const fv, algorithmFPType * const prob, const size_t iTree);
+    void parallelPredict(const algorithmFPType * const aX, const ArenaNodeType * const nodes, const size_t nBlocks, const size_t nCols,
+                         const size_t blockSize, const size_t residualSize, algorithmFPType * const prob, const size_t iTree);
 
-    void parallelPredict(const algorithmFPType * const aX, const DecisionTreeNode * const aNode, const size_t treeSize, const size_t nBlocks,
-                         const size_t nCols, const size_t blockSize, const size_t residualSize, algorithmFPType * const prob, const size_t iTree);
+    Status buildArena(const size_t nTreesTotal);
 
     Status predictByAllTrees(const size_t nTreesTotal, const DimType & dim);
 
@@ -179,9 +194,8 @@ protected:
     }
 
     DAAL_FORCEINLINE void predictByTreeInternal(size_t check, const size_t blockSize, const size_t nCols, uint32_t * const currentNodes,
-                                                bool * const isSplits, const algorithmFPType * const x, const featureIndexType * const fi,
-                                                const leftOrClassType * const lc, const algorithmFPType * const fv, algorithmFPType * const resPtr,
-                                                const size_t iTree)
+                                                bool * const isSplits, const algorithmFPType * const x, const ArenaNodeType * const nodes,
+                                                algorithmFPType * const resPtr, const size_t iTree)
     {
         for (; check > 0;)
         {
@@ -190,15 +204,19 @@ protected:
             {
                 const algorithmFPType * const currentSample = x + i * nCols;
                 const uint32_t cnIdx                        = currentNodes[i];
-                const size_t idx                            = isSplits[i] * fi[cnIdx];
-                const bool sn                               = currentSample[idx] > fv[cnIdx];
-                currentNodes[i] -= isSplits[i] * (cnIdx - lc[cnIdx] - sn);
-                isSplits[i] = (fi[currentNodes[i]] != -1);
+                const ArenaNodeType & node                  = nodes[cnIdx];
+                const size_t idx                            = isSplits[i] * node.featureIndex;
+                const bool sn                               = currentSample[idx] > node.featureValue;
+                currentNodes[i] -= isSplits[i] * (cnIdx - node.leftIndexOrClass - sn);
+                const ArenaNodeType & next = nodes[currentNodes[i]];
+                isSplits[i]                = (next.featureIndex != -1);
                 check += isSplits[i];
+                /* Both children of the next node are adjacent, request them while the other rows of the block are processed */
+                DAAL_PREFETCH_READ_T0(nodes + isSplits[i] * next.leftIndexOrClass);
             }
         }
         const double * probas = _model->getProbas(iTree);
-        fillResults<algorithmFPType, cpu>(_nClasses, _votingMethod, blockSize, probas, lc, currentNodes, resPtr);
+        fillResults<algorithmFPType, cpu>(_nClasses, _votingMethod, blockSize, probas, nodes, currentNodes, resPtr);
     }
 
 protected:
@@ -208,7 +226,8 @@ protected:
     NumericTable * _res;
     NumericTable * _prob;
     const dtrees::internal::ModelImpl * _model;
-    const dtrees::internal::ModelImpl * _cachedModel;
+    decision_forest::classification::ModelPtr _modelPtr;
+    decision_forest::classification::ModelPtr _cachedModel; /* Model the trees in _aTree are taken from */
     size_t _nClasses;
     size_t _cachedNClasses;
     VotingMethod _votingMethod;
@@ -226,6 +245,9 @@ protected:
     WriteOnlyRows<algorithmFPType, cpu> _resBD;
     WriteOnlyRows<algorithmFPType, cpu> _probBD;
     ReadRows<algorithmFPType, cpu> _xBD;
+    decision_forest::classification::ModelPtr _arenaModel;       /* Model the arena was built for, referenced while the arena is cached */
+    services::internal::TArray<ArenaNodeType, cpu> _arena;       /* Nodes of all the trees of the model */
+    services::internal::TArray<size_t, cpu> _arenaOffsets;       /* Offsets of the roots of the trees in the arena */
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -242,15 +264,45 @@ PredictKernel<algorithmFPType, method, cpu>::~PredictKernel()
 
 template <typename algorithmFPType, prediction::Method method, CpuType cpu>
 services::Status PredictKernel<algorithmFPType, method, cpu>::compute(services::HostAppIface * const pHostApp, const NumericTable * const x,
-                                                                      const decision_forest::classification::Model * const m, NumericTable * const r,
-                                                                      NumericTable * const prob, const size_t nClasses,
-                                                                      const VotingMethod votingMethod)
+                                                                      const decision_forest::classification::ModelPtr & m, NumericTable * const r,
+                                                                      NumericTable * const prob, NumericTable * const contributions,
+                                                                      const size_t nClasses, const VotingMethod votingMethod)
 {
-    const daal::algorithms::decision_forest::classification::internal::ModelImpl * const pModel =
-        static_cast<const daal::algorithms::decision_forest::classification::internal::ModelImpl * const>(m);
     if (_task == nullptr) _task = new PredictClassificationTask<algorithmFPType, cpu>();
-    _task->setParams(x, r, prob, pModel, nClasses, votingMethod);
-    return _task->run(pHostApp);
+    _task->setParams(x, r, prob, m, nClasses, votingMethod);
+    Status s = _task->run(pHostApp);
+    if (s && contributions) s = _task->runContributions(contributions);
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status PredictClassificationTask<algorithmFPType, cpu>::runContributions(NumericTable * const contributions)
+{
+    typedef dtrees::prediction::internal::DecisionTreeClassShapView TreeType;
+    const size_t nTreesTotal = _model->size();
+    TArray<TreeType, cpu> aTree(nTreesTotal);
+    DAAL_CHECK_MALLOC(aTree.get());
+    for (size_t iTree = 0; iTree < nTreesTotal; ++iTree)
+    {
+        aTree[iTree].nodes           = (const dtrees::internal::DecisionTreeNode *)_model->at(iTree)->getArray();
+        aTree[iTree].nodeSampleCount = _model->getNodeSampleCount(iTree);
+        aTree[iTree].probas          = (_votingMethod == VotingMethod::weighted) ? _model->getProbas(iTree) : nullptr;
+        aTree[iTree].nClasses        = _nClasses;
+        DAAL_CHECK(aTree[iTree].nodes && aTree[iTree].nodeSampleCount && aTree[iTree].nodeSampleCount[0] > 0, services::ErrorModelNotFullInitialized);
+    }
+
+    /* The probability of the second class explains the binary classification, each class gets its own block of columns otherwise */
+    const size_t nCols        = _data->getNumberOfColumns() + 1;
+    const size_t iFirstClass  = (_nClasses == 2) ? 1 : 0;
+    const algorithmFPType div = algorithmFPType(1) / algorithmFPType(nTreesTotal);
+    Status s;
+    for (size_t iClass = iFirstClass; s && iClass < _nClasses; ++iClass)
+    {
+        for (size_t iTree = 0; iTree < nTreesTotal; ++iTree) aTree[iTree].iClass = iClass;
+        s = dtrees::prediction::internal::computeContributions<algorithmFPType, TreeType, cpu>(aTree.get(), nTreesTotal, _featHelper, _data, div,
+                                                                                              contributions, (iClass - iFirstClass) * nCols);
+    }
+    return s;
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -365,45 +417,63 @@ void PredictClassificationTask<algorithmFPType, cpu>::predictByTreesWithoutConve
 }
 
 template <typename algorithmFPType, CpuType cpu>
-void PredictClassificationTask<algorithmFPType, cpu>::parallelPredict(const algorithmFPType * const aX, const DecisionTreeNode * const aNode,
-                                                                      const size_t treeSize, const size_t nBlocks, const size_t nCols,
-                                                                      const size_t blockSize, const size_t residualSize, algorithmFPType * const prob,
-                                                                      const size_t iTree)
+Status PredictClassificationTask<algorithmFPType, cpu>::buildArena(const size_t nTreesTotal)
 {
-    services::internal::TArray<featureIndexType, cpu> tFI(treeSize);
-    services::internal::TArray<leftOrClassType, cpu> tLC(treeSize);
-    services::internal::TArray<algorithmFPType, cpu> tFV(treeSize);
-
-    featureIndexType * const fi = tFI.get();
-    leftOrClassType * const lc  = tLC.get();
-    algorithmFPType * const fv  = tFV.get();
-
-    PRAGMA_IVDEP
-    PRAGMA_VECTOR_ALWAYS
-    for (size_t i = 0; i < treeSize; ++i)
+    if (_arenaModel.get() == _modelPtr.get()) return Status();
+    _arenaModel.reset();
+
+    _arenaOffsets.reset(nTreesTotal + 1);
+    DAAL_CHECK_MALLOC(_arenaOffsets.get());
+    size_t * const offsets = _arenaOffsets.get();
+    offsets[0]             = 0;
+    for (size_t iTree = 0; iTree < nTreesTotal; ++iTree)
     {
-        fi[i] = aNode[i].featureIndex;
-        lc[i] = aNode[i].leftIndexOrClass;
-        fv[i] = (algorithmFPType)aNode[i].featureValueOrResponse;
+        const size_t treeSize = _aTree[iTree]->getNumberOfRows();
+        offsets[iTree + 1]    = offsets[iTree] + (treeSize + _ARENA_TREE_ALIGNMENT - 1) / _ARENA_TREE_ALIGNMENT * _ARENA_TREE_ALIGNMENT;
     }
+
+    _arena.reset(offsets[nTreesTotal]);
+    DAAL_CHECK_MALLOC(_arena.get());
+
+    daal::threader_for(nTreesTotal, nTreesTotal, [&](const size_t iTree) {
+        const size_t treeSize                = _aTree[iTree]->getNumberOfRows();
+        const DecisionTreeNode * const aNode = (const DecisionTreeNode *)(*_aTree[iTree]).getArray();
+        ArenaNodeType * const nodes          = _arena.get() + offsets[iTree];
+
+        for (size_t i = 0; i < treeSize; ++i)
+        {
+            nodes[i].featureValue     = (algorithmFPType)aNode[i].featureValueOrResponse;
+            nodes[i].featureIndex     = aNode[i].featureIndex;
+            nodes[i].leftIndexOrClass = aNode[i].leftIndexOrClass;
+        }
+    });
+
+    _arenaModel = _modelPtr;
+    return Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void PredictClassificationTask<algorithmFPType, cpu>::parallelPredict(const algorithmFPType * const aX, const ArenaNodeType * const nodes,
+                                                                      const size_t nBlocks, const size_t nCols, const size_t blockSize,
+                                                                      const size_t residualSize, algorithmFPType * const prob, const size_t iTree)
+{
     daal::threader_for(nBlocks, nBlocks, [&, nCols](const size_t iBlock) {
-        predictByTree(aX + iBlock * blockSize * nCols, blockSize, nCols, fi, lc, fv, prob + iBlock * blockSize * _nClasses, iTree);
+        predictByTree(aX + iBlock * blockSize * nCols, blockSize, nCols, nodes, prob + iBlock * blockSize * _nClasses, iTree);
     });
 
     if (residualSize != 0)
     {
-        predictByTree(aX + nBlocks * blockSize * nCols, residualSize, nCols, fi, lc, fv, prob + nBlocks * blockSize * _nClasses, iTree);
+        predictByTree(aX + nBlocks * blockSize * nCols, residualSize, nCols, nodes, prob + nBlocks * blockSize * _nClasses, iTree);
     }
 }
 
 template <typename algorithmFPType, CpuType cpu>
 void PredictClassificationTask<algorithmFPType, cpu>::predictByTreeCommon(const algorithmFPType * const x, const size_t sizeOfBlock,
-                                                                          const size_t nCols, const featureIndexType * const fi,
-                                                                          const leftOrClassType * const lc, const algorithmFPType * const fv,
+                                                                          const size_t nCols, const ArenaNodeType * const nodes,
                                                                           algorithmFPType * const prob, const size_t iTree)
 {
     size_t check = 0;
-    check        = fi[0] != -1;
+    check        = nodes[0].featureIndex != -1;
 
     /* done for unrollig */
     if (sizeOfBlock == _DEFAULT_BLOCK_SIZE_COMMON)
@@ -412,7 +482,7 @@ void PredictClassificationTask<algorithmFPType, cpu>::predictByTreeCommon(const
         bool isSplits[_DEFAULT_BLOCK_SIZE_COMMON];
         services::internal::service_memset_seq<uint32_t, cpu>(currentNodes, uint32_t(0), _DEFAULT_BLOCK_SIZE_COMMON);
         services::internal::service_memset_seq<bool, cpu>(isSplits, bool(1), _DEFAULT_BLOCK_SIZE_COMMON);
-        predictByTreeInternal(check, _DEFAULT_BLOCK_SIZE_COMMON, nCols, currentNodes, isSplits, x, fi, lc, fv, prob, iTree);
+        predictByTreeInternal(check, _DEFAULT_BLOCK_SIZE_COMMON, nCols, currentNodes, isSplits, x, nodes, prob, iTree);
     }
     else
     {
@@ -424,26 +494,24 @@ void PredictClassificationTask<algorithmFPType, cpu>::predictByTreeCommon(const
         {
             services::internal::service_memset_seq<uint32_t, cpu>(currentNodes, uint32_t(0), sizeOfBlock);
             services::internal::service_memset_seq<bool, cpu>(isSplits, bool(1), sizeOfBlock);
-            predictByTreeInternal(check, sizeOfBlock, nCols, currentNodes, isSplits, x, fi, lc, fv, prob, iTree);
+            predictByTreeInternal(check, sizeOfBlock, nCols, currentNodes, isSplits, x, nodes, prob, iTree);
         }
     }
 }
 
 template <typename algorithmFPType, CpuType cpu>
 void PredictClassificationTask<algorithmFPType, cpu>::predictByTree(const algorithmFPType * const x, const size_t sizeOfBlock, const size_t nCols,
-                                                                    const featureIndexType * const tFI, const leftOrClassType * const tLC,
-                                                                    const algorithmFPType * const tFV, algorithmFPType * const prob,
+                                                                    const ArenaNodeType * const nodes, algorithmFPType * const prob,
                                                                     const size_t iTree)
 {
-    predictByTreeCommon(x, sizeOfBlock, nCols, tFI, tLC, tFV, prob, iTree);
+    predictByTreeCommon(x, sizeOfBlock, nCols, nodes, prob, iTree);
 }
 
 #if defined(__INTEL_COMPILER)
 
 template <>
 void PredictClassificationTask<float, avx512>::predictByTree(const float * const x, const size_t sizeOfBlock, const size_t nCols,
-                                                             const featureIndexType * const feat_idx, const leftOrClassType * const left_son,
-                                                             const float * const split_point, float * const resPtr, const size_t iTree)
+                                                             const ArenaNodeType * const nodes, float * const resPtr, const size_t iTree)
 {
     if (sizeOfBlock == _DEFAULT_BLOCK_SIZE)
     {
@@ -455,8 +523,10 @@ void PredictClassificationTask<float, avx512>::predictByTree(const float * const
         __m512i offset = _mm512_set_epi32(15 * nCols, 14 * nCols, 13 * nCols, 12 * nCols, 11 * nCols, 10 * nCols, 9 * nCols, 8 * nCols, 7 * nCols,
                                           6 * nCols, 5 * nCols, 4 * nCols, 3 * nCols, 2 * nCols, nCols, 0);
 
-        __mmask16 checkMask = feat_idx[0] != -1;
+        __mmask16 checkMask = nodes[0].featureIndex != -1;
 
+        /* Nodes are gathered from the arena by the offsets in 4-byte words */
+        __m512i stride = _mm512_set1_epi32(sizeof(ArenaNodeType) / sizeof(int));
         __m512i nOne   = _mm512_set1_epi32(-1);
         __m512i zero   = _mm512_set1_epi32(0);
         __m512 zero_ps = _mm512_set1_ps(0);
@@ -469,11 +539,12 @@ void PredictClassificationTask<float, avx512>::predictByTree(const float * const
             for (size_t i = 0; i < _DEFAULT_BLOCK_SIZE; i += 16)
             {
                 __m512i idxr = _mm512_castps_si512(_mm512_loadu_ps((float *)(idx + i)));
-                __m512 sp    = _mm512_i32gather_ps(idxr, split_point, 4);
+                __m512i pos  = _mm512_mullo_epi32(idxr, stride);
+                __m512 sp    = _mm512_i32gather_ps(pos, &nodes->featureValue, 4);
 
-                __m512i left = _mm512_i32gather_epi32(idxr, left_son, 4);
+                __m512i left = _mm512_i32gather_epi32(pos, &nodes->leftIndexOrClass, 4);
 
-                __m512i fi = _mm512_i32gather_epi32(idxr, feat_idx, 4);
+                __m512i fi = _mm512_i32gather_epi32(pos, &nodes->featureIndex, 4);
 
                 isSplit = _mm512_cmp_epi32_mask(fi, nOne, _MM_CMPINT_NE);
 
@@ -490,18 +561,17 @@ void PredictClassificationTask<float, avx512>::predictByTree(const float * const
         }
         const double * probas = _model->getProbas(iTree);
 
-        fillResults<float, avx512>(_nClasses, _votingMethod, _DEFAULT_BLOCK_SIZE, probas, left_son, idx, resPtr);
+        fillResults<float, avx512>(_nClasses, _votingMethod, _DEFAULT_BLOCK_SIZE, probas, nodes, idx, resPtr);
     }
     else
     {
-        predictByTreeCommon(x, sizeOfBlock, nCols, feat_idx, left_son, split_point, resPtr, iTree);
+        predictByTreeCommon(x, sizeOfBlock, nCols, nodes, resPtr, iTree);
     }
 }
 
 template <>
 void PredictClassificationTask<double, avx512>::predictByTree(const double * const x, const size_t sizeOfBlock, const size_t nCols,
-                                                              const featureIndexType * const feat_idx, const leftOrClassType * const left_son,
-                                                              const double * const split_point, double * const resPtr, const size_t iTree)
+                                                              const ArenaNodeType * const nodes, double * const resPtr, const size_t iTree)
 {
     if (sizeOfBlock == _DEFAULT_BLOCK_SIZE)
     {
@@ -512,7 +582,11 @@ void PredictClassificationTask<double, avx512>::predictByTree(const double * con
 
         __m256i offset = _mm256_set_epi32(7 * nCols, 6 * nCols, 5 * nCols, 4 * nCols, 3 * nCols, 2 * nCols, nCols, 0);
 
-        __mmask8 checkMask = feat_idx[0] != -1;
+        __mmask8 checkMask = nodes[0].featureIndex != -1;
+
+        /* Nodes are gathered from the arena by the offsets in 8-byte words for split points and 4-byte words for indices */
+        const __m256i stride32 = _mm256_set1_epi32(sizeof(ArenaNodeType) / sizeof(int));
+        const __m256i stride64 = _mm256_set1_epi32(sizeof(ArenaNodeType) / sizeof(double));
 
         while (checkMask)
         {
@@ -521,11 +595,12 @@ void PredictClassificationTask<double, avx512>::predictByTree(const double * con
             for (size_t i = 0; i < _DEFAULT_BLOCK_SIZE; i += 8)
             {
                 __m256i idxr = _mm256_castps_si256(_mm256_loadu_ps((float *)(idx + i)));
-                __m512d sp   = _mm512_i32gather_pd(idxr, split_point, 8);
+                __m256i pos  = _mm256_mullo_epi32(idxr, stride32);
+                __m512d sp   = _mm512_i32gather_pd(_mm256_mullo_epi32(idxr, stride64), &nodes->featureValue, 8);
 
-                __m256i left = _mm256_i32gather_epi32(left_son, idxr, 4);
+                __m256i left = _mm256_i32gather_epi32((const int *)&nodes->leftIndexOrClass, pos, 4);
 
-                __m256i fi = _mm256_i32gather_epi32(feat_idx, idxr, 4);
+                __m256i fi = _mm256_i32gather_epi32((const int *)&nodes->featureIndex, pos, 4);
 
                 isSplit = _mm256_cmp_epi32_mask(fi, _mm256_set1_epi32(-1), _MM_CMPINT_NE);
 
@@ -544,11 +619,11 @@ void PredictClassificationTask<double, avx512>::predictByTree(const double * con
 
         const double * probas = _model->getProbas(iTree);
 
-        fillResults<double, avx512>(_nClasses, _votingMethod, _DEFAULT_BLOCK_SIZE, probas, left_son, idx, resPtr);
+        fillResults<double, avx512>(_nClasses, _votingMethod, _DEFAULT_BLOCK_SIZE, probas, nodes, idx, resPtr);
     }
     else
     {
-        predictByTreeCommon(x, sizeOfBlock, nCols, feat_idx, left_son, split_point, resPtr, iTree);
+        predictByTreeCommon(x, sizeOfBlock, nCols, nodes, resPtr, iTree);
     }
 }
 #endif
@@ -618,9 +693,9 @@ Status PredictClassificationTask<algorithmFPType, cpu>::predictOneRowByAllTrees(
         _cachedNClasses = _nClasses;
     }
 
-    if (_cachedModel != _model)
+    if (_cachedModel.get() != _modelPtr.get())
     {
-        _cachedModel = _model;
+        _cachedModel = _modelPtr;
         _aTree.reset(nTreesTotal);
         DAAL_CHECK_MALLOC(_aTree.get());
         _averageTreeSize = 0;
@@ -698,9 +773,9 @@ Status PredictClassificationTask<algorithmFPType, cpu>::predictOneRowByAllTrees(
 template <>
 Status PredictClassificationTask<float, avx512>::predictOneRowByAllTrees(size_t nTreesTotal)
 {
-    if (_cachedModel != _model)
+    if (_cachedModel.get() != _modelPtr.get())
     {
-        _cachedModel = _model;
+        _cachedModel = _modelPtr;
         _aTree.reset(nTreesTotal);
         DAAL_CHECK_MALLOC(_aTree.get());
         _averageTreeSize = 0;
@@ -960,14 +1035,16 @@ Status PredictClassificationTask<algorithmFPType, cpu>::predictAllPointsByAllTre
     ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(_data), 0, nRowsOfRes);
     DAAL_CHECK_BLOCK_STATUS(xBD);
     const algorithmFPType * const aX = xBD.get();
+
+    /* The trees are packed into the arena once and reused by the following calls with the same model */
+    Status s = buildArena(numberOfTrees);
+    DAAL_CHECK_STATUS_VAR(s);
     if (numberOfTrees > _MIN_TREES_FOR_THREADING)
     {
         daal::static_tls<algorithmFPType *> tlsData([=]() { return service_scalable_calloc<algorithmFPType, cpu>(_nClasses * nRowsOfRes); });
 
         daal::static_threader_for(numberOfTrees, [&, nCols](const size_t iTree, size_t tid) {
-            const size_t treeSize                = _aTree[iTree]->getNumberOfRows();
-            const DecisionTreeNode * const aNode = (const DecisionTreeNode *)(*_aTree[iTree]).getArray();
-            parallelPredict(aX, aNode, treeSize, nBlocks, nCols, blockSize, residualSize, tlsData.local(tid), iTree);
+            parallelPredict(aX, _arena.get() + _arenaOffsets[iTree], nBlocks, nCols, blockSize, residualSize, tlsData.local(tid), iTree);
         });
 
         const size_t nThreads  = tlsData.nthreads();
@@ -1029,9 +1106,7 @@ Status PredictClassificationTask<algorithmFPType, cpu>::predictAllPointsByAllTre
 
         for (size_t iTree = 0; iTree < numberOfTrees; ++iTree)
         {
-            const size_t treeSize                = _aTree[iTree]->getNumberOfRows();
-            const DecisionTreeNode * const aNode = (const DecisionTreeNode *)(*_aTree[iTree]).getArray();
-            parallelPredict(aX, aNode, treeSize, nBlocks, nCols, blockSize, residualSize, commonBufVal, iTree);
+            parallelPredict(aX, _arena.get() + _arenaOffsets[iTree], nBlocks, nCols, blockSize, residualSize, commonBufVal, iTree);
         }
         if (prob != nullptr || res != nullptr)
         {
@@ -1089,9 +1164,9 @@ Status PredictClassificationTask<algorithmFPType, cpu>::run(services::HostAppIfa
     {
         return predictOneRowByAllTrees(nTreesTotal);
     }
-    if (_cachedModel != _model)
+    if (_cachedModel.get() != _modelPtr.get())
     {
-        _cachedModel = _model;
+        _cachedModel = _modelPtr;
         _aTree.reset(nTreesTotal);
         DAAL_CHECK_MALLOC(_aTree.get());
         _averageTreeSize = 0;
@@ -116,6 +116,51 @@ services::Status Parameter::check() const
     return daal::algorithms::classifier::interface2::Parameter::check();
 }
 
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_DECISION_FOREST_CLASSIFICATION_PREDICTION_RESULT_ID);
+
+Result::Result() : classifier::prediction::Result(featureContributions + 1) {}
+
+/**
+ * Returns the result of decision forest model-based prediction
+ * \param[in] id    Identifier of the result
+ * \return          Result that corresponds to the given identifier
+ */
+NumericTablePtr Result::get(ResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the result of decision forest model-based prediction
+ * \param[in] id      Identifier of the result
+ * \param[in] value   Result
+ */
+void Result::set(ResultId id, const NumericTablePtr & value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Checks the result of decision forest model-based prediction
+ * \param[in] input   %Input object
+ * \param[in] par     %Parameter of the algorithm
+ * \param[in] method  Computation method
+ */
+services::Status Result::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, int method) const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, classifier::prediction::Result::check(input, par, method));
+
+    const Parameter * algPar = dynamic_cast<const Parameter *>(par);
+    if (algPar && (algPar->resultsToCompute & computeFeatureContributions))
+    {
+        const NumericTablePtr dataTable = static_cast<const Input *>(input)->get(classifier::prediction::data);
+        const size_t nOut               = (algPar->nClasses > 2 ? algPar->nClasses : 1) * (dataTable->getNumberOfColumns() + 1);
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(featureContributions).get(), featureContributionsStr(), 0, 0, nOut, dataTable->getNumberOfRows()));
+    }
+    return s;
+}
+
 } // namespace interface1
 } // namespace prediction
 } // namespace classification
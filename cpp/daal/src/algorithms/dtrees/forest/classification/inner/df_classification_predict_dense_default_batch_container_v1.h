@@ -58,8 +58,8 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     classifier::prediction::Result * const result = static_cast<classifier::prediction::Result *>(_res);
 
     const NumericTable * const a = static_cast<NumericTable *>(input->get(classifier::prediction::data).get());
-    const decision_forest::classification::Model * const m =
-        static_cast<decision_forest::classification::Model *>(input->get(classifier::prediction::model).get());
+    const decision_forest::classification::ModelPtr m =
+        services::staticPointerCast<decision_forest::classification::Model, classifier::Model>(input->get(classifier::prediction::model));
     NumericTable * const r = static_cast<NumericTable *>(result->get(classifier::prediction::prediction).get());
 
     const classifier::interface1::Parameter * const par = static_cast<classifier::interface1::Parameter *>(_par);
@@ -68,7 +68,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     const VotingMethod defaultVotingMethod = VotingMethod::unweighted;
 
     __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
-                       daal::services::internal::hostApp(*const_cast<Input *>(input)), a, m, r, nullptr, par->nClasses, defaultVotingMethod);
+                       daal::services::internal::hostApp(*const_cast<Input *>(input)), a, m, r, nullptr, nullptr, par->nClasses, defaultVotingMethod);
 }
 } // namespace interface1
 } // namespace prediction
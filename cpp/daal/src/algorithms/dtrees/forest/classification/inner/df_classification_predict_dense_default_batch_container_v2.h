@@ -57,8 +57,8 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     const Input * const input                     = static_cast<Input *>(_in);
     classifier::prediction::Result * const result = static_cast<classifier::prediction::Result *>(_res);
     const classifier::Parameter * const par       = static_cast<classifier::Parameter *>(_par);
-    const decision_forest::classification::Model * const m =
-        static_cast<decision_forest::classification::Model *>(input->get(classifier::prediction::model).get());
+    const decision_forest::classification::ModelPtr m =
+        services::staticPointerCast<decision_forest::classification::Model, classifier::Model>(input->get(classifier::prediction::model));
 
     const NumericTable * const a = static_cast<NumericTable *>(input->get(classifier::prediction::data).get());
     NumericTable * const r =
@@ -73,7 +73,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     const VotingMethod defaultVotingMethod = VotingMethod::unweighted;
 
     __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
-                       daal::services::internal::hostApp(*const_cast<Input *>(input)), a, m, r, prob, par->nClasses, defaultVotingMethod);
+                       daal::services::internal::hostApp(*const_cast<Input *>(input)), a, m, r, prob, nullptr, par->nClasses, defaultVotingMethod);
 }
 
 } // namespace interface2
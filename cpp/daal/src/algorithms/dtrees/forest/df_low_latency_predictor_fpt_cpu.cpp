@@ -0,0 +1,81 @@
+/* file: df_low_latency_predictor_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Scoring kernels of the low latency predictors of decision forest models.
+//  The file is compiled for every CPU, the kernels for the current CPU are selected by the scorer.
+//--
+*/
+
+#include "src/algorithms/dtrees/forest/df_low_latency_predictor_impl.h"
+#include "src/algorithms/dtrees/dtrees_predict_dense_default_impl.i"
+#include "src/externals/service_memory.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace internal
+{
+template <typename algorithmFPType, CpuType cpu>
+void findLeavesLowLatency(const LowLatencyScorer & scorer, size_t iTree, const algorithmFPType * x, size_t nRows,
+                          const dtrees::internal::DecisionTreeNode ** leaves)
+{
+    typedef LowLatencyScorer::TreeType TreeType;
+    const TreeType & tree                            = scorer.getTree(iTree);
+    const dtrees::internal::FeatureTypes & featTypes = scorer.getFeatureTypes();
+    const size_t nFeatures                           = scorer.getNumberOfFeatures();
+    for (size_t iRow = 0; iRow < nRows; ++iRow)
+    {
+        leaves[iRow] = dtrees::prediction::internal::findNode<algorithmFPType, TreeType, cpu>(tree, featTypes, x + iRow * nFeatures);
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void predictResponsesLowLatency(const LowLatencyScorer & scorer, const algorithmFPType * x, size_t nRows, algorithmFPType * res)
+{
+    services::internal::service_memset_seq<algorithmFPType, cpu>(res, algorithmFPType(0), nRows);
+    const size_t nTrees    = scorer.getNumberOfTrees();
+    const size_t nFeatures = scorer.getNumberOfFeatures();
+    const dtrees::internal::DecisionTreeNode * leaves[LOW_LATENCY_BLOCK_SIZE];
+    for (size_t iStart = 0; iStart < nRows; iStart += LOW_LATENCY_BLOCK_SIZE)
+    {
+        const size_t nBlockRows     = (nRows - iStart < LOW_LATENCY_BLOCK_SIZE) ? nRows - iStart : LOW_LATENCY_BLOCK_SIZE;
+        algorithmFPType * const out = res + iStart;
+        for (size_t iTree = 0; iTree < nTrees; ++iTree)
+        {
+            // all the rows of the block are scored by the tree while it stays in cache
+            findLeavesLowLatency<algorithmFPType, cpu>(scorer, iTree, x + iStart * nFeatures, nBlockRows, leaves);
+            for (size_t iRow = 0; iRow < nBlockRows; ++iRow) out[iRow] += leaves[iRow]->featureValueOrResponse;
+        }
+    }
+    const algorithmFPType div = algorithmFPType(1) / algorithmFPType(nTrees);
+    for (size_t iRow = 0; iRow < nRows; ++iRow) res[iRow] *= div;
+}
+
+template void findLeavesLowLatency<DAAL_FPTYPE, DAAL_CPU>(const LowLatencyScorer & scorer, size_t iTree, const DAAL_FPTYPE * x, size_t nRows,
+                                                          const dtrees::internal::DecisionTreeNode ** leaves);
+template void predictResponsesLowLatency<DAAL_FPTYPE, DAAL_CPU>(const LowLatencyScorer & scorer, const DAAL_FPTYPE * x, size_t nRows,
+                                                                DAAL_FPTYPE * res);
+
+} // namespace internal
+} // namespace decision_forest
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,136 @@
+/* file: df_low_latency_predictor_impl.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the scorer used by the low latency predictors of decision forest models.
+//--
+*/
+
+#ifndef __DF_LOW_LATENCY_PREDICTOR_IMPL_H__
+#define __DF_LOW_LATENCY_PREDICTOR_IMPL_H__
+
+#include "src/algorithms/dtrees/dtrees_model_impl.h"
+#include "src/algorithms/dtrees/dtrees_feature_type_helper.h"
+#include "src/externals/service_dispatch.h"
+#include "src/services/service_arrays.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace internal
+{
+/* Number of rows processed by the low latency predictors at once, defines the size of their buffers */
+const size_t LOW_LATENCY_BLOCK_SIZE = 16;
+
+class LowLatencyScorer;
+
+// Finds the leaves of the tree iTree for nRows <= LOW_LATENCY_BLOCK_SIZE rows.
+// Instantiated for every CPU in df_low_latency_predictor_fpt_cpu.cpp
+template <typename algorithmFPType, CpuType cpu>
+void findLeavesLowLatency(const LowLatencyScorer & scorer, size_t iTree, const algorithmFPType * x, size_t nRows,
+                          const dtrees::internal::DecisionTreeNode ** leaves);
+
+// Computes the average of the responses in the leaves of the trees for nRows rows.
+// Instantiated for every CPU in df_low_latency_predictor_fpt_cpu.cpp
+template <typename algorithmFPType, CpuType cpu>
+void predictResponsesLowLatency(const LowLatencyScorer & scorer, const algorithmFPType * x, size_t nRows, algorithmFPType * res);
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Finds the leaves of the forest trees on the calling thread.
+// The trees are collected and the kernels for the current CPU are selected once,
+// so scoring requires neither numeric tables nor memory allocations.
+//////////////////////////////////////////////////////////////////////////////////////////
+class LowLatencyScorer
+{
+public:
+    typedef dtrees::internal::DecisionTreeTable TreeType;
+    typedef dtrees::internal::DecisionTreeNode NodeType;
+
+    LowLatencyScorer()
+        : _nFeatures(0), _findLeavesFloat(nullptr), _findLeavesDouble(nullptr), _predictResponsesFloat(nullptr), _predictResponsesDouble(nullptr)
+    {}
+
+    // The categorical features are defined by the dictionary of featureTypes, all the features are ordered if it is null
+    services::Status init(const dtrees::internal::ModelImpl & model, size_t nFeatures, const data_management::NumericTable * featureTypes)
+    {
+        const size_t nTrees = model.size();
+        DAAL_CHECK(nTrees, services::ErrorNullModel);
+        _aTree.reset(nTrees);
+        DAAL_CHECK_MALLOC(_aTree.get());
+        for (size_t i = 0; i < nTrees; ++i)
+        {
+            _aTree[i] = model.at(i);
+            DAAL_CHECK(_aTree[i] && _aTree[i]->getArray(), services::ErrorModelNotFullInitialized);
+        }
+        if (featureTypes)
+        {
+            DAAL_CHECK(featureTypes->getNumberOfColumns() == nFeatures, services::ErrorIncorrectNumberOfFeatures);
+            DAAL_CHECK_MALLOC(_featHelper.init(*featureTypes));
+        }
+        _nFeatures = nFeatures;
+
+#define DAAL_SELECT_LOW_LATENCY_KERNELS(cpuId, scorer) (scorer)->selectKernels<cpuId>();
+        DAAL_DISPATCH_FUNCTION_BY_CPU(DAAL_SELECT_LOW_LATENCY_KERNELS, this);
+#undef DAAL_SELECT_LOW_LATENCY_KERNELS
+        return services::Status();
+    }
+
+    size_t getNumberOfFeatures() const { return _nFeatures; }
+    size_t getNumberOfTrees() const { return _aTree.size(); }
+    const TreeType & getTree(size_t iTree) const { return *_aTree[iTree]; }
+    const dtrees::internal::FeatureTypes & getFeatureTypes() const { return _featHelper; }
+
+    const NodeType * getNodes(size_t iTree) const { return (const NodeType *)_aTree[iTree]->getArray(); }
+
+    void findLeaves(size_t iTree, const float * x, size_t nRows, const NodeType ** leaves) const { _findLeavesFloat(*this, iTree, x, nRows, leaves); }
+    void findLeaves(size_t iTree, const double * x, size_t nRows, const NodeType ** leaves) const
+    {
+        _findLeavesDouble(*this, iTree, x, nRows, leaves);
+    }
+
+    void predictResponses(const float * x, size_t nRows, float * res) const { _predictResponsesFloat(*this, x, nRows, res); }
+    void predictResponses(const double * x, size_t nRows, double * res) const { _predictResponsesDouble(*this, x, nRows, res); }
+
+    template <CpuType cpu>
+    void selectKernels()
+    {
+        _findLeavesFloat        = &findLeavesLowLatency<float, cpu>;
+        _findLeavesDouble       = &findLeavesLowLatency<double, cpu>;
+        _predictResponsesFloat  = &predictResponsesLowLatency<float, cpu>;
+        _predictResponsesDouble = &predictResponsesLowLatency<double, cpu>;
+    }
+
+private:
+    daal::internal::TArray<const TreeType *, sse2> _aTree;
+    dtrees::internal::FeatureTypes _featHelper;
+    size_t _nFeatures;
+    void (*_findLeavesFloat)(const LowLatencyScorer &, size_t, const float *, size_t, const NodeType **);
+    void (*_findLeavesDouble)(const LowLatencyScorer &, size_t, const double *, size_t, const NodeType **);
+    void (*_predictResponsesFloat)(const LowLatencyScorer &, const float *, size_t, float *);
+    void (*_predictResponsesDouble)(const LowLatencyScorer &, const double *, size_t, double *);
+};
+
+} // namespace internal
+} // namespace decision_forest
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -352,6 +352,9 @@ services::Status computeImpl(HostAppIface * pHostApp, const NumericTable * x, co
                              ResultData & res, const Parameter & par, size_t nClasses, const dtrees::internal::FeatureTypes & featTypes,
                              const dtrees::internal::IndexedFeatures & indexedFeatures)
 {
+    /* Buffers allocated for every tree and node are reused */
+    services::internal::ScratchPoolScope scratchPoolScope;
+
     services::Status s;
     DAAL_CHECK(md.resize(par.nTrees), ErrorMemoryAllocationFailed);
 
@@ -1150,7 +1153,7 @@ services::Status TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, c
 {
     const size_t nOOB = _helper.getNumOOBIndices();
     if (!nOOB) return services::Status();
-    TArray<IndexType, cpu> oobIndices(nOOB);
+    TArrayScratch<IndexType, cpu> oobIndices(nOOB);
     DAAL_CHECK_MALLOC(oobIndices.get());
     _helper.getOOBIndices(oobIndices.get());
     const bool bMDA(_par.varImportance == training::MDA_Raw || _par.varImportance == training::MDA_Scaled);
@@ -1159,7 +1162,7 @@ services::Status TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, c
         const algorithmFPType oobError = computeOOBError(t, nOOB, oobIndices.get());
         if (bMDA)
         {
-            TArray<IndexType, cpu> permutation(nOOB);
+            TArrayScratch<IndexType, cpu> permutation(nOOB);
             DAAL_CHECK_MALLOC(permutation.get());
             for (size_t i = 0; i < nOOB; permutation[i] = i, ++i)
                 ;
@@ -1200,7 +1203,7 @@ algorithmFPType TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cp
 
     //compute prediction error on each OOB row and get its mean using online formulae (Welford)
     //TODO: can be threader_for() block
-    TArray<algorithmFPType, cpu> buf(dim);
+    TArrayScratch<algorithmFPType, cpu> buf(dim);
     ReadRows<algorithmFPType, cpu> x(const_cast<NumericTable *>(_data), aInd[0], 1);
     services::internal::tmemcpy<algorithmFPType, cpu>(buf.get(), x.get(), dim);
     ReadRows<algorithmFPType, cpu> p(const_cast<NumericTable *>(_data), aInd[aPerm[0]], 1);
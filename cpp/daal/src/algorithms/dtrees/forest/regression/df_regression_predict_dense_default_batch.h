@@ -54,9 +54,10 @@ public:
      *  \param a[in]    Matrix of input variables X
      *  \param m[in]    decision forest model obtained on training stage
      *  \param r[out]   Prediction results
-     *  \param par[in]  decision forest algorithm parameters
+     *  \param contributions[out]  Contributions of the features to the prediction results, null if they are not computed
      */
-    services::Status compute(services::HostAppIface * pHostApp, const NumericTable * a, const regression::Model * m, NumericTable * r);
+    services::Status compute(services::HostAppIface * pHostApp, const NumericTable * a, const regression::Model * m, NumericTable * r,
+                             NumericTable * contributions);
 };
 
 } // namespace internal
@@ -72,19 +72,24 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     NumericTable * a = static_cast<NumericTable *>(input->get(data).get());
     daal::algorithms::decision_forest::regression::Model * m =
         static_cast<daal::algorithms::decision_forest::regression::Model *>(input->get(model).get());
-    NumericTable * r = static_cast<NumericTable *>(result->get(prediction).get());
+    NumericTable * r      = static_cast<NumericTable *>(result->get(prediction).get());
+    const Parameter * par = static_cast<const Parameter *>(_par);
+
+    NumericTable * contributions =
+        (par->resultsToCompute & computeFeatureContributions) ? static_cast<NumericTable *>(result->get(featureContributions).get()) : nullptr;
 
     daal::services::Environment::env & env = *_env;
 
     if (!deviceInfo.isCpu)
     {
+        if (contributions) return services::Status(services::ErrorMethodNotSupported);
         __DAAL_CALL_KERNEL_SYCL(env, internal::PredictKernelOneAPI, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
                                 daal::services::internal::hostApp(*input), a, m, r);
     }
     else
     {
         __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
-                           daal::services::internal::hostApp(*input), a, m, r);
+                           daal::services::internal::hostApp(*input), a, m, r, contributions);
     }
 }
 
@@ -34,6 +34,7 @@
 #include "src/algorithms/service_error_handling.h"
 #include "src/externals/service_memory.h"
 #include "src/algorithms/dtrees/regression/dtrees_regression_predict_dense_default_impl.i"
+#include "src/algorithms/dtrees/dtrees_predict_shap_impl.i"
 #include "src/services/service_algo_utils.h"
 
 using namespace daal::internal;
@@ -62,6 +63,7 @@ public:
     PredictRegressionTask(const NumericTable * x, NumericTable * y) : super(x, y) {}
 
     services::Status run(const decision_forest::regression::internal::ModelImpl * m, services::HostAppIface * pHostApp);
+    services::Status runContributions(const decision_forest::regression::internal::ModelImpl * m, NumericTable * contributions);
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -69,12 +71,14 @@ public:
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, prediction::Method method, CpuType cpu>
 services::Status PredictKernel<algorithmFPType, method, cpu>::compute(services::HostAppIface * pHostApp, const NumericTable * x,
-                                                                      const regression::Model * m, NumericTable * r)
+                                                                      const regression::Model * m, NumericTable * r, NumericTable * contributions)
 {
     const daal::algorithms::decision_forest::regression::internal::ModelImpl * pModel =
         static_cast<const daal::algorithms::decision_forest::regression::internal::ModelImpl *>(m);
     PredictRegressionTask<algorithmFPType, cpu> task(x, r);
-    return task.run(pModel, pHostApp);
+    services::Status s = task.run(pModel, pHostApp);
+    if (s && contributions) s = task.runContributions(pModel, contributions);
+    return s;
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -90,6 +94,25 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::run(const decision
     return super::run(pHostApp, div);
 }
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictRegressionTask<algorithmFPType, cpu>::runContributions(const decision_forest::regression::internal::ModelImpl * m,
+                                                                               NumericTable * contributions)
+{
+    typedef dtrees::prediction::internal::DecisionTreeShapView TreeType;
+    const auto nTreesTotal = this->_aTree.size();
+    TArray<TreeType, cpu> aTree(nTreesTotal);
+    DAAL_CHECK_MALLOC(aTree.get());
+    for (size_t iTree = 0; iTree < nTreesTotal; ++iTree)
+    {
+        aTree[iTree].nodes           = (const dtrees::internal::DecisionTreeNode *)this->_aTree[iTree]->getArray();
+        aTree[iTree].nodeSampleCount = m->getNodeSampleCount(iTree);
+        DAAL_CHECK(aTree[iTree].nodes && aTree[iTree].nodeSampleCount && aTree[iTree].nodeSampleCount[0] > 0, services::ErrorModelNotFullInitialized);
+    }
+    const algorithmFPType div = algorithmFPType(1) / algorithmFPType(nTreesTotal);
+    return dtrees::prediction::internal::computeContributions<algorithmFPType, TreeType, cpu>(aTree.get(), nTreesTotal, this->_featHelper,
+                                                                                             this->_data, div, contributions);
+}
+
 } /* namespace internal */
 } /* namespace prediction */
 } /* namespace regression */
@@ -45,9 +45,17 @@ namespace prediction
 template <typename algorithmFPType>
 DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, const int method)
 {
-    size_t nVectors = (static_cast<const Input *>(input))->get(data)->getNumberOfRows();
+    const data_management::NumericTablePtr dataTable = (static_cast<const Input *>(input))->get(data);
+    size_t nVectors                                  = dataTable->getNumberOfRows();
     services::Status st;
     set(prediction, data_management::HomogenNumericTable<algorithmFPType>::create(1, nVectors, data_management::NumericTableIface::doAllocate, &st));
+    const Parameter * algPar = dynamic_cast<const Parameter *>(par);
+    if (st && algPar && (algPar->resultsToCompute & computeFeatureContributions))
+    {
+        const size_t nFeatures = dataTable->getNumberOfColumns();
+        set(featureContributions,
+            data_management::HomogenNumericTable<algorithmFPType>::create(nFeatures + 1, nVectors, data_management::NumericTableIface::doAllocate, &st));
+    }
     return st;
 }
 
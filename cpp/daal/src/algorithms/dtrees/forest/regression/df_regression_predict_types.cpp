@@ -130,6 +130,14 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
     Status s;
     DAAL_CHECK_STATUS(s, algorithms::regression::prediction::Result::check(input, par, method));
     DAAL_CHECK_EX(get(prediction)->getNumberOfColumns() == 1, ErrorIncorrectNumberOfColumns, ArgumentName, predictionStr());
+
+    const Parameter * algPar = dynamic_cast<const Parameter *>(par);
+    if (algPar && (algPar->resultsToCompute & computeFeatureContributions))
+    {
+        const NumericTablePtr dataTable = static_cast<const Input *>(input)->get(data);
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(featureContributions).get(), featureContributionsStr(), 0, 0, dataTable->getNumberOfColumns() + 1,
+                                               dataTable->getNumberOfRows()));
+    }
     return s;
 }
 
@@ -0,0 +1,132 @@
+/* file: gbt_classification_low_latency_predictor.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the low latency predictor of the gradient boosted trees classification model
+//--
+*/
+
+#include "algorithms/gradient_boosted_trees/gbt_classification_low_latency_predictor.h"
+#include "src/algorithms/dtrees/gbt/classification/gbt_classification_model_impl.h"
+#include "src/algorithms/dtrees/gbt/gbt_low_latency_predictor_impl.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace classification
+{
+namespace prediction
+{
+namespace interface1
+{
+using gbt::prediction::internal::LOW_LATENCY_BLOCK_SIZE;
+
+class LowLatencyPredictor::PredictorImpl
+{
+public:
+    PredictorImpl(const ModelPtr & model, size_t nClasses) : _model(model), _nClasses(nClasses) {}
+
+    services::Status init(const data_management::NumericTable * featureTypes)
+    {
+        const gbt::classification::internal::ModelImpl * const pModel =
+            static_cast<const gbt::classification::internal::ModelImpl *>(_model.get());
+        DAAL_CHECK(_nClasses > 1, services::ErrorIncorrectNumberOfClasses);
+        DAAL_CHECK((_nClasses < 3) || (pModel->getNumberOfTrees() % _nClasses == 0), services::ErrorGbtIncorrectNumberOfTrees);
+
+        /* Binary classification model has one raw value per row, multiclass one has a value per class */
+        const size_t nOutputs = (_nClasses == 2) ? 1 : _nClasses;
+        _raw.reset(LOW_LATENCY_BLOCK_SIZE * nOutputs);
+        DAAL_CHECK_MALLOC(_raw.get());
+        return _scorer.init(*pModel, pModel->getNumberOfFeatures(), nOutputs, featureTypes);
+    }
+
+    template <typename algorithmFPType>
+    services::Status predict(const algorithmFPType * x, size_t nRows, algorithmFPType * labels, algorithmFPType * probabilities)
+    {
+        DAAL_CHECK(x && (labels || probabilities), services::ErrorNullPtr);
+        const size_t nFeatures = _scorer.getNumberOfFeatures();
+        for (size_t iStart = 0; iStart < nRows; iStart += LOW_LATENCY_BLOCK_SIZE)
+        {
+            const size_t nBlockRows = (nRows - iStart < LOW_LATENCY_BLOCK_SIZE) ? nRows - iStart : LOW_LATENCY_BLOCK_SIZE;
+            algorithmFPType * const raw = reinterpret_cast<algorithmFPType *>(_raw.get());
+            _scorer.predict(x + iStart * nFeatures, nBlockRows, raw);
+            _scorer.finalizeClassification(_nClasses, raw, nBlockRows, labels ? labels + iStart : nullptr,
+                                           probabilities ? probabilities + iStart * _nClasses : nullptr);
+        }
+        return services::Status();
+    }
+
+    size_t getNumberOfFeatures() const { return _scorer.getNumberOfFeatures(); }
+
+private:
+    ModelPtr _model;
+    size_t _nClasses;
+    gbt::prediction::internal::LowLatencyScorer _scorer;
+    TArray<double, sse2> _raw; /* Raw boosted values of the block of rows, large enough for both float and double */
+};
+
+LowLatencyPredictor::LowLatencyPredictor(const ModelPtr & model, size_t nClasses)
+    : LowLatencyPredictor(model, nClasses, data_management::NumericTablePtr())
+{}
+
+LowLatencyPredictor::LowLatencyPredictor(const ModelPtr & model, size_t nClasses, const data_management::NumericTablePtr & featureTypes)
+    : _impl(nullptr)
+{
+    if (!model.get())
+    {
+        _status |= services::ErrorNullModel;
+    }
+    else
+    {
+        _impl = new PredictorImpl(model, nClasses);
+        _status |= _impl->init(featureTypes.get());
+    }
+    services::throwIfPossible(_status);
+}
+
+LowLatencyPredictor::~LowLatencyPredictor()
+{
+    delete _impl;
+}
+
+services::Status LowLatencyPredictor::predict(const float * x, size_t nRows, float * labels, float * probabilities)
+{
+    DAAL_CHECK(_status.ok(), services::ErrorModelNotFullInitialized);
+    return _impl->predict(x, nRows, labels, probabilities);
+}
+
+services::Status LowLatencyPredictor::predict(const double * x, size_t nRows, double * labels, double * probabilities)
+{
+    DAAL_CHECK(_status.ok(), services::ErrorModelNotFullInitialized);
+    return _impl->predict(x, nRows, labels, probabilities);
+}
+
+size_t LowLatencyPredictor::getNumberOfFeatures() const
+{
+    return _impl ? _impl->getNumberOfFeatures() : 0;
+}
+
+} // namespace interface1
+} // namespace prediction
+} // namespace classification
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
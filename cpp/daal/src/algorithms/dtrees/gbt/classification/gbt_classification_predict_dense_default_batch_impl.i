@@ -36,6 +36,7 @@
 #include "src/algorithms/dtrees/regression/dtrees_regression_predict_dense_default_impl.i"
 #include "src/algorithms/dtrees/gbt/regression/gbt_regression_predict_dense_default_batch_impl.i"
 #include "src/algorithms/dtrees/gbt/gbt_predict_dense_default_impl.i"
+#include "src/algorithms/dtrees/gbt/gbt_predict_shap_impl.i"
 #include "src/algorithms/objective_function/cross_entropy_loss/cross_entropy_loss_dense_default_batch_kernel.h"
 #include "src/services/service_algo_utils.h"
 
@@ -64,7 +65,10 @@ class PredictBinaryClassificationTask : public gbt::regression::prediction::inte
 {
 public:
     typedef gbt::regression::prediction::internal::PredictRegressionTask<algorithmFPType, cpu> super;
-    PredictBinaryClassificationTask(const NumericTable * x, NumericTable * y, NumericTable * prob) : super(x, y), _prob(prob) {}
+    PredictBinaryClassificationTask(const NumericTable * x, NumericTable * y, NumericTable * prob, const algorithms::ModelPtr & model,
+                                    typename super::QuickScorerType * scorer)
+        : super(x, y, model, scorer), _prob(prob)
+    {}
     services::Status run(const gbt::classification::internal::ModelImpl * m, size_t nIterations, services::HostAppIface * pHostApp)
     {
         DAAL_ASSERT(!nIterations || nIterations <= m->size());
@@ -74,7 +78,8 @@ public:
         DAAL_CHECK_MALLOC(this->_aTree.get());
         for (size_t i = 0; i < nTreesTotal; ++i) this->_aTree[i] = m->at(i);
         const auto nRows = this->_data->getNumberOfRows();
-        services::Status s;
+        services::Status s = super::initQuickScorer();
+        if (!s) return s;
         DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, sizeof(algorithmFPType));
         //compute raw boosted values
         if (this->_res && _prob)
@@ -156,6 +161,13 @@ public:
         return s;
     }
 
+    //contributions of the features to the raw boosted values of the trees used by the last run
+    services::Status runContributions(const gbt::classification::internal::ModelImpl * m, NumericTable * contributions)
+    {
+        return gbt::prediction::internal::computeContributions<algorithmFPType, cpu>(*m, this->_aTree.size(), this->_featHelper, this->_data,
+                                                                                     contributions);
+    }
+
 protected:
     NumericTable * _prob;
 };
@@ -171,15 +183,33 @@ public:
     typedef gbt::prediction::internal::TileDimensions<algorithmFPType> DimType;
     typedef daal::tls<algorithmFPType *> ClassesRawBoostedTlsBase;
     typedef daal::TlsMem<algorithmFPType, cpu> ClassesRawBoostedTls;
-
-    PredictMulticlassTask(const NumericTable * x, NumericTable * y, NumericTable * prob) : _data(x), _res(y), _prob(prob) {}
+    typedef gbt::prediction::internal::QuickScorer<algorithmFPType, cpu> QuickScorerType;
+
+    PredictMulticlassTask(const NumericTable * x, NumericTable * y, NumericTable * prob, const algorithms::ModelPtr & model, QuickScorerType * scorer)
+        : _data(x),
+          _csr(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(x))),
+          _res(y),
+          _prob(prob),
+          _model(model),
+          _bUseQuickScorer(scorer != nullptr),
+          _scorer(scorer)
+    {}
     services::Status run(const gbt::classification::internal::ModelImpl * m, size_t nClasses, size_t nIterations, services::HostAppIface * pHostApp);
 
+    //contributions of the features to the raw boosted values of the classes computed by the trees used by the last run
+    services::Status runContributions(const gbt::classification::internal::ModelImpl * m, size_t nClasses, NumericTable * contributions)
+    {
+        return gbt::prediction::internal::computeContributions<algorithmFPType, cpu>(*m, _aTree.size(), _featHelper, _data, contributions,
+                                                                                     nClasses);
+    }
+
 protected:
     services::Status predictByAllTrees(size_t nTreesTotal, size_t nClasses, const DimType & dim);
 
     void predictByTrees(algorithmFPType * res, size_t iFirstTree, size_t nTrees, size_t nClasses, const algorithmFPType * x);
     void predictByTreesVector(algorithmFPType * val, size_t iFirstTree, size_t nTrees, size_t nClasses, const algorithmFPType * x);
+    void predictByTreesSparse(algorithmFPType * val, size_t iFirstTree, size_t nTrees, size_t nClasses, const algorithmFPType * x,
+                              const size_t * colIndices, size_t nNonZeros);
     void softmax(algorithmFPType * Input, algorithmFPType * Output, size_t nRows, size_t nCols);
 
     size_t getMaxClass(const algorithmFPType * val, size_t nClasses) const
@@ -189,29 +219,49 @@ protected:
 
 protected:
     const NumericTable * _data;
+    CSRNumericTableIface * _csr; //not null if the data is in CSR format
     NumericTable * _res;
     NumericTable * _prob;
     dtrees::internal::FeatureTypes _featHelper;
     TArray<const TreeType *, cpu> _aTree;
+    algorithms::ModelPtr _model;
+    bool _bUseQuickScorer;
+    QuickScorerType * _scorer; /* Kept by the kernel between the calls, null for the default method */
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
 // PredictKernel
 //////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, prediction::Method method, CpuType cpu>
+PredictKernel<algorithmFPType, method, cpu>::~PredictKernel()
+{
+    delete _scorer;
+}
+
 template <typename algorithmFPType, prediction::Method method, CpuType cpu>
 services::Status PredictKernel<algorithmFPType, method, cpu>::compute(services::HostAppIface * pHostApp, const NumericTable * x,
-                                                                      const classification::Model * m, NumericTable * r, NumericTable * prob,
-                                                                      size_t nClasses, size_t nIterations)
+                                                                      const classification::ModelPtr & m, NumericTable * r, NumericTable * prob,
+                                                                      NumericTable * contributions, size_t nClasses, size_t nIterations)
 {
     const daal::algorithms::gbt::classification::internal::ModelImpl * pModel =
-        static_cast<const daal::algorithms::gbt::classification::internal::ModelImpl *>(m);
+        static_cast<const daal::algorithms::gbt::classification::internal::ModelImpl *>(m.get());
+    if (method == quickScorer && !_scorer)
+    {
+        _scorer = new gbt::prediction::internal::QuickScorer<algorithmFPType, cpu>();
+        DAAL_CHECK_MALLOC(_scorer);
+    }
+    services::Status s;
     if (nClasses == 2)
     {
-        PredictBinaryClassificationTask<algorithmFPType, cpu> task(x, r, prob);
-        return task.run(pModel, nIterations, pHostApp);
+        PredictBinaryClassificationTask<algorithmFPType, cpu> task(x, r, prob, m, _scorer);
+        s = task.run(pModel, nIterations, pHostApp);
+        if (s && contributions) s = task.runContributions(pModel, contributions);
+        return s;
     }
-    PredictMulticlassTask<algorithmFPType, cpu> task(x, r, prob);
-    return task.run(pModel, nClasses, nIterations, pHostApp);
+    PredictMulticlassTask<algorithmFPType, cpu> task(x, r, prob, m, _scorer);
+    s = task.run(pModel, nClasses, nIterations, pHostApp);
+    if (s && contributions) s = task.runContributions(pModel, nClasses, contributions);
+    return s;
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -225,6 +275,16 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::run(const gbt::cla
     DAAL_CHECK_MALLOC(this->_aTree.get());
     for (size_t i = 0; i < nTreesTotal; ++i) this->_aTree[i] = m->at(i);
 
+    /* The trees that cannot be evaluated by QuickScorer are processed by the default method,
+       the data in CSR format is processed by the default method too, so that the rows are not converted to dense ones */
+    if (_csr) _bUseQuickScorer = false;
+    if (_bUseQuickScorer) _bUseQuickScorer = QuickScorerType::isSupported(_featHelper, _aTree.get(), nTreesTotal);
+    if (_bUseQuickScorer)
+    {
+        services::Status s = _scorer->init(_model, _aTree.get(), nTreesTotal, _data->getNumberOfColumns(), nClasses);
+        if (!s) return s;
+    }
+
     DimType dim(*_data, nTreesTotal);
 
     return predictByAllTrees(nTreesTotal, nClasses, dim);
@@ -256,6 +316,17 @@ void PredictMulticlassTask<algorithmFPType, cpu>::predictByTreesVector(algorithm
     }
 }
 
+template <typename algorithmFPType, CpuType cpu>
+void PredictMulticlassTask<algorithmFPType, cpu>::predictByTreesSparse(algorithmFPType * val, size_t iFirstTree, size_t nTrees, size_t nClasses,
+                                                                       const algorithmFPType * x, const size_t * colIndices, size_t nNonZeros)
+{
+    for (size_t iTree = iFirstTree, iLastTree = iFirstTree + nTrees; iTree < iLastTree; ++iTree)
+    {
+        val[iTree % nClasses] += gbt::prediction::internal::predictForTreeSparse<algorithmFPType, TreeType, cpu>(*this->_aTree[iTree],
+                                                                                                                this->_featHelper, x, colIndices, nNonZeros);
+    }
+}
+
 template <typename algorithmFPType, CpuType cpu>
 services::Status PredictMulticlassTask<algorithmFPType, cpu>::predictByAllTrees(size_t nTreesTotal, size_t nClasses, const DimType & dim)
 {
@@ -280,9 +351,35 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::predictByAllTrees(
             const size_t nRowsToProcess = (iBlock == (dim.nDataBlocks - 1)) ? dim.nRowsTotal - iStartRow : dim.nRowsInBlock;
             algorithmFPType * valL      = valFull + iStartRow * nClasses;
             algorithmFPType * val       = valL;
+            algorithmFPType * res       = resBD.get() ? resBD.get() + iStartRow : nullptr;
+
+            if (_csr)
+            {
+                ReadRowsCSR<algorithmFPType, cpu> xBD(_csr, iStartRow, nRowsToProcess);
+                DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+                const size_t * rows = xBD.rows();
+                for (size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
+                {
+                    const size_t iFirst = rows[iRow] - rows[0];
+                    val                 = valL + iRow * nClasses;
+                    predictByTreesSparse(val, 0, nTreesTotal, nClasses, xBD.values() + iFirst, xBD.cols() + iFirst, rows[iRow + 1] - rows[iRow]);
+                    if (res) res[iRow] = algorithmFPType(getMaxClass(val, nClasses));
+                }
+                return;
+            }
+
             ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(_data), iStartRow, nRowsToProcess);
             DAAL_CHECK_BLOCK_STATUS_THR(xBD);
-            algorithmFPType * res = resBD.get() ? resBD.get() + iStartRow : nullptr;
+
+            if (_bUseQuickScorer)
+            {
+                safeStat |= _scorer->predict(xBD.get(), nRowsToProcess, nCols, valL);
+                for (size_t iRow = 0; res && iRow < nRowsToProcess; ++iRow)
+                {
+                    res[iRow] = algorithmFPType(getMaxClass(valL + iRow * nClasses, nClasses));
+                }
+                return;
+            }
 
             size_t iRow = 0;
             for (; iRow + VECTOR_BLOCK_SIZE <= nRowsToProcess; iRow += VECTOR_BLOCK_SIZE)
@@ -319,11 +416,39 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::predictByAllTrees(
             algorithmFPType * const val = lsData.local();
             const size_t iStartRow      = iBlock * dim.nRowsInBlock;
             const size_t nRowsToProcess = (iBlock == (dim.nDataBlocks - 1)) ? dim.nRowsTotal - iStartRow : dim.nRowsInBlock;
+            algorithmFPType * res       = resBD.get() + iStartRow;
+
+            if (_csr)
+            {
+                ReadRowsCSR<algorithmFPType, cpu> xBD(_csr, iStartRow, nRowsToProcess);
+                DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+                const size_t * rows = xBD.rows();
+                for (size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
+                {
+                    const size_t iFirst = rows[iRow] - rows[0];
+                    services::internal::service_memset_seq<algorithmFPType, cpu>(val, algorithmFPType(0), nClasses);
+                    predictByTreesSparse(val, 0, nTreesTotal, nClasses, xBD.values() + iFirst, xBD.cols() + iFirst, rows[iRow + 1] - rows[iRow]);
+                    res[iRow] = algorithmFPType(getMaxClass(val, nClasses));
+                }
+                return;
+            }
+
             ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(_data), iStartRow, nRowsToProcess);
             DAAL_CHECK_BLOCK_STATUS_THR(xBD);
-            algorithmFPType * res = resBD.get() + iStartRow;
 
             size_t iRow = 0;
+            if (_bUseQuickScorer)
+            {
+                for (; iRow < nRowsToProcess; iRow += VECTOR_BLOCK_SIZE)
+                {
+                    const size_t nRowsInBlock = (iRow + VECTOR_BLOCK_SIZE <= nRowsToProcess) ? VECTOR_BLOCK_SIZE : nRowsToProcess - iRow;
+                    services::internal::service_memset_seq<algorithmFPType, cpu>(val, algorithmFPType(0), nClasses * nRowsInBlock);
+                    safeStat |= _scorer->predict(xBD.get() + iRow * nCols, nRowsInBlock, nCols, val);
+
+                    for (size_t i = 0; i < nRowsInBlock; ++i) res[iRow + i] = algorithmFPType(getMaxClass(val + i * nClasses, nClasses));
+                }
+                return;
+            }
             for (; iRow + VECTOR_BLOCK_SIZE <= nRowsToProcess; iRow += VECTOR_BLOCK_SIZE)
             {
                 services::internal::service_memset_seq<algorithmFPType, cpu>(val, algorithmFPType(0), nClasses * VECTOR_BLOCK_SIZE);
@@ -38,6 +38,15 @@ namespace algorithms
 {
 namespace gbt
 {
+namespace prediction
+{
+namespace internal
+{
+template <typename algorithmFPType, CpuType cpu>
+class QuickScorer;
+} // namespace internal
+} // namespace prediction
+
 namespace classification
 {
 namespace prediction
@@ -48,17 +57,29 @@ template <typename algorithmFpType, gbt::classification::prediction::Method meth
 class PredictKernel : public daal::algorithms::Kernel
 {
 public:
+    PredictKernel() : _scorer(nullptr) {}
+    ~PredictKernel();
+
     /**
      *  \brief Compute gradient boosted trees prediction results.
      *
      *  \param a[in]    Matrix of input variables X
      *  \param m[in]   Gradient boosted trees model obtained on training stage
      *  \param r[out]   Prediction results
+     *  \param prob[out]   Probabilities of the classes, null if they are not computed
+     *  \param contributions[out]  Contributions of the features to the raw boosted values, null if they are not computed
      *  \param nClasses[in]     Number of classes in gradient boosted trees algorithm parameter
      *  \param nIterations[in]  Number of iterations to predict in gradient boosted trees algorithm parameter
      */
-    services::Status compute(services::HostAppIface * pHostApp, const NumericTable * a, const classification::Model * m, NumericTable * r,
-                             NumericTable * prob, size_t nClasses, size_t nIterations);
+    services::Status compute(services::HostAppIface * pHostApp, const NumericTable * a, const classification::ModelPtr & m, NumericTable * r,
+                             NumericTable * prob, NumericTable * contributions, size_t nClasses, size_t nIterations);
+
+private:
+    PredictKernel(const PredictKernel &);
+    PredictKernel & operator=(const PredictKernel &);
+
+    /* QuickScorer representation of the model predicted by the previous call, built by the quickScorer method only */
+    gbt::prediction::internal::QuickScorer<algorithmFpType, cpu> * _scorer;
 };
 
 } // namespace internal
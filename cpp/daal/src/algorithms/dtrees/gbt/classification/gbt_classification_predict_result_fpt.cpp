@@ -0,0 +1,69 @@
+/* file: gbt_classification_predict_result_fpt.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the gradient boosted trees classification algorithm interface
+//--
+*/
+
+#include "algorithms/gradient_boosted_trees/gbt_classification_predict_types.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "src/services/daal_strings.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace classification
+{
+namespace prediction
+{
+namespace interface2
+{
+using namespace daal::services;
+
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, const int method)
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, classifier::prediction::Result::allocate<algorithmFPType>(input, par, method));
+
+    const Parameter * algPar = dynamic_cast<const Parameter *>(par);
+    if (algPar && (algPar->resultsToCompute & computeFeatureContributions))
+    {
+        const data_management::NumericTablePtr dataPtr = static_cast<const Input *>(input)->get(classifier::prediction::data);
+        DAAL_CHECK_EX(dataPtr.get(), ErrorNullInputNumericTable, ArgumentName, dataStr());
+        //the contributions to the raw boosted value of the second class are enough to explain the binary classification
+        const size_t nOut = (algPar->nClasses > 2 ? algPar->nClasses : 1) * (dataPtr->getNumberOfColumns() + 1);
+        set(featureContributions, data_management::HomogenNumericTable<algorithmFPType>::create(nOut, dataPtr->getNumberOfRows(),
+                                                                                               data_management::NumericTableIface::doAllocate, &s));
+    }
+    return s;
+}
+
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par,
+                                                                    const int method);
+
+} // namespace interface2
+} // namespace prediction
+} // namespace classification
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
@@ -58,12 +58,17 @@ BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 {
-    classifier::training::Input * input = static_cast<classifier::training::Input *>(_in);
-    Result * result                     = static_cast<Result *>(_res);
+    Input * input   = static_cast<Input *>(_in);
+    Result * result = static_cast<Result *>(_res);
 
     NumericTable * x = input->get(classifier::training::data).get();
     NumericTable * y = input->get(classifier::training::labels).get();
 
+    NumericTable * validX = input->get(validationData).get();
+    NumericTable * validY = input->get(validationLabels).get();
+
+    const gbt::classification::Model * initialM = input->get(initialModel).get();
+
     gbt::classification::Model * m = result->get(classifier::training::model).get();
 
     const gbt::classification::training::Parameter * par = static_cast<gbt::classification::training::Parameter *>(_par);
@@ -72,7 +77,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
         dynamic_cast<daal::algorithms::engines::internal::BatchBaseImpl *>(par->engine.get());
 
     __DAAL_CALL_KERNEL(env, internal::ClassificationTrainBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
-                       daal::services::internal::hostApp(*input), x, y, *m, *result, *par, *engine);
+                       daal::services::internal::hostApp(*input), x, y, validX, validY, initialM, *m, *result, *par, *engine);
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
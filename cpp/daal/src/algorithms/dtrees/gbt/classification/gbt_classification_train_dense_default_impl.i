@@ -31,6 +31,7 @@
 #include "src/algorithms/dtrees/gbt/gbt_train_tree_builder.i"
 #include "src/algorithms/service_error_handling.h"
 #include "src/services/service_algo_utils.h"
+#include "src/services/service_data_utils.h"
 
 using namespace daal::algorithms::dtrees::training::internal;
 using namespace daal::algorithms::gbt::training::internal;
@@ -118,6 +119,33 @@ public:
             }
         });
     }
+
+    //L(y,f) = max(-z,0) + ln(1 + exp(-|z|)) where z = (2y - 1)*f, which is stable for large |f|
+    virtual algorithmFPType getLoss(size_t n, const algorithmFPType * y, const algorithmFPType * f) DAAL_C11_OVERRIDE
+    {
+        TVector<algorithmFPType, cpu, ScalableAllocator<cpu> > aExp(n);
+        auto exp = aExp.get();
+        if (!exp) return algorithmFPType(0);
+        const algorithmFPType expThreshold = daal::internal::Math<algorithmFPType, cpu>::vExpThreshold();
+        const algorithmFPType sum = LoopHelper<cpu>::template sum<algorithmFPType>(n, [&](size_t start, size_t end) -> algorithmFPType {
+            algorithmFPType lsum = 0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = start; i < end; i++)
+            {
+                const algorithmFPType z = y[i] > algorithmFPType(0.5) ? f[i] : -f[i];
+                exp[i]                  = z < 0 ? z : -z;
+                if (exp[i] < expThreshold) exp[i] = expThreshold;
+                if (z < 0) lsum -= z;
+            }
+            daal::internal::Math<algorithmFPType, cpu>::vExp(end - start, exp + start, exp + start);
+            daal::internal::Math<algorithmFPType, cpu>::vLog1p(end - start, exp + start, exp + start);
+            PRAGMA_ICC_NO16(omp simd reduction(+ : lsum))
+            for (size_t i = start; i < end; i++) lsum += exp[i];
+            return lsum;
+        });
+        return sum / algorithmFPType(n);
+    }
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -155,6 +183,27 @@ public:
         });
     }
 
+    virtual algorithmFPType getLoss(size_t n, const algorithmFPType * y, const algorithmFPType * f) DAAL_C11_OVERRIDE
+    {
+        static const size_t s_cMaxClassesBufSize = 12;
+        const bool bUseTLS(_nClasses > s_cMaxClassesBufSize);
+        daal::TlsMem<algorithmFPType, cpu> lsData(_nClasses);
+        const algorithmFPType minProb = daal::services::internal::EpsilonVal<algorithmFPType>::get();
+        const algorithmFPType sum = LoopHelper<cpu>::template sum<algorithmFPType>(n, [&](size_t start, size_t end) -> algorithmFPType {
+            algorithmFPType buf[s_cMaxClassesBufSize];
+            algorithmFPType * p  = bUseTLS ? lsData.local() : buf;
+            algorithmFPType lsum = 0;
+            for (size_t i = start; i < end; i++)
+            {
+                getSoftmax(f + _nClasses * i, p);
+                const algorithmFPType py = p[size_t(y[i])];
+                lsum -= daal::internal::Math<algorithmFPType, cpu>::sLog(py < minProb ? minProb : py);
+            }
+            return lsum;
+        });
+        return sum / algorithmFPType(n);
+    }
+
 protected:
     void getSoftmax(const algorithmFPType * arg, algorithmFPType * res) const
     {
@@ -326,12 +375,15 @@ services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::c
     tmpPar.minBinSize                  = par.minBinSize;
     tmpPar.internalOptions             = par.internalOptions;
     tmpPar.loss                        = par.loss;
-    return compute(pHost, x, y, m, res, tmpPar, engine);
+    tmpPar.gradientBits                = par.gradientBits;
+    return compute(pHost, x, y, nullptr, nullptr, nullptr, m, res, tmpPar, engine);
 }
 template <typename algorithmFPType, gbt::classification::training::Method method, CpuType cpu>
 services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::compute(HostAppIface * pHost, const NumericTable * x,
-                                                                                       const NumericTable * y, gbt::classification::Model & m,
-                                                                                       Result & res, const Parameter & par,
+                                                                                       const NumericTable * y, const NumericTable * validX,
+                                                                                       const NumericTable * validY,
+                                                                                       const gbt::classification::Model * initialModel,
+                                                                                       gbt::classification::Model & m, Result & res, const Parameter & par,
                                                                                        engines::internal::BatchBaseImpl & engine)
 {
     const size_t nFeaturesPerNode = par.featuresPerNode ? par.featuresPerNode : x->getNumberOfColumns();
@@ -341,14 +393,7 @@ services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::c
     services::Status s;
     dtrees::internal::IndexedFeatures indexedFeatures;
     dtrees::internal::FeatureTypes featTypes;
-    DAAL_CHECK_MALLOC(featTypes.init(*x));
-
-    if (!par.memorySavingMode)
-    {
-        BinParams prm(par.maxBins, par.minBinSize);
-        DAAL_CHECK_STATUS(s,
-                          (indexedFeatures.init<algorithmFPType, cpu>(*x, &featTypes, par.splitMethod == gbt::training::inexact ? &prm : nullptr)));
-    }
+    DAAL_CHECK_STATUS(s, (initIndexedFeatures<algorithmFPType, cpu>(x, par, indexedFeatures, featTypes)));
 
     WriteOnlyRows<algorithmFPType, cpu> weightsRows, totalCoverRows, coverRows, totalGainRows, gainRows;
     const gbt::classification::training::interface2::Parameter * parPtr =
@@ -384,25 +429,28 @@ services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::c
     algorithmFPType * ptrTotalGain  = totalGainRows.get();
     algorithmFPType * ptrGain       = gainRows.get();
 
+    const gbt::internal::ModelImpl * initialModelImpl =
+        initialModel ? static_cast<const daal::algorithms::gbt::classification::internal::ModelImpl *>(initialModel) : nullptr;
+
     if (inexactWithHistMethod)
     {
         if (indexedFeatures.maxNumIndices() <= 256)
             return computeImpl<algorithmFPType, cpu, uint8_t, TrainBatchTask<algorithmFPType, uint8_t, method, cpu>, Result>(
-                pHost, x, y, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl *>(&m), par, engine, par.nClasses,
+                pHost, x, y, validX, validY, initialModelImpl, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl *>(&m), par, engine, par.nClasses,
                 indexedFeatures, featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
         else if (indexedFeatures.maxNumIndices() <= 65536)
             return computeImpl<algorithmFPType, cpu, uint16_t, TrainBatchTask<algorithmFPType, uint16_t, method, cpu>, Result>(
-                pHost, x, y, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl *>(&m), par, engine, par.nClasses,
+                pHost, x, y, validX, validY, initialModelImpl, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl *>(&m), par, engine, par.nClasses,
                 indexedFeatures, featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
         else
             return computeImpl<algorithmFPType, cpu, uint32_t, TrainBatchTask<algorithmFPType, uint32_t, method, cpu>, Result>(
-                pHost, x, y, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl *>(&m), par, engine, par.nClasses,
+                pHost, x, y, validX, validY, initialModelImpl, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl *>(&m), par, engine, par.nClasses,
                 indexedFeatures, featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
     }
     else
     {
         return computeImpl<algorithmFPType, cpu, uint32_t, TrainBatchTask<algorithmFPType, uint32_t, method, cpu>, Result>(
-            pHost, x, y, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl *>(&m), par, engine, par.nClasses, indexedFeatures,
+            pHost, x, y, validX, validY, initialModelImpl, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl *>(&m), par, engine, par.nClasses, indexedFeatures,
             featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
     }
 }
@@ -52,8 +52,9 @@ public:
     services::Status compute(HostAppIface * pHost, const NumericTable * x, const NumericTable * y, gbt::classification::Model & m, Result & res,
                              const interface1::Parameter & par,
                              engines::internal::BatchBaseImpl & engine); // remove this function when interface1::Parameter becomes deprecated
-    services::Status compute(HostAppIface * pHost, const NumericTable * x, const NumericTable * y, gbt::classification::Model & m, Result & res,
-                             const interface2::Parameter & par, engines::internal::BatchBaseImpl & engine);
+    services::Status compute(HostAppIface * pHost, const NumericTable * x, const NumericTable * y, const NumericTable * validX,
+                             const NumericTable * validY, const gbt::classification::Model * initialModel, gbt::classification::Model & m,
+                             Result & res, const interface2::Parameter & par, engines::internal::BatchBaseImpl & engine);
 };
 
 } // namespace internal
@@ -0,0 +1,126 @@
+/* file: gbt_classification_training_input.cpp */
+/*******************************************************************************
+* Copyright 2014-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of gradient boosted trees algorithm classes.
+//--
+*/
+
+#include "algorithms/gradient_boosted_trees/gbt_classification_training_types.h"
+#include "src/services/daal_strings.h"
+#include "src/algorithms/dtrees/gbt/classification/gbt_classification_model_impl.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace classification
+{
+namespace training
+{
+namespace interface1
+{
+Input::Input() : classifier::training::Input(lastModelInputId + 1) {}
+
+NumericTablePtr Input::get(gbt::classification::training::InputId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+void Input::set(gbt::classification::training::InputId id, const NumericTablePtr & value)
+{
+    Argument::set(id, value);
+}
+
+gbt::classification::ModelPtr Input::get(ModelInputId id) const
+{
+    return staticPointerCast<gbt::classification::Model, SerializationIface>(Argument::get(id));
+}
+
+void Input::set(ModelInputId id, const gbt::classification::ModelPtr & value)
+{
+    Argument::set(id, value);
+}
+
+Status Input::check(const daal::algorithms::Parameter * parameter, int method) const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, classifier::training::Input::check(parameter, method));
+
+    const gbt::training::Parameter * par = dynamic_cast<const gbt::training::Parameter *>(parameter);
+    DAAL_CHECK(par, ErrorNullParameterNotSupported);
+    DAAL_CHECK_EX(par->validationMetric != gbt::training::meanAbsoluteError, ErrorIncorrectParameter, ParameterName, validationMetricStr());
+    const classifier::Parameter * classifierPar = dynamic_cast<const classifier::Parameter *>(parameter);
+    DAAL_CHECK(classifierPar, ErrorNullParameterNotSupported);
+
+    if (par->earlyStoppingRounds)
+    {
+        const NumericTablePtr validationDataTable = get(validationData);
+        DAAL_CHECK_STATUS(s, checkNumericTable(validationDataTable.get(), validationDataStr(), 0, 0, this->getNumberOfFeatures()));
+        const int unexpectedLabelsLayouts = (int)NumericTableIface::upperPackedSymmetricMatrix | (int)NumericTableIface::lowerPackedSymmetricMatrix
+                                            | (int)NumericTableIface::upperPackedTriangularMatrix
+                                            | (int)NumericTableIface::lowerPackedTriangularMatrix;
+        const NumericTablePtr validationLabelsTable = get(validationLabels);
+        const size_t nValidationRows                = validationDataTable->getNumberOfRows();
+        DAAL_CHECK_STATUS(s, checkNumericTable(validationLabelsTable.get(), validationLabelsStr(), unexpectedLabelsLayouts, 0, 1, nValidationRows));
+
+        //the validation metric indexes the class probabilities by the labels
+        DAAL_CHECK_EX(classifierPar->nClasses < INT_MAX, ErrorIncorrectParameter, ParameterName, nClassesStr());
+        const int nClasses = static_cast<int>(classifierPar->nClasses);
+        BlockDescriptor<int> labelsBlock;
+        DAAL_CHECK_STATUS(s, validationLabelsTable->getBlockOfRows(0, nValidationRows, readOnly, labelsBlock));
+        const int * const labels = labelsBlock.getBlockPtr();
+        bool bOutOfRange         = false;
+        for (size_t i = 0; i < nValidationRows; ++i)
+        {
+            bOutOfRange |= (labels[i] < 0) || (labels[i] >= nClasses);
+        }
+        DAAL_CHECK_STATUS(s, validationLabelsTable->releaseBlockOfRows(labelsBlock));
+        DAAL_CHECK_EX(!bOutOfRange, ErrorIncorrectClassLabels, ArgumentName, validationLabelsStr());
+    }
+    else
+    {
+        DAAL_CHECK_EX(get(validationData).get() == nullptr, ErrorIncorrectOptionalInput, ArgumentName, validationDataStr());
+        DAAL_CHECK_EX(get(validationLabels).get() == nullptr, ErrorIncorrectOptionalInput, ArgumentName, validationLabelsStr());
+    }
+
+    const gbt::classification::ModelPtr initialModelPtr = get(initialModel);
+    if (initialModelPtr)
+    {
+        DAAL_CHECK_EX(dynamic_cast<const gbt::classification::internal::ModelImpl *>(initialModelPtr.get()), ErrorIncorrectTypeOfModel, ArgumentName,
+                      initialModelStr());
+        DAAL_CHECK_EX(initialModelPtr->getNumberOfFeatures() == this->getNumberOfFeatures(), ErrorIncorrectNumberOfFeatures, ArgumentName,
+                      initialModelStr());
+        //the model of the same number of classes consists of the same number of trees per iteration
+        const size_t nTreesPerIteration = classifierPar->nClasses > 2 ? classifierPar->nClasses : 1;
+        DAAL_CHECK_EX(initialModelPtr->numberOfTrees() % nTreesPerIteration == 0, ErrorIncorrectSizeOfModel, ArgumentName, initialModelStr());
+    }
+    return s;
+}
+
+} // namespace interface1
+} // namespace training
+} // namespace classification
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
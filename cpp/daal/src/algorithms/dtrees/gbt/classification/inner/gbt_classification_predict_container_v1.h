@@ -58,14 +58,15 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     classifier::prediction::Result * result = static_cast<classifier::prediction::Result *>(_res);
 
     NumericTable * a               = static_cast<NumericTable *>(input->get(classifier::prediction::data).get());
-    gbt::classification::Model * m = static_cast<gbt::classification::Model *>(input->get(classifier::prediction::model).get());
+    const gbt::classification::ModelPtr m =
+        services::staticPointerCast<gbt::classification::Model, classifier::Model>(input->get(classifier::prediction::model));
     NumericTable * r               = static_cast<NumericTable *>(result->get(classifier::prediction::prediction).get());
 
     daal::services::Environment::env & env                             = *_env;
     const gbt::classification::prediction::interface1::Parameter * par = static_cast<gbt::classification::prediction::interface1::Parameter *>(_par);
 
     __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
-                       daal::services::internal::hostApp(*input), a, m, r, nullptr, par->nClasses, par->nIterations);
+                       daal::services::internal::hostApp(*input), a, m, r, nullptr, nullptr, par->nClasses, par->nIterations);
 }
 
 } // namespace interface1
@@ -0,0 +1,113 @@
+/* file: gbt_low_latency_predictor_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Scoring and finalization kernels of the low latency predictors of gradient boosted trees models.
+//  The file is compiled for every CPU, the kernel for the current CPU is selected by the scorer.
+//--
+*/
+
+#include "src/algorithms/dtrees/gbt/gbt_low_latency_predictor_impl.h"
+#include "src/algorithms/dtrees/gbt/gbt_predict_dense_default_impl.i"
+#include "src/externals/service_math.h"
+#include "src/externals/service_memory.h"
+#include "src/services/service_data_utils.h"
+#include "src/services/service_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace prediction
+{
+namespace internal
+{
+template <typename algorithmFPType, CpuType cpu>
+void predictLowLatency(const LowLatencyScorer & scorer, const algorithmFPType * x, size_t nRows, algorithmFPType * res)
+{
+    typedef LowLatencyScorer::TreeType TreeType;
+    const size_t nFeatures                           = scorer.getNumberOfFeatures();
+    const size_t nOutputs                            = scorer.getNumberOfOutputs();
+    const size_t nTrees                              = scorer.getNumberOfTrees();
+    const dtrees::internal::FeatureTypes & featTypes = scorer.getFeatureTypes();
+
+    services::internal::service_memset_seq<algorithmFPType, cpu>(res, algorithmFPType(0), nRows * nOutputs);
+    for (size_t iTree = 0; iTree < nTrees; ++iTree)
+    {
+        const TreeType & tree       = scorer.getTree(iTree);
+        algorithmFPType * const out = res + iTree % nOutputs;
+        // all the rows are scored by the tree while it stays in cache
+        for (size_t iRow = 0; iRow < nRows; ++iRow)
+        {
+            out[iRow * nOutputs] += predictForTree<algorithmFPType, TreeType, cpu>(tree, featTypes, x + iRow * nFeatures);
+        }
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void finalizeLowLatencyClassification(size_t nClasses, algorithmFPType * raw, size_t nRows, algorithmFPType * labels, algorithmFPType * probabilities)
+{
+    if (nClasses == 2)
+    {
+        const algorithmFPType label[2] = { algorithmFPType(1.), algorithmFPType(0.) };
+        if (labels)
+        {
+            //probablity is a sigmoid(f) hence sign(f) can be checked
+            for (size_t iRow = 0; iRow < nRows; ++iRow) labels[iRow] = label[services::internal::SignBit<algorithmFPType, cpu>::get(raw[iRow])];
+        }
+        if (probabilities)
+        {
+            daal::internal::Math<algorithmFPType, cpu>::vExp(nRows, raw, raw);
+            for (size_t iRow = 0; iRow < nRows; ++iRow)
+            {
+                probabilities[2 * iRow + 1] = raw[iRow] / (algorithmFPType(1.) + raw[iRow]);
+                probabilities[2 * iRow]     = algorithmFPType(1.) - probabilities[2 * iRow + 1];
+            }
+        }
+        return;
+    }
+
+    for (size_t iRow = 0; iRow < nRows; ++iRow)
+    {
+        algorithmFPType * const val = raw + iRow * nClasses;
+        const size_t maxClass       = services::internal::getMaxElementIndex<algorithmFPType, cpu>(val, nClasses);
+        if (labels) labels[iRow] = algorithmFPType(maxClass);
+        if (!probabilities) continue;
+
+        /* Softmax with the maximal raw value subtracted to avoid overflow of the exponent */
+        const algorithmFPType maxVal = val[maxClass];
+        for (size_t iClass = 0; iClass < nClasses; ++iClass) val[iClass] -= maxVal;
+        daal::internal::Math<algorithmFPType, cpu>::vExp(nClasses, val, val);
+        algorithmFPType sum(0);
+        for (size_t iClass = 0; iClass < nClasses; ++iClass) sum += val[iClass];
+        algorithmFPType * const prob = probabilities + iRow * nClasses;
+        for (size_t iClass = 0; iClass < nClasses; ++iClass) prob[iClass] = val[iClass] / sum;
+    }
+}
+
+template void predictLowLatency<DAAL_FPTYPE, DAAL_CPU>(const LowLatencyScorer & scorer, const DAAL_FPTYPE * x, size_t nRows, DAAL_FPTYPE * res);
+template void finalizeLowLatencyClassification<DAAL_FPTYPE, DAAL_CPU>(size_t nClasses, DAAL_FPTYPE * raw, size_t nRows, DAAL_FPTYPE * labels,
+                                                                      DAAL_FPTYPE * probabilities);
+
+} // namespace internal
+} // namespace prediction
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
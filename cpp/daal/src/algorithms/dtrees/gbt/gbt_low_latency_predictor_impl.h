@@ -0,0 +1,138 @@
+/* file: gbt_low_latency_predictor_impl.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the scorer used by the low latency predictors of gradient boosted trees models.
+//--
+*/
+
+#ifndef __GBT_LOW_LATENCY_PREDICTOR_IMPL_H__
+#define __GBT_LOW_LATENCY_PREDICTOR_IMPL_H__
+
+#include "src/algorithms/dtrees/gbt/gbt_model_impl.h"
+#include "src/algorithms/dtrees/dtrees_feature_type_helper.h"
+#include "src/externals/service_dispatch.h"
+#include "src/services/service_arrays.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace prediction
+{
+namespace internal
+{
+/* Number of rows processed by the low latency predictors at once, defines the size of their buffers */
+const size_t LOW_LATENCY_BLOCK_SIZE = 16;
+
+class LowLatencyScorer;
+
+// Computes nRows x nOutputs raw values, the tree iTree contributes to the output iTree % nOutputs.
+// Instantiated for every CPU in gbt_low_latency_predictor_fpt_cpu.cpp
+template <typename algorithmFPType, CpuType cpu>
+void predictLowLatency(const LowLatencyScorer & scorer, const algorithmFPType * x, size_t nRows, algorithmFPType * res);
+
+// Converts the raw values of the classification model into the labels and the probabilities of the classes, null if they are not computed.
+// The binary classification model has one raw value per row, multiclass one has nClasses values.
+// Instantiated for every CPU in gbt_low_latency_predictor_fpt_cpu.cpp
+template <typename algorithmFPType, CpuType cpu>
+void finalizeLowLatencyClassification(size_t nClasses, algorithmFPType * raw, size_t nRows, algorithmFPType * labels, algorithmFPType * probabilities);
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Computes raw boosted values of the model on the calling thread.
+// The trees are collected and the kernels for the current CPU are selected once,
+// so scoring requires neither numeric tables nor memory allocations.
+//////////////////////////////////////////////////////////////////////////////////////////
+class LowLatencyScorer
+{
+public:
+    typedef gbt::internal::GbtDecisionTree TreeType;
+
+    LowLatencyScorer() : _nFeatures(0), _nOutputs(0), _predictFloat(nullptr), _predictDouble(nullptr), _finalizeFloat(nullptr), _finalizeDouble(nullptr)
+    {}
+
+    // The categorical features are defined by the dictionary of featureTypes, all the features are ordered if it is null
+    services::Status init(const gbt::internal::ModelImpl & model, size_t nFeatures, size_t nOutputs,
+                          const data_management::NumericTable * featureTypes)
+    {
+        const size_t nTrees = model.size();
+        DAAL_CHECK(nTrees, services::ErrorNullModel);
+        _aTree.reset(nTrees);
+        DAAL_CHECK_MALLOC(_aTree.get());
+        for (size_t i = 0; i < nTrees; ++i) _aTree[i] = model.at(i);
+        if (featureTypes)
+        {
+            DAAL_CHECK(featureTypes->getNumberOfColumns() == nFeatures, services::ErrorIncorrectNumberOfFeatures);
+            DAAL_CHECK_MALLOC(_featHelper.init(*featureTypes));
+        }
+        _nFeatures = nFeatures;
+        _nOutputs  = nOutputs;
+
+#define DAAL_SELECT_LOW_LATENCY_KERNELS(cpuId, scorer) (scorer)->selectKernels<cpuId>();
+        DAAL_DISPATCH_FUNCTION_BY_CPU(DAAL_SELECT_LOW_LATENCY_KERNELS, this);
+#undef DAAL_SELECT_LOW_LATENCY_KERNELS
+        return services::Status();
+    }
+
+    size_t getNumberOfFeatures() const { return _nFeatures; }
+    size_t getNumberOfOutputs() const { return _nOutputs; }
+    size_t getNumberOfTrees() const { return _aTree.size(); }
+    const TreeType & getTree(size_t iTree) const { return *_aTree[iTree]; }
+    const dtrees::internal::FeatureTypes & getFeatureTypes() const { return _featHelper; }
+
+    void predict(const float * x, size_t nRows, float * res) const { _predictFloat(*this, x, nRows, res); }
+    void predict(const double * x, size_t nRows, double * res) const { _predictDouble(*this, x, nRows, res); }
+
+    void finalizeClassification(size_t nClasses, float * raw, size_t nRows, float * labels, float * probabilities) const
+    {
+        _finalizeFloat(nClasses, raw, nRows, labels, probabilities);
+    }
+    void finalizeClassification(size_t nClasses, double * raw, size_t nRows, double * labels, double * probabilities) const
+    {
+        _finalizeDouble(nClasses, raw, nRows, labels, probabilities);
+    }
+
+    template <CpuType cpu>
+    void selectKernels()
+    {
+        _predictFloat   = &predictLowLatency<float, cpu>;
+        _predictDouble  = &predictLowLatency<double, cpu>;
+        _finalizeFloat  = &finalizeLowLatencyClassification<float, cpu>;
+        _finalizeDouble = &finalizeLowLatencyClassification<double, cpu>;
+    }
+
+private:
+    TArray<const TreeType *, sse2> _aTree;
+    dtrees::internal::FeatureTypes _featHelper;
+    size_t _nFeatures;
+    size_t _nOutputs;
+    void (*_predictFloat)(const LowLatencyScorer &, const float *, size_t, float *);
+    void (*_predictDouble)(const LowLatencyScorer &, const double *, size_t, double *);
+    void (*_finalizeFloat)(size_t, float *, size_t, float *, float *);
+    void (*_finalizeDouble)(size_t, double *, size_t, double *, double *);
+};
+
+} // namespace internal
+} // namespace prediction
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -219,6 +219,31 @@ void ModelImpl::clear()
     super::clear();
 }
 
+void ModelImpl::truncate(const size_t nTrees)
+{
+    for (size_t i = size(); i > nTrees; --i)
+    {
+        _serializationData->erase(i - 1);
+        _impurityTables->erase(i - 1);
+        _nNodeSampleTables->erase(i - 1);
+        _nTree.dec();
+    }
+}
+
+void ModelImpl::addTrees(const ModelImpl & other)
+{
+    const size_t nImpurityTables   = other._impurityTables.get() ? other._impurityTables->size() : 0;
+    const size_t nNodeSampleTables = other._nNodeSampleTables.get() ? other._nNodeSampleTables->size() : 0;
+    for (size_t i = 0; i < other.size(); ++i)
+    {
+        _nTree.inc();
+
+        _serializationData->push_back((*other._serializationData)[i]);
+        _impurityTables->push_back(i < nImpurityTables ? (*other._impurityTables)[i] : SerializationIfacePtr());
+        _nNodeSampleTables->push_back(i < nNodeSampleTables ? (*other._nNodeSampleTables)[i] : SerializationIfacePtr());
+    }
+}
+
 void ModelImpl::destroy()
 {
     super::destroy();
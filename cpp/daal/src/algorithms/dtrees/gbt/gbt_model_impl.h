@@ -268,6 +268,10 @@ public:
     bool reserve(const size_t nTrees);
     bool resize(const size_t nTrees);
     void clear();
+    //removes the trees added after the first nTrees ones
+    void truncate(const size_t nTrees);
+    //appends the trees of the other model, the trees are shared by both models
+    void addTrees(const ModelImpl & other);
 
     const GbtDecisionTree * at(const size_t idx) const;
 
@@ -284,9 +288,13 @@ public:
     static services::Status treeToTable(TreeType & t, gbt::internal::GbtDecisionTree ** pTbl, HomogenNumericTable<double> ** pTblImp,
                                         HomogenNumericTable<int> ** pTblSmplCnt, size_t nFeature);
 
-protected:
+    //numbers of the training observations in the nodes of the tree, null if the model does not contain them
+    using super::getNodeSampleCount;
+
     static bool nodeIsDummyLeaf(size_t idx, const GbtDecisionTree & gbtTree);
     static bool nodeIsLeaf(size_t idx, const GbtDecisionTree & gbtTree, const size_t lvl);
+
+protected:
     static size_t getIdxOfParent(const size_t sonIdx);
     static void getMaxLvl(const dtrees::internal::DecisionTreeNode * const arr, const size_t idx, size_t & maxLvl, size_t curLvl = 0);
 
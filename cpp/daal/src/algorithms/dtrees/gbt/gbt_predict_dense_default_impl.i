@@ -124,6 +124,27 @@ inline algorithmFPType predictForTree(const DecisionTreeType & t, const FeatureT
     return values[i];
 }
 
+//the observation is given in CSR format: values and one-based column indices of its non-zero entries in increasing order
+template <typename algorithmFPType, typename DecisionTreeType, CpuType cpu>
+inline algorithmFPType predictForTreeSparse(const DecisionTreeType & t, const FeatureTypes & featTypes, const algorithmFPType * x,
+                                            const size_t * colIndices, size_t nNonZeros)
+{
+    const ModelFPType * const values        = (const ModelFPType *)t.getSplitPoints() - 1;
+    const FeatureIndexType * const fIndexes = t.getFeatureIndexesForSplit() - 1;
+
+    const FeatureIndexType maxLvl = t.getMaxLvl();
+
+    FeatureIndexType i = 1;
+
+    for (FeatureIndexType itr = 0; itr < maxLvl; itr++)
+    {
+        const algorithmFPType val = dtrees::prediction::internal::getSparseValue<algorithmFPType, cpu>(x, colIndices, nNonZeros, fIndexes[i]);
+        i = i * 2 + (featTypes.isUnordered(fIndexes[i]) ? int(val) != int(values[i]) : val > values[i]);
+    }
+
+    return values[i];
+}
+
 template <typename algorithmFPType>
 struct TileDimensions
 {
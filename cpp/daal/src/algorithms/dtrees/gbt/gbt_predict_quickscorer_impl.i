@@ -0,0 +1,398 @@
+/* file: gbt_predict_quickscorer_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of gradient boosted trees prediction
+//  (quickScorer) method.
+//--
+*/
+/*
+//  REFERENCES
+//
+//  1. Claudio Lucchese, Franco Maria Nardini, Salvatore Orlando, Raffaele Perego,
+//     Nicola Tonellotto, Rossano Venturini
+//     QuickScorer: a Fast Algorithm to Rank Documents with Additive Ensembles
+//     of Regression Trees, SIGIR 2015
+*/
+
+#ifndef __GBT_PREDICT_QUICKSCORER_IMPL_I__
+#define __GBT_PREDICT_QUICKSCORER_IMPL_I__
+
+#include "src/algorithms/dtrees/gbt/gbt_model_impl.h"
+#include "src/algorithms/dtrees/dtrees_feature_type_helper.h"
+#include "src/algorithms/service_sort.h"
+#include "src/externals/service_memory.h"
+#include "src/services/service_arrays.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <intrin.h>
+#endif
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace prediction
+{
+namespace internal
+{
+/**
+ * Evaluates an ensemble of trees by QuickScorer algorithm.
+ *
+ * Every tree is represented by the bit vector of its leaves. The split nodes of all the trees are grouped by features
+ * and sorted by split points, so for the feature value x the nodes with split point less than x, i.e. the nodes where
+ * the observation goes to the right, form a contiguous range. Every such node clears the bits of the leaves of its left
+ * subtree, and the exit leaf of the tree is the leftmost leaf which bit is still set. The trees are split into blocks
+ * that fit into the cache, and all rows are evaluated by one block before the next one is processed.
+ */
+template <typename algorithmFPType, CpuType cpu>
+class QuickScorer
+{
+public:
+    typedef DAAL_UINT64 LeafMaskType;
+    typedef gbt::internal::GbtDecisionTree TreeType;
+
+    /* Number of leaves in one word of the bit vector */
+    static const size_t nLeavesInWord = 64;
+    /* Maximal depth of the tree supported by QuickScorer */
+    static const size_t maxTreeLevels = 16;
+    /* Size in bytes of the trees data processed as one block */
+    static const size_t blockSizeInBytes = 256 * 1024;
+
+    DAAL_NEW_DELETE();
+
+    QuickScorer() : _nFeatures(0), _nOutputs(0), _nBlocks(0), _maxBlockWords(0), _nTrees(0) {}
+
+    /* Returns true if the trees can be evaluated by QuickScorer */
+    static bool isSupported(const dtrees::internal::FeatureTypes & featTypes, const TreeType * const * trees, size_t nTrees)
+    {
+        if (featTypes.hasUnorderedFeatures()) return false;
+        for (size_t iTree = 0; iTree < nTrees; ++iTree)
+        {
+            if (trees[iTree]->getMaxLvl() > maxTreeLevels) return false;
+        }
+        return true;
+    }
+
+    /* Builds QuickScorer representation of the trees. The value of the tree iTree is added to the output iTree % nOutputs */
+    services::Status init(const TreeType * const * trees, size_t nTrees, size_t nFeatures, size_t nOutputs);
+
+    /* Builds QuickScorer representation of the first nTrees trees of the model unless it is built for them already.
+       The model is referenced while its representation is kept, so another model is never taken for it */
+    services::Status init(const algorithms::ModelPtr & model, const TreeType * const * trees, size_t nTrees, size_t nFeatures, size_t nOutputs)
+    {
+        if (_model && _model.get() == model.get() && _nTrees == nTrees && _nFeatures == nFeatures && _nOutputs == nOutputs)
+            return services::Status();
+        _model.reset();
+        services::Status s = init(trees, nTrees, nFeatures, nOutputs);
+        if (s)
+        {
+            _model  = model;
+            _nTrees = nTrees;
+        }
+        return s;
+    }
+
+    /* Adds the values of the trees for the rows of x to res, res is an nRows x nOutputs array */
+    services::Status predict(const algorithmFPType * x, size_t nRows, size_t nCols, algorithmFPType * res) const;
+
+protected:
+    struct NodeMask
+    {
+        uint32_t word;      /* Index of the first word of the left subtree leaves in the bit vector of the block */
+        uint32_t nWords;    /* Number of words cleared by the node, 0 if the node clears a part of one word */
+        LeafMaskType mask;  /* Mask applied to the word if nWords is 0 */
+    };
+
+    static size_t getNumberOfWords(const TreeType & tree)
+    {
+        const size_t nLeaves = size_t(1) << tree.getMaxLvl();
+        return nLeaves < nLeavesInWord ? 1 : nLeaves / nLeavesInWord;
+    }
+
+    static size_t getTreeSizeInBytes(const TreeType & tree)
+    {
+        const size_t nLeaves = size_t(1) << tree.getMaxLvl();
+        return (nLeaves - 1) * (sizeof(ModelFPType) + sizeof(NodeMask)) + nLeaves * sizeof(ModelFPType)
+               + getNumberOfWords(tree) * sizeof(LeafMaskType);
+    }
+
+    /* Returns true if the subtrees with roots at the given nodes of the same level are identical */
+    static bool isSameSubtree(const TreeType & tree, size_t iNode1, size_t iNode2, size_t level)
+    {
+        const ModelFPType * const splitPoints       = tree.getSplitPoints();
+        const FeatureIndexType * const featIndexes = tree.getFeatureIndexesForSplit();
+        if (splitPoints[iNode1] != splitPoints[iNode2]) return false;
+        if (level == tree.getMaxLvl()) return true;
+        if (featIndexes[iNode1] != featIndexes[iNode2]) return false;
+        return isSameSubtree(tree, 2 * iNode1 + 1, 2 * iNode2 + 1, level + 1) && isSameSubtree(tree, 2 * iNode1 + 2, 2 * iNode2 + 2, level + 1);
+    }
+
+    services::Status initBlock(const TreeType * const * trees, size_t iBlock, size_t iFirstTree, size_t nTrees);
+
+    static DAAL_FORCEINLINE size_t lowestSetBit(LeafMaskType mask)
+    {
+#if defined(_WIN32) || defined(_WIN64)
+        unsigned long index;
+        _BitScanForward64(&index, mask);
+        return index;
+#else
+        return __builtin_ctzll(mask);
+#endif
+    }
+
+protected:
+    size_t _nFeatures;
+    size_t _nOutputs;
+    size_t _nBlocks;
+    size_t _maxBlockWords;
+
+    TArray<size_t, cpu> _blockFirstTree;     /* Index of the first tree of the block, _nBlocks + 1 elements */
+    TArray<size_t, cpu> _blockFirstNode;     /* Index of the first node of the block for every feature, _nBlocks * _nFeatures + 1 elements */
+    TArray<size_t, cpu> _blockWords;         /* Size of the bit vector of the block */
+    TArray<uint32_t, cpu> _treeFirstWord;    /* Position of the bit vector of the tree in the bit vector of its block */
+    TArray<size_t, cpu> _treeFirstLeaf;      /* Position of the leaves of the tree in _leafValues */
+    TArray<ModelFPType, cpu> _nodeSplitPoint; /* Split points of the nodes sorted by features and split points */
+    TArray<NodeMask, cpu> _nodeMask;
+    TArray<ModelFPType, cpu> _leafValues;
+    algorithms::ModelPtr _model; /* Model the representation is built for */
+    size_t _nTrees;
+};
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status QuickScorer<algorithmFPType, cpu>::init(const TreeType * const * trees, size_t nTrees, size_t nFeatures, size_t nOutputs)
+{
+    _nFeatures = nFeatures;
+    _nOutputs  = nOutputs;
+
+    /* Split the trees into blocks that fit into the cache */
+    _blockFirstTree.reset(nTrees + 1);
+    DAAL_CHECK_MALLOC(_blockFirstTree.get());
+    _treeFirstWord.reset(nTrees);
+    DAAL_CHECK_MALLOC(_treeFirstWord.get());
+    _treeFirstLeaf.reset(nTrees);
+    DAAL_CHECK_MALLOC(_treeFirstLeaf.get());
+
+    _nBlocks          = 0;
+    size_t nNodes     = 0;
+    size_t nLeaves    = 0;
+    size_t blockBytes = 0;
+    for (size_t iTree = 0; iTree < nTrees; ++iTree)
+    {
+        const size_t treeBytes = getTreeSizeInBytes(*trees[iTree]);
+        if (iTree == 0 || blockBytes + treeBytes > blockSizeInBytes)
+        {
+            _blockFirstTree[_nBlocks++] = iTree;
+            blockBytes                  = 0;
+        }
+        blockBytes += treeBytes;
+
+        const size_t nTreeLeaves = size_t(1) << trees[iTree]->getMaxLvl();
+        _treeFirstLeaf[iTree]    = nLeaves;
+        nLeaves += nTreeLeaves;
+        nNodes += nTreeLeaves - 1;
+    }
+    _blockFirstTree[_nBlocks] = nTrees;
+
+    _blockFirstNode.reset(_nBlocks * _nFeatures + 1);
+    DAAL_CHECK_MALLOC(_blockFirstNode.get());
+    _blockWords.reset(_nBlocks);
+    DAAL_CHECK_MALLOC(_blockWords.get());
+    _nodeSplitPoint.reset(nNodes);
+    DAAL_CHECK_MALLOC(_nodeSplitPoint.get());
+    _nodeMask.reset(nNodes);
+    DAAL_CHECK_MALLOC(_nodeMask.get());
+    _leafValues.reset(nLeaves);
+    DAAL_CHECK_MALLOC(_leafValues.get());
+
+    services::Status status;
+    _blockFirstNode[0] = 0;
+    _maxBlockWords     = 0;
+    for (size_t iBlock = 0; iBlock < _nBlocks; ++iBlock)
+    {
+        DAAL_CHECK_STATUS(status, initBlock(trees, iBlock, _blockFirstTree[iBlock], _blockFirstTree[iBlock + 1] - _blockFirstTree[iBlock]));
+        if (_blockWords[iBlock] > _maxBlockWords) _maxBlockWords = _blockWords[iBlock];
+    }
+    return status;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status QuickScorer<algorithmFPType, cpu>::initBlock(const TreeType * const * trees, size_t iBlock, size_t iFirstTree, size_t nTrees)
+{
+    const size_t iFirstNode = _blockFirstNode[iBlock * _nFeatures];
+
+    size_t nMaxNodes = 0;
+    for (size_t iTree = iFirstTree; iTree < iFirstTree + nTrees; ++iTree) nMaxNodes += (size_t(1) << trees[iTree]->getMaxLvl()) - 1;
+
+    TArray<size_t, cpu> featureStartArr(_nFeatures + 1);
+    DAAL_CHECK_MALLOC(featureStartArr.get());
+    size_t * const featureStart = featureStartArr.get();
+    services::internal::service_memset_seq<size_t, cpu>(featureStart, 0, _nFeatures + 1);
+
+    TArray<FeatureIndexType, cpu> nodeFeatureArr(nMaxNodes + 1);
+    TArray<ModelFPType, cpu> nodeSplitPointArr(nMaxNodes + 1);
+    TArray<NodeMask, cpu> nodeMaskArr(nMaxNodes + 1);
+    DAAL_CHECK_MALLOC(nodeFeatureArr.get() && nodeSplitPointArr.get() && nodeMaskArr.get());
+
+    /* Collect the split nodes of the block. The nodes which subtrees are identical do not change the tree value and are skipped */
+    size_t nNodes      = 0;
+    size_t nBlockWords = 0;
+    for (size_t iTree = iFirstTree; iTree < iFirstTree + nTrees; ++iTree)
+    {
+        const TreeType & tree = *trees[iTree];
+        const size_t nLevels  = tree.getMaxLvl();
+        const size_t nLeaves  = size_t(1) << nLevels;
+
+        _treeFirstWord[iTree] = uint32_t(nBlockWords);
+        nBlockWords += getNumberOfWords(tree);
+
+        const ModelFPType * const splitPoints      = tree.getSplitPoints();
+        const FeatureIndexType * const featIndexes = tree.getFeatureIndexesForSplit();
+        services::internal::tmemcpy<ModelFPType, cpu>(_leafValues.get() + _treeFirstLeaf[iTree], splitPoints + nLeaves - 1, nLeaves);
+
+        for (size_t level = 0, iNode = 0; level < nLevels; ++level)
+        {
+            const size_t nLevelNodes = size_t(1) << level;
+            const size_t nLeftLeaves = size_t(1) << (nLevels - level - 1);
+            for (size_t iPos = 0; iPos < nLevelNodes; ++iPos, ++iNode)
+            {
+                if (isSameSubtree(tree, 2 * iNode + 1, 2 * iNode + 2, level + 1)) continue;
+                DAAL_ASSERT(featIndexes[iNode] < _nFeatures);
+
+                const size_t iFirstLeaf = iPos * 2 * nLeftLeaves;
+                NodeMask & node         = nodeMaskArr[nNodes];
+                node.word               = uint32_t(_treeFirstWord[iTree] + iFirstLeaf / nLeavesInWord);
+                if (nLeftLeaves >= nLeavesInWord)
+                {
+                    node.nWords = uint32_t(nLeftLeaves / nLeavesInWord);
+                    node.mask   = 0;
+                }
+                else
+                {
+                    node.nWords = 0;
+                    node.mask   = ~(((LeafMaskType(1) << nLeftLeaves) - 1) << (iFirstLeaf % nLeavesInWord));
+                }
+                nodeFeatureArr[nNodes]    = featIndexes[iNode];
+                nodeSplitPointArr[nNodes] = splitPoints[iNode];
+                ++featureStart[featIndexes[iNode] + 1];
+                ++nNodes;
+            }
+        }
+    }
+    _blockWords[iBlock] = nBlockWords;
+
+    /* Group the nodes by features */
+    for (size_t iFeature = 0; iFeature < _nFeatures; ++iFeature)
+    {
+        featureStart[iFeature + 1] += featureStart[iFeature];
+        _blockFirstNode[iBlock * _nFeatures + iFeature] = iFirstNode + featureStart[iFeature];
+    }
+    _blockFirstNode[(iBlock + 1) * _nFeatures] = iFirstNode + nNodes;
+
+    for (size_t i = 0; i < nNodes; ++i)
+    {
+        const size_t iDst     = _blockFirstNode[iBlock * _nFeatures + nodeFeatureArr[i]]++;
+        _nodeSplitPoint[iDst] = nodeSplitPointArr[i];
+        _nodeMask[iDst]       = nodeMaskArr[i];
+    }
+
+    /* Sort the nodes of every feature by split points, the feature indices of the nodes are not needed anymore */
+    uint32_t * const order = nodeFeatureArr.get();
+    for (size_t iFeature = 0; iFeature < _nFeatures; ++iFeature)
+    {
+        const size_t iBegin                             = iFirstNode + featureStart[iFeature];
+        const size_t n                                  = featureStart[iFeature + 1] - featureStart[iFeature];
+        _blockFirstNode[iBlock * _nFeatures + iFeature] = iBegin;
+        if (n < 2) continue;
+
+        for (size_t i = 0; i < n; ++i) order[i] = uint32_t(i);
+        daal::algorithms::internal::qSort<ModelFPType, uint32_t, cpu>(n, _nodeSplitPoint.get() + iBegin, order);
+
+        NodeMask * const masks = _nodeMask.get() + iBegin;
+        for (size_t i = 0; i < n; ++i) nodeMaskArr[i] = masks[order[i]];
+        services::internal::tmemcpy<NodeMask, cpu>(masks, nodeMaskArr.get(), n);
+    }
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status QuickScorer<algorithmFPType, cpu>::predict(const algorithmFPType * x, size_t nRows, size_t nCols, algorithmFPType * res) const
+{
+    TArray<LeafMaskType, cpu> bitVectorArr(_maxBlockWords);
+    DAAL_CHECK_MALLOC(bitVectorArr.get());
+    LeafMaskType * const bitVector = bitVectorArr.get();
+
+    const ModelFPType * const nodeSplitPoint = _nodeSplitPoint.get();
+    const NodeMask * const nodeMask          = _nodeMask.get();
+    const ModelFPType * const leafValues     = _leafValues.get();
+
+    for (size_t iBlock = 0; iBlock < _nBlocks; ++iBlock)
+    {
+        const size_t iFirstTree    = _blockFirstTree[iBlock];
+        const size_t iLastTree     = _blockFirstTree[iBlock + 1];
+        const size_t nWords        = _blockWords[iBlock];
+        const size_t * const first = _blockFirstNode.get() + iBlock * _nFeatures;
+
+        for (size_t iRow = 0; iRow < nRows; ++iRow)
+        {
+            const algorithmFPType * const xRow = x + iRow * nCols;
+            algorithmFPType * const resRow     = res + iRow * _nOutputs;
+
+            services::internal::service_memset_seq<LeafMaskType, cpu>(bitVector, ~LeafMaskType(0), nWords);
+
+            for (size_t iFeature = 0; iFeature < _nFeatures; ++iFeature)
+            {
+                const algorithmFPType value = xRow[iFeature];
+                const size_t iEnd           = first[iFeature + 1];
+                /* The observation goes to the right in the nodes with split point less than the value */
+                for (size_t i = first[iFeature]; i < iEnd && value > nodeSplitPoint[i]; ++i)
+                {
+                    const NodeMask & node = nodeMask[i];
+                    if (node.nWords)
+                    {
+                        services::internal::service_memset_seq<LeafMaskType, cpu>(bitVector + node.word, LeafMaskType(0), node.nWords);
+                    }
+                    else
+                    {
+                        bitVector[node.word] &= node.mask;
+                    }
+                }
+            }
+
+            for (size_t iTree = iFirstTree; iTree < iLastTree; ++iTree)
+            {
+                /* The exit leaf is never cleared, so the loop stops within the bit vector of the tree */
+                size_t iWord = _treeFirstWord[iTree];
+                while (!bitVector[iWord]) ++iWord;
+                const size_t iLeaf = (iWord - _treeFirstWord[iTree]) * nLeavesInWord + lowestSetBit(bitVector[iWord]);
+                resRow[iTree % _nOutputs] += leafValues[_treeFirstLeaf[iTree] + iLeaf];
+            }
+        }
+    }
+    return services::Status();
+}
+
+} /* namespace internal */
+} /* namespace prediction */
+} /* namespace gbt */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
@@ -0,0 +1,96 @@
+/* file: gbt_predict_shap_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the computation of feature contributions to
+//  gradient boosted trees predictions.
+//--
+*/
+
+#ifndef __GBT_PREDICT_SHAP_IMPL_I__
+#define __GBT_PREDICT_SHAP_IMPL_I__
+
+#include "src/algorithms/dtrees/gbt/gbt_model_impl.h"
+#include "src/algorithms/dtrees/dtrees_predict_shap_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace prediction
+{
+namespace internal
+{
+//////////////////////////////////////////////////////////////////////////////////////////
+// Access to the nodes of GbtDecisionTree by TreeSHAP algorithm, the leaves above the last
+// level of the tree are recognized by their dummy sons
+//////////////////////////////////////////////////////////////////////////////////////////
+struct GbtTreeShapView
+{
+    const gbt::internal::GbtDecisionTree * tree;
+    const int * nodeSampleCount;
+
+    bool isLeaf(size_t iNode, size_t lvl) const { return gbt::internal::ModelImpl::nodeIsLeaf(iNode, *tree, lvl); }
+    size_t left(size_t iNode) const { return 2 * iNode + 1; }
+    size_t right(size_t iNode) const { return 2 * iNode + 2; }
+    int featureIndex(size_t iNode) const { return int(tree->getFeatureIndexesForSplit()[iNode]); }
+    ModelFPType featureValue(size_t iNode) const { return tree->getSplitPoints()[iNode]; }
+    ModelFPType response(size_t iNode) const { return tree->getSplitPoints()[iNode]; }
+    size_t cover(size_t iNode) const { return size_t(nodeSampleCount[iNode]); }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Computes the contributions of the features to the sums of the responses of the first nTrees
+// trees of the model, the model should contain the numbers of training observations in the nodes.
+// The trees are split into nGroups groups by the remainder of their index divided by nGroups,
+// one group per class in multiclass classification, the contributions to the sum of the group
+// iGroup are stored in the columns from iGroup * (p + 1) to (iGroup + 1) * (p + 1) - 1
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+services::Status computeContributions(const gbt::internal::ModelImpl & m, size_t nTrees, const FeatureTypes & featTypes, const NumericTable * x,
+                                      NumericTable * contributions, size_t nGroups = 1)
+{
+    DAAL_ASSERT(nGroups && (nTrees % nGroups == 0));
+    const size_t nTreesInGroup = nTrees / nGroups;
+    TArray<GbtTreeShapView, cpu> aTree(nTreesInGroup);
+    DAAL_CHECK_MALLOC(aTree.get());
+    services::Status s;
+    for (size_t iGroup = 0; s && (iGroup < nGroups); ++iGroup)
+    {
+        for (size_t i = 0; i < nTreesInGroup; ++i)
+        {
+            const size_t iTree       = i * nGroups + iGroup;
+            aTree[i].tree            = m.at(iTree);
+            aTree[i].nodeSampleCount = m.getNodeSampleCount(iTree);
+            DAAL_CHECK(aTree[i].nodeSampleCount && aTree[i].nodeSampleCount[0] > 0, services::ErrorModelNotFullInitialized);
+        }
+        s = dtrees::prediction::internal::computeContributions<algorithmFPType, GbtTreeShapView, cpu>(
+            aTree.get(), nTreesInGroup, featTypes, x, algorithmFPType(1), contributions, iGroup * (x->getNumberOfColumns() + 1));
+    }
+    return s;
+}
+
+} /* namespace internal */
+} /* namespace prediction */
+} /* namespace gbt */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
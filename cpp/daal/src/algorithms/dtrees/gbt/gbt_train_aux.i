@@ -165,6 +165,58 @@ struct gh
     algorithmFPType value(algorithmFPType regLambda) const { return (g / (h + regLambda)) * g; }
 };
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Service class, pair (gradient, hessian) quantized to integers of at most 16 bits
+//////////////////////////////////////////////////////////////////////////////////////////
+template <CpuType cpu>
+struct ghQuantized
+{
+    short g; //gradient
+    short h; //hessian
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Service class, the integer sums of the quantized pairs (gradient, hessian) in a bin of the histogram
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename IntType, CpuType cpu>
+struct ghSumQuantized
+{
+    IntType g;
+    IntType h;
+    IntType n;
+    IntType dummy;
+};
+
+//integer types of the bins of the quantized histograms
+enum QuantizedBinType
+{
+    quantizedBinInt16,
+    quantizedBinInt32,
+    quantizedBinInt64
+};
+
+//returns the narrowest integer type of the bins that cannot overflow on a node with nRows rows,
+//the absolute values of the sums are bounded by nRows * qMax
+template <CpuType cpu>
+inline QuantizedBinType getQuantizedBinType(size_t nRows, size_t gradientBits)
+{
+    const DAAL_UINT64 qMax     = ((DAAL_UINT64)1 << (gradientBits - 1)) - 1;
+    const DAAL_UINT64 maxSum   = (DAAL_UINT64)nRows * qMax;
+    const DAAL_UINT64 maxCount = (DAAL_UINT64)nRows;
+    if (maxSum <= 0x7FFF && maxCount <= 0x7FFF) return quantizedBinInt16;
+    if (maxSum <= 0x7FFFFFFF && maxCount <= 0x7FFFFFFF) return quantizedBinInt32;
+    return quantizedBinInt64;
+}
+
+//returns the size in bytes of the bin of the quantized histogram
+template <CpuType cpu>
+inline size_t getQuantizedBinSize(QuantizedBinType binType)
+{
+    if (binType == quantizedBinInt16) return sizeof(ghSumQuantized<short, cpu>);
+    if (binType == quantizedBinInt32) return sizeof(ghSumQuantized<int, cpu>);
+    return sizeof(ghSumQuantized<DAAL_INT64, cpu>);
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Impurity data
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -181,6 +233,8 @@ class LossFunction : public Base
 public:
     virtual void getGradients(size_t n, size_t nRows, const algorithmFPType * y, const algorithmFPType * f, const IndexType * sampleInd,
                               algorithmFPType * gh) = 0;
+    //mean value of the loss function over n observations, f holds the arguments of the observations one after another
+    virtual algorithmFPType getLoss(size_t n, const algorithmFPType * y, const algorithmFPType * f) = 0;
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -485,11 +539,11 @@ struct MergedResult
         {
             res[i].release(data);
         }
-        res.~TVector<PartialResult, cpu, ScalableAllocator<cpu> >();
-        service_scalable_free<void, cpu>(this);
+        res.~TVector<PartialResult, cpu, ScratchAllocator<cpu> >();
+        services::internal::ScratchCalloc<MergedResult, cpu>::deallocate(this);
     }
     MergedResult(size_t size) : res(size) {}
-    TVector<PartialResult, cpu, ScalableAllocator<cpu> > res;
+    TVector<PartialResult, cpu, ScratchAllocator<cpu> > res;
 };
 
 template <CpuType cpu>
@@ -507,6 +561,25 @@ struct LoopHelper
             for (size_t i = 0; i < nBlocks; ++i) func(i);
         }
     }
+
+    //sum of func(start, end) over the blocks the range [0, n) is split into
+    template <typename algorithmFPType, typename Func>
+    static algorithmFPType sum(size_t n, Func func)
+    {
+        const size_t nBlocks   = getNBlocksForOpt<cpu>(threader_get_threads_number(), n);
+        const size_t nPerBlock = n / nBlocks;
+        const size_t nSurplus  = n % nBlocks;
+        TArrayScratch<algorithmFPType, cpu> sumsArr(nBlocks);
+        algorithmFPType * const sums = sumsArr.get();
+        run(nBlocks > 1, nBlocks, [&](size_t iBlock) {
+            const size_t start = iBlock + 1 > nSurplus ? nPerBlock * iBlock + nSurplus : (nPerBlock + 1) * iBlock;
+            const size_t end   = iBlock + 1 > nSurplus ? start + nPerBlock : start + (nPerBlock + 1);
+            sums[iBlock]       = func(start, end);
+        });
+        algorithmFPType res = 0;
+        for (size_t i = 0; i < nBlocks; ++i) res += sums[i];
+        return res;
+    }
 };
 
 template <typename T, CpuType cpu>
@@ -689,21 +762,23 @@ struct GHSumForTLS
 };
 
 template <typename T, typename algorithmFPType, CpuType cpu,
-          typename Allocator = services::internal::ScalableMalloc<ghSum<algorithmFPType, cpu>, cpu> >
+          typename Allocator = services::internal::ScratchMalloc<ghSum<algorithmFPType, cpu>, cpu> >
 class TlsGHSumMerge : public daal::tls<T *>
 {
 public:
     using super     = daal::tls<T *>;
     using GHSumType = ghSum<algorithmFPType, cpu>;
 
-    TlsGHSumMerge(size_t n) : super([=]() -> T * { return new (service_scalable_calloc<T, cpu>(1)) T(Allocator::allocate(n)); }) {}
+    TlsGHSumMerge(size_t n)
+        : super([=]() -> T * { return new (services::internal::ScratchCalloc<T, cpu>::allocate(1)) T(Allocator::allocate(n)); })
+    {}
 
     ~TlsGHSumMerge()
     {
         this->reduce([](T * ptr) -> void {
             Allocator::deallocate(ptr->ghSum);
             ptr->~T();
-            service_scalable_free<T, cpu>(ptr);
+            services::internal::ScratchCalloc<T, cpu>::deallocate(ptr);
         });
     }
 
@@ -733,13 +808,27 @@ struct GlobalStorages
     using TlsType   = TlsGHSumMerge<GHSumForTLS<GHSumType, cpu>, algorithmFPType, cpu>;
 
     GlobalStorages(size_t nFeatures, size_t nStor, size_t nUniq, size_t nGlobal)
-        : singleGHSums(nStor), GHForCols(nUniq, nGlobal), nUniquesArr(nFeatures)
+        : singleGHSums(nStor), GHForCols(nUniq, nGlobal), nUniquesArr(nFeatures), nGHSumsTls(nUniq), maxParentHists(0), nParentHists(0)
     {}
 
+    //the histograms of a parent node are kept until the histogram of its larger child is computed by subtraction,
+    //their number is bounded, the histograms of both children are computed from their rows when the bound is reached
+    bool holdParentHist()
+    {
+        if (size_t(nParentHists.inc()) <= maxParentHists) return true;
+        nParentHists.dec();
+        return false;
+    }
+
+    void releaseParentHist() { nParentHists.dec(); }
+
     GroupOfStorages<GHSumType, cpu> singleGHSums;
     GHSumsStorage<TlsType, cpu> GHForCols;
     TVector<size_t, cpu, ScalableAllocator<cpu> > nUniquesArr;
     size_t nDiffFeatMax;
+    size_t nGHSumsTls; //number of GHSumType elements in the thread local histograms, they also hold the widest quantized bins
+    size_t maxParentHists;
+    daal::services::AtomicInt nParentHists;
 
     BinIndexType * newFI;
 };
@@ -30,6 +30,10 @@
 #include "src/algorithms/dtrees/dtrees_predict_dense_default_impl.i"
 #include "src/algorithms/dtrees/gbt/gbt_internal.h"
 #include "src/algorithms/dtrees/gbt/gbt_train_aux.i"
+#include "src/algorithms/dtrees/gbt/gbt_predict_dense_default_impl.i"
+#include "src/externals/service_ittnotify.h"
+
+DAAL_ITTNOTIFY_DOMAIN(gbt.train.dense.default);
 
 namespace daal
 {
@@ -46,6 +50,60 @@ using namespace daal::algorithms::gbt::internal;
 
 typedef int RowIndexType;
 
+//adds the responses of nTbl trees to the loss function arguments f of the observations x,
+//the response of the tree aTbl[k] is added to the argument k % nTrees of an observation
+template <typename algorithmFPType, CpuType cpu>
+services::Status addTreesResponses(const NumericTable * x, const FeatureTypes & featTypes, const gbt::internal::GbtDecisionTree * const * aTbl,
+                                   size_t nTbl, size_t nTrees, algorithmFPType * f)
+{
+    using namespace gbt::prediction::internal;
+    typedef gbt::internal::GbtDecisionTree TreeType;
+    const size_t nRowsInBlock  = 512;
+    const size_t nRows         = x->getNumberOfRows();
+    const size_t nCols         = x->getNumberOfColumns();
+    const size_t nBlocks       = nRows / nRowsInBlock + !!(nRows % nRowsInBlock);
+    CSRNumericTableIface * csr = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(x));
+
+    daal::SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t iStartRow      = iBlock * nRowsInBlock;
+        const size_t nRowsToProcess = (iBlock + 1 == nBlocks) ? nRows - iStartRow : nRowsInBlock;
+        algorithmFPType * res       = f + iStartRow * nTrees;
+        if (csr)
+        {
+            ReadRowsCSR<algorithmFPType, cpu> xBD(csr, iStartRow, nRowsToProcess);
+            DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+            const size_t * rows = xBD.rows();
+            for (size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
+            {
+                const size_t iFirst = rows[iRow] - rows[0];
+                for (size_t iTbl = 0; iTbl < nTbl; ++iTbl)
+                    res[iRow * nTrees + iTbl % nTrees] += predictForTreeSparse<algorithmFPType, TreeType, cpu>(
+                        *aTbl[iTbl], featTypes, xBD.values() + iFirst, xBD.cols() + iFirst, rows[iRow + 1] - rows[iRow]);
+            }
+            return;
+        }
+
+        ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(x), iStartRow, nRowsToProcess);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+        const algorithmFPType * px = xBD.get();
+        algorithmFPType v[VECTOR_BLOCK_SIZE];
+        for (size_t iTbl = 0; iTbl < nTbl; ++iTbl)
+        {
+            const size_t iTree = iTbl % nTrees;
+            size_t iRow        = 0;
+            for (; iRow + VECTOR_BLOCK_SIZE <= nRowsToProcess; iRow += VECTOR_BLOCK_SIZE)
+            {
+                predictForTreeVector<algorithmFPType, TreeType, cpu>(*aTbl[iTbl], featTypes, px + iRow * nCols, v);
+                for (size_t k = 0; k < VECTOR_BLOCK_SIZE; ++k) res[(iRow + k) * nTrees + iTree] += v[k];
+            }
+            for (; iRow < nRowsToProcess; ++iRow)
+                res[iRow * nTrees + iTree] += predictForTree<algorithmFPType, TreeType, cpu>(*aTbl[iTbl], featTypes, px + iRow * nCols);
+        }
+    });
+    return safeStat.detach();
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Base task class. Implements general pipeline of tree building
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -96,6 +154,15 @@ public:
     bool isIndirect() const { return _bIndirect; }
     double computeLeafWeightUpdateF(const int * idx, size_t n, const ImpurityType & imp, size_t iTree);
     void updateOOB(size_t iTree, TreeType & t);
+    //value of the validation metric on n observations with the responses y and the loss function arguments f
+    algorithmFPType validationMetric(size_t n, const algorithmFPType * y, const algorithmFPType * f);
+    //the boosting is continued from the loss function arguments computed by the trees of a trained model
+    services::Status continueFrom(const gbt::internal::GbtDecisionTree * const * aTbl, size_t nTbl)
+    {
+        initializeF(algorithmFPType(0));
+        _bContinued = true;
+        return addTreesResponses<algorithmFPType, cpu>(_data, _featHelper, aTbl, nTbl, _nTrees, f());
+    }
     bool terminateCriteria(size_t nSamples, size_t level, const ImpurityType & imp) const
     {
         return ((nSamples < 2 * _par.minObservationsInLeafNode) || ((_par.maxTreeDepth > 0) && (level >= _par.maxTreeDepth)));
@@ -213,6 +280,7 @@ protected:
     bool _bParallelNodes    = false;
     bool _bParallelTrees    = false;
     bool _bIndirect         = true;
+    bool _bContinued        = false;
 };
 
 template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
@@ -263,12 +331,57 @@ double TrainBatchTaskBase<algorithmFPType, BinIndexType, cpu>::computeLeafWeight
     return res + inc;
 }
 
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+algorithmFPType TrainBatchTaskBase<algorithmFPType, BinIndexType, cpu>::validationMetric(size_t n, const algorithmFPType * y,
+                                                                                         const algorithmFPType * f)
+{
+    const size_t nTrees = _nTrees;
+    algorithmFPType sum = 0;
+    switch (_par.validationMetric)
+    {
+    case meanAbsoluteError:
+        sum = LoopHelper<cpu>::template sum<algorithmFPType>(n, [&](size_t start, size_t end) -> algorithmFPType {
+            algorithmFPType lsum = 0;
+            PRAGMA_ICC_NO16(omp simd reduction(+ : lsum))
+            for (size_t i = start; i < end; i++) lsum += (f[i] > y[i] ? f[i] - y[i] : y[i] - f[i]);
+            return lsum;
+        });
+        break;
+    case classificationError:
+        sum = LoopHelper<cpu>::template sum<algorithmFPType>(n, [&](size_t start, size_t end) -> algorithmFPType {
+            size_t nErrors = 0;
+            for (size_t i = start; i < end; i++)
+            {
+                //the positive argument means the class 1 in the binary case, the class of the largest argument otherwise
+                size_t label = 0;
+                if (nTrees == 1)
+                {
+                    label = f[i] > 0;
+                }
+                else
+                {
+                    const algorithmFPType * fi = f + i * nTrees;
+                    for (size_t k = 1; k < nTrees; ++k)
+                        if (fi[k] > fi[label]) label = k;
+                }
+                nErrors += (label != size_t(y[i]));
+            }
+            return algorithmFPType(nErrors);
+        });
+        break;
+    default: return lossFunc()->getLoss(n, y, f);
+    }
+    return sum / algorithmFPType(n);
+}
+
 template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
 services::Status TrainBatchTaskBase<algorithmFPType, BinIndexType, cpu>::run(gbt::internal::GbtDecisionTree ** aTbl,
                                                                              HomogenNumericTable<double> ** aTblImp,
                                                                              HomogenNumericTable<int> ** aTblSmplCnt, size_t iIteration,
                                                                              GlobalStorages<algorithmFPType, BinIndexType, cpu> & GH_SUMS_BUF)
 {
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.iteration);
+
     for (size_t i = 0; i < _nTrees; ++i)
     {
         aTbl[i]        = nullptr;
@@ -276,7 +389,7 @@ services::Status TrainBatchTaskBase<algorithmFPType, BinIndexType, cpu>::run(gbt
         aTblSmplCnt[i] = nullptr;
     }
 
-    if (iIteration)
+    if (iIteration || _bContinued)
     {
         _initialF = 0;
     }
@@ -312,10 +425,20 @@ void TrainBatchTaskBase<algorithmFPType, BinIndexType, cpu>::updateOOB(size_t iT
     auto pf               = f();
     const size_t n        = _aSampleToF.size();
     const size_t nIt      = n - _nSamples;
+    CSRNumericTableIface * csr = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(_dataHelper.data()));
     daal::threader_for(nIt, nIt, [&](size_t i) {
         RowIndexType iRow = aSampleToF[i + _nSamples];
-        ReadRows<algorithmFPType, cpu> x(const_cast<NumericTable *>(_dataHelper.data()), iRow, 1);
-        auto pNode = dtrees::prediction::internal::findNode<algorithmFPType, TreeType, cpu>(t, x.get());
+        const typename TreeType::NodeType::Base * pNode = nullptr;
+        if (csr)
+        {
+            ReadRowsCSR<algorithmFPType, cpu> x(csr, iRow, 1);
+            pNode = dtrees::prediction::internal::findNodeSparse<algorithmFPType, TreeType, cpu>(t, x.values(), x.cols(), x.rows()[1] - x.rows()[0]);
+        }
+        else
+        {
+            ReadRows<algorithmFPType, cpu> x(const_cast<NumericTable *>(_dataHelper.data()), iRow, 1);
+            pNode = dtrees::prediction::internal::findNode<algorithmFPType, TreeType, cpu>(t, x.get());
+        }
         DAAL_ASSERT(pNode);
         algorithmFPType inc = TreeType::NodeType::castLeaf(pNode)->response;
         // pf buffer was already initialized by _initialF before first iteration
@@ -332,21 +455,50 @@ class TrainBatchTaskBaseXBoost : public TrainBatchTaskBase<algorithmFPType, BinI
 public:
     typedef TrainBatchTaskBase<algorithmFPType, BinIndexType, cpu> super;
     typedef typename super::DataHelperType DataHelperType;
+    typedef typename super::ImpurityType ImpurityType;
     typedef gh<algorithmFPType, cpu> ghType;
+    typedef ghQuantized<cpu> ghQuantizedType;
 
     TrainBatchTaskBaseXBoost(HostAppIface * hostApp, const NumericTable * x, const NumericTable * y, const Parameter & par,
                              const dtrees::internal::FeatureTypes & featTypes, const dtrees::internal::IndexedFeatures * indexedFeatures,
                              engines::internal::BatchBaseImpl & engine, size_t nClasses)
-        : super(x, y, par, featTypes, indexedFeatures, engine, nClasses), _hostApp(hostApp)
+        : super(x, y, par, featTypes, indexedFeatures, engine, nClasses), _hostApp(hostApp), _iStep(0)
     {}
 
     //loss function gradient and hessian values calculated in f() points
     ghType * grad(size_t iTree) { return _aGH.get() + iTree * this->_data->getNumberOfRows(); }
+
+    //the histograms are computed by rows from the quantized gradients
+    bool isQuantized() const { return !!_aGHQuantized.get(); }
+    const ghQuantizedType * gradQuantized(size_t iTree) const { return _aGHQuantized.get() + iTree * this->_data->getNumberOfRows(); }
+    //scales of the quantized gradient and hessian
+    const algorithmFPType * gradScale(size_t iTree) const { return _aGHScale.get() + 2 * iTree; }
+    //integer type of the bins of the quantized histograms of the node with n rows
+    QuantizedBinType quantizedBinType(size_t n) const { return getQuantizedBinType<cpu>(n, this->_par.gradientBits); }
+
     void step(const algorithmFPType * y) DAAL_C11_OVERRIDE
     {
+        DAAL_ITTNOTIFY_SCOPED_TASK(compute.gradients);
         this->lossFunc()->getGradients(this->_nSamples, this->_data->getNumberOfRows(), y, this->f(), this->aSampleToF(),
                                        (algorithmFPType *)_aGH.get());
+        if (isQuantized())
+        {
+            for (size_t iTree = 0; iTree < this->_nTrees; ++iTree) quantizeGradients(iTree);
+            ++_iStep;
+        }
+    }
+
+    //the leaf values are computed from the exact gradients when the splits are found by the quantized ones
+    double computeLeafWeightUpdateF(const int * idx, size_t n, const ImpurityType & imp, size_t iTree)
+    {
+        if (!isQuantized()) return super::computeLeafWeightUpdateF(idx, n, imp, iTree);
+
+        const ghType * pgh = grad(iTree);
+        ImpurityType exactImp;
+        for (size_t i = 0; i < n; ++i) exactImp.add(pgh[idx[i]]);
+        return super::computeLeafWeightUpdateF(idx, n, exactImp, iTree);
     }
+
     virtual services::Status init() DAAL_C11_OVERRIDE
     {
         auto s = super::init();
@@ -354,22 +506,161 @@ public:
         {
             _aGH.reset(this->_data->getNumberOfRows() * this->_nTrees);
             DAAL_CHECK_MALLOC(_aGH.get());
+
+            //the quantized gradients are used by the histograms computed by rows only
+            const Parameter & par = this->_par;
+            if (par.gradientBits && !par.memorySavingMode && par.splitMethod == gbt::training::inexact
+                && this->nFeaturesPerNode() == this->nFeatures())
+            {
+                _aGHQuantized.reset(this->_data->getNumberOfRows() * this->_nTrees);
+                _aGHScale.reset(2 * this->_nTrees);
+                DAAL_CHECK_MALLOC(_aGHQuantized.get() && _aGHScale.get());
+            }
         }
         return s;
     }
 
+protected:
+    //maps the gradients and hessians of the sampled rows to the integers in [-qMax, qMax] with stochastic rounding,
+    //the random values are the hashes of the row and step indices, so the result does not depend on the threading
+    void quantizeGradients(size_t iTree)
+    {
+        const size_t nSamples           = this->_nSamples;
+        const RowIndexType * aSampleToF = this->aSampleToF();
+        const ghType * pgh              = grad(iTree);
+        ghQuantizedType * pq            = _aGHQuantized.get() + iTree * this->_data->getNumberOfRows();
+        const DAAL_INT64 qMax           = ((DAAL_INT64)1 << (this->_par.gradientBits - 1)) - 1;
+
+        const size_t nBlocks   = getNBlocksForOpt<cpu>(this->numAvailableThreads(), nSamples);
+        const bool inParallel  = nBlocks > 1;
+        const size_t nPerBlock = nSamples / nBlocks;
+        const size_t nSurplus  = nSamples % nBlocks;
+        daal::services::internal::TArrayScratch<algorithmFPType, cpu> gMaxArr(nBlocks);
+        daal::services::internal::TArrayScratch<algorithmFPType, cpu> hMaxArr(nBlocks);
+        algorithmFPType * const gMax = gMaxArr.get();
+        algorithmFPType * const hMax = hMaxArr.get();
+
+        LoopHelper<cpu>::run(inParallel, nBlocks, [&](size_t iBlock) {
+            const size_t start = iBlock + 1 > nSurplus ? nPerBlock * iBlock + nSurplus : (nPerBlock + 1) * iBlock;
+            const size_t end   = iBlock + 1 > nSurplus ? start + nPerBlock : start + (nPerBlock + 1);
+            algorithmFPType g = 0;
+            algorithmFPType h = 0;
+            for (size_t i = start; i < end; ++i)
+            {
+                const ghType & val = pgh[aSampleToF ? aSampleToF[i] : i];
+                g                  = services::internal::max<cpu, algorithmFPType>(g, val.g < 0 ? -val.g : val.g);
+                h                  = services::internal::max<cpu, algorithmFPType>(h, val.h < 0 ? -val.h : val.h);
+            }
+            gMax[iBlock] = g;
+            hMax[iBlock] = h;
+        });
+        algorithmFPType gScale = 0, hScale = 0;
+        for (size_t i = 0; i < nBlocks; ++i)
+        {
+            gScale = services::internal::max<cpu, algorithmFPType>(gScale, gMax[i]);
+            hScale = services::internal::max<cpu, algorithmFPType>(hScale, hMax[i]);
+        }
+        gScale                     = (gScale > 0) ? gScale / algorithmFPType(qMax) : algorithmFPType(1);
+        hScale                     = (hScale > 0) ? hScale / algorithmFPType(qMax) : algorithmFPType(1);
+        _aGHScale[2 * iTree]       = gScale;
+        _aGHScale[2 * iTree + 1]   = hScale;
+        const DAAL_UINT64 stepSeed = ((DAAL_UINT64)_iStep * this->_nTrees + iTree) << 32;
+
+        LoopHelper<cpu>::run(inParallel, nBlocks, [&](size_t iBlock) {
+            const size_t start = iBlock + 1 > nSurplus ? nPerBlock * iBlock + nSurplus : (nPerBlock + 1) * iBlock;
+            const size_t end   = iBlock + 1 > nSurplus ? start + nPerBlock : start + (nPerBlock + 1);
+            for (size_t i = start; i < end; ++i)
+            {
+                const size_t iRow     = aSampleToF ? aSampleToF[i] : i;
+                const DAAL_UINT64 key = stepSeed + 2 * (DAAL_UINT64)iRow;
+                pq[iRow].g            = roundStochastic(pgh[iRow].g / gScale, key, qMax);
+                pq[iRow].h            = roundStochastic(pgh[iRow].h / hScale, key + 1, qMax);
+            }
+        });
+    }
+
+    static short roundStochastic(algorithmFPType val, DAAL_UINT64 key, DAAL_INT64 qMax)
+    {
+        //splitmix64 finalizer
+        key = (key ^ (key >> 30)) * (DAAL_UINT64)0xbf58476d1ce4e5b9;
+        key = (key ^ (key >> 27)) * (DAAL_UINT64)0x94d049bb133111eb;
+        key = key ^ (key >> 31);
+        const algorithmFPType u = algorithmFPType(key >> 40) * algorithmFPType(1. / ((DAAL_UINT64)1 << 24));
+        const algorithmFPType x = val + u;
+        DAAL_INT64 res          = (DAAL_INT64)x;
+        if (algorithmFPType(res) > x) --res;
+        //val + u can be rounded up to qMax + 1 in single precision
+        return short(services::internal::max<cpu, DAAL_INT64>(-qMax, services::internal::min<cpu, DAAL_INT64>(res, qMax)));
+    }
+
 protected:
     TVector<ghType, cpu> _aGH; //loss function first and second order derivatives
+    TVector<ghQuantizedType, cpu> _aGHQuantized;
+    TVector<algorithmFPType, cpu> _aGHScale;
     HostAppIface * _hostApp;
+    size_t _iStep;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Validation set helper. Keeps the loss function arguments on the validation set
+// and adds the trees built on every iteration to them
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class ValidationSetHelper
+{
+public:
+    ValidationSetHelper(const FeatureTypes & featTypes, size_t nTrees) : _data(nullptr), _featHelper(featTypes), _nTrees(nTrees), _nRows(0) {}
+
+    services::Status init(const NumericTable * x, const NumericTable * y)
+    {
+        _data  = x;
+        _nRows = x->getNumberOfRows();
+
+        //the trees of the first iteration include the initial value of the loss function arguments
+        _aF.reset(_nRows * _nTrees);
+        _aY.reset(_nRows);
+        DAAL_CHECK_MALLOC(_aF.get() && _aY.get());
+        _aF.setAll(algorithmFPType(0));
+
+        ReadRows<algorithmFPType, cpu> yBD(const_cast<NumericTable *>(y), 0, _nRows);
+        DAAL_CHECK_BLOCK_STATUS(yBD);
+        const algorithmFPType * py = yBD.get();
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < _nRows; ++i) _aY[i] = py[i];
+        return services::Status();
+    }
+
+    //the responses of the trees aTbl[k] are added to the arguments k % nTrees
+    services::Status addTrees(const gbt::internal::GbtDecisionTree * const * aTbl, size_t nTbl)
+    {
+        return addTreesResponses<algorithmFPType, cpu>(_data, _featHelper, aTbl, nTbl, _nTrees, _aF.get());
+    }
+
+    size_t nRows() const { return _nRows; }
+    const algorithmFPType * y() const { return _aY.get(); }
+    const algorithmFPType * f() const { return _aF.get(); }
+
+protected:
+    const NumericTable * _data;
+    const FeatureTypes & _featHelper;
+    const size_t _nTrees;
+    size_t _nRows;
+    TVector<algorithmFPType, cpu> _aF; //loss function arguments on the validation set
+    TVector<algorithmFPType, cpu> _aY;
 };
 
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu, typename TaskType, typename ResultType>
-services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, gbt::internal::ModelImpl & md,
+services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, const NumericTable * validX,
+                                 const NumericTable * validY, const gbt::internal::ModelImpl * initialModel, gbt::internal::ModelImpl & md,
                                  const gbt::training::Parameter & par, engines::internal::BatchBaseImpl & engine, size_t nClasses,
                                  dtrees::internal::IndexedFeatures & indexedFeatures, dtrees::internal::FeatureTypes & featTypes, ResultType * res,
                                  algorithmFPType * ptrWeight, algorithmFPType * ptrCover, algorithmFPType * ptrTotalCover, algorithmFPType * ptrGain,
                                  algorithmFPType * ptrTotalGain)
 {
+    /* Buffers allocated for every iteration and node are reused */
+    services::internal::ScratchPoolScope scratchPoolScope;
+
     services::Status s;
 
     const size_t nFeaturesPerNode = par.featuresPerNode ? par.featuresPerNode : x->getNumberOfColumns();
@@ -380,7 +671,19 @@ services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x
     DAAL_CHECK_STATUS(s, task.init());
 
     const size_t nTrees = task.nTrees();
-    DAAL_CHECK_MALLOC(md.reserve(par.maxIterations * nTrees));
+
+    //the trees of the initial model are shared by the new model, the new trees are appended to them
+    const size_t nInitialTrees = initialModel ? initialModel->size() : 0;
+    TVector<const gbt::internal::GbtDecisionTree *, cpu> aInitialTrees(nInitialTrees);
+    DAAL_CHECK_MALLOC(!nInitialTrees || aInitialTrees.get());
+    for (size_t i = 0; i < nInitialTrees; ++i) aInitialTrees[i] = initialModel->at(i);
+
+    DAAL_CHECK_MALLOC(md.reserve(nInitialTrees + par.maxIterations * nTrees));
+    if (nInitialTrees)
+    {
+        md.addTrees(*initialModel);
+        DAAL_CHECK_STATUS(s, task.continueFrom(aInitialTrees.get(), nInitialTrees));
+    }
 
     TVector<gbt::internal::GbtDecisionTree *, cpu> aTables;
     TVector<HomogenNumericTable<double> *, cpu> impTables;
@@ -429,10 +732,24 @@ services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x
     const size_t initValue = (inexactWithHistMethod) ? 2 : 0;
     const size_t nStor     = x->getNumberOfColumns();
 
-    GlobalStorages<algorithmFPType, BinIndexType, cpu> storage(x->getNumberOfColumns(), nStor, nDiffFeatMax, initValue);
+    //the thread local histograms of the quantized gradients must hold the bins of the widest integer type used by the root node
+    using GHSumType         = ghSum<algorithmFPType, cpu>;
+    const size_t binsSize   = task.isQuantized() ? nDiffFeatMax * getQuantizedBinSize<cpu>(task.quantizedBinType(x->getNumberOfRows())) : 0;
+    const size_t nGHSumsTls = services::internal::max<cpu, size_t>(nDiffFeatMax, (binsSize + sizeof(GHSumType) - 1) / sizeof(GHSumType));
+
+    GlobalStorages<algorithmFPType, BinIndexType, cpu> storage(x->getNumberOfColumns(), nStor, nGHSumsTls, initValue);
     storage.nUniquesArr  = nUniquesArr;
     storage.nDiffFeatMax = nDiffFeatMax;
 
+    if (inexactWithHistMethod)
+    {
+        //bounds the memory of the parent histograms kept for the subtraction
+        const size_t parentHistsMemory = size_t(1) << 30;
+        const size_t histSize          = nDiffFeatMax * sizeof(ghSum<algorithmFPType, cpu>);
+
+        storage.maxParentHists = services::internal::max<cpu, size_t>(2 * threader_get_threads_number(), parentHistsMemory / histSize);
+    }
+
     if (!par.memorySavingMode)
     {
         for (size_t i = 0; i < x->getNumberOfColumns(); ++i)
@@ -443,7 +760,8 @@ services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x
 
     TVector<BinIndexType, cpu, ScalableAllocator<cpu> > newFIArr;
 
-    if (inexactWithHistMethod)
+    //the histograms of the data in CSR format are computed by its non-zero entries, the row-major bins are not needed
+    if (inexactWithHistMethod && !indexedFeatures.isSparse())
     {
         size_t nThreads    = threader_get_threads_number();
         size_t nRows       = x->getNumberOfRows();
@@ -483,6 +801,35 @@ services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x
     DAAL_CHECK_MALLOC(allWeightVec.get());
     allWeight = allWeightVec.get();
 
+    //the training stops when the metric on the validation set has not improved for earlyStoppingRounds iterations,
+    //the model keeps the trees of the best iteration
+    const bool earlyStopping = par.earlyStoppingRounds && validX && validY;
+    ValidationSetHelper<algorithmFPType, cpu> validation(featTypes, nTrees);
+    algorithmFPType * aImportance[] = { ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain, allWeight };
+    const size_t nImportance        = sizeof(aImportance) / sizeof(aImportance[0]);
+    TVector<algorithmFPType, cpu> bestImportance;
+    algorithmFPType bestMetric  = 0;
+    size_t nBestTrees           = 0;
+    size_t nRoundsNoImprovement = 0;
+    bool bestFound              = false;
+    if (earlyStopping)
+    {
+        DAAL_CHECK_STATUS(s, validation.init(validX, validY));
+        bestImportance.reset(nImportance * nStor);
+        DAAL_CHECK_MALLOC(bestImportance.get());
+        if (nInitialTrees)
+        {
+            //the initial model itself is the first candidate for the best one
+            DAAL_CHECK_STATUS(s, validation.addTrees(aInitialTrees.get(), nInitialTrees));
+            bestMetric = task.validationMetric(validation.nRows(), validation.y(), validation.f());
+            nBestTrees = nInitialTrees;
+            bestFound  = true;
+            for (size_t k = 0; k < nImportance; ++k)
+                if (aImportance[k])
+                    for (size_t kFeature = 0; kFeature < nStor; ++kFeature) bestImportance[k * nStor + kFeature] = aImportance[k][kFeature];
+        }
+    }
+
     for (size_t i = 0; (i < par.maxIterations) && !algorithms::internal::isCancelled(s, pHostApp); ++i)
     {
         s = task.run(aTbl, aTblImp, aTblSmplCnt, i, storage);
@@ -539,9 +886,38 @@ services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x
             md.add(aTbl[iTree], aTblImp[iTree], aTblSmplCnt[iTree]);
         }
 
+        if (earlyStopping)
+        {
+            s = validation.addTrees(aTbl, nTrees);
+            if (!s) break;
+            const algorithmFPType metric = task.validationMetric(validation.nRows(), validation.y(), validation.f());
+            if (!bestFound || metric < bestMetric)
+            {
+                bestMetric           = metric;
+                nBestTrees           = md.size();
+                nRoundsNoImprovement = 0;
+                bestFound            = true;
+                for (size_t k = 0; k < nImportance; ++k)
+                    if (aImportance[k])
+                        for (size_t kFeature = 0; kFeature < nStor; ++kFeature) bestImportance[k * nStor + kFeature] = aImportance[k][kFeature];
+            }
+            else if (++nRoundsNoImprovement >= par.earlyStoppingRounds)
+            {
+                break;
+            }
+        }
+
         if ((i + 1 < par.maxIterations) && task.done()) break;
     }
 
+    if (earlyStopping && s && bestFound && md.size() > nBestTrees)
+    {
+        md.truncate(nBestTrees);
+        for (size_t k = 0; k < nImportance; ++k)
+            if (aImportance[k])
+                for (size_t kFeature = 0; kFeature < nStor; ++kFeature) aImportance[k][kFeature] = bestImportance[k * nStor + kFeature];
+    }
+
     if (ptrCover != nullptr)
         for (size_t i = 0; i < nStor; ++i)
             if (allWeight[i] != 0) ptrCover[i] = ptrCover[i] / allWeight[i];
@@ -556,17 +932,40 @@ services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x
 //////////////////////////////////////////////////////////////////////////////////////////
 // compute() implementation
 //////////////////////////////////////////////////////////////////////////////////////////
+//creates the index of the training data features, the data in CSR format is supported by the histogram method only
+template <typename algorithmFPType, CpuType cpu>
+services::Status initIndexedFeatures(const NumericTable * x, const gbt::training::Parameter & par, dtrees::internal::IndexedFeatures & indexedFeatures,
+                                     dtrees::internal::FeatureTypes & featTypes)
+{
+    DAAL_CHECK_MALLOC(featTypes.init(*x));
+    CSRNumericTableIface * csr = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(x));
+    DAAL_CHECK(!csr || !par.memorySavingMode, services::ErrorIncorrectTypeOfInputNumericTable);
+    if (par.memorySavingMode) return services::Status();
+
+    const size_t nCols = x->getNumberOfColumns();
+    BinParams prm(par.maxBins, par.minBinSize);
+    if (csr)
+    {
+        const size_t nFeaturesPerNode = par.featuresPerNode ? par.featuresPerNode : nCols;
+        DAAL_CHECK(par.splitMethod == gbt::training::inexact && nFeaturesPerNode == nCols, services::ErrorIncorrectTypeOfInputNumericTable);
+        for (size_t i = 0; i < nCols; ++i) DAAL_CHECK(!featTypes.isUnordered(i), services::ErrorIncorrectTypeOfInputNumericTable);
+        return indexedFeatures.initSparse<algorithmFPType, cpu>(*csr, x->getNumberOfRows(), nCols, prm);
+    }
+    return indexedFeatures.init<algorithmFPType, cpu>(*x, &featTypes, par.splitMethod == gbt::training::inexact ? &prm : nullptr);
+}
+
 template <typename algorithmFPType, CpuType cpu, typename BinIndexType, typename TaskType, typename ResultType>
-services::Status computeImpl(HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, gbt::internal::ModelImpl & md,
+services::Status computeImpl(HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, const NumericTable * validX,
+                             const NumericTable * validY, const gbt::internal::ModelImpl * initialModel, gbt::internal::ModelImpl & md,
                              const gbt::training::Parameter & par, engines::internal::BatchBaseImpl & engine, size_t nClasses,
                              dtrees::internal::IndexedFeatures & indexedFeatures, dtrees::internal::FeatureTypes & featTypes, ResultType * res,
                              algorithmFPType * ptrWeight, algorithmFPType * ptrCover, algorithmFPType * ptrTotalCover, algorithmFPType * ptrGain,
                              algorithmFPType * ptrTotalGain)
 
 {
-    return computeTypeDisp<algorithmFPType, int, BinIndexType, cpu, TaskType>(pHostApp, x, y, md, par, engine, nClasses, indexedFeatures, featTypes,
-                                                                              res, ptrWeight, ptrCover, ptrTotalCover, ptrGain,
-                                                                              ptrTotalGain); // TODO: remove int
+    return computeTypeDisp<algorithmFPType, int, BinIndexType, cpu, TaskType>(pHostApp, x, y, validX, validY, initialModel, md, par, engine,
+                                                                              nClasses, indexedFeatures, featTypes, res, ptrWeight, ptrCover,
+                                                                              ptrTotalCover, ptrGain, ptrTotalGain); // TODO: remove int
 }
 
 } /* namespace internal */
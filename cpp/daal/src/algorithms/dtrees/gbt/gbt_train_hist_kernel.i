@@ -220,6 +220,22 @@ public:
     {
         services::internal::service_memset_seq<algorithmFPType, cpu>((algorithmFPType *)aGHSum, algorithmFPType(0), nUnique * 4);
     }
+
+    //the missing entries of the sparse data are not visited when the sums are computed by rows,
+    //they are the rest of the node totals and belong to the bin of zero value
+    //TODO: learn the default direction of the missing entries, now the split value decides it as for the explicit zeros
+    static void addMissingZeros(const size_t nUnique, const size_t zeroBin, const algorithmFPType g, const algorithmFPType h, const size_t n,
+                                GHSumType * const aGHSum, algorithmFPType & gTotal, algorithmFPType & hTotal)
+    {
+        algorithmFPType nTotal = 0;
+        for (size_t i = 0; i < nUnique; ++i) nTotal += aGHSum[i].n;
+
+        aGHSum[zeroBin].g += g - gTotal;
+        aGHSum[zeroBin].h += h - hTotal;
+        aGHSum[zeroBin].n += algorithmFPType(n) - nTotal;
+        gTotal = g;
+        hTotal = h;
+    }
 };
 
 template <typename RowIndexType, typename BinIndexType, typename algorithmFPType, CpuType cpu>
@@ -273,6 +289,165 @@ struct ComputeGHSumByRows
     }
 };
 
+//computes the sums by the non-zero entries of the rows of the data in CSR format
+template <typename RowIndexType, typename algorithmFPType, CpuType cpu>
+struct ComputeGHSumByRowsSparse
+{
+    static void run(algorithmFPType * aGHSumFP, const dtrees::internal::IndexedFeatures & indexedFeatures, const RowIndexType * aIdx,
+                    const algorithmFPType * pgh, size_t iStart, size_t iEnd, const size_t * UniquesArr)
+    {
+        const size_t * const rowOffsets                                  = indexedFeatures.sparseRowOffsets();
+        const dtrees::internal::IndexedFeatures::IndexType * const cols = indexedFeatures.sparseColIndices();
+        const dtrees::internal::IndexedFeatures::IndexType * const bins = indexedFeatures.sparseBins();
+
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            const RowIndexType iRow = aIdx[i];
+            const algorithmFPType g = pgh[2 * iRow];
+            const algorithmFPType h = pgh[2 * iRow + 1];
+
+            PRAGMA_IVDEP
+            for (size_t k = rowOffsets[iRow]; k < rowOffsets[iRow + 1]; ++k)
+            {
+                const size_t idx = 4 * (UniquesArr[cols[k]] + (size_t)bins[k]);
+                aGHSumFP[idx + 0] += g;
+                aGHSumFP[idx + 1] += h;
+                aGHSumFP[idx + 2] += algorithmFPType(1);
+            }
+        }
+    }
+};
+
+//the quantized gradients are accumulated in the integer bins of ghSumQuantized<IntType> type, IntType is chosen by
+//getQuantizedBinType() for the node, so the sums cannot overflow. The integer sums are exact and do not depend on the order of the rows
+template <typename IntType, typename RowIndexType, typename BinIndexType, CpuType cpu>
+struct ComputeGHSumByRowsQuantized
+{
+    static void run(IntType * aGHSumQ, const BinIndexType * indexedFeature, const RowIndexType * aIdx, const ghQuantized<cpu> * pgh,
+                    size_t nFeatures, size_t iStart, size_t iEnd, size_t nRows, const size_t * UniquesArr)
+    {
+        const size_t cacheLineSize       = 64; // bytes
+        const size_t prefetchOffset      = 10; // heuristic, prefetch on 10 rows ahead
+        const size_t elementsInCacheLine = cacheLineSize / sizeof(BinIndexType);
+
+        const size_t noPrefetchSize              = services::internal::min<cpu, size_t>(prefetchOffset + elementsInCacheLine, nRows);
+        const size_t iEndWithPrefetch            = services::internal::min<cpu, size_t>(nRows - noPrefetchSize, iEnd);
+        const size_t nCacheLinesToPrefetchOneRow = nFeatures / elementsInCacheLine + !!(nFeatures % elementsInCacheLine);
+
+        RowIndexType i = iStart;
+        for (; i < iEndWithPrefetch; ++i)
+        {
+            DAAL_PREFETCH_READ_T0(pgh + aIdx[i + prefetchOffset]);
+            const BinIndexType * ptr = indexedFeature + aIdx[i + prefetchOffset] * nFeatures;
+            for (RowIndexType j = 0; j < nCacheLinesToPrefetchOneRow; j++) DAAL_PREFETCH_READ_T0(ptr + elementsInCacheLine * j);
+
+            const BinIndexType * featIdx = indexedFeature + aIdx[i] * nFeatures;
+            const IntType g              = pgh[aIdx[i]].g;
+            const IntType h              = pgh[aIdx[i]].h;
+
+            PRAGMA_IVDEP
+            for (RowIndexType j = 0; j < nFeatures; j++)
+            {
+                const size_t idx = 4 * (UniquesArr[j] + (size_t)featIdx[j]);
+                aGHSumQ[idx + 0] += g;
+                aGHSumQ[idx + 1] += h;
+                aGHSumQ[idx + 2] += 1;
+            }
+        }
+
+        for (; i < iEnd; ++i)
+        {
+            const BinIndexType * featIdx = indexedFeature + aIdx[i] * nFeatures;
+            const IntType g              = pgh[aIdx[i]].g;
+            const IntType h              = pgh[aIdx[i]].h;
+
+            PRAGMA_IVDEP
+            for (RowIndexType j = 0; j < nFeatures; j++)
+            {
+                const size_t idx = 4 * (UniquesArr[j] + (size_t)featIdx[j]);
+                aGHSumQ[idx + 0] += g;
+                aGHSumQ[idx + 1] += h;
+                aGHSumQ[idx + 2] += 1;
+            }
+        }
+    }
+};
+
+template <typename IntType, typename RowIndexType, CpuType cpu>
+struct ComputeGHSumByRowsQuantizedSparse
+{
+    static void run(IntType * aGHSumQ, const dtrees::internal::IndexedFeatures & indexedFeatures, const RowIndexType * aIdx,
+                    const ghQuantized<cpu> * pgh, size_t iStart, size_t iEnd, const size_t * UniquesArr)
+    {
+        const size_t * const rowOffsets                                  = indexedFeatures.sparseRowOffsets();
+        const dtrees::internal::IndexedFeatures::IndexType * const cols = indexedFeatures.sparseColIndices();
+        const dtrees::internal::IndexedFeatures::IndexType * const bins = indexedFeatures.sparseBins();
+
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            const RowIndexType iRow = aIdx[i];
+            const IntType g         = pgh[iRow].g;
+            const IntType h         = pgh[iRow].h;
+
+            PRAGMA_IVDEP
+            for (size_t k = rowOffsets[iRow]; k < rowOffsets[iRow + 1]; ++k)
+            {
+                const size_t idx = 4 * (UniquesArr[cols[k]] + (size_t)bins[k]);
+                aGHSumQ[idx + 0] += g;
+                aGHSumQ[idx + 1] += h;
+                aGHSumQ[idx + 2] += 1;
+            }
+        }
+    }
+};
+
+//sums the integer histograms of the blocks and scales them back to algorithmFPType,
+//the sums are accumulated in the range of the feature in the first block as the ranges of the features do not intersect
+template <typename algorithmFPType, CpuType cpu>
+struct MergeGHSumsQuantized
+{
+    static void run(const QuantizedBinType binType, const size_t nUnique, const size_t iStart, algorithmFPType ** results, const size_t nBlocks,
+                    const algorithmFPType gScale, const algorithmFPType hScale, Result<algorithmFPType, cpu> & res)
+    {
+        if (binType == quantizedBinInt16)
+            mergeBins<short>(nUnique, iStart, results, nBlocks, gScale, hScale, res);
+        else if (binType == quantizedBinInt32)
+            mergeBins<int>(nUnique, iStart, results, nBlocks, gScale, hScale, res);
+        else
+            mergeBins<DAAL_INT64>(nUnique, iStart, results, nBlocks, gScale, hScale, res);
+    }
+
+protected:
+    template <typename IntType>
+    static void mergeBins(const size_t nUnique, const size_t iStart, algorithmFPType ** results, const size_t nBlocks, const algorithmFPType gScale,
+                          const algorithmFPType hScale, Result<algorithmFPType, cpu> & res)
+    {
+        IntType * cur = (IntType *)results[0] + 4 * iStart;
+
+        for (size_t iB = 1; iB < nBlocks; ++iB)
+        {
+            const IntType * ptr = (const IntType *)results[iB] + 4 * iStart;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < 4 * nUnique; i++) cur[i] += ptr[i];
+        }
+
+        DAAL_INT64 gTotal = 0;
+        DAAL_INT64 hTotal = 0;
+        for (size_t i = 0; i < nUnique; ++i)
+        {
+            res.ghSums[i].g     = algorithmFPType(cur[4 * i]) * gScale;
+            res.ghSums[i].h     = algorithmFPType(cur[4 * i + 1]) * hScale;
+            res.ghSums[i].n     = algorithmFPType(cur[4 * i + 2]);
+            res.ghSums[i].dummy = 0;
+            gTotal += cur[4 * i];
+            hTotal += cur[4 * i + 1];
+        }
+        res.gTotal += algorithmFPType(gTotal) * gScale;
+        res.hTotal += algorithmFPType(hTotal) * hScale;
+    }
+};
+
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
 struct MergeGHSums
 {
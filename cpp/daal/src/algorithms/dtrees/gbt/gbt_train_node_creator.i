@@ -82,7 +82,7 @@ public:
             }
             else if (!res->kid[0])
             {
-                buildLeftnode(newTasks, nTask, res);
+                buildLeftnode(newTasks, nTask, res, impRight);
             }
             else if (!res->kid[1])
             {
@@ -111,14 +111,14 @@ public:
 protected:
     virtual void build2nodes(GbtTask ** newTasks, size_t & nTask, typename NodeType::Split * res, ImpurityType & impRight)
     {
-        buildLeftnode(newTasks, nTask, res);
+        buildLeftnode(newTasks, nTask, res, impRight);
         buildRightnode(newTasks, nTask, res, impRight);
     }
 
-    void buildLeftnode(GbtTask ** newTasks, size_t & nTask, typename NodeType::Split * res)
+    virtual void buildLeftnode(GbtTask ** newTasks, size_t & nTask, typename NodeType::Split * res, ImpurityType & impRight)
     {
         NodeInfoType node(_node.iStart, _split.nLeft, _node.level + 1, _split.left, res->kid[0]);
-        newTasks[nTask++] = new (services::internal::service_scalable_calloc<UpdaterType, cpu>(1)) UpdaterType(_data, node);
+        newTasks[nTask++] = new (services::internal::ScratchCalloc<UpdaterType, cpu>::allocate(1)) UpdaterType(_data, node);
         if (_prevRes)
         {
             _prevRes->release(_data);
@@ -126,10 +126,10 @@ protected:
         }
     }
 
-    void buildRightnode(GbtTask ** newTasks, size_t & nTask, typename NodeType::Split * res, ImpurityType & impRight)
+    virtual void buildRightnode(GbtTask ** newTasks, size_t & nTask, typename NodeType::Split * res, ImpurityType & impRight)
     {
         NodeInfoType node(_node.iStart + _split.nLeft, _node.n - _split.nLeft, _node.level + 1, impRight, res->kid[1]);
-        newTasks[nTask++] = new (services::internal::service_scalable_calloc<UpdaterType, cpu>(1)) UpdaterType(_data, node);
+        newTasks[nTask++] = new (services::internal::ScratchCalloc<UpdaterType, cpu>::allocate(1)) UpdaterType(_data, node);
 
         if (_prevRes)
         {
@@ -195,13 +195,44 @@ public:
 protected:
     virtual void build2nodes(GbtTask ** newTasks, size_t & nTask, typename super::NodeType::Split * res, typename super::ImpurityType & impRight)
     {
+        if (!_prevRes || !_data.GH_SUMS_BUF->holdParentHist())
+        {
+            super::buildLeftnode(newTasks, nTask, res, impRight);
+            super::buildRightnode(newTasks, nTask, res, impRight);
+            return;
+        }
+
         typename super::NodeInfoType node1(super::_node.iStart, super::_split.nLeft, super::_node.level + 1, super::_split.left, res->kid[0]);
         typename super::NodeInfoType node2(super::_node.iStart + super::_split.nLeft, super::_node.n - super::_split.nLeft, super::_node.level + 1,
                                            impRight, res->kid[1]);
-        newTasks[nTask++] = new (services::internal::service_scalable_calloc<MergedUpdaterType, cpu>(1))
+        newTasks[nTask++] = new (services::internal::ScratchCalloc<MergedUpdaterType, cpu>::allocate(1))
             MergedUpdaterType(super::_data, node1, node2, super::_prevRes);
     }
 
+    //when the sibling of the only child to split is a smaller leaf, the histograms of the leaf are computed
+    //and the histograms of the child are obtained by subtraction
+    virtual void buildLeftnode(GbtTask ** newTasks, size_t & nTask, typename super::NodeType::Split * res, typename super::ImpurityType & impRight)
+    {
+        typename super::NodeInfoType node(_node.iStart, _split.nLeft, _node.level + 1, _split.left, res->kid[0]);
+        typename super::NodeInfoType leaf(_node.iStart + _split.nLeft, _node.n - _split.nLeft, _node.level + 1, impRight, res->kid[1]);
+        if (leaf.n < node.n && _prevRes && _data.GH_SUMS_BUF->holdParentHist())
+            newTasks[nTask++] = new (services::internal::ScratchCalloc<MergedUpdaterType, cpu>::allocate(1))
+                MergedUpdaterType(_data, node, leaf, _prevRes, true);
+        else
+            super::buildLeftnode(newTasks, nTask, res, impRight);
+    }
+
+    virtual void buildRightnode(GbtTask ** newTasks, size_t & nTask, typename super::NodeType::Split * res, typename super::ImpurityType & impRight)
+    {
+        typename super::NodeInfoType node(_node.iStart + _split.nLeft, _node.n - _split.nLeft, _node.level + 1, impRight, res->kid[1]);
+        typename super::NodeInfoType leaf(_node.iStart, _split.nLeft, _node.level + 1, _split.left, res->kid[0]);
+        if (leaf.n < node.n && _prevRes && _data.GH_SUMS_BUF->holdParentHist())
+            newTasks[nTask++] = new (services::internal::ScratchCalloc<MergedUpdaterType, cpu>::allocate(1))
+                MergedUpdaterType(_data, node, leaf, _prevRes, true);
+        else
+            super::buildRightnode(newTasks, nTask, res, impRight);
+    }
+
     using super::_data;
     using super::_split;
     using super::_node;
@@ -29,6 +29,7 @@
 #include "src/algorithms/dtrees/dtrees_model_impl.h"
 #include "src/algorithms/dtrees/dtrees_train_data_helper.i"
 #include "src/algorithms/dtrees/dtrees_predict_dense_default_impl.i"
+#include "src/externals/service_ittnotify.h"
 
 namespace daal
 {
@@ -61,6 +62,8 @@ public:
 
     virtual GbtTask * execute()
     {
+        DAAL_ITTNOTIFY_SCOPED_TASK(compute.partition);
+
         int * bestSplitIdx = _sharedData.bestSplitIdxBuf + _nodeInfo.iStart;
         int * aIdx         = _sharedData.aIdx + _nodeInfo.iStart;
 
@@ -151,12 +154,23 @@ protected:
 
     DAAL_INT doPartition(size_t n, size_t iStart, SplitDataType & split, DAAL_INT iFeature, size_t idxFeatureValueBestSplit)
     {
-        return doPartitionIdx(n, _sharedData.aIdx + iStart, _sharedData.ctx.dataHelper().indexedFeatures().data(iFeature), split.featureUnordered,
-                              idxFeatureValueBestSplit, _sharedData.bestSplitIdxBuf + (2 * iStart), split.nLeft);
+        const IndexedFeatures & indexedFeatures = _sharedData.ctx.dataHelper().indexedFeatures();
+        if (indexedFeatures.isSparse())
+        {
+            //the bins of the sparse data are found among the non-zero entries of the rows
+            auto binOfRow = [&](RowIndexType iRow) -> RowIndexType { return indexedFeatures.sparseBin(iFeature, iRow); };
+            return doPartitionIdx(n, _sharedData.aIdx + iStart, binOfRow, split.featureUnordered, idxFeatureValueBestSplit,
+                                  _sharedData.bestSplitIdxBuf + (2 * iStart), split.nLeft);
+        }
+        const RowIndexType * indexedFeature = indexedFeatures.data(iFeature);
+        auto binOfRow                       = [=](RowIndexType iRow) -> RowIndexType { return indexedFeature[iRow]; };
+        return doPartitionIdx(n, _sharedData.aIdx + iStart, binOfRow, split.featureUnordered, idxFeatureValueBestSplit,
+                              _sharedData.bestSplitIdxBuf + (2 * iStart), split.nLeft);
     }
 
-    DAAL_INT doPartitionIdx(IndexType n, RowIndexType * aIdx, const RowIndexType * indexedFeature, bool featureUnordered,
-                            RowIndexType idxFeatureValueBestSplit, RowIndexType * buffer, RowIndexType nLeft)
+    template <typename BinOfRow>
+    DAAL_INT doPartitionIdx(IndexType n, RowIndexType * aIdx, const BinOfRow & binOfRow, bool featureUnordered, RowIndexType idxFeatureValueBestSplit,
+                            RowIndexType * buffer, RowIndexType nLeft)
     {
         DAAL_INT iRowSplitVal = -1;
 
@@ -189,7 +203,7 @@ protected:
                 PRAGMA_VECTOR_ALWAYS
                 for (IndexType i = iStart; i < iEnd; ++i)
                 {
-                    if (indexedFeature[aIdx[i]] != idxFeatureValueBestSplit)
+                    if (binOfRow(aIdx[i]) != idxFeatureValueBestSplit)
                         bestSplitIdxRight[iRight++] = aIdx[i];
                     else
                         bestSplitIdx[iLeft++] = aIdx[i];
@@ -201,7 +215,7 @@ protected:
                 PRAGMA_VECTOR_ALWAYS
                 for (IndexType i = iStart; i < iEnd; ++i)
                 {
-                    if (indexedFeature[aIdx[i]] > idxFeatureValueBestSplit)
+                    if (binOfRow(aIdx[i]) > idxFeatureValueBestSplit)
                         bestSplitIdxRight[iRight++] = aIdx[i];
                     else
                         bestSplitIdx[iLeft++] = aIdx[i];
@@ -236,7 +250,7 @@ protected:
         });
 
         RowIndexType i = 0;
-        while (indexedFeature[aIdx[i]] != idxFeatureValueBestSplit) i++;
+        while (binOfRow(aIdx[i]) != idxFeatureValueBestSplit) i++;
         iRowSplitVal = aIdx[i];
 
         return iRowSplitVal;
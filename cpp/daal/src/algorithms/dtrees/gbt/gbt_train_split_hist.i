@@ -31,6 +31,7 @@
 #include "src/algorithms/dtrees/gbt/gbt_train_aux.i"
 #include "src/services/service_defines.h"
 #include "src/algorithms/dtrees/gbt/gbt_train_hist_kernel.i"
+#include "src/externals/service_ittnotify.h"
 
 namespace daal
 {
@@ -107,6 +108,8 @@ public:
 
     virtual void computeGHSums()
     {
+        DAAL_ITTNOTIFY_SCOPED_TASK(compute.ghSums);
+
         const size_t nUnique                = _data.ctx.dataHelper().indexedFeatures().numIndices(_iFeature);
         const RowIndexType * indexedFeature = (RowIndexType *)_data.ctx.dataHelper().indexedFeatures().data(_iFeature);
 
@@ -170,6 +173,8 @@ public:
 
     virtual GbtTask * execute()
     {
+        DAAL_ITTNOTIFY_SCOPED_TASK(compute.findBestSplit);
+
         const size_t nUnique = _data.ctx.dataHelper().indexedFeatures().numIndices(_iFeature);
 
         _res1.isFailed = true;
@@ -182,7 +187,19 @@ public:
         const size_t iStart = _data.GH_SUMS_BUF->nUniquesArr[_iFeature];
         const size_t iEnd   = iStart + nUnique;
 
-        MergeGHSums<algorithmFPType, RowIndexType, BinIndexType, cpu>::run(nUnique, iStart, iEnd, _results, _size, _res1);
+        if (_data.ctx.isQuantized())
+        {
+            const algorithmFPType * scale = _data.ctx.gradScale(_data.iTree);
+            MergeGHSumsQuantized<algorithmFPType, cpu>::run(_data.ctx.quantizedBinType(_node1.n), nUnique, iStart, _results, _size, scale[0],
+                                                            scale[1], _res1);
+        }
+        else
+            MergeGHSums<algorithmFPType, RowIndexType, BinIndexType, cpu>::run(nUnique, iStart, iEnd, _results, _size, _res1);
+
+        const dtrees::internal::IndexedFeatures & indexedFeatures = _data.ctx.dataHelper().indexedFeatures();
+        if (indexedFeatures.isSparse())
+            GHSums::addMissingZeros(nUnique, indexedFeatures.zeroBin(_iFeature), _node1.imp.g, _node1.imp.h, _node1.n, _res1.ghSums, _res1.gTotal,
+                                    _res1.hTotal);
 
         daal::threader_for(2, 2, [&](size_t iBlock) {
             if (iBlock == 0)
@@ -290,6 +307,8 @@ public:
 
     virtual GbtTask * execute()
     {
+        DAAL_ITTNOTIFY_SCOPED_TASK(compute.findBestSplit);
+
         const size_t nUnique = _data.ctx.dataHelper().indexedFeatures().numIndices(_iFeature);
 
         _res1.isFailed = true;
@@ -302,7 +321,19 @@ public:
         const size_t iStart = _data.GH_SUMS_BUF->nUniquesArr[_iFeature];
         const size_t iEnd   = iStart + nUnique;
 
-        MergeGHSums<algorithmFPType, RowIndexType, BinIndexType, cpu>::run(nUnique, iStart, iEnd, _results, _size, _res1);
+        if (_data.ctx.isQuantized())
+        {
+            const algorithmFPType * scale = _data.ctx.gradScale(_data.iTree);
+            MergeGHSumsQuantized<algorithmFPType, cpu>::run(_data.ctx.quantizedBinType(_node1.n), nUnique, iStart, _results, _size, scale[0],
+                                                            scale[1], _res1);
+        }
+        else
+            MergeGHSums<algorithmFPType, RowIndexType, BinIndexType, cpu>::run(nUnique, iStart, iEnd, _results, _size, _res1);
+
+        const dtrees::internal::IndexedFeatures & indexedFeatures = _data.ctx.dataHelper().indexedFeatures();
+        if (indexedFeatures.isSparse())
+            GHSums::addMissingZeros(nUnique, indexedFeatures.zeroBin(_iFeature), _node1.imp.g, _node1.imp.h, _node1.n, _res1.ghSums, _res1.gTotal,
+                                    _res1.hTotal);
 
         // TODO: check for hasDiffFeatureValues()
 
@@ -354,6 +385,8 @@ public:
 
     virtual GbtTask * execute()
     {
+        DAAL_ITTNOTIFY_SCOPED_TASK(compute.ghSumsByRows);
+
         const BinIndexType * indexedFeature = _data.GH_SUMS_BUF->newFI;
         int * aIdx                          = _data.aIdx;
         const RowIndexType nFeatures        = _data.ctx.nFeatures();
@@ -365,19 +398,58 @@ public:
         GHSumType * aGHSum         = local->ghSum;
         algorithmFPType * aGHSumFP = (algorithmFPType *)local->ghSum;
 
+        if (_data.ctx.isQuantized())
+        {
+            const QuantizedBinType binType = _data.ctx.quantizedBinType(_node.n);
+            if (!local->isInitilized)
+            {
+                //only the part of the buffer occupied by the bins of the node type is used
+                const size_t binsSize = _data.GH_SUMS_BUF->nDiffFeatMax * getQuantizedBinSize<cpu>(binType);
+                GHSums::fillByZero((binsSize + sizeof(GHSumType) - 1) / sizeof(GHSumType), aGHSum);
+                local->isInitilized = true;
+            }
+            if (binType == quantizedBinInt16)
+                computeQuantized<short>((short *)aGHSum, iStart, iEnd);
+            else if (binType == quantizedBinInt32)
+                computeQuantized<int>((int *)aGHSum, iStart, iEnd);
+            else
+                computeQuantized<DAAL_INT64>((DAAL_INT64 *)aGHSum, iStart, iEnd);
+            return nullptr;
+        }
+
         if (!local->isInitilized)
         {
-            GHSums::fillByZero(_data.GH_SUMS_BUF->nDiffFeatMax, aGHSum);
+            GHSums::fillByZero(_data.GH_SUMS_BUF->nGHSumsTls, aGHSum);
             local->isInitilized = true;
         }
 
+        const dtrees::internal::IndexedFeatures & indexedFeatures = _data.ctx.dataHelper().indexedFeatures();
+
         algorithmFPType * pgh = (algorithmFPType *)_data.ctx.grad(_data.iTree);
-        ComputeGHSumByRows<RowIndexType, BinIndexType, algorithmFPType, cpu>::run(aGHSumFP, indexedFeature, aIdx, pgh, nFeatures, iStart, iEnd,
-                                                                                  _node.iStart + _node.n, _data.GH_SUMS_BUF->nUniquesArr.get());
+        if (indexedFeatures.isSparse())
+            ComputeGHSumByRowsSparse<RowIndexType, algorithmFPType, cpu>::run(aGHSumFP, indexedFeatures, aIdx, pgh, iStart, iEnd,
+                                                                              _data.GH_SUMS_BUF->nUniquesArr.get());
+        else
+            ComputeGHSumByRows<RowIndexType, BinIndexType, algorithmFPType, cpu>::run(aGHSumFP, indexedFeature, aIdx, pgh, nFeatures, iStart, iEnd,
+                                                                                      _node.iStart + _node.n, _data.GH_SUMS_BUF->nUniquesArr.get());
         return nullptr;
     }
 
 protected:
+    template <typename IntType>
+    void computeQuantized(IntType * aGHSumQ, size_t iStart, size_t iEnd)
+    {
+        const dtrees::internal::IndexedFeatures & indexedFeatures = _data.ctx.dataHelper().indexedFeatures();
+        const ghQuantized<cpu> * pghQuantized                     = _data.ctx.gradQuantized(_data.iTree);
+        if (indexedFeatures.isSparse())
+            ComputeGHSumByRowsQuantizedSparse<IntType, RowIndexType, cpu>::run(aGHSumQ, indexedFeatures, _data.aIdx, pghQuantized, iStart, iEnd,
+                                                                               _data.GH_SUMS_BUF->nUniquesArr.get());
+        else
+            ComputeGHSumByRowsQuantized<IntType, RowIndexType, BinIndexType, cpu>::run(aGHSumQ, _data.GH_SUMS_BUF->newFI, _data.aIdx, pghQuantized,
+                                                                                       _data.ctx.nFeatures(), iStart, iEnd, _node.iStart + _node.n,
+                                                                                       _data.GH_SUMS_BUF->nUniquesArr.get());
+    }
+
     const size_t _iBlock;
     const size_t _blockSize;
     SharedDataType & _data;
@@ -232,19 +232,19 @@ protected:
         {
             using Mode    = MemorySafetySplitMode<algorithmFPType, RowIndexType, BinIndexType, cpu>;
             using Updater = UpdaterByColumns<algorithmFPType, RowIndexType, BinIndexType, Mode, cpu>;
-            buildSplit(new (service_scalable_calloc<Updater, cpu>(1)) Updater(data, job));
+            buildSplit(new (services::internal::ScratchCalloc<Updater, cpu>::allocate(1)) Updater(data, job));
         }
         else if (_ctx.par().splitMethod == gbt::training::exact || _ctx.nFeatures() != _ctx.nFeaturesPerNode())
         {
             using Mode    = ExactSplitMode<algorithmFPType, RowIndexType, BinIndexType, cpu>;
             using Updater = UpdaterByColumns<algorithmFPType, RowIndexType, BinIndexType, Mode, cpu>;
-            buildSplit(new (service_scalable_calloc<Updater, cpu>(1)) Updater(data, job));
+            buildSplit(new (services::internal::ScratchCalloc<Updater, cpu>::allocate(1)) Updater(data, job));
         }
         else
         {
             using Mode    = InexactSplitMode<algorithmFPType, RowIndexType, BinIndexType, cpu>;
             using Updater = UpdaterByRows<algorithmFPType, RowIndexType, BinIndexType, Mode, cpu>;
-            buildSplit(new (service_scalable_calloc<Updater, cpu>(1)) Updater(data, job));
+            buildSplit(new (services::internal::ScratchCalloc<Updater, cpu>::allocate(1)) Updater(data, job));
         }
 
         if (taskGroup()) taskGroup()->wait();
@@ -265,8 +265,8 @@ protected:
         const size_t nThreads = _ctx.numAvailableThreads();
         const size_t nBlocks  = getNBlocksForOpt<cpu>(nThreads, nSamples);
         const bool inParallel = nBlocks > 1;
-        daal::services::internal::TArray<algorithmFPType, cpu> gsArr(nBlocks);
-        daal::services::internal::TArray<algorithmFPType, cpu> hsArr(nBlocks);
+        daal::services::internal::TArrayScratch<algorithmFPType, cpu> gsArr(nBlocks);
+        daal::services::internal::TArrayScratch<algorithmFPType, cpu> hsArr(nBlocks);
         algorithmFPType * const gs = gsArr.get();
         algorithmFPType * const hs = hsArr.get();
         const size_t nPerBlock     = nSamples / nBlocks;
@@ -398,7 +398,7 @@ void TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::buildSplit(G
     task->getNextTasks(newTasks, nTasks); // returns 0, 1 or 2 tasks
 
     task->~GbtTask();
-    service_scalable_free<GbtTask, cpu>(task);
+    services::internal::ScratchCalloc<GbtTask, cpu>::deallocate(task);
 
     if (nTasks == 1)
     {
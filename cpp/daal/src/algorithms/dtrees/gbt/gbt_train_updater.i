@@ -150,7 +150,7 @@ protected:
 
     virtual void findBestSplit(SplitDataType & split, DAAL_INT & iFeature, DAAL_INT & idxFeatureValueBestSplit)
     {
-        _result = new (services::internal::service_scalable_calloc<MergedResultType, cpu>(1)) MergedResultType(_data.ctx.nFeaturesPerNode());
+        _result = new (services::internal::ScratchCalloc<MergedResultType, cpu>::allocate(1)) MergedResultType(_data.ctx.nFeaturesPerNode());
 
         const IndexType * featureSample = chooseFeatures();
         iFeature                        = -1;
@@ -218,7 +218,8 @@ protected:
             task.execute();
         });
 
-        algorithmFPType ** ptrs = services::internal::service_scalable_calloc<algorithmFPType *, cpu>(nBlocks);
+        services::internal::TArrayScratch<algorithmFPType *, cpu> ptrsArr(nBlocks);
+        algorithmFPType ** ptrs = ptrsArr.get();
         size_t size;
         tls->reduceTo(ptrs, size);
 
@@ -231,7 +232,6 @@ protected:
 
         tls->release();
         this->_data.GH_SUMS_BUF->GHForCols.returnBlockToStorage(tls);
-        services::internal::service_scalable_free<algorithmFPType *, cpu>(ptrs);
     }
 };
 
@@ -251,17 +251,19 @@ public:
 
     using GHSumType = ghSum<algorithmFPType, cpu>;
 
-    MergedUpdaterByRows(DataType & data, NodeInfoType & node1, NodeInfoType & node2, MergedResult<ResultType, cpu> * _prevResult)
-        : super(data, node1), _node2(node2), _prevRes(_prevResult)
+    //bLeaf2 means the second node is a leaf, its histograms are needed to compute the histograms of the first node by subtraction only
+    MergedUpdaterByRows(DataType & data, NodeInfoType & node1, NodeInfoType & node2, MergedResult<ResultType, cpu> * _prevResult,
+                        bool bLeaf2 = false)
+        : super(data, node1), _node2(node2), _prevRes(_prevResult), _bLeaf2(bLeaf2)
     {}
 
     virtual void findSplit(const RowIndexType * featureSample, BestSplitType & bestSplit) DAAL_C11_OVERRIDE {}
 
     virtual GbtTask * execute() DAAL_C11_OVERRIDE
     {
-        _result1 = new (services::internal::service_scalable_calloc<MergedResult<ResultType, cpu>, cpu>(1))
+        _result1 = new (services::internal::ScratchCalloc<MergedResult<ResultType, cpu>, cpu>::allocate(1))
             MergedResult<ResultType, cpu>(_data.ctx.nFeaturesPerNode());
-        _result2 = new (services::internal::service_scalable_calloc<MergedResult<ResultType, cpu>, cpu>(1))
+        _result2 = new (services::internal::ScratchCalloc<MergedResult<ResultType, cpu>, cpu>::allocate(1))
             MergedResult<ResultType, cpu>(_data.ctx.nFeaturesPerNode());
 
         DAAL_INT idxFeatureValueBestSplit1;
@@ -273,6 +275,7 @@ public:
         else // full GHSums will be computed for 2 node
             findBestSplit(_node2, _node1, _bestSplit2, _bestSplit1, _iFeature2, _iFeature1, idxFeatureValueBestSplit2, idxFeatureValueBestSplit1,
                           _result2, _result1);
+        if (_bLeaf2) _iFeature2 = -1;
 
         LoopHelper<cpu>::run(true, 2, [&](size_t i) {
             if (_iFeature1 >= 0 && i == 0)
@@ -295,13 +298,22 @@ public:
         NodesCreatorType kidsCreatorLeft(_data, _bestSplit1, _node1, _result1); // spawns 0 or 1 tasks
         kidsCreatorLeft.create(_iFeature1, newTasks, nTasks);
 
-        NodesCreatorType kidsCreatorRight(_data, _bestSplit2, _node2, _result2); // spawns 0 or 1 tasks
-        kidsCreatorRight.create(_iFeature2, newTasks, nTasks);
+        if (_bLeaf2)
+        {
+            _result2->release(_data);
+            _result2 = nullptr;
+        }
+        else
+        {
+            NodesCreatorType kidsCreatorRight(_data, _bestSplit2, _node2, _result2); // spawns 0 or 1 tasks
+            kidsCreatorRight.create(_iFeature2, newTasks, nTasks);
+        }
 
         if (_prevRes)
         {
             _prevRes->release(_data);
             _prevRes = nullptr;
+            _data.GH_SUMS_BUF->releaseParentHist();
         }
     }
 
@@ -345,7 +357,8 @@ protected:
             task.execute();
         });
 
-        algorithmFPType ** ptrs = services::internal::service_scalable_calloc<algorithmFPType *, cpu>(nBlocks);
+        services::internal::TArrayScratch<algorithmFPType *, cpu> ptrsArr(nBlocks);
+        algorithmFPType ** ptrs = ptrsArr.get();
         size_t size;
         tls->reduceTo(ptrs, size);
 
@@ -358,7 +371,6 @@ protected:
 
         tls->release();
         _data.GH_SUMS_BUF->GHForCols.returnBlockToStorage(tls);
-        services::internal::service_scalable_free<algorithmFPType *, cpu>(ptrs);
     }
 
     virtual void findBestSplit(SplitDataType & split, DAAL_INT & iFeature, DAAL_INT & idxFeatureValueBestSplit) DAAL_C11_OVERRIDE {
@@ -378,6 +390,7 @@ protected:
     MergedResult<ResultType, cpu> * _prevRes;
     MergedResult<ResultType, cpu> * _result1;
     MergedResult<ResultType, cpu> * _result2;
+    const bool _bLeaf2;
 };
 
 } /* namespace internal */
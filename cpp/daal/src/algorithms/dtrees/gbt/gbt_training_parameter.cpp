@@ -54,7 +54,10 @@ Parameter::Parameter()
       engine(engines::mt19937::Batch<>::create()),
       minBinSize(5),
       maxBins(256),
-      internalOptions(gbt::internal::parallelAll)
+      internalOptions(gbt::internal::parallelAll),
+      gradientBits(0),
+      earlyStoppingRounds(0),
+      validationMetric(defaultValidationMetric)
 {}
 
 Status checkImpl(const gbt::training::Parameter & prm)
@@ -66,10 +69,14 @@ Status checkImpl(const gbt::training::Parameter & prm)
     DAAL_CHECK_EX((prm.observationsPerTreeFraction > 0) && (prm.observationsPerTreeFraction <= 1), ErrorIncorrectParameter, ParameterName,
                   observationsPerTreeFractionStr());
     DAAL_CHECK_EX(prm.minObservationsInLeafNode, ErrorIncorrectParameter, ParameterName, minObservationsInLeafNodeStr());
+    DAAL_CHECK_EX((prm.validationMetric == lossMetric) || (prm.validationMetric == meanAbsoluteError) || (prm.validationMetric == classificationError),
+                  ErrorIncorrectParameter, ParameterName, validationMetricStr());
     if (prm.splitMethod == inexact)
     {
         DAAL_CHECK_EX((prm.maxBins >= 2), ErrorIncorrectParameter, ParameterName, maxBinsStr());
         DAAL_CHECK_EX((prm.minBinSize >= 1), ErrorIncorrectParameter, ParameterName, minBinSizeStr());
+        DAAL_CHECK_EX((prm.gradientBits == 0) || (prm.gradientBits == 8) || (prm.gradientBits == 16), ErrorIncorrectParameter, ParameterName,
+                      gradientBitsStr());
     }
     return Status();
 }
@@ -0,0 +1,109 @@
+/* file: gbt_regression_low_latency_predictor.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the low latency predictor of the gradient boosted trees regression model
+//--
+*/
+
+#include "algorithms/gradient_boosted_trees/gbt_regression_low_latency_predictor.h"
+#include "src/algorithms/dtrees/gbt/regression/gbt_regression_model_impl.h"
+#include "src/algorithms/dtrees/gbt/gbt_low_latency_predictor_impl.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace prediction
+{
+namespace interface1
+{
+class LowLatencyPredictor::PredictorImpl
+{
+public:
+    PredictorImpl(const ModelPtr & model) : _model(model) {}
+
+    services::Status init(const data_management::NumericTable * featureTypes)
+    {
+        const gbt::regression::internal::ModelImpl * const pModel = static_cast<const gbt::regression::internal::ModelImpl *>(_model.get());
+        return _scorer.init(*pModel, pModel->getNumberOfFeatures(), 1, featureTypes);
+    }
+
+    template <typename algorithmFPType>
+    services::Status predict(const algorithmFPType * x, size_t nRows, algorithmFPType * prediction) const
+    {
+        DAAL_CHECK(x && prediction, services::ErrorNullPtr);
+        _scorer.predict(x, nRows, prediction);
+        return services::Status();
+    }
+
+    size_t getNumberOfFeatures() const { return _scorer.getNumberOfFeatures(); }
+
+private:
+    ModelPtr _model;
+    gbt::prediction::internal::LowLatencyScorer _scorer;
+};
+
+LowLatencyPredictor::LowLatencyPredictor(const ModelPtr & model) : LowLatencyPredictor(model, data_management::NumericTablePtr()) {}
+
+LowLatencyPredictor::LowLatencyPredictor(const ModelPtr & model, const data_management::NumericTablePtr & featureTypes) : _impl(nullptr)
+{
+    if (!model.get())
+    {
+        _status |= services::ErrorNullModel;
+    }
+    else
+    {
+        _impl = new PredictorImpl(model);
+        _status |= _impl->init(featureTypes.get());
+    }
+    services::throwIfPossible(_status);
+}
+
+LowLatencyPredictor::~LowLatencyPredictor()
+{
+    delete _impl;
+}
+
+services::Status LowLatencyPredictor::predict(const float * x, size_t nRows, float * prediction) const
+{
+    DAAL_CHECK(_status.ok(), services::ErrorModelNotFullInitialized);
+    return _impl->predict(x, nRows, prediction);
+}
+
+services::Status LowLatencyPredictor::predict(const double * x, size_t nRows, double * prediction) const
+{
+    DAAL_CHECK(_status.ok(), services::ErrorModelNotFullInitialized);
+    return _impl->predict(x, nRows, prediction);
+}
+
+size_t LowLatencyPredictor::getNumberOfFeatures() const
+{
+    return _impl ? _impl->getNumberOfFeatures() : 0;
+}
+
+} // namespace interface1
+} // namespace prediction
+} // namespace regression
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
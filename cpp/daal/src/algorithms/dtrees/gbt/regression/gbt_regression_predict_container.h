@@ -56,13 +56,16 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     Result * result = static_cast<Result *>(_res);
 
     NumericTable * a                                   = static_cast<NumericTable *>(input->get(data).get());
-    daal::algorithms::gbt::regression::Model * m       = static_cast<daal::algorithms::gbt::regression::Model *>(input->get(model).get());
+    const daal::algorithms::gbt::regression::ModelPtr m = input->get(model);
     NumericTable * r                                   = static_cast<NumericTable *>(result->get(prediction).get());
     const gbt::regression::prediction::Parameter * par = static_cast<gbt::regression::prediction::Parameter *>(_par);
 
+    NumericTable * contributions =
+        (par->resultsToCompute & computeFeatureContributions) ? static_cast<NumericTable *>(result->get(featureContributions).get()) : nullptr;
+
     daal::services::Environment::env & env = *_env;
     __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
-                       daal::services::internal::hostApp(*input), a, m, r, par->nIterations);
+                       daal::services::internal::hostApp(*input), a, m, r, contributions, par->nIterations);
 }
 
 } // namespace prediction
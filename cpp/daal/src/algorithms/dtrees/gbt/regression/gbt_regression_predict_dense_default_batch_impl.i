@@ -35,6 +35,8 @@
 #include "src/externals/service_memory.h"
 #include "src/algorithms/dtrees/regression/dtrees_regression_predict_dense_default_impl.i"
 #include "src/algorithms/dtrees/gbt/gbt_predict_dense_default_impl.i"
+#include "src/algorithms/dtrees/gbt/gbt_predict_quickscorer_impl.i"
+#include "src/algorithms/dtrees/gbt/gbt_predict_shap_impl.i"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -61,32 +63,61 @@ class PredictRegressionTask
 {
 public:
     typedef gbt::internal::GbtDecisionTree TreeType;
-    PredictRegressionTask(const NumericTable * x, NumericTable * y) : _data(x), _res(y) {}
+    typedef gbt::prediction::internal::QuickScorer<algorithmFPType, cpu> QuickScorerType;
+    PredictRegressionTask(const NumericTable * x, NumericTable * y, const algorithms::ModelPtr & model, QuickScorerType * scorer = nullptr)
+        : _data(x),
+          _csr(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(x))),
+          _res(y),
+          _model(model),
+          _bUseQuickScorer(scorer != nullptr),
+          _scorer(scorer)
+    {}
     services::Status run(const gbt::regression::internal::ModelImpl * m, size_t nIterations, services::HostAppIface * pHostApp);
+    services::Status runContributions(const gbt::regression::internal::ModelImpl * m, NumericTable * contributions);
 
 protected:
+    services::Status initQuickScorer();
     services::Status runInternal(services::HostAppIface * pHostApp, NumericTable * result);
     algorithmFPType predictByTrees(size_t iFirstTree, size_t nTrees, const algorithmFPType * x);
+    algorithmFPType predictByTreesSparse(size_t iFirstTree, size_t nTrees, const algorithmFPType * x, const size_t * colIndices, size_t nNonZeros);
     void predictByTreesVector(size_t iFirstTree, size_t nTrees, const algorithmFPType * x, algorithmFPType * res);
 
 protected:
     dtrees::internal::FeatureTypes _featHelper;
     TArray<const TreeType *, cpu> _aTree;
     const NumericTable * _data;
+    CSRNumericTableIface * _csr; //not null if the data is in CSR format
     NumericTable * _res;
+    algorithms::ModelPtr _model;
+    bool _bUseQuickScorer;
+    QuickScorerType * _scorer; /* Kept by the kernel between the calls, null for the default method */
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
 // PredictKernel
 //////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, prediction::Method method, CpuType cpu>
+PredictKernel<algorithmFPType, method, cpu>::~PredictKernel()
+{
+    delete _scorer;
+}
+
 template <typename algorithmFPType, prediction::Method method, CpuType cpu>
 services::Status PredictKernel<algorithmFPType, method, cpu>::compute(services::HostAppIface * pHostApp, const NumericTable * x,
-                                                                      const regression::Model * m, NumericTable * r, size_t nIterations)
+                                                                      const regression::ModelPtr & m, NumericTable * r, NumericTable * contributions,
+                                                                      size_t nIterations)
 {
     const daal::algorithms::gbt::regression::internal::ModelImpl * pModel =
-        static_cast<const daal::algorithms::gbt::regression::internal::ModelImpl *>(m);
-    PredictRegressionTask<algorithmFPType, cpu> task(x, r);
-    return task.run(pModel, nIterations, pHostApp);
+        static_cast<const daal::algorithms::gbt::regression::internal::ModelImpl *>(m.get());
+    if (method == quickScorer && !_scorer)
+    {
+        _scorer = new gbt::prediction::internal::QuickScorer<algorithmFPType, cpu>();
+        DAAL_CHECK_MALLOC(_scorer);
+    }
+    PredictRegressionTask<algorithmFPType, cpu> task(x, r, m, _scorer);
+    services::Status s = task.run(pModel, nIterations, pHostApp);
+    if (s && contributions) s = task.runContributions(pModel, contributions);
+    return s;
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -99,9 +130,30 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::run(const gbt::reg
     this->_aTree.reset(nTreesTotal);
     DAAL_CHECK_MALLOC(this->_aTree.get());
     for (size_t i = 0; i < nTreesTotal; ++i) this->_aTree[i] = m->at(i);
+    services::Status s = initQuickScorer();
+    if (!s) return s;
     return runInternal(pHostApp, this->_res);
 }
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictRegressionTask<algorithmFPType, cpu>::runContributions(const gbt::regression::internal::ModelImpl * m,
+                                                                               NumericTable * contributions)
+{
+    return gbt::prediction::internal::computeContributions<algorithmFPType, cpu>(*m, this->_aTree.size(), this->_featHelper, this->_data,
+                                                                                 contributions);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictRegressionTask<algorithmFPType, cpu>::initQuickScorer()
+{
+    /* The trees that cannot be evaluated by QuickScorer are processed by the default method,
+       the data in CSR format is processed by the default method too, so that the rows are not converted to dense ones */
+    if (_csr) _bUseQuickScorer = false;
+    if (_bUseQuickScorer) _bUseQuickScorer = QuickScorerType::isSupported(this->_featHelper, this->_aTree.get(), this->_aTree.size());
+    if (!_bUseQuickScorer) return services::Status();
+    return _scorer->init(_model, this->_aTree.get(), this->_aTree.size(), this->_data->getNumberOfColumns(), 1);
+}
+
 template <typename algorithmFPType, CpuType cpu>
 services::Status PredictRegressionTask<algorithmFPType, cpu>::runInternal(services::HostAppIface * pHostApp, NumericTable * result)
 {
@@ -122,9 +174,29 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::runInternal(servic
         daal::threader_for(dim.nDataBlocks, dim.nDataBlocks, [&](size_t iBlock) {
             const size_t iStartRow      = iBlock * dim.nRowsInBlock;
             const size_t nRowsToProcess = (iBlock == dim.nDataBlocks - 1) ? dim.nRowsTotal - iBlock * dim.nRowsInBlock : dim.nRowsInBlock;
+            algorithmFPType * res       = resBD.get() + iStartRow;
+
+            if (_csr)
+            {
+                ReadRowsCSR<algorithmFPType, cpu> xBD(_csr, iStartRow, nRowsToProcess);
+                DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+                const size_t * rows = xBD.rows();
+                for (size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
+                {
+                    const size_t iFirst = rows[iRow] - rows[0];
+                    res[iRow] += predictByTreesSparse(iTree, nTreesToUse, xBD.values() + iFirst, xBD.cols() + iFirst, rows[iRow + 1] - rows[iRow]);
+                }
+                return;
+            }
+
             ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(this->_data), iStartRow, nRowsToProcess);
             DAAL_CHECK_BLOCK_STATUS_THR(xBD);
-            algorithmFPType * res = resBD.get() + iStartRow;
+
+            if (_bUseQuickScorer)
+            {
+                safeStat |= _scorer->predict(xBD.get(), nRowsToProcess, dim.nCols, res);
+                return;
+            }
 
             size_t iRow;
             for (iRow = 0; iRow + VECTOR_BLOCK_SIZE <= nRowsToProcess; iRow += VECTOR_BLOCK_SIZE)
@@ -152,6 +224,17 @@ algorithmFPType PredictRegressionTask<algorithmFPType, cpu>::predictByTrees(size
     return val;
 }
 
+template <typename algorithmFPType, CpuType cpu>
+algorithmFPType PredictRegressionTask<algorithmFPType, cpu>::predictByTreesSparse(size_t iFirstTree, size_t nTrees, const algorithmFPType * x,
+                                                                                 const size_t * colIndices, size_t nNonZeros)
+{
+    algorithmFPType val = 0;
+    for (size_t iTree = iFirstTree, iLastTree = iFirstTree + nTrees; iTree < iLastTree; ++iTree)
+        val += gbt::prediction::internal::predictForTreeSparse<algorithmFPType, TreeType, cpu>(*this->_aTree[iTree], this->_featHelper, x, colIndices,
+                                                                                              nNonZeros);
+    return val;
+}
+
 template <typename algorithmFPType, CpuType cpu>
 void PredictRegressionTask<algorithmFPType, cpu>::predictByTreesVector(size_t iFirstTree, size_t nTrees, const algorithmFPType * x,
                                                                        algorithmFPType * res)
@@ -38,6 +38,15 @@ namespace algorithms
 {
 namespace gbt
 {
+namespace prediction
+{
+namespace internal
+{
+template <typename algorithmFPType, CpuType cpu>
+class QuickScorer;
+} // namespace internal
+} // namespace prediction
+
 namespace regression
 {
 namespace prediction
@@ -48,16 +57,27 @@ template <typename algorithmFpType, gbt::regression::prediction::Method method,
 class PredictKernel : public daal::algorithms::Kernel
 {
 public:
+    PredictKernel() : _scorer(nullptr) {}
+    ~PredictKernel();
+
     /**
      *  \brief Compute gradient boosted trees prediction results.
      *
      *  \param a[in]    Matrix of input variables X
      *  \param m[in]    gradient boosted trees model obtained on training stage
      *  \param r[out]   Prediction results
+     *  \param contributions[out]  Contributions of the features to the prediction results, null if they are not computed
      *  \param nIterations[in]  Number of iterations to predict in gradient boosted trees algorithm parameter
      */
-    services::Status compute(services::HostAppIface * pHostApp, const NumericTable * a, const regression::Model * m, NumericTable * r,
-                             size_t nIterations);
+    services::Status compute(services::HostAppIface * pHostApp, const NumericTable * a, const regression::ModelPtr & m, NumericTable * r,
+                             NumericTable * contributions, size_t nIterations);
+
+private:
+    PredictKernel(const PredictKernel &);
+    PredictKernel & operator=(const PredictKernel &);
+
+    /* QuickScorer representation of the model predicted by the previous call, built by the quickScorer method only */
+    gbt::prediction::internal::QuickScorer<algorithmFpType, cpu> * _scorer;
 };
 
 } // namespace internal
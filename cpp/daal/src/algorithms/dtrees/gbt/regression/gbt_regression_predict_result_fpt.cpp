@@ -47,6 +47,13 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
     const size_t nVectors = dataPtr->getNumberOfRows();
     Argument::set(prediction,
                   data_management::HomogenNumericTable<algorithmFPType>::create(1, nVectors, data_management::NumericTableIface::doAllocate, &s));
+    const Parameter * algPar = static_cast<const Parameter *>(par);
+    if (s && algPar && (algPar->resultsToCompute & computeFeatureContributions))
+    {
+        const size_t nFeatures = dataPtr->getNumberOfColumns();
+        Argument::set(featureContributions, data_management::HomogenNumericTable<algorithmFPType>::create(
+                                                nFeatures + 1, nVectors, data_management::NumericTableIface::doAllocate, &s));
+    }
     return s;
 }
 
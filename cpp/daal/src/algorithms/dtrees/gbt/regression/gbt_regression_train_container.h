@@ -88,6 +88,11 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     const NumericTable * x = input->get(data).get();
     const NumericTable * y = input->get(dependentVariable).get();
 
+    const NumericTable * validX = input->get(validationData).get();
+    const NumericTable * validY = input->get(validationDependentVariable).get();
+
+    const gbt::regression::Model * initialM = input->get(initialModel).get();
+
     gbt::regression::Model * m = result->get(model).get();
 
     const Parameter * par                  = static_cast<gbt::regression::training::Parameter *>(_par);
@@ -98,10 +103,11 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     if (deviceInfo.isCpu)
     {
         __DAAL_CALL_KERNEL(env, internal::RegressionTrainBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
-                           daal::services::internal::hostApp(*input), x, y, *m, *result, *par, *engine);
+                           daal::services::internal::hostApp(*input), x, y, validX, validY, initialM, *m, *result, *par, *engine);
     }
     else
     {
+        if (par->earlyStoppingRounds || initialM) return services::Status(services::ErrorMethodNotSupported);
         __DAAL_CALL_KERNEL_SYCL(env, internal::RegressionTrainBatchKernelOneAPI, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
                                 daal::services::internal::hostApp(*input), x, y, *m, *result, *par, *engine);
     }
@@ -85,6 +85,17 @@ public:
             }
         });
     }
+
+    virtual algorithmFPType getLoss(size_t n, const algorithmFPType * y, const algorithmFPType * f) DAAL_C11_OVERRIDE
+    {
+        const algorithmFPType sum = LoopHelper<cpu>::template sum<algorithmFPType>(n, [&](size_t start, size_t end) -> algorithmFPType {
+            algorithmFPType lsum = 0;
+            PRAGMA_ICC_NO16(omp simd reduction(+ : lsum))
+            for (size_t i = start; i < end; i++) lsum += (f[i] - y[i]) * (f[i] - y[i]);
+            return lsum;
+        });
+        return algorithmFPType(0.5) * sum / algorithmFPType(n);
+    }
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -166,8 +177,10 @@ protected:
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, gbt::regression::training::Method method, CpuType cpu>
 services::Status RegressionTrainBatchKernel<algorithmFPType, method, cpu>::compute(HostAppIface * pHostApp, const NumericTable * x,
-                                                                                   const NumericTable * y, gbt::regression::Model & m, Result & res,
-                                                                                   const Parameter & par, engines::internal::BatchBaseImpl & engine)
+                                                                                   const NumericTable * y, const NumericTable * validX,
+                                                                                   const NumericTable * validY, const gbt::regression::Model * initialModel,
+                                                                                   gbt::regression::Model & m, Result & res, const Parameter & par,
+                                                                                   engines::internal::BatchBaseImpl & engine)
 {
     const size_t nFeaturesPerNode = par.featuresPerNode ? par.featuresPerNode : x->getNumberOfColumns();
     const bool inexactWithHistMethod =
@@ -176,14 +189,7 @@ services::Status RegressionTrainBatchKernel<algorithmFPType, method, cpu>::compu
     services::Status s;
     dtrees::internal::IndexedFeatures indexedFeatures;
     dtrees::internal::FeatureTypes featTypes;
-    DAAL_CHECK_MALLOC(featTypes.init(*x));
-
-    if (!par.memorySavingMode)
-    {
-        BinParams prm(par.maxBins, par.minBinSize);
-        DAAL_CHECK_STATUS(s,
-                          (indexedFeatures.init<algorithmFPType, cpu>(*x, &featTypes, par.splitMethod == gbt::training::inexact ? &prm : nullptr)));
-    }
+    DAAL_CHECK_STATUS(s, (initIndexedFeatures<algorithmFPType, cpu>(x, par, indexedFeatures, featTypes)));
 
     WriteOnlyRows<algorithmFPType, cpu> weightsRows, totalCoverRows, coverRows, totalGainRows, gainRows;
 
@@ -214,25 +220,28 @@ services::Status RegressionTrainBatchKernel<algorithmFPType, method, cpu>::compu
     algorithmFPType * ptrTotalGain  = totalGainRows.get();
     algorithmFPType * ptrGain       = gainRows.get();
 
+    const gbt::internal::ModelImpl * initialModelImpl =
+        initialModel ? static_cast<const daal::algorithms::gbt::regression::internal::ModelImpl *>(initialModel) : nullptr;
+
     if (inexactWithHistMethod)
     {
         if (indexedFeatures.maxNumIndices() <= 256)
             return computeImpl<algorithmFPType, cpu, uint8_t, TrainBatchTask<algorithmFPType, uint8_t, method, cpu>, Result>(
-                pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl *>(&m), par, engine, 1, indexedFeatures,
+                pHostApp, x, y, validX, validY, initialModelImpl, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl *>(&m), par, engine, 1, indexedFeatures,
                 featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
         else if (indexedFeatures.maxNumIndices() <= 65536)
             return computeImpl<algorithmFPType, cpu, uint16_t, TrainBatchTask<algorithmFPType, uint16_t, method, cpu>, Result>(
-                pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl *>(&m), par, engine, 1, indexedFeatures,
+                pHostApp, x, y, validX, validY, initialModelImpl, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl *>(&m), par, engine, 1, indexedFeatures,
                 featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
         else
             return computeImpl<algorithmFPType, cpu, uint32_t, TrainBatchTask<algorithmFPType, uint32_t, method, cpu>, Result>(
-                pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl *>(&m), par, engine, 1, indexedFeatures,
+                pHostApp, x, y, validX, validY, initialModelImpl, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl *>(&m), par, engine, 1, indexedFeatures,
                 featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
     }
     else
     {
         return computeImpl<algorithmFPType, cpu, uint32_t, TrainBatchTask<algorithmFPType, uint32_t, method, cpu>, Result>(
-            pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl *>(&m), par, engine, 1, indexedFeatures, featTypes,
+            pHostApp, x, y, validX, validY, initialModelImpl, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl *>(&m), par, engine, 1, indexedFeatures, featTypes,
             &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
     }
 }
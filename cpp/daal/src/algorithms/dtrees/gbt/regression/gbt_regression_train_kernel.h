@@ -49,7 +49,8 @@ template <typename algorithmFPType, Method method, CpuType cpu>
 class RegressionTrainBatchKernel : public daal::algorithms::Kernel
 {
 public:
-    services::Status compute(HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, gbt::regression::Model & m, Result & res,
+    services::Status compute(HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, const NumericTable * validX,
+                             const NumericTable * validY, const gbt::regression::Model * initialModel, gbt::regression::Model & m, Result & res,
                              const Parameter & par, engines::internal::BatchBaseImpl & engine);
 };
 
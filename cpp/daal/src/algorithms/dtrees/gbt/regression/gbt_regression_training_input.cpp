@@ -23,6 +23,7 @@
 
 #include "algorithms/gradient_boosted_trees/gbt_regression_training_types.h"
 #include "src/services/daal_strings.h"
+#include "src/algorithms/dtrees/gbt/regression/gbt_regression_model_impl.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -51,7 +52,7 @@ Status Parameter::check() const
 }
 
 /** Default constructor */
-Input::Input() : algorithms::regression::training::Input(lastInputId + 1) {}
+Input::Input() : algorithms::regression::training::Input(lastModelInputId + 1) {}
 
 /**
  * Returns an input object for gradient boosted trees model-based training
@@ -73,6 +74,26 @@ void Input::set(InputId id, const NumericTablePtr & value)
     algorithms::regression::training::Input::set(algorithms::regression::training::InputId(id), value);
 }
 
+/**
+ * Returns an input model for gradient boosted trees model-based training
+ * \param[in] id    Identifier of the input model
+ * \return          %Input model that corresponds to the given identifier
+ */
+gbt::regression::ModelPtr Input::get(ModelInputId id) const
+{
+    return staticPointerCast<gbt::regression::Model, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets an input model for gradient boosted trees model-based training
+ * \param[in] id      Identifier of the input model
+ * \param[in] value   Pointer to the model
+ */
+void Input::set(ModelInputId id, const gbt::regression::ModelPtr & value)
+{
+    Argument::set(id, value);
+}
+
 /**
 * Checks an input object for the gradient boosted trees algorithm
 * \param[in] par     Algorithm parameter
@@ -94,6 +115,28 @@ Status Input::check(const daal::algorithms::Parameter * par, int method) const
     DAAL_CHECK_EX(nSamplesPerTree > 0, ErrorIncorrectParameter, ParameterName, observationsPerTreeFractionStr());
     const auto nFeatures = dataTable->getNumberOfColumns();
     DAAL_CHECK_EX(parameter->featuresPerNode <= nFeatures, ErrorIncorrectParameter, ParameterName, featuresPerNodeStr());
+    DAAL_CHECK_EX(parameter->validationMetric != gbt::training::classificationError, ErrorIncorrectParameter, ParameterName, validationMetricStr());
+
+    if (parameter->earlyStoppingRounds)
+    {
+        const NumericTablePtr validationDataTable = get(validationData);
+        DAAL_CHECK_STATUS(s, checkNumericTable(validationDataTable.get(), validationDataStr(), 0, 0, nFeatures));
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(validationDependentVariable).get(), validationDependentVariableStr(), 0, 0, 1,
+                                               validationDataTable->getNumberOfRows()));
+    }
+    else
+    {
+        DAAL_CHECK_EX(get(validationData).get() == nullptr, ErrorIncorrectOptionalInput, ArgumentName, validationDataStr());
+        DAAL_CHECK_EX(get(validationDependentVariable).get() == nullptr, ErrorIncorrectOptionalInput, ArgumentName, validationDependentVariableStr());
+    }
+
+    const gbt::regression::ModelPtr initialModelPtr = get(initialModel);
+    if (initialModelPtr)
+    {
+        DAAL_CHECK_EX(dynamic_cast<const gbt::regression::internal::ModelImpl *>(initialModelPtr.get()), ErrorIncorrectTypeOfModel, ArgumentName,
+                      initialModelStr());
+        DAAL_CHECK_EX(initialModelPtr->getNumberOfFeatures() == nFeatures, ErrorIncorrectNumberOfFeatures, ArgumentName, initialModelStr());
+    }
     return s;
 }
 
@@ -25,6 +25,7 @@
 #define __SERVICE_ARRAY__
 
 #include "src/externals/service_memory.h"
+#include "src/services/service_allocators.h"
 
 namespace daal
 {
@@ -50,6 +51,14 @@ public:
     static void free(void * ptr) { services::internal::service_scalable_free<byte, cpu>((byte *)ptr); }
 };
 
+template <CpuType cpu>
+class ScratchAllocator
+{
+public:
+    static void * alloc(size_t nBytes) { return services::internal::ScratchCalloc<byte, cpu>::allocate(nBytes); }
+    static void free(void * ptr) { services::internal::ScratchCalloc<byte, cpu>::deallocate((byte *)ptr); }
+};
+
 //Simple container
 template <typename T, CpuType cpu, typename Allocator = DefaultAllocator<cpu> >
 class TVector
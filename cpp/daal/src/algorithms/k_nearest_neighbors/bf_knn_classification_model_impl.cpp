@@ -55,7 +55,8 @@ services::Status Model::serializeImpl(data_management::InputDataArchive * arch)
 services::Status Model::deserializeImpl(const data_management::OutputDataArchive * arch)
 {
     daal::algorithms::classifier::Model::serialImpl<const data_management::OutputDataArchive, true>(arch);
-    return _impl->serialImpl<const data_management::OutputDataArchive, true>(arch);
+    return _impl->serialImpl<const data_management::OutputDataArchive, true>(
+        arch, COMPUTE_DAAL_VERSION(arch->getMajorVersion(), arch->getMinorVersion(), arch->getUpdateVersion()));
 }
 
 size_t Model::getNumberOfFeatures() const
@@ -69,6 +70,13 @@ services::Status Parameter::check() const
                   services::ErrorIncorrectParameter, services::ParameterName, nClassesStr());
     DAAL_CHECK_EX(this->k > 0 && this->k <= static_cast<size_t>(services::internal::MaxVal<int>::get()), services::ErrorIncorrectParameter,
                   services::ParameterName, kStr());
+    DAAL_CHECK_EX(this->nProbes > 0, services::ErrorIncorrectParameter, services::ParameterName, nProbesStr());
+    DAAL_CHECK_EX(this->distanceType <= lastDistanceType, services::ErrorIncorrectParameter, services::ParameterName, distanceTypeStr());
+    DAAL_CHECK_EX(this->distanceType != minkowski || this->minkowskiPower >= 1.0, services::ErrorIncorrectParameter, services::ParameterName,
+                  minkowskiPowerStr());
+    /* Inner product taken with the minus sign can be negative, so it cannot be inverted into a weight */
+    DAAL_CHECK_EX(this->distanceType != innerProduct || this->voteWeights != voteDistance, services::ErrorIncorrectParameter,
+                  services::ParameterName, voteWeightsStr());
     return services::Status();
 }
 
@@ -58,8 +58,23 @@ services::Status Input::check(const daal::algorithms::Parameter * parameter, int
     const bf_knn_classification::ModelPtr m = get(classifier::prediction::model);
     ErrorCollection errors;
     errors.setCanThrow(false);
-    DAAL_CHECK(checkNumericTable(m->impl()->getData().get(), dataStr()), ErrorModelNotFullInitialized);
-    DAAL_CHECK_EX(algParameter->k <= m->impl()->getData()->getNumberOfRows(), services::ErrorIncorrectParameter, services::ParameterName, kStr());
+    /* The model trained by ivfFlat keeps only the inverted lists, the one trained by defaultDense keeps only the training data */
+    const bool hasTrainingData = (m->impl()->getData().get() != nullptr);
+    const bool hasLists        = m->impl()->hasInvertedLists();
+    if (method == ivfFlat)
+    {
+        DAAL_CHECK(hasLists || !hasTrainingData, ErrorKNNIncompatibleModelMethod);
+        DAAL_CHECK(hasLists, ErrorModelNotFullInitialized);
+        DAAL_CHECK_EX(algParameter->k <= m->impl()->getListData()->getNumberOfRows(), services::ErrorIncorrectParameter, services::ParameterName,
+                      kStr());
+    }
+    else
+    {
+        DAAL_CHECK(hasTrainingData || !hasLists, ErrorKNNIncompatibleModelMethod);
+        DAAL_CHECK(checkNumericTable(m->impl()->getData().get(), dataStr()), ErrorModelNotFullInitialized);
+        DAAL_CHECK_EX(algParameter->k <= m->impl()->getData()->getNumberOfRows(), services::ErrorIncorrectParameter, services::ParameterName,
+                      kStr());
+    }
     if ((algParameter->resultsToEvaluate & daal::algorithms::classifier::computeClassLabels) != 0)
     {
         DAAL_CHECK(checkNumericTable(m->impl()->getLabels().get(), labelsStr()), ErrorModelNotFullInitialized);
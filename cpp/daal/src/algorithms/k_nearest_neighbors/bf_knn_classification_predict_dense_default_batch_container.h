@@ -65,7 +65,16 @@ services::Status BatchContainer<algorithmFpType, method, cpu>::compute()
     auto & context                                           = services::internal::getDefaultContext();
     auto & deviceInfo                                        = context.getInfoDevice();
 
-    if (deviceInfo.isCpu)
+    if (deviceInfo.isCpu && method == ivfFlat)
+    {
+        __DAAL_CALL_KERNEL(env, internal::KNNClassificationPredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFpType), computeIvf, a.get(), m.get(),
+                           label.get(), indices.get(), distances.get(), par);
+    }
+    else if (method == ivfFlat || par->distanceType != euclidean)
+    {
+        return services::Status(services::ErrorDeviceSupportNotImplemented);
+    }
+    else if (deviceInfo.isCpu)
     {
         __DAAL_CALL_KERNEL(env, internal::KNNClassificationPredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFpType), compute, a.get(), m.get(),
                            label.get(), indices.get(), distances.get(), par);
@@ -29,6 +29,7 @@ namespace prediction
 namespace interface1
 {
 template class BatchContainer<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
+template class BatchContainer<DAAL_FPTYPE, ivfFlat, DAAL_CPU>;
 } // namespace interface1
 namespace internal
 {
@@ -24,6 +24,8 @@ namespace algorithms
 {
 __DAAL_INSTANTIATE_DISPATCH_CONTAINER_SYCL(bf_knn_classification::prediction::BatchContainer, batch, DAAL_FPTYPE,
                                            bf_knn_classification::prediction::defaultDense)
+__DAAL_INSTANTIATE_DISPATCH_CONTAINER_SYCL(bf_knn_classification::prediction::BatchContainer, batch, DAAL_FPTYPE,
+                                           bf_knn_classification::prediction::ivfFlat)
 
 namespace bf_knn_classification
 {
@@ -53,6 +55,7 @@ Batch<algorithmFPType, method>::Batch(size_t nClasses)
 }
 
 template class Batch<DAAL_FPTYPE, defaultDense>;
+template class Batch<DAAL_FPTYPE, ivfFlat>;
 
 } // namespace interface1
 } // namespace prediction
@@ -41,6 +41,8 @@ class KNNClassificationPredictKernel : public daal::algorithms::Kernel
 public:
     services::Status compute(const NumericTable * data, const classifier::Model * m, NumericTable * label, NumericTable * indices,
                              NumericTable * distances, const daal::algorithms::Parameter * par);
+    services::Status computeIvf(const NumericTable * data, const classifier::Model * m, NumericTable * label, NumericTable * indices,
+                                NumericTable * distances, const daal::algorithms::Parameter * par);
 };
 
 } // namespace internal
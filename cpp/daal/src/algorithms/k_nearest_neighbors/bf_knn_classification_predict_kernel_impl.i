@@ -25,6 +25,8 @@
 #include "src/algorithms/k_nearest_neighbors/bf_knn_classification_predict_kernel.h"
 #include "src/algorithms/k_nearest_neighbors/oneapi/bf_knn_classification_model_ucapi_impl.h"
 #include "src/algorithms/k_nearest_neighbors/bf_knn_impl.i"
+#include "src/algorithms/k_nearest_neighbors/bf_knn_ivf_impl.i"
+#include "src/services/daal_strings.h"
 #include "src/services/service_data_utils.h"
 #include "src/data_management/service_numeric_table.h"
 
@@ -54,11 +56,27 @@ services::Status KNNClassificationPredictKernel<algorithmFPType, cpu>::compute(c
     const DAAL_UINT64 resultsToEvaluate = parameter->resultsToEvaluate;
     const DAAL_UINT64 resultsToCompute  = parameter->resultsToCompute;
 
+    const daal::algorithms::internal::PairwiseDistanceType distanceType =
+        static_cast<daal::algorithms::internal::PairwiseDistanceType>(parameter->distanceType);
+
     daal::algorithms::bf_knn_classification::internal::BruteForceNearestNeighbors<algorithmFPType, cpu> bfnn;
-    bfnn.kNeighbors(k, nClasses, voteWeights, resultsToCompute, resultsToEvaluate, trainDataTable.get(), data, trainLabelTable.get(), label, indices,
-                    distances);
+    return bfnn.kNeighbors(k, nClasses, voteWeights, resultsToCompute, resultsToEvaluate, trainDataTable.get(), data, trainLabelTable.get(), label,
+                           indices, distances, distanceType, algorithmFPType(parameter->minkowskiPower));
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status KNNClassificationPredictKernel<algorithmFPType, cpu>::computeIvf(const NumericTable * data, const classifier::Model * m,
+                                                                                  NumericTable * label, NumericTable * indices,
+                                                                                  NumericTable * distances, const daal::algorithms::Parameter * par)
+{
+    const Model * const convModel     = static_cast<const Model *>(m);
+    const Parameter * const parameter = static_cast<const Parameter *>(par);
+
+    DAAL_CHECK_EX(parameter->distanceType == euclidean, services::ErrorMethodNotSupported, services::ParameterName, distanceTypeStr());
 
-    return services::Status();
+    daal::algorithms::bf_knn_classification::internal::InvertedListsNearestNeighbors<algorithmFPType, cpu> ivfnn;
+    return ivfnn.kNeighbors(parameter->k, parameter->nProbes, parameter->nClasses, parameter->voteWeights, parameter->resultsToCompute,
+                            parameter->resultsToEvaluate, *convModel->impl(), data, label, indices, distances);
 }
 
 } // namespace internal
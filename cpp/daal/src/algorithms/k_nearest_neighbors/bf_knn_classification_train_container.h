@@ -75,7 +75,8 @@ services::Status BatchContainer<algorithmFpType, method, cpu>::compute()
     daal::services::Environment::env & env = *_env;
 
     const bool copy = (par->dataUseInModel == doNotUse);
-    status |= r->impl()->setData<algorithmFpType>(x, copy);
+    /* The inverted file index keeps its own copy of the data grouped by lists */
+    if (method == defaultDense) status |= r->impl()->setData<algorithmFpType>(x, copy);
     if ((par->resultsToEvaluate & daal::algorithms::classifier::computeClassLabels) != 0)
     {
         const NumericTablePtr y = input->get(classifier::training::labels);
@@ -86,7 +87,16 @@ services::Status BatchContainer<algorithmFpType, method, cpu>::compute()
     auto & context    = services::internal::getDefaultContext();
     auto & deviceInfo = context.getInfoDevice();
 
-    if (deviceInfo.isCpu)
+    if (deviceInfo.isCpu && method == ivfFlat)
+    {
+        __DAAL_CALL_KERNEL(env, internal::KNNClassificationTrainKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFpType), computeIvf, x.get(),
+                           r->impl()->getLabels().get(), r.get(), *par, *par->engine);
+    }
+    else if (method == ivfFlat)
+    {
+        return services::Status(services::ErrorDeviceSupportNotImplemented);
+    }
+    else if (deviceInfo.isCpu)
     {
         __DAAL_CALL_KERNEL(env, internal::KNNClassificationTrainKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFpType), compute, r->impl()->getData().get(),
                            r->impl()->getLabels().get(), r.get(), *par, *par->engine);
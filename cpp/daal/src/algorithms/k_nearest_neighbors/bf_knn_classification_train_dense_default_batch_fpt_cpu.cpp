@@ -29,6 +29,7 @@ namespace training
 namespace interface1
 {
 template class BatchContainer<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
+template class BatchContainer<DAAL_FPTYPE, ivfFlat, DAAL_CPU>;
 }
 namespace internal
 {
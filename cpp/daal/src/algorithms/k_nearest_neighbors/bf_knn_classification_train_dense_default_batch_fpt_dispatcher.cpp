@@ -23,6 +23,8 @@ namespace algorithms
 {
 __DAAL_INSTANTIATE_DISPATCH_CONTAINER_SYCL(bf_knn_classification::training::BatchContainer, batch, DAAL_FPTYPE,
                                            bf_knn_classification::training::defaultDense)
+__DAAL_INSTANTIATE_DISPATCH_CONTAINER_SYCL(bf_knn_classification::training::BatchContainer, batch, DAAL_FPTYPE,
+                                           bf_knn_classification::training::ivfFlat)
 namespace bf_knn_classification
 {
 namespace training
@@ -51,6 +53,7 @@ Batch<algorithmFPType, method>::Batch(size_t nClasses)
 }
 
 template class Batch<DAAL_FPTYPE, defaultDense>;
+template class Batch<DAAL_FPTYPE, ivfFlat>;
 
 } // namespace interface1
 } // namespace training
@@ -41,6 +41,7 @@ class KNNClassificationTrainKernel : public daal::algorithms::Kernel
 {
 public:
     services::Status compute(NumericTable * x, NumericTable * y, Model * r, const Parameter & par, engines::BatchBase & engine);
+    services::Status computeIvf(NumericTable * x, NumericTable * y, Model * r, const Parameter & par, engines::BatchBase & engine);
 };
 
 } // namespace internal
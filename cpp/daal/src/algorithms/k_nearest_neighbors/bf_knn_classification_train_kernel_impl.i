@@ -24,6 +24,8 @@
 #include "src/algorithms/k_nearest_neighbors/bf_knn_classification_train_kernel.h"
 #include "src/algorithms/k_nearest_neighbors/oneapi/bf_knn_classification_model_ucapi_impl.h"
 #include "src/algorithms/k_nearest_neighbors/bf_knn_impl.i"
+#include "src/algorithms/k_nearest_neighbors/bf_knn_ivf_impl.i"
+#include "src/services/daal_strings.h"
 
 namespace daal
 {
@@ -42,6 +44,16 @@ services::Status KNNClassificationTrainKernel<algorithmFpType, cpu>::compute(Num
     return services::Status();
 }
 
+template <typename algorithmFpType, CpuType cpu>
+services::Status KNNClassificationTrainKernel<algorithmFpType, cpu>::computeIvf(NumericTable * x, NumericTable * y, Model * r, const Parameter & par,
+                                                                                engines::BatchBase & engine)
+{
+    // the k-means clustering of the inverted lists relies on the Euclidean distance
+    DAAL_CHECK_EX(par.distanceType == euclidean, services::ErrorMethodNotSupported, services::ParameterName, distanceTypeStr());
+    daal::algorithms::bf_knn_classification::internal::InvertedListsBuilder<algorithmFpType, cpu> builder;
+    return builder.build(*x, par.nLists, par.nQuantizerIterations, engine, *r->impl());
+}
+
 } // namespace internal
 } // namespace training
 } // namespace bf_knn_classification
@@ -36,6 +36,7 @@
 #include "src/algorithms/service_sort.h"
 #include "src/externals/service_math.h"
 #include "src/algorithms/k_nearest_neighbors/knn_heap.h"
+#include "src/services/service_unique_ptr.h"
 
 namespace daal
 {
@@ -45,6 +46,19 @@ namespace bf_knn_classification
 {
 namespace internal
 {
+/* Tells whether the selector of the nearest neighbors keeps them sorted by the distance */
+template <typename Selector>
+struct IsSortedSelector
+{
+    static const bool value = false;
+};
+
+template <typename T, CpuType cpu>
+struct IsSortedSelector<SortedNeighbors<T, cpu> >
+{
+    static const bool value = true;
+};
+
 template <typename FPType, CpuType cpu>
 class BruteForceNearestNeighbors
 {
@@ -55,11 +69,14 @@ public:
 
     typedef GlobalNeighbors<FPType, cpu> Neighbors;
     typedef Heap<Neighbors, cpu> HeapType;
+    typedef SortedNeighbors<Neighbors, cpu> SortedNeighborsType;
+    typedef daal::algorithms::internal::PairwiseDistances<FPType, cpu> MetricType;
+    typedef daal::algorithms::internal::EuclideanDistances<FPType, cpu> EuclideanMetricType;
 
     services::Status kNeighbors(const size_t k, const size_t nClasses, VoteWeights voteWeights, DAAL_UINT64 resultsToCompute,
                                 DAAL_UINT64 resultsToEvaluate, const NumericTable * trainTable, const NumericTable * testTable,
                                 const NumericTable * trainLabelTable, NumericTable * testLabelTable, NumericTable * indicesTable,
-                                NumericTable * distancesTable)
+                                NumericTable * distancesTable, daal::algorithms::internal::PairwiseDistanceType distanceType, FPType minkowskiPower)
     {
         const size_t nDims  = trainTable->getNumberOfColumns();
         const size_t nTrain = trainTable->getNumberOfRows();
@@ -76,15 +93,20 @@ public:
             DAAL_CHECK_MALLOC(trainLabel);
         }
 
-        daal::algorithms::internal::EuclideanDistances<FPType, cpu> euclDist(*testTable, *trainTable, true);
-        euclDist.init();
+        UniquePtr<MetricType, cpu> metric(
+            daal::algorithms::internal::createPairwiseDistances<FPType, cpu>(distanceType, *testTable, *trainTable, minkowskiPower));
+        DAAL_CHECK_MALLOC(metric.get());
+        DAAL_CHECK_STATUS_VAR(metric->init());
+
+        // the Euclidean distances are finalized together with the selection of the neighbors
+        EuclideanMetricType * const euclDist =
+            (distanceType == daal::algorithms::internal::euclideanDistance) ? static_cast<EuclideanMetricType *>(metric.get()) : nullptr;
 
         const size_t outBlockSize = 128;
         const size_t inBlockSize  = 128;
         const size_t nOuterBlocks = nTest / outBlockSize + !!(nTest % outBlockSize);
 
         TlsMem<FPType, cpu> tlsDistances(inBlockSize * outBlockSize);
-        TlsMem<int, cpu> tlsIdx(outBlockSize);
         TlsMem<FPType, cpu> tlsKDistances(inBlockSize * k);
         TlsMem<int, cpu> tlsKIndexes(inBlockSize * k);
         TlsMem<FPType, cpu> tlsVoting(nClasses);
@@ -96,9 +118,21 @@ public:
             const size_t outerEnd   = outerBlock + 1 == nOuterBlocks ? nTest : outerStart + outBlockSize;
             const size_t outerSize  = outerEnd - outerStart;
 
-            DAAL_CHECK_STATUS_THR(computeKNearestBlock(&euclDist, outerSize, inBlockSize, outerStart, nTrain, resultsToEvaluate, resultsToCompute,
-                                                       nClasses, k, voteWeights, trainLabel, trainTable, testTable, testLabelTable, indicesTable,
-                                                       distancesTable, tlsDistances, tlsIdx, tlsKDistances, tlsKIndexes, tlsVoting, nOuterBlocks));
+            // small k is selected with the sorted arrays kept in registers instead of the heaps
+            if (k <= SortedNeighborsType::maxSize)
+            {
+                DAAL_CHECK_STATUS_THR(computeKNearestBlock<SortedNeighborsType>(
+                    metric.get(), euclDist, outerSize, inBlockSize, outerStart, nTrain, resultsToEvaluate, resultsToCompute, nClasses, k, voteWeights, trainLabel,
+                    trainTable, testTable, testLabelTable, indicesTable, distancesTable, tlsDistances, tlsKDistances, tlsKIndexes, tlsVoting,
+                    nOuterBlocks));
+            }
+            else
+            {
+                DAAL_CHECK_STATUS_THR(computeKNearestBlock<HeapType>(metric.get(), euclDist, outerSize, inBlockSize, outerStart, nTrain, resultsToEvaluate,
+                                                                     resultsToCompute, nClasses, k, voteWeights, trainLabel, trainTable, testTable,
+                                                                     testLabelTable, indicesTable, distancesTable, tlsDistances, tlsKDistances,
+                                                                     tlsKIndexes, tlsVoting, nOuterBlocks));
+            }
         });
 
         if (resultsToEvaluate & daal::algorithms::classifier::computeClassLabels)
@@ -110,51 +144,50 @@ public:
     }
 
 protected:
+    template <typename Selector>
     struct BruteForceTask
     {
     public:
         DAAL_NEW_DELETE();
-        FPType * maxs;
-        HeapType * heapsData;
+        Selector * selectorsData;
 
-        static BruteForceTask * create(const size_t inBlockSize, const size_t outBlockSize, const size_t k)
+        static BruteForceTask * create(const size_t outBlockSize, const size_t k)
         {
-            auto object = new BruteForceTask(inBlockSize, outBlockSize, k);
+            auto object = new BruteForceTask(outBlockSize, k);
             if (object && object->isValid()) return object;
             delete object;
             return nullptr;
         }
 
-        bool isValid() const { return _buff.get() && _heaps.get(); }
+        bool isValid() const { return _selectors.get() && _isInitialized; }
 
     private:
-        BruteForceTask(size_t inBlockSize, size_t outBlockSize, size_t k)
+        BruteForceTask(size_t outBlockSize, size_t k) : _isInitialized(true)
         {
-            _buff.reset(outBlockSize);
-            maxs = _buff.get();
-            service_memset_seq<FPType, cpu>(maxs, MaxVal<FPType>::get(), outBlockSize);
-
-            _heaps.reset(outBlockSize);
+            _selectors.reset(outBlockSize);
 
-            for (size_t i = 0; i < outBlockSize; ++i)
+            for (size_t i = 0; i < _selectors.size(); ++i)
             {
-                _heaps[i].init(k);
+                _isInitialized &= _selectors[i].init(k);
             }
-            heapsData = _heaps.get();
+            selectorsData = _selectors.get();
         }
 
-        TArrayScalable<FPType, cpu> _buff;
-        TArrayScalable<HeapType, cpu> _heaps;
+        TArrayScalable<Selector, cpu> _selectors;
+        bool _isInitialized;
     };
 
-    services::Status computeKNearestBlock(daal::algorithms::internal::EuclideanDistances<FPType, cpu> * distancesInstance, const size_t blockSize,
-                                          const size_t trainBlockSize, const size_t startTestIdx, const size_t nTrain, DAAL_UINT64 resultsToEvaluate,
+    template <typename Selector>
+    services::Status computeKNearestBlock(MetricType * metric, EuclideanMetricType * euclDist, const size_t blockSize, const size_t trainBlockSize,
+                                          const size_t startTestIdx, const size_t nTrain, DAAL_UINT64 resultsToEvaluate,
                                           DAAL_UINT64 resultsToCompute, const size_t nClasses, const size_t k, VoteWeights voteWeights,
                                           FPType * trainLabel, const NumericTable * trainTable, const NumericTable * testTable,
                                           NumericTable * testLabelTable, NumericTable * indicesTable, NumericTable * distancesTable,
-                                          TlsMem<FPType, cpu> & tlsDistances, TlsMem<int, cpu> & tlsIdx, TlsMem<FPType, cpu> & tlsKDistances,
-                                          TlsMem<int, cpu> & tlsKIndexes, TlsMem<FPType, cpu> & tlsVoting, size_t nOuterBlocks)
+                                          TlsMem<FPType, cpu> & tlsDistances, TlsMem<FPType, cpu> & tlsKDistances, TlsMem<int, cpu> & tlsKIndexes,
+                                          TlsMem<FPType, cpu> & tlsVoting, size_t nOuterBlocks)
     {
+        typedef BruteForceTask<Selector> TaskType;
+
         const size_t inBlockSize = trainBlockSize;
         const size_t inRows      = nTrain;
         const size_t nInBlocks   = inRows / inBlockSize + (inRows % inBlockSize > 0);
@@ -172,10 +205,13 @@ protected:
         DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, inBlockSize * sizeof(int), k);
         DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, inBlockSize * sizeof(FPType), k);
 
+        const FPType * const trainNorms = euclDist ? euclDist->getNormsB() : nullptr;
+        const FPType * const testNorms  = euclDist ? euclDist->getNormsA() + startTestIdx : nullptr;
+
         SafeStatus safeStat;
 
-        daal::static_tls<BruteForceTask *> tlsTask([=, &safeStat]() {
-            auto tlsData = BruteForceTask::create(inBlockSize, iSize, k);
+        daal::static_tls<TaskType *> tlsTask([=, &safeStat]() {
+            auto tlsData = TaskType::create(iSize, k);
             if (!tlsData)
             {
                 safeStat.add(services::ErrorMemoryAllocationFailed);
@@ -189,33 +225,33 @@ protected:
             const size_t j2    = (inBlock + 1 == nInBlocks ? inRows : j1 + inBlockSize);
             const size_t jSize = j2 - j1;
 
-            const BruteForceTask * tls = tlsTask.local(tid);
+            const TaskType * tls = tlsTask.local(tid);
             DAAL_CHECK_MALLOC_THR(tls);
 
             FPType * distancesBuff = tlsDistances.local();
             DAAL_CHECK_MALLOC_THR(distancesBuff);
 
-            int * idx = tlsIdx.local();
-            DAAL_CHECK_MALLOC_THR(idx);
-
-            FPType * maxs         = tls->maxs;
-            HeapType * heapsLocal = tls->heapsData;
+            Selector * selectorsLocal = tls->selectorsData;
 
             ReadRows<FPType, cpu> outDataRows(const_cast<NumericTable *>(trainTable), j1, j2 - j1);
             DAAL_CHECK_BLOCK_STATUS_THR(outDataRows);
             const FPType * const trainData = outDataRows.get();
 
-            DAAL_CHECK_STATUS_THR(distancesInstance->computeBatch(testData, trainData, i1, iSize, j1, jSize, distancesBuff));
-
-            for (size_t i = 0; i < iSize; i++)
+            DAAL_ASSERT(inRows <= static_cast<size_t>(services::internal::MaxVal<int>::get()));
+            if (euclDist)
             {
-                const size_t indexes = getIndexesWithLessDistances(idx, distancesBuff + i * jSize, jSize, maxs[i]);
-
-                if (indexes)
+                DAAL_CHECK_STATUS_THR(euclDist->computeInnerProducts(testData, trainData, iSize, jSize, distancesBuff));
+                for (size_t i = 0; i < iSize; i++)
                 {
-                    DAAL_ASSERT(inRows + j1 <= static_cast<size_t>(services::internal::MaxVal<int>::get()));
-                    DAAL_ASSERT(inRows + i * jSize <= static_cast<size_t>(services::internal::MaxVal<int>::get()));
-                    updateLocalNeighbours(indexes, idx, jSize, i, k, maxs, distancesBuff, j1, heapsLocal[i]);
+                    selectNearest<true>(distancesBuff + i * jSize, trainNorms + j1, jSize, j1, k, selectorsLocal[i]);
+                }
+            }
+            else
+            {
+                DAAL_CHECK_STATUS_THR(metric->computeBatch(testData, trainData, i1, iSize, j1, jSize, distancesBuff));
+                for (size_t i = 0; i < iSize; i++)
+                {
+                    selectNearest<false>(distancesBuff + i * jSize, nullptr, jSize, j1, k, selectorsLocal[i]);
                 }
             }
         });
@@ -226,44 +262,51 @@ protected:
         FPType * kDistances = tlsKDistances.local();
         DAAL_CHECK_MALLOC(kDistances);
 
-        TArrayScalable<HeapType, cpu> heaps(iSize);
+        TArrayScalable<Selector, cpu> selectors(iSize);
+        DAAL_CHECK_MALLOC(selectors.get());
 
         for (size_t i = 0; i < iSize; ++i)
         {
-            heaps[i].init(k);
+            DAAL_CHECK_MALLOC(selectors[i].init(k));
         }
 
-        tlsTask.reduce([&](BruteForceTask * tls) {
-            HeapType * heapsLocal = tls->heapsData;
+        tlsTask.reduce([&](TaskType * tls) {
+            if (!tls) return;
+            Selector * selectorsLocal = tls->selectorsData;
             for (size_t i = 0; i < iSize; i++)
             {
-                const size_t size = heapsLocal[i].size();
+                const size_t size = selectorsLocal[i].size();
                 for (size_t j = 0; j < size; ++j)
                 {
-                    heaps[i].replaceMaxIfNeeded(heapsLocal[i][j], k);
+                    selectors[i].replaceMaxIfNeeded(selectorsLocal[i][j], k);
                 }
             }
 
             delete tls;
         });
+        DAAL_CHECK_SAFE_STATUS();
 
         for (size_t i = 0; i < iSize; i++)
         {
+            // the norm of the test row is added only to the selected Euclidean distances
+            const FPType testNorm = testNorms ? testNorms[i] : FPType(0);
             for (size_t kk = 0; kk < k; ++kk)
             {
-                // max(0, d) to remove negative distances before Sqrt
-                kDistances[i * k + kk] = services::internal::max<cpu, FPType>(FPType(0), heaps[i][kk].distance);
-                kIndexes[i * k + kk]   = heaps[i][kk].index;
+                kDistances[i * k + kk] = selectors[i][kk].distance + testNorm;
+                kIndexes[i * k + kk]   = selectors[i][kk].index;
             }
         }
 
-        // Euclidean Distances are computed without Sqrt, fixing it here
-        Math<FPType, cpu>::vSqrt(iSize * k, kDistances, kDistances);
+        // the neighbors are selected by the values computed by the metric, e.g. Euclidean distances without Sqrt, fixing it here
+        metric->fromBatchScale(iSize * k, kDistances);
 
         // sort by distances
-        for (size_t i = 0; i < iSize; ++i)
+        if (!IsSortedSelector<Selector>::value)
         {
-            daal::algorithms::internal::qSort<FPType, int, cpu>(k, kDistances + i * k, kIndexes + i * k);
+            for (size_t i = 0; i < iSize; ++i)
+            {
+                daal::algorithms::internal::qSort<FPType, int, cpu>(k, kDistances + i * k, kIndexes + i * k);
+            }
         }
 
         if (resultsToCompute & computeIndicesOfNeighbors)
@@ -310,35 +353,27 @@ protected:
         return services::Status();
     }
 
-    size_t getIndexesWithLessDistances(int * idx, FPType * array, size_t size, FPType cmp)
+    /* Passes the training rows closer than the farthest selected neighbor to the selector.
+     * If addNorms is set, the values are the inner products of the test row with the training rows
+     * and the norms of the training rows are added to them. The norm of the test row is the same
+     * for all the training rows, so it does not change the order and is added later */
+    template <bool addNorms, typename Selector>
+    void selectNearest(const FPType * values, const FPType * trainNorms, size_t jSize, size_t j1, size_t k, Selector & selector)
     {
-        size_t count = 0;
-
-        for (size_t i = 0; i < size; ++i)
+        FPType threshold = (selector.size() < k) ? MaxVal<FPType>::get() : selector.getMax()->distance;
+        for (size_t j = 0; j < jSize; ++j)
         {
-            if (array[i] < cmp)
+            const FPType d = addNorms ? trainNorms[j] - FPType(2) * values[j] : values[j];
+            if (d < threshold)
             {
-                idx[count++] = i;
-            }
-        }
-        return count;
-    }
+                Neighbors neigh;
+                neigh.distance = d;
+                neigh.index    = j + j1;
 
-    void updateLocalNeighbours(size_t indexes, int * idx, size_t jSize, size_t i, size_t k, FPType * maxs, FPType * distances, size_t j1,
-                               HeapType & heap)
-    {
-        for (size_t j = 0; j < indexes; ++j)
-        {
-            FPType d = distances[i * jSize + idx[j]];
-
-            Neighbors neigh;
-            neigh.distance = d;
-            neigh.index    = idx[j] + j1;
-
-            heap.replaceMaxIfNeeded(neigh, k);
+                selector.replaceMaxIfNeeded(neigh, k);
+                if (selector.size() == k) threshold = selector.getMax()->distance;
+            }
         }
-
-        maxs[i] = heap.getMax()->distance;
     }
 
     services::Status uniformWeightedVoting(const size_t nClasses, const size_t k, const size_t n, const size_t nTrain, int * indices,
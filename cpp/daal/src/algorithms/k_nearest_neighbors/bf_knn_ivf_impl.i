@@ -0,0 +1,497 @@
+/* file: bf_knn_ivf_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the inverted file index (IVF-flat) used by the approximate
+//  search method of the brute-force k nearest neighbors algorithm.
+//--
+*/
+
+#ifndef __BF_KNN_IVF_IMPL_I__
+#define __BF_KNN_IVF_IMPL_I__
+
+#include "data_management/data/homogen_numeric_table.h"
+#include "src/algorithms/k_nearest_neighbors/bf_knn_impl.i"
+#include "src/algorithms/engines/engine_batch_impl.h"
+#include "src/algorithms/service_threading.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_rng.h"
+#include "src/services/service_arrays.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace bf_knn_classification
+{
+namespace internal
+{
+using daal::data_management::HomogenNumericTable;
+
+/* Number of rows processed by one task of the inverted lists builder and searcher */
+const size_t IVF_BLOCK_SIZE = 128;
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Builds the inverted file index of the training data set.
+// The rows are clustered with several Lloyd iterations of k-means, then they are grouped
+// by the nearest centroid so that the rows of each list are stored contiguously.
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename FPType, CpuType cpu>
+class InvertedListsBuilder
+{
+public:
+    services::Status build(const NumericTable & x, size_t nLists, size_t nIterations, engines::BatchBase & engine, Model::ModelImpl & model)
+    {
+        const size_t nRows = x.getNumberOfRows();
+        const size_t nDims = x.getNumberOfColumns();
+        DAAL_CHECK(nRows > 0 && nRows <= static_cast<size_t>(services::internal::MaxVal<int>::get()),
+                   services::ErrorIncorrectNumberOfRowsInInputNumericTable);
+
+        if (nLists == 0) nLists = static_cast<size_t>(Math<double, cpu>::sSqrt(double(nRows)) + 0.5);
+        if (nLists == 0) nLists = 1;
+        if (nLists > nRows) nLists = nRows;
+
+        services::Status status;
+        NumericTablePtr centroidsTable = HomogenNumericTable<FPType>::create(nDims, nLists, NumericTable::doAllocate, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        FPType * const centroids = static_cast<HomogenNumericTable<FPType> *>(centroidsTable.get())->getArray();
+
+        DAAL_CHECK_STATUS_VAR(initCentroids(x, nLists, engine, centroids));
+
+        TArray<int, cpu> assignments(nRows);
+        DAAL_CHECK_MALLOC(assignments.get());
+
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nLists, nDims + 1);
+        TArray<FPType, cpu> sums(nLists * (nDims + 1));
+        DAAL_CHECK_MALLOC(sums.get());
+
+        for (size_t iIter = 0; iIter < nIterations; ++iIter)
+        {
+            DAAL_CHECK_STATUS_VAR(assign(x, *centroidsTable, assignments.get(), sums.get()));
+            updateCentroids(nLists, nDims, sums.get(), centroids);
+        }
+        DAAL_CHECK_STATUS_VAR(assign(x, *centroidsTable, assignments.get(), nullptr));
+
+        return buildLists(x, nLists, assignments.get(), centroidsTable, model);
+    }
+
+private:
+    /* Takes nLists distinct random rows of the data set as the initial centroids */
+    services::Status initCentroids(const NumericTable & x, size_t nLists, engines::BatchBase & engine, FPType * centroids)
+    {
+        const size_t nRows = x.getNumberOfRows();
+        const size_t nDims = x.getNumberOfColumns();
+
+        TArray<int, cpu> sample(nLists);
+        DAAL_CHECK_MALLOC(sample.get());
+
+        engines::internal::BatchBaseImpl * const engineImpl = dynamic_cast<engines::internal::BatchBaseImpl *>(&engine);
+        DAAL_CHECK(engineImpl, services::ErrorIncorrectEngineParameter);
+        RNGs<int, cpu> rng;
+        DAAL_CHECK(!rng.uniformWithoutReplacement((int)nLists, sample.get(), engineImpl->getState(), 0, (int)nRows),
+                   services::ErrorIncorrectErrorcodeFromGenerator);
+
+        ReadRows<FPType, cpu> rows;
+        for (size_t i = 0; i < nLists; ++i)
+        {
+            const FPType * const row = rows.set(const_cast<NumericTable *>(&x), sample[i], 1);
+            DAAL_CHECK_BLOCK_STATUS(rows);
+            for (size_t j = 0; j < nDims; ++j) centroids[i * nDims + j] = row[j];
+        }
+        return services::Status();
+    }
+
+    /* Assigns every row to the nearest centroid; when sums are requested, also accumulates
+     * the sums of the rows and their counts per centroid, the count is stored after the sum */
+    services::Status assign(const NumericTable & x, const NumericTable & centroidsTable, int * assignments, FPType * sums)
+    {
+        const size_t nRows   = x.getNumberOfRows();
+        const size_t nDims   = x.getNumberOfColumns();
+        const size_t nLists  = centroidsTable.getNumberOfRows();
+        const size_t nBlocks = nRows / IVF_BLOCK_SIZE + !!(nRows % IVF_BLOCK_SIZE);
+
+        daal::algorithms::internal::EuclideanDistances<FPType, cpu> distances(x, centroidsTable, true);
+        DAAL_CHECK_STATUS_VAR(distances.init());
+
+        ReadRows<FPType, cpu> centroidRows(const_cast<NumericTable *>(&centroidsTable), 0, nLists);
+        DAAL_CHECK_BLOCK_STATUS(centroidRows);
+        const FPType * const centroids = centroidRows.get();
+
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, IVF_BLOCK_SIZE, nLists);
+        TlsMem<FPType, cpu> tlsDistances(IVF_BLOCK_SIZE * nLists);
+        TlsSum<FPType, cpu> tlsSums(nLists * (nDims + 1));
+
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t iStart = iBlock * IVF_BLOCK_SIZE;
+            const size_t iSize  = (iBlock + 1 == nBlocks) ? nRows - iStart : IVF_BLOCK_SIZE;
+
+            ReadRows<FPType, cpu> dataRows(const_cast<NumericTable *>(&x), iStart, iSize);
+            DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
+            const FPType * const data = dataRows.get();
+
+            FPType * const distancesBuff = tlsDistances.local();
+            DAAL_CHECK_MALLOC_THR(distancesBuff);
+            FPType * const localSums = sums ? tlsSums.local() : nullptr;
+            DAAL_CHECK_THR(!sums || localSums, services::ErrorMemoryAllocationFailed);
+
+            DAAL_CHECK_STATUS_THR(distances.computeBatch(data, centroids, iStart, iSize, 0, nLists, distancesBuff));
+
+            for (size_t i = 0; i < iSize; ++i)
+            {
+                const FPType * const rowDistances = distancesBuff + i * nLists;
+                size_t nearest                    = 0;
+                for (size_t l = 1; l < nLists; ++l)
+                {
+                    if (rowDistances[l] < rowDistances[nearest]) nearest = l;
+                }
+                assignments[iStart + i] = static_cast<int>(nearest);
+
+                if (localSums)
+                {
+                    FPType * const sum = localSums + nearest * (nDims + 1);
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < nDims; ++j) sum[j] += data[i * nDims + j];
+                    sum[nDims] += FPType(1);
+                }
+            }
+        });
+        DAAL_CHECK_SAFE_STATUS();
+
+        if (sums)
+        {
+            service_memset_seq<FPType, cpu>(sums, FPType(0), nLists * (nDims + 1));
+            tlsSums.reduceTo(sums, nLists * (nDims + 1));
+        }
+        return services::Status();
+    }
+
+    /* Moves the centroids to the means of their rows, centroids of the empty lists are kept as is */
+    void updateCentroids(size_t nLists, size_t nDims, const FPType * sums, FPType * centroids)
+    {
+        for (size_t l = 0; l < nLists; ++l)
+        {
+            const FPType * const sum = sums + l * (nDims + 1);
+            if (sum[nDims] == FPType(0)) continue;
+            const FPType inverseCount = FPType(1) / sum[nDims];
+            for (size_t j = 0; j < nDims; ++j) centroids[l * nDims + j] = sum[j] * inverseCount;
+        }
+    }
+
+    /* Groups the rows by their lists with the counting sort and stores the index in the model */
+    services::Status buildLists(const NumericTable & x, size_t nLists, const int * assignments, const NumericTablePtr & centroidsTable,
+                                Model::ModelImpl & model)
+    {
+        const size_t nRows   = x.getNumberOfRows();
+        const size_t nDims   = x.getNumberOfColumns();
+        const size_t nBlocks = nRows / IVF_BLOCK_SIZE + !!(nRows % IVF_BLOCK_SIZE);
+
+        services::Status status;
+        NumericTablePtr offsetsTable = HomogenNumericTable<int>::create(1, nLists + 1, NumericTable::doAllocate, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        NumericTablePtr indicesTable = HomogenNumericTable<int>::create(1, nRows, NumericTable::doAllocate, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        NumericTablePtr dataTable = HomogenNumericTable<FPType>::create(nDims, nRows, NumericTable::doAllocate, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        int * const offsets     = static_cast<HomogenNumericTable<int> *>(offsetsTable.get())->getArray();
+        int * const listIndices = static_cast<HomogenNumericTable<int> *>(indicesTable.get())->getArray();
+        FPType * const listData = static_cast<HomogenNumericTable<FPType> *>(dataTable.get())->getArray();
+
+        TArray<int, cpu> positions(nRows);
+        DAAL_CHECK_MALLOC(positions.get());
+
+        service_memset_seq<int, cpu>(offsets, 0, nLists + 1);
+        for (size_t i = 0; i < nRows; ++i) ++offsets[assignments[i] + 1];
+        for (size_t l = 0; l < nLists; ++l) offsets[l + 1] += offsets[l];
+
+        TArray<int, cpu> nextPosition(nLists);
+        DAAL_CHECK_MALLOC(nextPosition.get());
+        for (size_t l = 0; l < nLists; ++l) nextPosition[l] = offsets[l];
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            const int pos = nextPosition[assignments[i]]++;
+            positions[i]     = pos;
+            listIndices[pos] = static_cast<int>(i);
+        }
+
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t iStart = iBlock * IVF_BLOCK_SIZE;
+            const size_t iSize  = (iBlock + 1 == nBlocks) ? nRows - iStart : IVF_BLOCK_SIZE;
+
+            ReadRows<FPType, cpu> dataRows(const_cast<NumericTable *>(&x), iStart, iSize);
+            DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
+            const FPType * const data = dataRows.get();
+
+            for (size_t i = 0; i < iSize; ++i)
+            {
+                FPType * const dst = listData + positions[iStart + i] * nDims;
+                for (size_t j = 0; j < nDims; ++j) dst[j] = data[i * nDims + j];
+            }
+        });
+        DAAL_CHECK_SAFE_STATUS();
+
+        model.setInvertedLists(centroidsTable, offsetsTable, dataTable, indicesTable);
+        return services::Status();
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Searches the k nearest neighbors in the inverted file index.
+// Only the rows of the nProbes lists with the nearest centroids are scanned for every
+// query; more lists are scanned when those contain less than k rows.
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename FPType, CpuType cpu>
+class InvertedListsNearestNeighbors : public BruteForceNearestNeighbors<FPType, cpu>
+{
+public:
+    typedef BruteForceNearestNeighbors<FPType, cpu> super;
+    typedef typename super::Neighbors Neighbors;
+    typedef typename super::HeapType HeapType;
+
+    services::Status kNeighbors(const size_t k, size_t nProbes, const size_t nClasses, VoteWeights voteWeights, DAAL_UINT64 resultsToCompute,
+                                DAAL_UINT64 resultsToEvaluate, const Model::ModelImpl & model, const NumericTable * testTable,
+                                NumericTable * testLabelTable, NumericTable * indicesTable, NumericTable * distancesTable)
+    {
+        NumericTable * const centroidsTable = const_cast<NumericTable *>(model.getListCentroids().get());
+        NumericTable * const offsetsTable   = const_cast<NumericTable *>(model.getListOffsets().get());
+        NumericTable * const listDataTable  = const_cast<NumericTable *>(model.getListData().get());
+        NumericTable * const listIdxTable   = const_cast<NumericTable *>(model.getListIndices().get());
+
+        const size_t nDims  = listDataTable->getNumberOfColumns();
+        const size_t nTrain = listDataTable->getNumberOfRows();
+        const size_t nLists = centroidsTable->getNumberOfRows();
+        const size_t nTest  = testTable->getNumberOfRows();
+        DAAL_CHECK(k <= nTrain, services::ErrorIncorrectParameter);
+        if (nProbes > nLists) nProbes = nLists;
+
+        ReadRows<int, cpu> offsetsRows(offsetsTable, 0, nLists + 1);
+        DAAL_CHECK_BLOCK_STATUS(offsetsRows);
+        ReadRows<int, cpu> listIdxRows(listIdxTable, 0, nTrain);
+        DAAL_CHECK_BLOCK_STATUS(listIdxRows);
+        ReadRows<FPType, cpu> listDataRows(listDataTable, 0, nTrain);
+        DAAL_CHECK_BLOCK_STATUS(listDataRows);
+        ReadRows<FPType, cpu> centroidRows(centroidsTable, 0, nLists);
+        DAAL_CHECK_BLOCK_STATUS(centroidRows);
+
+        ReadRows<FPType, cpu> trainLabelRows;
+        const FPType * trainLabel = nullptr;
+        if (resultsToEvaluate & daal::algorithms::classifier::computeClassLabels)
+        {
+            trainLabel = trainLabelRows.set(const_cast<NumericTable *>(model.getLabels().get()), 0, nTrain);
+            DAAL_CHECK_BLOCK_STATUS(trainLabelRows);
+        }
+
+        SearchContext ctx = { k, nProbes, nDims, nLists, offsetsRows.get(), listIdxRows.get(), listDataRows.get(), centroidRows.get() };
+
+        daal::algorithms::internal::EuclideanDistances<FPType, cpu> centroidDistances(*testTable, *centroidsTable, true);
+        DAAL_CHECK_STATUS_VAR(centroidDistances.init());
+
+        const size_t nBlocks = nTest / IVF_BLOCK_SIZE + !!(nTest % IVF_BLOCK_SIZE);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, IVF_BLOCK_SIZE, nLists);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, IVF_BLOCK_SIZE, k);
+
+        SafeStatus safeStat;
+        daal::tls<SearchTask *> tlsTask([=, &safeStat]() {
+            SearchTask * const task = SearchTask::create(nLists, k, nClasses);
+            if (!task) safeStat.add(services::ErrorMemoryAllocationFailed);
+            return task;
+        });
+
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            SearchTask * const task = tlsTask.local();
+            DAAL_CHECK_MALLOC_THR(task);
+
+            const size_t iStart = iBlock * IVF_BLOCK_SIZE;
+            const size_t iSize  = (iBlock + 1 == nBlocks) ? nTest - iStart : IVF_BLOCK_SIZE;
+
+            ReadRows<FPType, cpu> testRows(const_cast<NumericTable *>(testTable), iStart, iSize);
+            DAAL_CHECK_BLOCK_STATUS_THR(testRows);
+            const FPType * const testData = testRows.get();
+
+            DAAL_CHECK_STATUS_THR(
+                centroidDistances.computeBatch(testData, ctx.centroids, iStart, iSize, 0, nLists, task->centroidDistances.get()));
+
+            for (size_t i = 0; i < iSize; ++i)
+            {
+                searchQuery(ctx, testData + i * nDims, task->centroidDistances.get() + i * nLists, *task, task->kDistances.get() + i * k,
+                            task->kIndexes.get() + i * k);
+            }
+
+            DAAL_CHECK_STATUS_THR(writeResults(iStart, iSize, k, nTrain, nClasses, voteWeights, resultsToCompute, resultsToEvaluate, trainLabel,
+                                               testLabelTable, indicesTable, distancesTable, *task));
+        });
+
+        tlsTask.reduce([](SearchTask * task) { delete task; });
+
+        return safeStat.detach();
+    }
+
+protected:
+    struct SearchContext
+    {
+        size_t k;
+        size_t nProbes;
+        size_t nDims;
+        size_t nLists;
+        const int * offsets;
+        const int * listIndices;
+        const FPType * listData;
+        const FPType * centroids;
+    };
+
+    struct SearchTask
+    {
+    public:
+        DAAL_NEW_DELETE();
+        TArrayScalable<FPType, cpu> centroidDistances;
+        TArrayScalable<int, cpu> listOrder;
+        TArrayScalable<FPType, cpu> kDistances;
+        TArrayScalable<int, cpu> kIndexes;
+        TArrayScalable<FPType, cpu> voting;
+        HeapType heap;
+
+        static SearchTask * create(size_t nLists, size_t k, size_t nClasses)
+        {
+            SearchTask * const task = new SearchTask(nLists, k, nClasses);
+            if (task && task->isValid()) return task;
+            delete task;
+            return nullptr;
+        }
+
+    private:
+        SearchTask(size_t nLists, size_t k, size_t nClasses)
+            : centroidDistances(IVF_BLOCK_SIZE * nLists),
+              listOrder(nLists),
+              kDistances(IVF_BLOCK_SIZE * k),
+              kIndexes(IVF_BLOCK_SIZE * k),
+              voting(nClasses)
+        {
+            _isHeapValid = heap.init(k);
+        }
+
+        bool isValid() const
+        {
+            return _isHeapValid && centroidDistances.get() && listOrder.get() && kDistances.get() && kIndexes.get() && voting.get();
+        }
+
+        bool _isHeapValid;
+    };
+
+    /* Scans the lists in the order of the distances from the query to their centroids,
+     * writes the squared distances to the k nearest rows and their original indices */
+    void searchQuery(const SearchContext & ctx, const FPType * query, FPType * centroidDistances, SearchTask & task, FPType * kDistances,
+                     int * kIndexes)
+    {
+        int * const order = task.listOrder.get();
+        for (size_t l = 0; l < ctx.nLists; ++l) order[l] = static_cast<int>(l);
+        daal::algorithms::internal::qSort<FPType, int, cpu>(ctx.nLists, centroidDistances, order);
+
+        HeapType & heap = task.heap;
+        heap.reset();
+        for (size_t p = 0; p < ctx.nLists && (p < ctx.nProbes || heap.size() < ctx.k); ++p)
+        {
+            const size_t list = order[p];
+            for (int r = ctx.offsets[list]; r < ctx.offsets[list + 1]; ++r)
+            {
+                const FPType * const row = ctx.listData + r * ctx.nDims;
+                DAAL_PREFETCH_READ_T0(row + ctx.nDims);
+
+                FPType distance(0);
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < ctx.nDims; ++j)
+                {
+                    const FPType diff = query[j] - row[j];
+                    distance += diff * diff;
+                }
+
+                Neighbors neighbor;
+                neighbor.distance = distance;
+                neighbor.index    = ctx.listIndices[r];
+                heap.replaceMaxIfNeeded(neighbor, ctx.k);
+            }
+        }
+
+        for (size_t kk = 0; kk < ctx.k; ++kk)
+        {
+            kDistances[kk] = heap[kk].distance;
+            kIndexes[kk]   = static_cast<int>(heap[kk].index);
+        }
+    }
+
+    /* Finalizes the distances of the block of queries, sorts the neighbors and writes them out in the same way as the brute-force search */
+    services::Status writeResults(size_t iStart, size_t iSize, size_t k, size_t nTrain, size_t nClasses, VoteWeights voteWeights,
+                                  DAAL_UINT64 resultsToCompute, DAAL_UINT64 resultsToEvaluate, const FPType * trainLabel,
+                                  NumericTable * testLabelTable, NumericTable * indicesTable, NumericTable * distancesTable, SearchTask & task)
+    {
+        FPType * const kDistances = task.kDistances.get();
+        int * const kIndexes      = task.kIndexes.get();
+
+        Math<FPType, cpu>::vSqrt(iSize * k, kDistances, kDistances);
+        for (size_t i = 0; i < iSize; ++i)
+        {
+            daal::algorithms::internal::qSort<FPType, int, cpu>(k, kDistances + i * k, kIndexes + i * k);
+        }
+
+        if (resultsToCompute & computeIndicesOfNeighbors)
+        {
+            daal::internal::WriteOnlyRows<int, cpu> indexesBlock(indicesTable, iStart, iSize);
+            DAAL_CHECK_BLOCK_STATUS(indexesBlock);
+            const size_t size = iSize * k * sizeof(int);
+            DAAL_CHECK(!daal::services::internal::daal_memcpy_s(indexesBlock.get(), size, kIndexes, size),
+                       daal::services::ErrorMemoryCopyFailedInternal);
+        }
+
+        if (resultsToCompute & computeDistances)
+        {
+            daal::internal::WriteOnlyRows<FPType, cpu> distancesBlock(distancesTable, iStart, iSize);
+            DAAL_CHECK_BLOCK_STATUS(distancesBlock);
+            const size_t size = iSize * k * sizeof(FPType);
+            DAAL_CHECK(!daal::services::internal::daal_memcpy_s(distancesBlock.get(), size, kDistances, size),
+                       daal::services::ErrorMemoryCopyFailedInternal);
+        }
+
+        if (resultsToEvaluate & daal::algorithms::classifier::computeClassLabels)
+        {
+            daal::internal::WriteOnlyRows<int, cpu> testLabelRows(testLabelTable, iStart, iSize);
+            DAAL_CHECK_BLOCK_STATUS(testLabelRows);
+            int * const testLabel = testLabelRows.get();
+
+            if (voteWeights == VoteWeights::voteUniform)
+            {
+                DAAL_CHECK_STATUS_VAR(this->uniformWeightedVoting(nClasses, k, iSize, nTrain, kIndexes, trainLabel, testLabel, task.voting.get()));
+            }
+            else
+            {
+                DAAL_CHECK_STATUS_VAR(
+                    this->distanceWeightedVoting(nClasses, k, iSize, nTrain, kDistances, kIndexes, trainLabel, testLabel, task.voting.get()));
+            }
+        }
+
+        return services::Status();
+    }
+};
+
+} // namespace internal
+} // namespace bf_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
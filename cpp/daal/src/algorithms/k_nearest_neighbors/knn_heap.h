@@ -190,6 +190,61 @@ private:
     size_t _count;
 };
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Keeps up to maxSize nearest neighbors in a fixed size array sorted by the distance.
+// Has the same interface as Heap; for small k the insertion into the sorted array is
+// cheaper than the heap update, the elements stay in registers or L1 and need no final sort.
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename T, CpuType cpu>
+class SortedNeighbors
+{
+public:
+    static const size_t maxSize = 16;
+
+    SortedNeighbors() : _count(0) {}
+
+    bool init(size_t size)
+    {
+        _count = 0;
+        return size <= maxSize;
+    }
+
+    void reset() { _count = 0; }
+
+    void replaceMaxIfNeeded(const T & e, size_t k)
+    {
+        size_t i = _count;
+        if (_count < k)
+        {
+            ++_count;
+        }
+        else if (e.distance < _elements[k - 1].distance)
+        {
+            i = k - 1;
+        }
+        else
+        {
+            return;
+        }
+
+        for (; i > 0 && e.distance < _elements[i - 1].distance; --i)
+        {
+            _elements[i] = _elements[i - 1];
+        }
+        _elements[i] = e;
+    }
+
+    size_t size() const { return _count; }
+
+    T * getMax() { return _elements + _count - 1; }
+
+    const T & operator[](size_t index) const { return _elements[index]; }
+
+private:
+    T _elements[maxSize];
+    size_t _count;
+};
+
 template <typename algorithmFpType, CpuType cpu>
 struct GlobalNeighbors
 {
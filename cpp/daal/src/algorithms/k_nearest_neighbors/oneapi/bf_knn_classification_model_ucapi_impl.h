@@ -23,6 +23,7 @@
 #include "data_management/data/homogen_numeric_table.h"
 #include "services/internal/sycl/execution_context.h"
 #include "services/daal_defines.h"
+#include "src/services/service_defines.h"
 
 namespace daal
 {
@@ -42,12 +43,21 @@ public:
     data_management::NumericTablePtr getData() { return _data; }
 
     template <typename Archive, bool onDeserialize>
-    services::Status serialImpl(Archive * arch)
+    services::Status serialImpl(Archive * arch, int daalVersion = INTEL_DAAL_VERSION)
     {
         arch->set(_nFeatures);
         arch->setSharedPtrObj(_data);
         arch->setSharedPtrObj(_labels);
 
+        /* The archives written by 2021.2 and older releases have no inverted lists */
+        if (daalVersion >= COMPUTE_DAAL_VERSION(2021, 3, 0))
+        {
+            arch->setSharedPtrObj(_listCentroids);
+            arch->setSharedPtrObj(_listOffsets);
+            arch->setSharedPtrObj(_listData);
+            arch->setSharedPtrObj(_listIndices);
+        }
+
         return services::Status();
     }
 
@@ -69,6 +79,25 @@ public:
 
     size_t getNumberOfFeatures() const { return _nFeatures; }
 
+    /* Inverted file index built by the ivfFlat training method:
+       the centroids of the lists, the offsets of the lists in the training data grouped by lists,
+       the grouped training data and the indices of its rows in the original training data */
+    bool hasInvertedLists() const { return _listCentroids && _listOffsets && _listData && _listIndices; }
+
+    data_management::NumericTableConstPtr getListCentroids() const { return _listCentroids; }
+    data_management::NumericTableConstPtr getListOffsets() const { return _listOffsets; }
+    data_management::NumericTableConstPtr getListData() const { return _listData; }
+    data_management::NumericTableConstPtr getListIndices() const { return _listIndices; }
+
+    void setInvertedLists(const data_management::NumericTablePtr & centroids, const data_management::NumericTablePtr & offsets,
+                          const data_management::NumericTablePtr & data, const data_management::NumericTablePtr & indices)
+    {
+        _listCentroids = centroids;
+        _listOffsets   = offsets;
+        _listData      = data;
+        _listIndices   = indices;
+    }
+
 protected:
     template <typename algorithmFPType>
     DAAL_FORCEINLINE services::Status setTable(const data_management::NumericTablePtr & value, data_management::NumericTablePtr & dest, bool copy)
@@ -124,6 +153,10 @@ private:
     size_t _nFeatures;
     data_management::NumericTablePtr _data;
     data_management::NumericTablePtr _labels;
+    data_management::NumericTablePtr _listCentroids;
+    data_management::NumericTablePtr _listOffsets;
+    data_management::NumericTablePtr _listData;
+    data_management::NumericTablePtr _listIndices;
 };
 
 } // namespace interface1
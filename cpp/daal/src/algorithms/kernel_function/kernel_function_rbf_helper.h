@@ -60,7 +60,7 @@ private:
         sqrDataA2 = isEqualMatrix ? sqrDataA1 : &sqrDataA1[blockSize];
     }
 
-    TArrayScalable<algorithmFPType, cpu> _buff;
+    TArrayScratch<algorithmFPType, cpu> _buff;
 };
 
 template <typename algorithmFPType, CpuType cpu>
@@ -26,6 +26,8 @@
 #define __MULTICLASSCLASSIFIER_PREDICT_VOTEBASED_IMPL_I__
 
 #include "algorithms/multi_class_classifier/multi_class_classifier_model.h"
+#include "algorithms/svm/svm_model.h"
+#include "services/internal/execution_context.h"
 #include "src/threading/threading.h"
 #include "src/algorithms/service_error_handling.h"
 #include "src/data_management/service_numeric_table.h"
@@ -44,13 +46,61 @@ using namespace daal::internal;
 using namespace daal::services;
 using namespace daal::services::internal;
 
+template <typename algorithmFPType, CpuType cpu>
+class SharedSupportVectors;
+
 template <typename algorithmFPType, typename ClsType, typename MultiClsParam, CpuType cpu>
 struct MultiClassClassifierPredictKernel<voteBased, training::oneAgainstOne, algorithmFPType, ClsType, MultiClsParam, cpu> : public Kernel
 {
     Status compute(const NumericTable * a, const daal::algorithms::Model * m, NumericTable * pred, NumericTable * df,
                    const daal::algorithms::Parameter * par);
+
+private:
+    Status computeWithSharedSV(size_t nClasses, size_t nVectors, size_t nRowsInBlock, size_t nBlocks, const NumericTable * a,
+                               const SharedSupportVectors<algorithmFPType, cpu> & sharedSV, NumericTable * pred, NumericTable * df,
+                               const size_t * nonEmptyClassMap);
 };
 
+/** Adds the votes of the two-class classifier for the pair of classes (iClass, jClass) */
+template <typename algorithmFPType, CpuType cpu>
+void addVotes(size_t nRows, size_t nClasses, size_t iClass, size_t jClass, const algorithmFPType * y, int * votes)
+{
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        if (y[i] >= 0)
+            votes[i * nClasses + iClass]++;
+        else
+            votes[i * nClasses + jClass]++;
+    }
+}
+
+/** Computes resulting labels as indices of the maximum vote values */
+template <CpuType cpu>
+Status computeLabels(size_t startRow, size_t nRows, size_t nClasses, const int * votes, const size_t * nonEmptyClassMap, NumericTable * pred)
+{
+    WriteOnlyRows<int, cpu> res(pred, startRow, nRows);
+    int * labels = res.get();
+    DAAL_CHECK_MALLOC(labels);
+
+    const int * votesPtr = votes;
+    for (size_t i = 0; i < nRows; i++, votesPtr += nClasses)
+    {
+        labels[i]   = nonEmptyClassMap[0];
+        int maxVote = votesPtr[0];
+        for (size_t iClass = 1; iClass < nClasses; iClass++)
+        {
+            if (votesPtr[iClass] > maxVote)
+            {
+                maxVote   = votesPtr[iClass];
+                labels[i] = nonEmptyClassMap[iClass];
+            }
+        }
+    }
+    return Status();
+}
+
 /** Base class for threading subtask */
 template <typename algorithmFPType, typename ClsType, CpuType cpu>
 class SubTaskVoteBased
@@ -113,40 +163,14 @@ public:
                     if (!s) return Status(ErrorMultiClassFailedToComputeTwoClassPrediction).add(s);
 
                     /* Compute votes for the block of input observations */
-                    PRAGMA_IVDEP
-                    PRAGMA_VECTOR_ALWAYS
-                    for (size_t i = 0; i < nRows; ++i)
-                    {
-                        if (y[i] >= 0)
-                            votes[i * _nClasses + iClass]++;
-                        else
-                            votes[i * _nClasses + jClass]++;
-                    }
+                    addVotes<algorithmFPType, cpu>(nRows, _nClasses, iClass, jClass, y, votes);
                 }
             }
         }
 
         if (pred)
         {
-            /* Compute resulting labels as indices of the maximum vote values */
-            WriteOnlyRows<int, cpu> res(pred, startRow, nRows);
-            int * labels = res.get();
-            DAAL_CHECK_MALLOC(labels);
-
-            int * votesPtr = votes;
-            for (size_t i = 0; i < nRows; i++, votesPtr += _nClasses)
-            {
-                labels[i]   = nonEmptyClassMap[0];
-                int maxVote = votesPtr[0];
-                for (size_t iClass = 1; iClass < _nClasses; iClass++)
-                {
-                    if (votesPtr[iClass] > maxVote)
-                    {
-                        maxVote   = votesPtr[iClass];
-                        labels[i] = nonEmptyClassMap[iClass];
-                    }
-                }
-            }
+            s = computeLabels<cpu>(startRow, nRows, _nClasses, votes, nonEmptyClassMap, pred);
         }
         return s;
     }
@@ -296,6 +320,389 @@ private:
     ReadRowsCSR<algorithmFPType, cpu> _xRows;
 };
 
+/**
+ * Support vectors of all two-class SVM models of the multi-class model with the duplicates removed.
+ * The support vectors are shared between the pairs of classes, so the kernel values are computed
+ * once for every unique support vector. The coefficients of every model are grouped by the blocks
+ * of unique support vectors processed by the prediction subtask.
+ * The support vectors are collected on every call, as the tables of the model can be changed in place.
+ */
+template <typename algorithmFPType, CpuType cpu>
+class SharedSupportVectors
+{
+public:
+    DAAL_NEW_DELETE();
+
+    SharedSupportVectors() : _nFeatures(0), _nVectors(0), _nModels(0), _nBlocks(0) {}
+
+    /**
+     * Collects the unique support vectors of the two-class models
+     * \param[in]  nClasses          Number of non-empty classes
+     * \param[in]  nFeatures         Number of features in the input data set
+     * \param[in]  model             Model of the multi-class classifier
+     * \param[in]  predictionPar     Parameter of the two-class classifier prediction algorithm
+     * \param[out] isSupported       Flag. True if all two-class models are dense SVM models
+     *                               and the kernel values can be shared, false otherwise
+     * \return Status of the computations
+     */
+    Status init(size_t nClasses, size_t nFeatures, Model * model, const daal::algorithms::Parameter * predictionPar, bool & isSupported)
+    {
+        isSupported = false;
+
+        const svm::Parameter * svmPar = dynamic_cast<const svm::Parameter *>(predictionPar);
+        if (!svmPar || !svmPar->kernel || !services::internal::getDefaultContext().getInfoDevice().isCpu) return Status();
+
+        const size_t nModels = nClasses * (nClasses - 1) / 2;
+        if (!nModels) return Status();
+
+        size_t nEntries = 0;
+        for (size_t imodel = 0; imodel < nModels; imodel++)
+        {
+            const svm::Model * svmModel = dynamic_cast<const svm::Model *>(model->getTwoClassClassifierModel(imodel).get());
+            if (!svmModel) return Status();
+
+            svm::Model * const svmModelPtr   = const_cast<svm::Model *>(svmModel);
+            const NumericTablePtr svTable    = svmModelPtr->getSupportVectors();
+            const NumericTablePtr coeffTable = svmModelPtr->getClassificationCoefficients();
+            if (!svTable || !coeffTable) return Status();
+            if (svTable->getDataLayout() == NumericTableIface::csrArray || svTable->getNumberOfColumns() != nFeatures) return Status();
+
+            nEntries += svTable->getNumberOfRows();
+        }
+
+        _kernel    = svmPar->kernel;
+        _nModels   = nModels;
+        _nFeatures = nFeatures;
+
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nEntries, nFeatures);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nEntries * nFeatures, sizeof(algorithmFPType));
+        _vectors.reset(nEntries * nFeatures);
+        DAAL_CHECK_MALLOC(_vectors.get() || !nEntries);
+
+        TArray<size_t, cpu> entryVectors(nEntries);
+        TArray<algorithmFPType, cpu> entryCoefficients(nEntries);
+        TArray<size_t, cpu> modelEntries(_nModels + 1);
+        _biases.reset(_nModels);
+        DAAL_CHECK_MALLOC((entryVectors.get() && entryCoefficients.get()) || !nEntries);
+        DAAL_CHECK_MALLOC(modelEntries.get() && _biases.get());
+
+        Status s;
+        DAAL_CHECK_STATUS(s, collectUniqueVectors(model, nEntries, entryVectors.get(), entryCoefficients.get(), modelEntries.get()));
+
+        _nBlocks = _nVectors / nVectorsInBlock + !!(_nVectors % nVectorsInBlock);
+        DAAL_CHECK_STATUS(s, groupEntriesByBlocks(nEntries, entryVectors.get(), entryCoefficients.get(), modelEntries.get()));
+
+        isSupported = true;
+        return s;
+    }
+
+    /** Number of the unique support vectors processed at once by the prediction subtask */
+    static const size_t nVectorsInBlock = 512;
+
+    size_t getNumberOfFeatures() const { return _nFeatures; }
+    size_t getNumberOfVectors() const { return _nVectors; }
+    size_t getNumberOfModels() const { return _nModels; }
+    size_t getNumberOfBlocks() const { return _nBlocks; }
+
+    const algorithmFPType * getVectors() const { return _vectors.get(); }
+    const algorithmFPType * getBiases() const { return _biases.get(); }
+
+    /** Range of the entries of the model that refer to the block of unique support vectors */
+    size_t getEntriesBegin(size_t imodel, size_t iBlock) const { return _blockEntries[imodel * _nBlocks + iBlock]; }
+    size_t getEntriesEnd(size_t imodel, size_t iBlock) const { return _blockEntries[imodel * _nBlocks + iBlock + 1]; }
+
+    /** Index of the unique support vector and its coefficient for every entry */
+    const size_t * getEntryVectors() const { return _entryVectors.get(); }
+    const algorithmFPType * getEntryCoefficients() const { return _entryCoefficients.get(); }
+
+    const kernel_function::KernelIfacePtr & getKernel() const { return _kernel; }
+
+private:
+    static size_t hashVector(const algorithmFPType * vector, size_t nFeatures)
+    {
+        /* FNV-1a hash of the bytes of the vector */
+        const byte * bytes = (const byte *)vector;
+        size_t hash        = (size_t)14695981039346656037ULL;
+        for (size_t i = 0; i < nFeatures * sizeof(algorithmFPType); i++)
+        {
+            hash = (hash ^ bytes[i]) * (size_t)1099511628211ULL;
+        }
+        return hash;
+    }
+
+    static bool isEqualVector(const algorithmFPType * a, const algorithmFPType * b, size_t nFeatures)
+    {
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            if (a[i] != b[i]) return false;
+        }
+        return true;
+    }
+
+    Status collectUniqueVectors(Model * model, size_t nEntries, size_t * entryVectors, algorithmFPType * entryCoefficients, size_t * modelEntries)
+    {
+        size_t hashTableSize = 1;
+        while (hashTableSize < 2 * nEntries) hashTableSize <<= 1;
+        const size_t emptyCell = (size_t)-1;
+
+        TArray<size_t, cpu> hashTable(hashTableSize);
+        DAAL_CHECK_MALLOC(hashTable.get());
+        service_memset_seq<size_t, cpu>(hashTable.get(), emptyCell, hashTableSize);
+
+        algorithmFPType * const vectors = _vectors.get();
+        _nVectors                       = 0;
+
+        size_t iEntry = 0;
+        for (size_t imodel = 0; imodel < _nModels; imodel++)
+        {
+            svm::Model * const svmModel = static_cast<svm::Model *>(model->getTwoClassClassifierModel(imodel).get());
+            NumericTable * const svTable    = svmModel->getSupportVectors().get();
+            NumericTable * const coeffTable = svmModel->getClassificationCoefficients().get();
+            const size_t nSV                = svTable->getNumberOfRows();
+
+            _biases[imodel]      = algorithmFPType(svmModel->getBias());
+            modelEntries[imodel] = iEntry;
+            if (!nSV) continue;
+
+            ReadRows<algorithmFPType, cpu> svRows(svTable, 0, nSV);
+            DAAL_CHECK_BLOCK_STATUS(svRows);
+            ReadColumns<algorithmFPType, cpu> coeffColumn(coeffTable, 0, 0, nSV);
+            DAAL_CHECK_BLOCK_STATUS(coeffColumn);
+            const algorithmFPType * const sv    = svRows.get();
+            const algorithmFPType * const coeff = coeffColumn.get();
+
+            for (size_t i = 0; i < nSV; i++, iEntry++)
+            {
+                const algorithmFPType * const vector = sv + i * _nFeatures;
+
+                size_t cell = hashVector(vector, _nFeatures) & (hashTableSize - 1);
+                while (hashTable[cell] != emptyCell && !isEqualVector(vectors + hashTable[cell] * _nFeatures, vector, _nFeatures))
+                {
+                    cell = (cell + 1) & (hashTableSize - 1);
+                }
+                if (hashTable[cell] == emptyCell)
+                {
+                    hashTable[cell] = _nVectors;
+                    services::internal::tmemcpy<algorithmFPType, cpu>(vectors + _nVectors * _nFeatures, vector, _nFeatures);
+                    _nVectors++;
+                }
+
+                entryVectors[iEntry]      = hashTable[cell];
+                entryCoefficients[iEntry] = coeff[i];
+            }
+        }
+        modelEntries[_nModels] = iEntry;
+        return Status();
+    }
+
+    Status groupEntriesByBlocks(size_t nEntries, const size_t * entryVectors, const algorithmFPType * entryCoefficients, const size_t * modelEntries)
+    {
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _nModels, _nBlocks);
+        const size_t nGroups = _nModels * _nBlocks;
+        _blockEntries.reset(nGroups + 1);
+        _entryVectors.reset(nEntries);
+        _entryCoefficients.reset(nEntries);
+        DAAL_CHECK_MALLOC(_blockEntries.get());
+        DAAL_CHECK_MALLOC((_entryVectors.get() && _entryCoefficients.get()) || !nEntries);
+
+        /* Counting sort of the entries of every model by the blocks of unique support vectors */
+        size_t * const blockEntries = _blockEntries.get();
+        service_memset_seq<size_t, cpu>(blockEntries, 0, nGroups + 1);
+        for (size_t imodel = 0; imodel < _nModels; imodel++)
+        {
+            for (size_t iEntry = modelEntries[imodel]; iEntry < modelEntries[imodel + 1]; iEntry++)
+            {
+                blockEntries[imodel * _nBlocks + entryVectors[iEntry] / nVectorsInBlock + 1]++;
+            }
+        }
+        for (size_t iGroup = 0; iGroup < nGroups; iGroup++)
+        {
+            blockEntries[iGroup + 1] += blockEntries[iGroup];
+        }
+
+        TArray<size_t, cpu> positions(nGroups);
+        DAAL_CHECK_MALLOC(positions.get() || !nGroups);
+        services::internal::tmemcpy<size_t, cpu>(positions.get(), blockEntries, nGroups);
+        for (size_t imodel = 0; imodel < _nModels; imodel++)
+        {
+            for (size_t iEntry = modelEntries[imodel]; iEntry < modelEntries[imodel + 1]; iEntry++)
+            {
+                const size_t position         = positions[imodel * _nBlocks + entryVectors[iEntry] / nVectorsInBlock]++;
+                _entryVectors[position]      = entryVectors[iEntry];
+                _entryCoefficients[position] = entryCoefficients[iEntry];
+            }
+        }
+        return Status();
+    }
+
+    size_t _nFeatures;
+    size_t _nVectors;
+    size_t _nModels;
+    size_t _nBlocks;
+    TArray<algorithmFPType, cpu> _vectors;
+    TArray<algorithmFPType, cpu> _biases;
+    TArray<size_t, cpu> _blockEntries;
+    TArray<size_t, cpu> _entryVectors;
+    TArray<algorithmFPType, cpu> _entryCoefficients;
+    kernel_function::KernelIfacePtr _kernel;
+};
+
+/** Class for threading subtask that computes the decision functions of all two-class SVM models
+    from the kernel values of the shared support vectors */
+template <typename algorithmFPType, CpuType cpu>
+class SubTaskVoteBasedSharedSV
+{
+public:
+    DAAL_NEW_DELETE();
+    typedef SharedSupportVectors<algorithmFPType, cpu> SharedSV;
+
+    /**
+     * Constructs a threading subtask that works with dense input data
+     * \param[in] nClasses  Number of classes
+     * \param[in] nRows     Maximum number of rows processed in the iteration of a threader_for loop
+     * \param[in] sharedSV  Unique support vectors of the two-class models
+     * \return Pointer to the newly constructed subtask in case of success; NULL pointer in case of failure
+     */
+    static SubTaskVoteBasedSharedSV * create(size_t nClasses, size_t nRows, const SharedSV & sharedSV)
+    {
+        SubTaskVoteBasedSharedSV * res = new SubTaskVoteBasedSharedSV(nClasses, nRows, sharedSV);
+        if (res && res->isValid()) return res;
+        delete res;
+        return nullptr;
+    }
+
+    /**
+     * Computes a block of predictions
+     * \param[in] startRow  Index of the starting row in the block
+     * \param[in] nRows     Number of rows in the block
+     * \param[in] a         Numeric table of size n x p with input data set
+     * \param[out] pred     Numeric table of size n x 1 with resulting labels
+     * \param[out] df       Numeric table with the values of the decision functions
+     * \param[in] nonEmptyClassMap Array that contains indices of non-empty classes
+     * \return Status of the computations
+     */
+    Status predict(size_t startRow, size_t nRows, const NumericTable * a, NumericTable * pred, NumericTable * df, const size_t * nonEmptyClassMap)
+    {
+        Status s;
+        const size_t nModels   = _sharedSV.getNumberOfModels();
+        const size_t nVectors  = _sharedSV.getNumberOfVectors();
+        const size_t nFeatures = _sharedSV.getNumberOfFeatures();
+        algorithmFPType * const decision = _aDecision.get();
+
+        _xRows.set(const_cast<NumericTable *>(a), startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS(_xRows);
+        NumericTablePtr xTable =
+            HomogenNumericTableCPU<algorithmFPType, cpu>::create(const_cast<algorithmFPType *>(_xRows.get()), nFeatures, nRows, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+
+        for (size_t imodel = 0; imodel < nModels; imodel++)
+        {
+            service_memset_seq<algorithmFPType, cpu>(decision + imodel * nRows, _sharedSV.getBiases()[imodel], nRows);
+        }
+
+        const size_t * const entryVectors              = _sharedSV.getEntryVectors();
+        const algorithmFPType * const entryCoefficients = _sharedSV.getEntryCoefficients();
+        for (size_t iBlock = 0; iBlock < _sharedSV.getNumberOfBlocks(); iBlock++)
+        {
+            const size_t startVector = iBlock * SharedSV::nVectorsInBlock;
+            const size_t nBlockVectors =
+                (startVector + SharedSV::nVectorsInBlock > nVectors) ? nVectors - startVector : SharedSV::nVectorsInBlock;
+
+            /* Compute the kernel values between the block of input observations and the block of unique support vectors */
+            DAAL_CHECK_STATUS(s, computeKernel(xTable, startVector, nBlockVectors, nRows));
+            const algorithmFPType * const kernelValues = _aKernel.get();
+
+            for (size_t imodel = 0; imodel < nModels; imodel++)
+            {
+                const size_t entriesBegin = _sharedSV.getEntriesBegin(imodel, iBlock);
+                const size_t entriesEnd   = _sharedSV.getEntriesEnd(imodel, iBlock);
+                algorithmFPType * const modelDecision = decision + imodel * nRows;
+                for (size_t i = 0; i < nRows; i++)
+                {
+                    const algorithmFPType * const kernelRow = kernelValues + i * nBlockVectors;
+                    algorithmFPType sum                     = algorithmFPType(0);
+                    for (size_t iEntry = entriesBegin; iEntry < entriesEnd; iEntry++)
+                    {
+                        sum += entryCoefficients[iEntry] * kernelRow[entryVectors[iEntry] - startVector];
+                    }
+                    modelDecision[i] += sum;
+                }
+            }
+        }
+
+        int * const votes = _aVotes.get();
+        service_memset_seq<int, cpu>(votes, 0, _nClasses * nRows);
+        for (size_t iClass = 1, imodel = 0; iClass < _nClasses; ++iClass)
+        {
+            for (size_t jClass = 0; jClass < iClass; ++jClass, ++imodel)
+            {
+                const algorithmFPType * const y = decision + imodel * nRows;
+                if (df)
+                {
+                    const size_t iClassesForDF = (jClass * (2 * _nClasses - jClass - 1)) / 2 + (iClass - jClass - 1);
+                    WriteOnlyColumns<algorithmFPType, cpu> dfBlock(df, iClassesForDF, startRow, nRows);
+                    DAAL_CHECK_BLOCK_STATUS(dfBlock);
+                    services::internal::tmemcpy<algorithmFPType, cpu>(dfBlock.get(), y, nRows);
+                }
+                addVotes<algorithmFPType, cpu>(nRows, _nClasses, iClass, jClass, y, votes);
+            }
+        }
+
+        if (pred)
+        {
+            s = computeLabels<cpu>(startRow, nRows, _nClasses, votes, nonEmptyClassMap, pred);
+        }
+        return s;
+    }
+
+private:
+    SubTaskVoteBasedSharedSV(size_t nClasses, size_t nRows, const SharedSV & sharedSV)
+        : _nClasses(nClasses),
+          _nRows(nRows),
+          _sharedSV(sharedSV),
+          _aVotes(nClasses * nRows),
+          _aKernel(nRows * SharedSV::nVectorsInBlock),
+          _aDecision(sharedSV.getNumberOfModels() * nRows),
+          _kernel(sharedSV.getKernel()->clone()),
+          _kernelResult(new kernel_function::Result())
+    {
+        if (_kernel && _kernelResult) _kernel->setResult(_kernelResult);
+    }
+
+    bool isValid() const { return _aVotes.get() && _aKernel.get() && _aDecision.get() && _kernel && _kernelResult; }
+
+    Status computeKernel(const NumericTablePtr & xTable, size_t startVector, size_t nBlockVectors, size_t nRows)
+    {
+        Status s;
+        const size_t nFeatures = _sharedSV.getNumberOfFeatures();
+        algorithmFPType * const vectors = const_cast<algorithmFPType *>(_sharedSV.getVectors()) + startVector * nFeatures;
+
+        NumericTablePtr svTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(vectors, nFeatures, nBlockVectors, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        NumericTablePtr kernelTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(_aKernel.get(), nBlockVectors, nRows, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+
+        _kernelResult->set(kernel_function::values, kernelTable);
+        _kernel->getInput()->set(kernel_function::X, xTable);
+        _kernel->getInput()->set(kernel_function::Y, svTable);
+        _kernel->getParameter()->computationMode = kernel_function::matrixMatrix;
+
+        s = _kernel->computeNoThrow();
+        if (!s) return Status(ErrorMultiClassFailedToComputeTwoClassPrediction).add(s);
+        return s;
+    }
+
+    size_t _nClasses;
+    size_t _nRows;
+    const SharedSV & _sharedSV;
+    TArray<int, cpu> _aVotes;
+    TArray<algorithmFPType, cpu> _aKernel;
+    TArray<algorithmFPType, cpu> _aDecision;
+    ReadRows<algorithmFPType, cpu> _xRows;
+    kernel_function::KernelIfacePtr _kernel;
+    kernel_function::ResultPtr _kernelResult;
+};
+
 template <typename algorithmFPType, typename ClsType, typename MultiClsParam, CpuType cpu>
 Status MultiClassClassifierPredictKernel<voteBased, training::oneAgainstOne, algorithmFPType, ClsType, MultiClsParam, cpu>::compute(
     const NumericTable * a, const daal::algorithms::Model * m, NumericTable * pred, NumericTable * df, const daal::algorithms::Parameter * par)
@@ -321,6 +728,16 @@ Status MultiClassClassifierPredictKernel<voteBased, training::oneAgainstOne, alg
     size_t nBlocks            = nVectors / nRowsInBlock;
     if (nBlocks * nRowsInBlock < nVectors) nBlocks++;
 
+    if (a->getDataLayout() != NumericTableIface::csrArray && simplePrediction)
+    {
+        /* Two-class SVM models share the support vectors, so the kernel values are computed once for all pairs of classes */
+        SharedSupportVectors<algorithmFPType, cpu> sharedSV;
+        bool isSharedSVSupported = false;
+        s = sharedSV.init(nClasses, a->getNumberOfColumns(), model, simplePrediction->getBaseParameter(), isSharedSVSupported);
+        DAAL_CHECK_STATUS_VAR(s);
+        if (isSharedSVSupported) return computeWithSharedSV(nClasses, nVectors, nRowsInBlock, nBlocks, a, sharedSV, pred, df, nonEmptyClassMap);
+    }
+
     typedef SubTaskVoteBased<algorithmFPType, ClsType, cpu> TSubTask;
     daal::ls<TSubTask *> lsTask([=, &simplePrediction]() {
         if (a->getDataLayout() == NumericTableIface::csrArray)
@@ -351,6 +768,37 @@ Status MultiClassClassifierPredictKernel<voteBased, training::oneAgainstOne, alg
     return safeStat.detach();
 }
 
+template <typename algorithmFPType, typename ClsType, typename MultiClsParam, CpuType cpu>
+Status MultiClassClassifierPredictKernel<voteBased, training::oneAgainstOne, algorithmFPType, ClsType, MultiClsParam, cpu>::computeWithSharedSV(
+    size_t nClasses, size_t nVectors, size_t nRowsInBlock, size_t nBlocks, const NumericTable * a,
+    const SharedSupportVectors<algorithmFPType, cpu> & sharedSV, NumericTable * pred, NumericTable * df, const size_t * nonEmptyClassMap)
+{
+    typedef SubTaskVoteBasedSharedSV<algorithmFPType, cpu> TSubTask;
+    daal::ls<TSubTask *> lsTask([=, &sharedSV]() { return TSubTask::create(nClasses, nRowsInBlock, sharedSV); });
+
+    /* Process input data set block by block */
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        TSubTask * local = lsTask.local();
+        if (!local)
+        {
+            safeStat.add(ErrorMemoryAllocationFailed);
+            return;
+        }
+        DAAL_LS_RELEASE(TSubTask, lsTask, local); //releases local storage when leaving this scope
+
+        const size_t startRow = iBlock * nRowsInBlock;
+        const size_t nRows    = (startRow + nRowsInBlock > nVectors) ? nVectors - startRow : nRowsInBlock;
+
+        /* Get a block of predictions */
+        Status s = local->predict(startRow, nRows, a, pred, df, nonEmptyClassMap);
+        DAAL_CHECK_STATUS_THR(s);
+    });
+
+    lsTask.reduce([=, &safeStat](TSubTask * local) { delete local; });
+    return safeStat.detach();
+}
+
 } // namespace internal
 } // namespace prediction
 } // namespace multi_class_classifier
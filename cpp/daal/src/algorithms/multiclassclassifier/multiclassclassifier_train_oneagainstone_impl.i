@@ -26,6 +26,9 @@
 #define __MULTICLASSCLASSIFIER_TRAIN_ONEAGAINSTONE_IMPL_I__
 
 #include "algorithms/multi_class_classifier/multi_class_classifier_model.h"
+#include "algorithms/svm/svm_model.h"
+#include "algorithms/svm/svm_train_types.h"
+#include "services/internal/execution_context.h"
 
 #include "src/threading/threading.h"
 #include "src/algorithms/service_sort.h"
@@ -76,18 +79,33 @@ services::Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType,
         DAAL_CHECK_STATUS(s, computeDataSize(nVectors, nFeatures, nClasses, xTable, y, nSubsetVectors, dataSize));
     }
 
+    /* Group the observations by classes to gather the subsets without scanning all the labels */
+    TArray<size_t, cpu> classRowsArr(nVectors + nClasses + 1);
+    DAAL_CHECK_MALLOC(classRowsArr.get());
+    size_t * const classRows    = classRowsArr.get();
+    size_t * const classOffsets = classRowsArr.get() + nVectors;
+    groupRowsByClasses(nVectors, nClasses, y, classRows, classOffsets);
+
+    const size_t nModels = (nClasses * (nClasses - 1)) >> 1;
+
+    svm::training::internal::SVMSharedKernelCachePtr<algorithmFPType, cpu> sharedKernelCache;
+    if (xTable->getDataLayout() != NumericTableIface::csrArray)
+    {
+        Status s;
+        DAAL_CHECK_STATUS(s, createSharedKernelCache(xTable, nModels, *simpleTrainingInit, sharedKernelCache));
+    }
+
     typedef SubTask<algorithmFPType, ClsType, cpu> TSubTask;
     /* Allocate memory for storing subsets of input data */
-    daal::ls<TSubTask *> lsTask([=, &simpleTrainingInit]() {
+    daal::ls<TSubTask *> lsTask([=, &simpleTrainingInit, &sharedKernelCache]() {
         if (xTable->getDataLayout() == NumericTableIface::csrArray)
             return (TSubTask *)SubTaskCSR<algorithmFPType, ClsType, cpu>::create(nFeatures, nSubsetVectors, dataSize, xTable, weights,
                                                                                  simpleTrainingInit);
         return (TSubTask *)SubTaskDense<algorithmFPType, ClsType, cpu>::create(nFeatures, nSubsetVectors, dataSize, xTable, weights,
-                                                                               simpleTrainingInit);
+                                                                               simpleTrainingInit, sharedKernelCache);
     });
 
     SafeStatus safeStat;
-    const size_t nModels = (nClasses * (nClasses - 1)) >> 1;
     daal::threader_for(nModels, nModels, [&](size_t imodel) {
         /* Find indices of positive and negative classes for current model */
         size_t i    = 1; /* index of the positive class */
@@ -109,7 +127,7 @@ services::Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType,
         DAAL_LS_RELEASE(TSubTask, lsTask, local); //releases local storage when leaving this scope
 
         size_t nRowsInSubset = 0;
-        Status s             = local->getDataSubset(nFeatures, nVectors, i, j, y, nRowsInSubset);
+        Status s             = local->getDataSubset(nFeatures, classRows, classOffsets, i, j, nRowsInSubset);
         DAAL_CHECK_STATUS_THR(s);
         classifier::ModelPtr pModel;
         if (nRowsInSubset)
@@ -181,37 +199,95 @@ Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, ClsType,
     return Status();
 }
 
+template <typename algorithmFPType, typename ClsType, typename MccParType, CpuType cpu>
+void MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, ClsType, MccParType, cpu>::groupRowsByClasses(
+    size_t nVectors, size_t nClasses, const algorithmFPType * y, size_t * classRows, size_t * classOffsets)
+{
+    daal::services::internal::service_memset_seq<size_t, cpu>(classOffsets, 0, nClasses + 1);
+    for (size_t i = 0; i < nVectors; ++i)
+    {
+        ++classOffsets[size_t(y[i]) + 1];
+    }
+    for (size_t i = 0; i < nClasses; ++i)
+    {
+        classOffsets[i + 1] += classOffsets[i];
+    }
+    /* Counting sort keeps the original order of observations within each class */
+    for (size_t i = 0; i < nVectors; ++i)
+    {
+        classRows[classOffsets[size_t(y[i])]++] = i;
+    }
+    for (size_t i = nClasses; i > 0; --i)
+    {
+        classOffsets[i] = classOffsets[i - 1];
+    }
+    classOffsets[0] = 0;
+}
+
+template <typename algorithmFPType, typename ClsType, typename MccParType, CpuType cpu>
+Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, ClsType, MccParType, cpu>::createSharedKernelCache(
+    const NumericTable * xTable, size_t nModels, ClsType & simpleTraining,
+    svm::training::internal::SVMSharedKernelCachePtr<algorithmFPType, cpu> & sharedKernelCache)
+{
+    /* The kernel rows are shared by two-class SVM classifiers trained with the Thunder method on CPU */
+    const svm::Parameter * svmPar = dynamic_cast<const svm::Parameter *>(simpleTraining.getBaseParameter());
+    if (!svmPar || !svmPar->kernel || simpleTraining.getMethod() != svm::training::thunder) return Status();
+    if (!services::internal::getDefaultContext().getInfoDevice().isCpu) return Status();
+
+    const size_t nVectors = xTable->getNumberOfRows();
+    if (nModels < 2 || nVectors > size_t(UINT32_MAX)) return Status();
+
+    /* The shared cache uses the memory that the caches of concurrently trained classifiers would use */
+    const size_t nThreads          = threader_get_max_threads_number();
+    const size_t nConcurrentModels = nModels < nThreads ? nModels : nThreads;
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, svmPar->cacheSize, nConcurrentModels);
+
+    Status s;
+    sharedKernelCache = svm::training::internal::SVMSharedKernelCache<algorithmFPType, cpu>::create(
+        NumericTablePtr(const_cast<NumericTable *>(xTable), services::EmptyDeleter()), svmPar->kernel, svmPar->cacheSize * nConcurrentModels, s);
+    return s;
+}
+
 template <typename algorithmFPType, typename ClsType, CpuType cpu>
-Status SubTaskDense<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label,
-                                                                         const algorithmFPType * y, size_t & nRows)
+Status SubTaskDense<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t nFeatures, const size_t * rows, size_t nClassRows,
+                                                                         algorithmFPType label, size_t & nRows)
 {
-    for (size_t ix = 0; ix < nVectors; ix++)
+    for (size_t i = 0; i < nClassRows;)
     {
-        if (size_t(y[ix]) != classIdx) continue;
-        _mtX.next(ix, 1);
+        /* Observations with consecutive indices are copied by one block */
+        size_t nBlockRows = 1;
+        while (i + nBlockRows < nClassRows && rows[i + nBlockRows] == rows[i] + nBlockRows) ++nBlockRows;
+
+        _mtX.next(rows[i], nBlockRows);
         DAAL_CHECK_BLOCK_STATUS(_mtX);
-        PRAGMA_IVDEP
-        PRAGMA_VECTOR_ALWAYS
-        for (size_t jx = 0; jx < nFeatures; jx++) this->_subsetX.get()[nRows * nFeatures + jx] = _mtX.get()[jx];
-        this->_subsetY[nRows] = label;
-        if (this->_weights)
+        tmemcpy<algorithmFPType, cpu>(this->_subsetX.get() + nRows * nFeatures, _mtX.get(), nBlockRows * nFeatures);
+        for (size_t k = 0; k < nBlockRows; ++k, ++nRows)
         {
-            this->_subsetW[nRows] = this->_weights[ix];
+            const size_t ix       = rows[i + k];
+            this->_subsetY[nRows] = label;
+            if (this->_weights)
+            {
+                this->_subsetW[nRows] = this->_weights[ix];
+            }
+            if (_fullDataIndices)
+            {
+                _fullDataIndices[nRows] = uint32_t(ix);
+            }
         }
-        ++nRows;
+        i += nBlockRows;
     }
     return Status();
 }
 
 template <typename algorithmFPType, typename ClsType, CpuType cpu>
-Status SubTaskCSR<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label,
-                                                                       const algorithmFPType * y, size_t & nRows)
+Status SubTaskCSR<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t nFeatures, const size_t * rows, size_t nClassRows,
+                                                                       algorithmFPType label, size_t & nRows)
 {
     _rowOffsetsX[0]  = 1;
     size_t dataIndex = (nRows ? _rowOffsetsX[nRows] - _rowOffsetsX[0] : 0);
-    for (size_t ix = 0; ix < nVectors; ix++)
+    for (size_t i = 0; i < nClassRows; i++)
     {
-        if (size_t(y[ix]) != classIdx) continue;
+        const size_t ix = rows[i];
         _mtX.next(ix, 1);
         DAAL_CHECK_BLOCK_STATUS(_mtX);
         const size_t nNonZeroValuesInRow = _mtX.rows()[1] - _mtX.rows()[0];
@@ -29,6 +29,7 @@
 #include "src/algorithms/service_sort.h"
 #include "src/externals/service_memory.h"
 #include "src/data_management/service_numeric_table.h"
+#include "src/algorithms/svm/svm_train_shared_cache.h"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -52,14 +53,17 @@ public:
     DAAL_NEW_DELETE();
     virtual ~SubTask() {}
 
-    services::Status getDataSubset(size_t nFeatures, size_t nVectors, int classIdxPositive, int classIdxNegative, const algorithmFPType * y,
-                                   size_t & nRows)
+    /* classRows contains the indices of observations grouped by classes, classOffsets[i] is the position of the first observation of class i */
+    services::Status getDataSubset(size_t nFeatures, const size_t * classRows, const size_t * classOffsets, int classIdxPositive,
+                                   int classIdxNegative, size_t & nRows)
     {
         nRows = 0;
         /* Prepare "positive" observations of the training subset */
-        services::Status s = copyDataIntoSubtable(nFeatures, nVectors, classIdxPositive, 1, y, nRows);
+        services::Status s = copyDataIntoSubtable(nFeatures, classRows + classOffsets[classIdxPositive],
+                                                  classOffsets[classIdxPositive + 1] - classOffsets[classIdxPositive], 1, nRows);
         if (s) /* Prepare "negative" observations of the training subset */
-            s = copyDataIntoSubtable(nFeatures, nVectors, classIdxNegative, -1, y, nRows);
+            s = copyDataIntoSubtable(nFeatures, classRows + classOffsets[classIdxNegative],
+                                     classOffsets[classIdxNegative + 1] - classOffsets[classIdxNegative], -1, nRows);
         return s;
     }
 
@@ -106,7 +110,7 @@ protected:
 
     bool isValid() const { return _subsetX.get() && _subsetYTable.get() && _simpleTraining.get(); }
 
-    virtual services::Status copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label, const algorithmFPType * y,
+    virtual services::Status copyDataIntoSubtable(size_t nFeatures, const size_t * rows, size_t nClassRows, algorithmFPType label,
                                                   size_t & nRows) = 0;
 
 protected:
@@ -155,7 +159,7 @@ private:
         }
     }
 
-    virtual services::Status copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label, const algorithmFPType * y,
+    virtual services::Status copyDataIntoSubtable(size_t nFeatures, const size_t * rows, size_t nClassRows, algorithmFPType label,
                                                   size_t & nRows) DAAL_C11_OVERRIDE;
 
 private:
@@ -171,10 +175,12 @@ public:
     virtual ~SubTaskDense() DAAL_C11_OVERRIDE {}
 
     typedef SubTask<algorithmFPType, ClsType, cpu> super;
+    typedef svm::training::internal::SVMSharedKernelCachePtr<algorithmFPType, cpu> SharedKernelCachePtr;
     static SubTaskDense * create(size_t nFeatures, size_t nSubsetVectors, size_t dataSize, const NumericTable * xTable,
-                                 const algorithmFPType * weights, const services::SharedPtr<ClsType> & st)
+                                 const algorithmFPType * weights, const services::SharedPtr<ClsType> & st,
+                                 const SharedKernelCachePtr & sharedKernelCache = SharedKernelCachePtr())
     {
-        auto val = new SubTaskDense(nFeatures, nSubsetVectors, dataSize, xTable, weights, st);
+        auto val = new SubTaskDense(nFeatures, nSubsetVectors, dataSize, xTable, weights, st, sharedKernelCache);
         if (val && val->isValid()) return val;
         delete val;
         val = nullptr;
@@ -183,22 +189,37 @@ public:
 
 private:
     typedef HomogenNumericTableCPU<algorithmFPType, cpu> HomogenNT;
+    typedef svm::training::internal::SVMSharedCacheSubsetTable<algorithmFPType, cpu> SharedCacheSubsetNT;
     bool isValid() const { return super::isValid() && this->_subsetXTable.get(); }
 
     SubTaskDense(size_t nFeatures, size_t nSubsetVectors, size_t dataSize, const NumericTable * xTable, const algorithmFPType * weights,
-                 const services::SharedPtr<ClsType> & st)
-        : super(nSubsetVectors, dataSize, weights, st), _mtX(const_cast<NumericTable *>(xTable))
+                 const services::SharedPtr<ClsType> & st, const SharedKernelCachePtr & sharedKernelCache)
+        : super(nSubsetVectors, dataSize, weights, st), _mtX(const_cast<NumericTable *>(xTable)), _fullDataIndices(nullptr)
     {
         services::Status status;
-        if (this->_subsetX.get()) this->_subsetXTable = HomogenNT::create(this->_subsetX.get(), nFeatures, nSubsetVectors, &status);
+        if (!this->_subsetX.get()) return;
+        if (sharedKernelCache)
+        {
+            /* Kernel values of the subset are taken from the cache shared by all two-class classifiers */
+            services::SharedPtr<SharedCacheSubsetNT> subsetXTable =
+                SharedCacheSubsetNT::create(this->_subsetX.get(), nFeatures, nSubsetVectors, sharedKernelCache, status);
+            if (!status) return;
+            _fullDataIndices    = subsetXTable->getFullDataIndices();
+            this->_subsetXTable = subsetXTable;
+        }
+        else
+        {
+            this->_subsetXTable = HomogenNT::create(this->_subsetX.get(), nFeatures, nSubsetVectors, &status);
+        }
         if (!status) return;
     }
 
-    virtual services::Status copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label, const algorithmFPType * y,
+    virtual services::Status copyDataIntoSubtable(size_t nFeatures, const size_t * rows, size_t nClassRows, algorithmFPType label,
                                                   size_t & nRows) DAAL_C11_OVERRIDE;
 
 private:
     ReadRows<algorithmFPType, cpu> _mtX;
+    uint32_t * _fullDataIndices;
 };
 
 template <typename algorithmFPType, typename ClsType, typename MccParType, CpuType cpu>
@@ -211,6 +232,11 @@ public:
 protected:
     services::Status computeDataSize(size_t nVectors, size_t nFeatures, size_t nClasses, const NumericTable * xTable, const algorithmFPType * y,
                                      size_t & nSubsetVectors, size_t & dataSize);
+
+    void groupRowsByClasses(size_t nVectors, size_t nClasses, const algorithmFPType * y, size_t * classRows, size_t * classOffsets);
+
+    services::Status createSharedKernelCache(const NumericTable * xTable, size_t nModels, ClsType & simpleTraining,
+                                             svm::training::internal::SVMSharedKernelCachePtr<algorithmFPType, cpu> & sharedKernelCache);
 };
 
 } // namespace internal
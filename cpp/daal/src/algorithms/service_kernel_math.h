@@ -82,10 +82,23 @@ FPType distance(const FPType * a, const FPType * b, size_t dim, FPType p)
     return daal::internal::Math<FPType, cpu>::sPowx(sum, (FPType)1.0 / p);
 }
 
+/* Types of the metrics implemented behind the PairwiseDistances interface.
+ * The values match the DistanceType enumerations of the algorithms that allow to select the metric */
+enum PairwiseDistanceType
+{
+    euclideanDistance    = 0, /* sqrt(sum((a - b)^2)) */
+    manhattanDistance    = 1, /* sum(|a - b|) */
+    minkowskiDistance    = 2, /* sum(|a - b|^p)^(1/p) */
+    cosineDistance       = 3, /* 1 - a*b' / (|a| * |b|) */
+    innerProductDistance = 4  /* -a*b' */
+};
+
 template <typename FPType, CpuType cpu>
 class PairwiseDistances
 {
 public:
+    DAAL_NEW_DELETE();
+
     virtual ~PairwiseDistances() {};
 
     virtual services::Status init() = 0;
@@ -94,6 +107,294 @@ public:
                                           FPType * const res)                                                             = 0;
     virtual services::Status computeBatch(size_t aOffset, size_t aSize, size_t bOffset, size_t bSize, FPType * const res) = 0;
     virtual services::Status computeFull(FPType * const res)                                                              = 0;
+
+    // Metrics may compute a monotonic function of the distance in computeBatch to skip the expensive per-element math,
+    // e.g. the squared Euclidean distance. Converts n values computed by computeBatch to the distances
+    virtual void fromBatchScale(size_t n, FPType * values) const {}
+};
+
+// compute: A x B'
+template <typename FPType, CpuType cpu>
+void computeInnerProductsBlock(const FPType * const a, const FPType * const b, const size_t nRowsA, const size_t nColsA, const size_t nRowsB,
+                               FPType * const out)
+{
+    const char transa    = 't';
+    const char transb    = 'n';
+    const DAAL_INT _m    = nRowsB;
+    const DAAL_INT _n    = nRowsA;
+    const DAAL_INT _k    = nColsA;
+    const FPType alpha   = 1.0;
+    const DAAL_INT lda   = nColsA;
+    const DAAL_INT ldy   = nColsA;
+    const FPType beta    = 0.0;
+    const DAAL_INT ldaty = nRowsB;
+
+    Blas<FPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, b, &lda, a, &ldy, &beta, out, &ldaty);
+}
+
+// compute: sum(A^2, 2)
+template <typename FPType, CpuType cpu>
+services::Status computeSquaredNorms(const NumericTable & ntData, FPType * const res)
+{
+    const size_t nRows = ntData.getNumberOfRows();
+    const size_t nCols = ntData.getNumberOfColumns();
+
+    const size_t blockSize = 512;
+    const size_t nBlocks   = nRows / blockSize + !!(nRows % blockSize);
+
+    SafeStatus safeStat;
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t begin = iBlock * blockSize;
+        const size_t end   = services::internal::min<cpu, size_t>(begin + blockSize, nRows);
+
+        ReadRows<FPType, cpu> dataRows(const_cast<NumericTable &>(ntData), begin, end - begin);
+        DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
+        const FPType * const data = dataRows.get();
+
+        FPType * r = res + begin;
+
+        for (size_t i = 0; i < end - begin; i++)
+        {
+            FPType sum = FPType(0);
+            PRAGMA_IVDEP
+            PRAGMA_ICC_NO16(omp simd reduction(+ : sum))
+            for (size_t j = 0; j < nCols; j++)
+            {
+                sum += data[i * nCols + j] * data[i * nCols + j];
+            }
+            r[i] = sum;
+        }
+    });
+
+    return safeStat.detach();
+}
+
+// Implements computeBatch() over the numeric tables and computeFull() via computeBatch() over the pointers
+template <typename FPType, CpuType cpu>
+class BlockPairwiseDistances : public PairwiseDistances<FPType, cpu>
+{
+public:
+    BlockPairwiseDistances(const NumericTable & a, const NumericTable & b) : _a(a), _b(b) {}
+
+    using PairwiseDistances<FPType, cpu>::computeBatch;
+
+    // output:  Row-major matrix of size { aSize x bSize }
+    virtual services::Status computeBatch(size_t aOffset, size_t aSize, size_t bOffset, size_t bSize, FPType * const res)
+    {
+        ReadRows<FPType, cpu> aDataRows(const_cast<NumericTable *>(&_a), aOffset, aSize);
+        DAAL_CHECK_BLOCK_STATUS(aDataRows);
+
+        ReadRows<FPType, cpu> bDataRows(const_cast<NumericTable *>(&_b), bOffset, bSize);
+        DAAL_CHECK_BLOCK_STATUS(bDataRows);
+
+        return this->computeBatch(aDataRows.get(), bDataRows.get(), aOffset, aSize, bOffset, bSize, res);
+    }
+
+    // output:  Row-major matrix of size { nrows(A) x nrows(B) }
+    virtual services::Status computeFull(FPType * const res)
+    {
+        SafeStatus safeStat;
+
+        const size_t nRowsA    = _a.getNumberOfRows();
+        const size_t nRowsB    = _b.getNumberOfRows();
+        const size_t blockSize = 256;
+        const size_t nBlocks   = nRowsA / blockSize + (nRowsA % blockSize > 0);
+
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t i1 = iBlock * blockSize;
+            const size_t i2 = (iBlock + 1 == nBlocks ? nRowsA : i1 + blockSize);
+
+            DAAL_CHECK_STATUS_THR(computeBatch(i1, i2 - i1, 0, nRowsB, res + i1 * nRowsB));
+        });
+
+        return safeStat.detach();
+    }
+
+protected:
+    const NumericTable & _a;
+    const NumericTable & _b;
+};
+
+// compute: sum(|A - B|^p, 2), the root is taken by fromBatchScale() only.
+// Manhattan distance is the case of p = 1, it needs neither power nor root
+template <typename FPType, CpuType cpu>
+class MinkowskiDistances : public BlockPairwiseDistances<FPType, cpu>
+{
+public:
+    MinkowskiDistances(const NumericTable & a, const NumericTable & b, FPType p) : BlockPairwiseDistances<FPType, cpu>(a, b), _p(p) {}
+
+    virtual services::Status init() { return services::Status(); }
+
+    using BlockPairwiseDistances<FPType, cpu>::computeBatch;
+
+    // output:  Row-major matrix of size { aSize x bSize }
+    virtual services::Status computeBatch(const FPType * const a, const FPType * const b, size_t aOffset, size_t aSize, size_t bOffset, size_t bSize,
+                                          FPType * const res)
+    {
+        const size_t nCols = this->_a.getNumberOfColumns();
+
+        if (_p == FPType(1))
+        {
+            for (size_t i = 0; i < aSize; i++)
+            {
+                const FPType * const aRow = a + i * nCols;
+                for (size_t j = 0; j < bSize; j++)
+                {
+                    const FPType * const bRow = b + j * nCols;
+                    FPType sum                = FPType(0);
+                    PRAGMA_IVDEP
+                    PRAGMA_ICC_NO16(omp simd reduction(+ : sum))
+                    for (size_t k = 0; k < nCols; k++)
+                    {
+                        const FPType diff = aRow[k] - bRow[k];
+                        sum += (diff < FPType(0)) ? -diff : diff;
+                    }
+                    res[i * bSize + j] = sum;
+                }
+            }
+            return services::Status();
+        }
+
+        if (_p == FPType(2))
+        {
+            for (size_t i = 0; i < aSize; i++)
+            {
+                for (size_t j = 0; j < bSize; j++)
+                {
+                    res[i * bSize + j] = distancePow2<FPType, cpu>(a + i * nCols, b + j * nCols, nCols);
+                }
+            }
+            return services::Status();
+        }
+
+        // the powers of the differences of the row of A with all the rows of B are computed by one vector call
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, bSize, nCols);
+        TArray<FPType, cpu> diffArray(bSize * nCols);
+        FPType * const diff = diffArray.get();
+        DAAL_CHECK_MALLOC(diff);
+
+        for (size_t i = 0; i < aSize; i++)
+        {
+            const FPType * const aRow = a + i * nCols;
+            for (size_t j = 0; j < bSize; j++)
+            {
+                const FPType * const bRow = b + j * nCols;
+                FPType * const diffRow    = diff + j * nCols;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t k = 0; k < nCols; k++)
+                {
+                    const FPType d = aRow[k] - bRow[k];
+                    diffRow[k]     = (d < FPType(0)) ? -d : d;
+                }
+            }
+
+            daal::internal::Math<FPType, cpu>::vPowx(bSize * nCols, diff, _p, diff);
+
+            for (size_t j = 0; j < bSize; j++)
+            {
+                const FPType * const diffRow = diff + j * nCols;
+                FPType sum                   = FPType(0);
+                PRAGMA_IVDEP
+                PRAGMA_ICC_NO16(omp simd reduction(+ : sum))
+                for (size_t k = 0; k < nCols; k++)
+                {
+                    sum += diffRow[k];
+                }
+                res[i * bSize + j] = sum;
+            }
+        }
+
+        return services::Status();
+    }
+
+    virtual void fromBatchScale(size_t n, FPType * values) const
+    {
+        if (_p == FPType(1)) return;
+        daal::internal::Math<FPType, cpu>::vPowx(n, values, FPType(1) / _p, values);
+    }
+
+private:
+    const FPType _p;
+};
+
+// compute: 1 - A*B' / (|A| * |B|) for cosineDistance or -A*B' for innerProductDistance.
+// The distance of a zero row to any other row is 1 for the cosine distance
+template <typename FPType, CpuType cpu>
+class InnerProductDistances : public BlockPairwiseDistances<FPType, cpu>
+{
+public:
+    InnerProductDistances(const NumericTable & a, const NumericTable & b, bool cosine) : BlockPairwiseDistances<FPType, cpu>(a, b), _cosine(cosine)
+    {}
+
+    virtual services::Status init()
+    {
+        if (!_cosine) return services::Status();
+
+        DAAL_CHECK_STATUS_VAR(computeInverseNorms(this->_a, _inverseNormsA));
+        if (&this->_a != &this->_b)
+        {
+            DAAL_CHECK_STATUS_VAR(computeInverseNorms(this->_b, _inverseNormsB));
+        }
+        return services::Status();
+    }
+
+    using BlockPairwiseDistances<FPType, cpu>::computeBatch;
+
+    // output:  Row-major matrix of size { aSize x bSize }
+    virtual services::Status computeBatch(const FPType * const a, const FPType * const b, size_t aOffset, size_t aSize, size_t bOffset, size_t bSize,
+                                          FPType * const res)
+    {
+        computeInnerProductsBlock<FPType, cpu>(a, b, aSize, this->_a.getNumberOfColumns(), bSize, res);
+
+        if (!_cosine)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < aSize * bSize; i++)
+            {
+                res[i] = -res[i];
+            }
+            return services::Status();
+        }
+
+        const FPType * const aa = _inverseNormsA.get() + aOffset;
+        const FPType * const bb = ((&this->_a == &this->_b) ? _inverseNormsA.get() : _inverseNormsB.get()) + bOffset;
+
+        for (size_t i = 0; i < aSize; i++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < bSize; j++)
+            {
+                res[i * bSize + j] = FPType(1) - res[i * bSize + j] * aa[i] * bb[j];
+            }
+        }
+
+        return services::Status();
+    }
+
+private:
+    services::Status computeInverseNorms(const NumericTable & table, TArray<FPType, cpu> & inverseNorms)
+    {
+        const size_t nRows = table.getNumberOfRows();
+        inverseNorms.reset(nRows);
+        FPType * const norms = inverseNorms.get();
+        DAAL_CHECK_MALLOC(norms);
+        DAAL_CHECK_STATUS_VAR((computeSquaredNorms<FPType, cpu>(table, norms)));
+
+        daal::internal::Math<FPType, cpu>::vSqrt(nRows, norms, norms);
+        for (size_t i = 0; i < nRows; i++)
+        {
+            norms[i] = (norms[i] > FPType(0)) ? FPType(1) / norms[i] : FPType(0);
+        }
+        return services::Status();
+    }
+
+    const bool _cosine;
+    TArray<FPType, cpu> _inverseNormsA;
+    TArray<FPType, cpu> _inverseNormsB;
 };
 
 // compute: sum(A^2, 2) + sum(B^2, 2) -2*A*B'
@@ -176,6 +477,31 @@ public:
         return computeBatch(aData, bData, aOffset, aSize, bOffset, bSize, res);
     }
 
+    virtual void fromBatchScale(size_t n, FPType * values) const
+    {
+        if (!_squared) return;
+        for (size_t i = 0; i < n; i++)
+        {
+            // max(0, d) to remove negative distances before Sqrt
+            values[i] = services::internal::max<cpu, FPType>(FPType(0), values[i]);
+        }
+        daal::internal::Math<FPType, cpu>::vSqrt(n, values, values);
+    }
+
+    // output:  Row-major matrix of size { aSize x bSize } of the inner products A*B' only, the squared distances
+    //          are getNormsA()[i] + getNormsB()[j] - 2*res[i, j]. Lets the caller fuse the norms addition with its own pass over the result
+    services::Status computeInnerProducts(const FPType * const a, const FPType * const b, size_t aSize, size_t bSize, FPType * const res)
+    {
+        computeABt(a, b, aSize, _a.getNumberOfColumns(), bSize, res);
+        return services::Status();
+    }
+
+    // sum(A^2, 2) computed by init()
+    const FPType * getNormsA() const { return normBufferA.get(); }
+
+    // sum(B^2, 2) computed by init()
+    const FPType * getNormsB() const { return (&_a == &_b) ? normBufferA.get() : normBufferB.get(); }
+
     // output:  Row-major matrix of size { nrows(A) x nrows(B) }
     virtual services::Status computeFull(FPType * const res)
     {
@@ -200,57 +526,12 @@ public:
 
 protected:
     // compute (sum(A^2, 2))
-    services::Status computeNorm(const NumericTable & ntData, FPType * const res)
-    {
-        const size_t nRows = ntData.getNumberOfRows();
-        const size_t nCols = ntData.getNumberOfColumns();
-
-        const size_t blockSize = 512;
-        const size_t nBlocks   = nRows / blockSize + !!(nRows % blockSize);
-
-        SafeStatus safeStat;
-
-        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
-            size_t begin = iBlock * blockSize;
-            size_t end   = services::internal::min<cpu, size_t>(begin + blockSize, nRows);
-
-            ReadRows<FPType, cpu> dataRows(const_cast<NumericTable &>(ntData), begin, end - begin);
-            DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
-            const FPType * const data = dataRows.get();
-
-            FPType * r = res + begin;
-
-            for (size_t i = 0; i < end - begin; i++)
-            {
-                FPType sum = FPType(0);
-                PRAGMA_IVDEP
-                PRAGMA_ICC_NO16(omp simd reduction(+ : sum))
-                for (size_t j = 0; j < nCols; j++)
-                {
-                    sum += data[i * nCols + j] * data[i * nCols + j];
-                }
-                r[i] = sum;
-            }
-        });
-
-        return safeStat.detach();
-    }
+    services::Status computeNorm(const NumericTable & ntData, FPType * const res) { return computeSquaredNorms<FPType, cpu>(ntData, res); }
 
     // compute (A x B')
     void computeABt(const FPType * const a, const FPType * const b, const size_t nRowsA, const size_t nColsA, const size_t nRowsB, FPType * const out)
     {
-        const char transa    = 't';
-        const char transb    = 'n';
-        const DAAL_INT _m    = nRowsB;
-        const DAAL_INT _n    = nRowsA;
-        const DAAL_INT _k    = nColsA;
-        const FPType alpha   = 1.0;
-        const DAAL_INT lda   = nColsA;
-        const DAAL_INT ldy   = nColsA;
-        const FPType beta    = 0.0;
-        const DAAL_INT ldaty = nRowsB;
-
-        Blas<FPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, b, &lda, a, &ldy, &beta, out, &ldaty);
+        computeInnerProductsBlock<FPType, cpu>(a, b, nRowsA, nColsA, nRowsB, out);
     }
 
     const NumericTable & _a;
@@ -261,6 +542,22 @@ protected:
     TArray<FPType, cpu> normBufferB;
 };
 
+// Creates the metric of the given type, the Euclidean distances are computed squared.
+// Returns nullptr if the memory allocation fails
+template <typename FPType, CpuType cpu>
+PairwiseDistances<FPType, cpu> * createPairwiseDistances(PairwiseDistanceType type, const NumericTable & a, const NumericTable & b,
+                                                         FPType minkowskiPower)
+{
+    switch (type)
+    {
+    case manhattanDistance: return new MinkowskiDistances<FPType, cpu>(a, b, FPType(1));
+    case minkowskiDistance: return new MinkowskiDistances<FPType, cpu>(a, b, minkowskiPower);
+    case cosineDistance: return new InnerProductDistances<FPType, cpu>(a, b, true);
+    case innerProductDistance: return new InnerProductDistances<FPType, cpu>(a, b, false);
+    default: return new EuclideanDistances<FPType, cpu>(a, b, true);
+    }
+}
+
 } // namespace internal
 } // namespace algorithms
 } // namespace daal
@@ -0,0 +1,362 @@
+/* file: svm_train_shared_cache.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Cache of kernel function values shared by several SVM training tasks
+//  that are trained on subsets of the same data set
+//--
+*/
+
+#ifndef __SVM_TRAIN_SHARED_CACHE_H__
+#define __SVM_TRAIN_SHARED_CACHE_H__
+
+#include "algorithms/kernel_function/kernel_function.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/service_threading.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_memory.h"
+#include "src/services/service_arrays.h"
+#include "src/threading/threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svm
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::data_management;
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+/**
+ * Cache of the kernel function rows computed on the full data set.
+ * The row is identified by the index of the observation in the full data set,
+ * so the row computed for one subset of the data is reused by all other subsets containing the same observation.
+ * The cache is thread-safe: the rows are pinned while they are being read and are replaced in the CLOCK order otherwise.
+ */
+template <typename algorithmFPType, CpuType cpu>
+class SVMSharedKernelCache
+{
+public:
+    DAAL_NEW_DELETE();
+
+    /**
+     * Creates the cache that stores kernel function rows in the memory of cacheSize bytes.
+     * Returns empty pointer if the cache cannot store at least one row.
+     */
+    static services::SharedPtr<SVMSharedKernelCache> create(const NumericTablePtr & xTable, const kernel_function::KernelIfacePtr & kernel,
+                                                            const size_t cacheSize, services::Status & status)
+    {
+        const size_t nVectors  = xTable->getNumberOfRows();
+        const size_t lineBytes = nVectors * sizeof(algorithmFPType);
+        if (nVectors == 0 || cacheSize < lineBytes) return services::SharedPtr<SVMSharedKernelCache>();
+
+        const size_t alignedLineBytes = lineBytes & 63 ? (lineBytes & (~63)) + 64 : lineBytes; // nearest number aligned on 64
+        const size_t nLines           = services::internal::min<cpu, size_t>(nVectors, cacheSize / alignedLineBytes);
+        services::SharedPtr<SVMSharedKernelCache> res(new SVMSharedKernelCache(xTable, kernel, nLines, alignedLineBytes / sizeof(algorithmFPType)));
+        if (!res)
+        {
+            status.add(services::ErrorMemoryAllocationFailed);
+            return res;
+        }
+        status |= res->init();
+        if (!status) res.reset();
+        return res;
+    }
+
+    size_t getNumberOfVectors() const { return _nVectors; }
+
+    /**
+     * Returns pointers to the kernel rows of the observations with given indices in the full data set.
+     * The null pointer is returned for the rows that cannot be provided by the cache,
+     * e.g. when the row is being computed by other thread or all the lines of the cache are in use.
+     * The non-null rows stay valid until releaseRows() is called for them.
+     */
+    services::Status getRows(const uint32_t * const indices, const size_t n, const algorithmFPType ** const rows)
+    {
+        services::Status status;
+        TArray<uint32_t, cpu> buffer(3 * n);
+        DAAL_CHECK_MALLOC(buffer.get());
+        uint32_t * const computeLines   = buffer.get();
+        uint32_t * const computeIndices = buffer.get() + n;
+        uint32_t * const computePos     = buffer.get() + 2 * n;
+        size_t nCompute                 = 0;
+        {
+            AUTOLOCK(_mutex);
+            for (size_t i = 0; i < n; ++i)
+            {
+                rows[i]            = nullptr;
+                const int64_t line = _rowLine[indices[i]];
+                if (line >= 0)
+                {
+                    if (_lineState[line] == ready)
+                    {
+                        ++_linePins[line];
+                        _lineUsed[line] = 1;
+                        rows[i]         = getLine(line);
+                    }
+                    continue;
+                }
+
+                const int64_t victim = findVictim();
+                if (victim < 0) continue;
+                if (_lineState[victim] != empty) _rowLine[_lineRow[victim]] = -1;
+                _lineRow[victim]   = indices[i];
+                _lineState[victim] = computing;
+                _lineUsed[victim]  = 1;
+                ++_linePins[victim];
+                _rowLine[indices[i]] = victim;
+
+                computeLines[nCompute]   = victim;
+                computeIndices[nCompute] = indices[i];
+                computePos[nCompute]     = i;
+                ++nCompute;
+            }
+        }
+
+        if (nCompute == 0) return status;
+
+        status = computeRows(computeLines, computeIndices, nCompute);
+
+        AUTOLOCK(_mutex);
+        for (size_t k = 0; k < nCompute; ++k)
+        {
+            const uint32_t line = computeLines[k];
+            if (status)
+            {
+                _lineState[line]    = ready;
+                rows[computePos[k]] = getLine(line);
+            }
+            else
+            {
+                _rowLine[_lineRow[line]] = -1;
+                _lineState[line]         = empty;
+                --_linePins[line];
+            }
+        }
+        if (!status)
+        {
+            releaseRowsNoLock(rows, n);
+        }
+        return status;
+    }
+
+    /** Unpins the rows returned by getRows() */
+    void releaseRows(const algorithmFPType * const * const rows, const size_t n)
+    {
+        AUTOLOCK(_mutex);
+        releaseRowsNoLock(rows, n);
+    }
+
+protected:
+    enum LineState
+    {
+        empty     = 0,
+        computing = 1,
+        ready     = 2
+    };
+
+    SVMSharedKernelCache(const NumericTablePtr & xTable, const kernel_function::KernelIfacePtr & kernel, const size_t nLines, const size_t lineSize)
+        : _xTable(xTable), _kernel(kernel), _nVectors(xTable->getNumberOfRows()), _nLines(nLines), _lineSize(lineSize), _clockHand(0)
+    {}
+
+    services::Status init()
+    {
+        _rowLine.reset(_nVectors);
+        DAAL_CHECK_MALLOC(_rowLine.get());
+        _lineRow.reset(_nLines);
+        DAAL_CHECK_MALLOC(_lineRow.get());
+        _linePins.reset(_nLines);
+        DAAL_CHECK_MALLOC(_linePins.get());
+        _lineState.reset(_nLines);
+        DAAL_CHECK_MALLOC(_lineState.get());
+        _lineUsed.reset(_nLines);
+        DAAL_CHECK_MALLOC(_lineUsed.get());
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _nLines, _lineSize);
+        _data.reset(_nLines * _lineSize);
+        DAAL_CHECK_MALLOC(_data.get());
+
+        service_memset_seq<int64_t, cpu>(_rowLine.get(), -1, _nVectors);
+        service_memset_seq<uint32_t, cpu>(_lineRow.get(), 0, _nLines);
+        service_memset_seq<uint32_t, cpu>(_linePins.get(), 0, _nLines);
+        service_memset_seq<char, cpu>(_lineState.get(), empty, _nLines);
+        service_memset_seq<char, cpu>(_lineUsed.get(), 0, _nLines);
+        return services::Status();
+    }
+
+    algorithmFPType * getLine(const size_t line) { return _data.get() + line * _lineSize; }
+
+    /* Finds the line to store a new row. Not pinned lines that were not used since the previous pass of the clock hand are replaced */
+    int64_t findVictim()
+    {
+        for (size_t iStep = 0; iStep < 2 * _nLines; ++iStep)
+        {
+            const size_t line = _clockHand;
+            _clockHand        = (_clockHand + 1 == _nLines) ? 0 : _clockHand + 1;
+            if (_lineState[line] == empty) return line;
+            if (_linePins[line]) continue;
+            if (_lineUsed[line])
+            {
+                _lineUsed[line] = 0;
+                continue;
+            }
+            return line;
+        }
+        return -1;
+    }
+
+    void releaseRowsNoLock(const algorithmFPType * const * const rows, const size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (!rows[i]) continue;
+            const size_t line = (rows[i] - _data.get()) / _lineSize;
+            DAAL_ASSERT(_linePins[line] > 0);
+            --_linePins[line];
+        }
+    }
+
+    /* Computes kernel function values between the full data set and the observations with given indices */
+    services::Status computeRows(const uint32_t * const lines, const uint32_t * const indices, const size_t nRows)
+    {
+        services::Status status;
+        NumericTable & x      = *_xTable;
+        const size_t nFeatures = x.getNumberOfColumns();
+
+        TArray<algorithmFPType, cpu> yData(nRows * nFeatures);
+        DAAL_CHECK_MALLOC(yData.get());
+
+        SafeStatus safeStat;
+        daal::threader_for(nRows, nRows, [&](const size_t iRow) {
+            ReadRows<algorithmFPType, cpu> mtX(x, indices[iRow], 1);
+            DAAL_CHECK_BLOCK_STATUS_THR(mtX);
+            DAAL_CHECK_THR(!services::internal::daal_memcpy_s(yData.get() + iRow * nFeatures, nFeatures * sizeof(algorithmFPType), mtX.get(),
+                                                              nFeatures * sizeof(algorithmFPType)),
+                           services::ErrorMemoryCopyFailedInternal);
+        });
+        DAAL_CHECK_SAFE_STATUS();
+
+        NumericTablePtr yTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(yData.get(), nFeatures, nRows, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        auto valuesTable = SOANumericTableCPU<cpu>::create(nRows, _nVectors, DictionaryIface::FeaturesEqual::equal, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        for (size_t iRow = 0; iRow < nRows; ++iRow)
+        {
+            DAAL_CHECK_STATUS(status, valuesTable->template setArray<algorithmFPType>(getLine(lines[iRow]), iRow));
+        }
+
+        /* Kernel function object stores its input and result, so every computation uses its own copy */
+        kernel_function::KernelIfacePtr kernel = _kernel->clone();
+        DAAL_CHECK_MALLOC(kernel.get());
+        kernel->getParameter()->computationMode = kernel_function::matrixMatrix;
+        kernel->getInput()->set(kernel_function::X, _xTable);
+        kernel->getInput()->set(kernel_function::Y, yTable);
+
+        kernel_function::ResultPtr shRes(new kernel_function::Result());
+        DAAL_CHECK_MALLOC(shRes.get());
+        shRes->set(kernel_function::values, valuesTable);
+        kernel->setResult(shRes);
+        return kernel->computeNoThrow();
+    }
+
+protected:
+    const NumericTablePtr _xTable;
+    const kernel_function::KernelIfacePtr _kernel;
+    const size_t _nVectors; /*!< Number of observations in the full data set, the length of the kernel row */
+    const size_t _nLines;   /*!< Number of cache lines */
+    const size_t _lineSize; /*!< Number of elements in the cache line, aligned on 64 bytes */
+    size_t _clockHand;
+    Mutex _mutex;
+    TArray<int64_t, cpu> _rowLine;   /*!< Cache line that stores the row of the observation, -1 if the row is not cached */
+    TArray<uint32_t, cpu> _lineRow;  /*!< Observation which row is stored in the cache line */
+    TArray<uint32_t, cpu> _linePins; /*!< Number of readers of the cache line */
+    TArray<char, cpu> _lineState;
+    TArray<char, cpu> _lineUsed;
+    TArrayScalable<algorithmFPType, cpu> _data;
+};
+
+template <typename algorithmFPType, CpuType cpu>
+using SVMSharedKernelCachePtr = services::SharedPtr<SVMSharedKernelCache<algorithmFPType, cpu> >;
+
+/**
+ * Interface of the training data which is a subset of the data set with the shared kernel cache
+ */
+template <typename algorithmFPType, CpuType cpu>
+class SVMSharedCacheSubsetIface
+{
+public:
+    virtual ~SVMSharedCacheSubsetIface() {}
+
+    virtual SVMSharedKernelCache<algorithmFPType, cpu> * getSharedKernelCache() const = 0;
+
+    /** Indices of the subset observations in the full data set */
+    virtual const uint32_t * getFullDataIndices() const = 0;
+};
+
+/**
+ * Homogen numeric table with the subset of the data set which kernel rows are taken from the shared cache
+ */
+template <typename algorithmFPType, CpuType cpu>
+class SVMSharedCacheSubsetTable : public HomogenNumericTableCPU<algorithmFPType, cpu>, public SVMSharedCacheSubsetIface<algorithmFPType, cpu>
+{
+public:
+    static services::SharedPtr<SVMSharedCacheSubsetTable> create(algorithmFPType * const ptr, const size_t nFeatures, const size_t nRows,
+                                                                 const SVMSharedKernelCachePtr<algorithmFPType, cpu> & cache,
+                                                                 services::Status & status)
+    {
+        services::SharedPtr<SVMSharedCacheSubsetTable> res(new SVMSharedCacheSubsetTable(ptr, nFeatures, nRows, cache, status));
+        if (!res)
+        {
+            status.add(services::ErrorMemoryAllocationFailed);
+        }
+        else if (!status || !res->_fullDataIndices.get())
+        {
+            status.add(services::ErrorMemoryAllocationFailed);
+            res.reset();
+        }
+        return res;
+    }
+
+    SVMSharedKernelCache<algorithmFPType, cpu> * getSharedKernelCache() const DAAL_C11_OVERRIDE { return _cache.get(); }
+
+    const uint32_t * getFullDataIndices() const DAAL_C11_OVERRIDE { return _fullDataIndices.get(); }
+
+    uint32_t * getFullDataIndices() { return _fullDataIndices.get(); }
+
+protected:
+    SVMSharedCacheSubsetTable(algorithmFPType * const ptr, const size_t nFeatures, const size_t nRows,
+                              const SVMSharedKernelCachePtr<algorithmFPType, cpu> & cache, services::Status & status)
+        : HomogenNumericTableCPU<algorithmFPType, cpu>(ptr, nFeatures, nRows, status), _cache(cache), _fullDataIndices(nRows)
+    {}
+
+    const SVMSharedKernelCachePtr<algorithmFPType, cpu> _cache;
+    TArray<uint32_t, cpu> _fullDataIndices;
+};
+
+} // namespace internal
+} // namespace training
+} // namespace svm
+} // namespace algorithms
+} // namespace daal
+
+#endif
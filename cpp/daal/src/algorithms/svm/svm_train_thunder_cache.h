@@ -29,6 +29,7 @@
 #include "src/data_management/service_micro_table.h"
 #include "src/data_management/service_numeric_table.h"
 #include "src/algorithms/svm/svm_train_cache.h"
+#include "src/algorithms/svm/svm_train_shared_cache.h"
 #include "src/externals/service_service.h"
 #include "data_management/data/soa_numeric_table.h"
 
@@ -88,9 +89,10 @@ public:
 
     static SVMCachePtr<thunder, algorithmFPType, cpu> create(const size_t cacheSize, const size_t nSize, const size_t lineSize,
                                                              const NumericTablePtr & xTable, const kernel_function::KernelIfacePtr & kernel,
-                                                             services::Status & status)
+                                                             services::Status & status,
+                                                             const SVMSharedCacheSubsetIface<algorithmFPType, cpu> * sharedSubset = nullptr)
     {
-        services::SharedPtr<thisType> res = services::SharedPtr<thisType>(new thisType(cacheSize, lineSize, xTable, kernel));
+        services::SharedPtr<thisType> res = services::SharedPtr<thisType>(new thisType(cacheSize, lineSize, xTable, kernel, sharedSubset));
         if (!res)
         {
             status.add(ErrorMemoryAllocationFailed);
@@ -114,6 +116,8 @@ public:
         _cache.reset();
         _cacheData.reset();
         _soaData.reset();
+        _sharedIndex.reset();
+        _sharedRows.reset();
         return services::Status();
     }
 
@@ -151,6 +155,10 @@ public:
                 }
             }
         }
+        if (nIndicesForKernel != 0 && _sharedSubset)
+        {
+            DAAL_CHECK_STATUS(status, copySharedKernel(nIndicesForKernel));
+        }
         if (nIndicesForKernel != 0)
         {
             DAAL_CHECK_STATUS(status, computeKernel(nIndicesForKernel, _kernelOriginalIndex.get()));
@@ -161,10 +169,52 @@ public:
     }
 
 protected:
-    SVMCache(const size_t cacheSize, const size_t lineSize, const NumericTablePtr & xTable, const kernel_function::KernelIfacePtr & kernel)
-        : super(cacheSize, lineSize, kernel), _lruCache(cacheSize), _xTable(xTable)
+    SVMCache(const size_t cacheSize, const size_t lineSize, const NumericTablePtr & xTable, const kernel_function::KernelIfacePtr & kernel,
+             const SVMSharedCacheSubsetIface<algorithmFPType, cpu> * sharedSubset)
+        : super(cacheSize, lineSize, kernel), _lruCache(cacheSize), _xTable(xTable), _sharedSubset(sharedSubset)
     {}
 
+    /* Fills the cache lines from the kernel rows of the full data set stored in the shared cache.
+       On exit nWorkElements is the number of lines that are not available in the shared cache and are left in the front of the work arrays */
+    services::Status copySharedKernel(size_t & nWorkElements)
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(cache.copySharedKernel);
+        services::Status status;
+        SVMSharedKernelCache<algorithmFPType, cpu> * sharedCache = _sharedSubset->getSharedKernelCache();
+        const uint32_t * const fullDataIndices                   = _sharedSubset->getFullDataIndices();
+
+        for (size_t i = 0; i < nWorkElements; ++i)
+        {
+            _sharedIndex[i] = fullDataIndices[_kernelOriginalIndex[i]];
+        }
+        DAAL_CHECK_STATUS(status, sharedCache->getRows(_sharedIndex.get(), nWorkElements, _sharedRows.get()));
+
+        const size_t lineSize = _lineSize;
+        daal::threader_for(nWorkElements, nWorkElements, [&](const size_t i) {
+            const algorithmFPType * const row = _sharedRows[i];
+            if (!row) return;
+            algorithmFPType * const cachei = _cache[_kernelIndex[i]];
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < lineSize; ++j)
+            {
+                cachei[j] = row[fullDataIndices[j]];
+            }
+        });
+        sharedCache->releaseRows(_sharedRows.get(), nWorkElements);
+
+        size_t nLeft = 0;
+        for (size_t i = 0; i < nWorkElements; ++i)
+        {
+            if (_sharedRows[i]) continue;
+            _kernelIndex[nLeft]         = _kernelIndex[i];
+            _kernelOriginalIndex[nLeft] = _kernelOriginalIndex[i];
+            ++nLeft;
+        }
+        nWorkElements = nLeft;
+        return status;
+    }
+
     services::Status computeKernel(const size_t nWorkElements, const uint32_t * indices)
     {
         services::Status status;
@@ -202,6 +252,13 @@ protected:
         DAAL_CHECK_MALLOC(_kernelIndex.get());
         _kernelOriginalIndex.reset(nSize);
         DAAL_CHECK_MALLOC(_kernelOriginalIndex.get());
+        if (_sharedSubset)
+        {
+            _sharedIndex.reset(nSize);
+            DAAL_CHECK_MALLOC(_sharedIndex.get());
+            _sharedRows.reset(nSize);
+            DAAL_CHECK_MALLOC(_sharedRows.get());
+        }
 
         const size_t bytes            = _lineSize * sizeof(algorithmFPType);
         const size_t alignedBytesSize = bytes & 63 ? (bytes & (~63)) + 64 : bytes;  // nearest number aligned on 64
@@ -241,6 +298,9 @@ protected:
     TArrayScalable<algorithmFPType *, cpu> _cache;
     TArrayScalable<algorithmFPType, cpu> _cacheData;
     TArrayScalable<algorithmFPType *, cpu> _soaData;
+    const SVMSharedCacheSubsetIface<algorithmFPType, cpu> * _sharedSubset;
+    TArray<uint32_t, cpu> _sharedIndex;
+    TArray<const algorithmFPType *, cpu> _sharedRows;
 };
 
 } // namespace internal
@@ -76,6 +76,9 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::compute(const Nume
 {
     DAAL_ITTNOTIFY_SCOPED_TASK(COMPUTE);
 
+    /* Kernel buffers allocated on every iteration of the solver are reused */
+    services::internal::ScratchPoolScope scratchPoolScope;
+
     services::Status status;
 
     const algorithmFPType C(svmPar->C);
@@ -169,9 +172,19 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::compute(const Nume
 
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nVectors * sizeof(algorithmFPType), nVectors);
 
+    /* Kernel rows of the training data that is a subset of a larger data set may be shared with other training tasks */
+    using SharedSubsetIface                = SVMSharedCacheSubsetIface<algorithmFPType, cpu>;
+    const SharedSubsetIface * sharedSubset = dynamic_cast<const SharedSubsetIface *>(xTable.get());
+    if (sharedSubset && !sharedSubset->getSharedKernelCache()) sharedSubset = nullptr;
+
     size_t defaultCacheSize = services::internal::min<cpu, size_t>(nVectors, cacheSize / nVectors / sizeof(algorithmFPType));
     defaultCacheSize        = services::internal::max<cpu, size_t>(nWS, defaultCacheSize);
-    auto cachePtr           = SVMCache<thunder, lruCache, algorithmFPType, cpu>::create(defaultCacheSize, nWS, nVectors, xTable, kernel, status);
+    if (sharedSubset)
+    {
+        /* The memory for kernel values is accounted in the shared cache, the local one holds the working set only */
+        defaultCacheSize = nWS;
+    }
+    auto cachePtr = SVMCache<thunder, lruCache, algorithmFPType, cpu>::create(defaultCacheSize, nWS, nVectors, xTable, kernel, status, sharedSubset);
     DAAL_CHECK_STATUS_VAR(status);
 
     _blockSizeWS = services::internal::min<cpu, algorithmFPType>(nWS, 256);
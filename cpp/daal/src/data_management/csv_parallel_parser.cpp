@@ -0,0 +1,372 @@
+/** file csv_parallel_parser.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "data_management/data_source/internal/csv_parallel_parser.h"
+#include "services/daal_memory.h"
+#include "services/env_detect.h"
+#include "src/externals/service_dispatch.h"
+#include "src/services/service_data_utils.h"
+#include "src/services/service_utils.h"
+#include "src/services/service_defines.h"
+#include "src/services/service_arrays.h"
+#include "src/threading/threading.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/data_management/csv_parser_cpu.h"
+#include "src/algorithms/service_error_handling.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+/* Minimal size of the text in bytes processed by one task */
+const size_t minCsvChunkSize = 1048576;
+/* Number of chunks per thread, more than one to balance the load between threads */
+const size_t csvChunksPerThread = 4;
+
+template <CpuType cpu>
+DAAL_FORCEINLINE const char * findCsvLineEnd(const char * begin, const char * end)
+{
+    return findCsvSymbol<cpu>(begin, end, '\n');
+}
+
+/* Returns pointer to the end of the line content, i.e. trailing '\r' symbols are excluded */
+DAAL_FORCEINLINE const char * trimCsvLine(const char * begin, const char * end)
+{
+    while (end > begin && end[-1] == '\r')
+    {
+        --end;
+    }
+    return end;
+}
+
+/*
+ * Counts the lines of the text that precede the first empty line.
+ * Returns the position right after the empty line in blockEnd, or NULL if the text has no empty lines
+ */
+template <CpuType cpu>
+size_t countCsvRows(const char * begin, const char * end, const char *& blockEnd)
+{
+    size_t nRows = 0;
+    blockEnd     = NULL;
+    while (begin < end)
+    {
+        const char * lineEnd = findCsvLineEnd<cpu>(begin, end);
+        const char * next    = (lineEnd < end) ? lineEnd + 1 : end;
+        if (trimCsvLine(begin, lineEnd) == begin)
+        {
+            blockEnd = next;
+            break;
+        }
+        ++nRows;
+        begin = next;
+    }
+    return nRows;
+}
+
+/* Returns the position right after the nRows-th line of the text */
+template <CpuType cpu>
+const char * skipCsvRows(const char * begin, const char * end, size_t nRows)
+{
+    for (; nRows > 0 && begin < end; --nRows)
+    {
+        const char * lineEnd = findCsvLineEnd<cpu>(begin, end);
+        begin                = (lineEnd < end) ? lineEnd + 1 : end;
+    }
+    return begin;
+}
+
+/* Basic statistics of the rows parsed by one thread */
+template <CpuType cpu>
+class CsvRowsStatistics
+{
+public:
+    DAAL_NEW_DELETE();
+
+    explicit CsvRowsStatistics(size_t nColumns) : _nColumns(nColumns), _values(4 * nColumns)
+    {
+        if (!isValid())
+        {
+            return;
+        }
+        for (size_t j = 0; j < _nColumns; j++)
+        {
+            minimum()[j]    = services::internal::MaxVal<double>::get();
+            maximum()[j]    = -services::internal::MaxVal<double>::get();
+            sum()[j]        = 0.0;
+            sumSquares()[j] = 0.0;
+        }
+    }
+
+    bool isValid() const { return _values.get() != NULL; }
+
+    double * minimum() { return _values.get(); }
+    double * maximum() { return _values.get() + _nColumns; }
+    double * sum() { return _values.get() + 2 * _nColumns; }
+    double * sumSquares() { return _values.get() + 3 * _nColumns; }
+
+    template <typename FPType>
+    void update(const FPType * row)
+    {
+        double * min   = minimum();
+        double * max   = maximum();
+        double * s     = sum();
+        double * sumSq = sumSquares();
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < _nColumns; j++)
+        {
+            const double value = row[j];
+            min[j]             = (value < min[j]) ? value : min[j];
+            max[j]             = (value > max[j]) ? value : max[j];
+            s[j] += value;
+            sumSq[j] += value * value;
+        }
+    }
+
+    void combine(CsvRowsStatistics & other)
+    {
+        double * min   = minimum();
+        double * max   = maximum();
+        double * s     = sum();
+        double * sumSq = sumSquares();
+        for (size_t j = 0; j < _nColumns; j++)
+        {
+            min[j] = (other.minimum()[j] < min[j]) ? other.minimum()[j] : min[j];
+            max[j] = (other.maximum()[j] > max[j]) ? other.maximum()[j] : max[j];
+            s[j] += other.sum()[j];
+            sumSq[j] += other.sumSquares()[j];
+        }
+    }
+
+private:
+    const size_t _nColumns;
+    services::internal::TArray<double, cpu> _values;
+};
+
+template <CpuType cpu>
+services::Status storeCsvStatistics(NumericTable & nt, NumericTable::BasicStatisticsId id, const double * values, size_t nColumns)
+{
+    NumericTablePtr statTable = nt.basicStatistics.get(id);
+    if (!statTable || statTable->getNumberOfColumns() != nColumns)
+    {
+        return services::Status();
+    }
+
+    daal::internal::WriteOnlyRows<double, cpu> statRows(*statTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(statRows);
+    double * stat = statRows.get();
+    for (size_t j = 0; j < nColumns; j++)
+    {
+        stat[j] = values[j];
+    }
+    return services::Status();
+}
+
+template <CpuType cpu>
+services::Status splitCsvIntoChunksImpl(const char * text, size_t size, size_t maxRows, CsvChunks & chunks, size_t & nBytes)
+{
+    const size_t nThreads = threader_get_threads_number();
+    size_t nChunks        = services::internal::min<cpu, size_t>(nThreads * csvChunksPerThread, size / minCsvChunkSize);
+    nChunks               = services::internal::max<cpu, size_t>(nChunks, 1);
+
+    chunks.byteOffsets.clear();
+    chunks.rowOffsets.clear();
+    DAAL_CHECK_MALLOC(chunks.byteOffsets.resize(nChunks + 1) && chunks.rowOffsets.resize(nChunks + 1));
+
+    /* Chunk borders are moved forward to the beginning of the next line */
+    chunks.byteOffsets.push_back(0);
+    for (size_t i = 1; i < nChunks; i++)
+    {
+        const size_t target = services::internal::max<cpu, size_t>(i * (size / nChunks), chunks.byteOffsets[i - 1] + 1);
+        const size_t border = (target < size) ? findCsvLineEnd<cpu>(text + target - 1, text + size) - text + 1 : size;
+        chunks.byteOffsets.push_back(services::internal::min<cpu, size_t>(border, size));
+    }
+    chunks.byteOffsets.push_back(size);
+
+    chunks.rowOffsets.push_back(0);
+    for (size_t i = 0; i < nChunks; i++)
+    {
+        chunks.rowOffsets.push_back(0);
+    }
+
+    services::internal::TArray<const char *, cpu> blockEnds(nChunks);
+    DAAL_CHECK_MALLOC(blockEnds.get());
+
+    size_t * rowOffsets        = chunks.rowOffsets.data();
+    const size_t * byteOffsets = chunks.byteOffsets.data();
+    const char ** chunkEnds    = blockEnds.get();
+    daal::threader_for(nChunks, nChunks, [&](size_t iChunk) {
+        rowOffsets[iChunk + 1] = countCsvRows<cpu>(text + byteOffsets[iChunk], text + byteOffsets[iChunk + 1], chunkEnds[iChunk]);
+    });
+
+    /* The partition ends at the first empty line or right after the maxRows-th line, whichever comes first */
+    nBytes       = size;
+    size_t iLast = nChunks - 1;
+    for (size_t i = 0; i < nChunks; i++)
+    {
+        rowOffsets[i + 1] += rowOffsets[i];
+        if (rowOffsets[i + 1] > maxRows)
+        {
+            nBytes            = skipCsvRows<cpu>(text + byteOffsets[i], text + byteOffsets[i + 1], maxRows - rowOffsets[i]) - text;
+            rowOffsets[i + 1] = maxRows;
+            iLast             = i;
+            break;
+        }
+        if (chunkEnds[i])
+        {
+            nBytes = chunkEnds[i] - text;
+            iLast  = i;
+            break;
+        }
+    }
+
+    chunks.byteOffsets[iLast + 1] = nBytes;
+    for (size_t i = iLast + 1; i < nChunks; i++)
+    {
+        chunks.byteOffsets.erase(iLast + 2);
+        chunks.rowOffsets.erase(iLast + 2);
+    }
+
+    return services::Status();
+}
+
+template <CpuType cpu>
+services::Status parseCsvChunksImpl(const char * text, const CsvChunks & chunks, char delimiter, const services::Collection<size_t> & columnIndices,
+                                    NumericTable & nt, size_t rowOffset)
+{
+    typedef DAAL_DATA_TYPE FPType;
+
+    const size_t nChunks  = chunks.getNumberOfChunks();
+    const size_t nRows    = chunks.getNumberOfRows();
+    const size_t nColumns = nt.getNumberOfColumns();
+    const size_t nTokens  = columnIndices.size();
+
+    DAAL_CHECK(rowOffset + nRows <= nt.getNumberOfRows(), services::ErrorIncorrectDataRange);
+    for (size_t i = 0; i < nTokens; i++)
+    {
+        DAAL_CHECK(columnIndices[i] == csvSkippedToken || columnIndices[i] < nColumns, services::ErrorIncorrectNumberOfColumns);
+    }
+
+    if (nRows == 0)
+    {
+        return services::Status();
+    }
+
+    const size_t * rowOffsets  = chunks.rowOffsets.data();
+    const size_t * byteOffsets = chunks.byteOffsets.data();
+    const size_t * tokenColumn = columnIndices.data();
+
+    daal::SafeStatus safeStat;
+    daal::static_tls<CsvRowsStatistics<cpu> *> tlsStatistics([=, &safeStat]() {
+        CsvRowsStatistics<cpu> * statistics = new CsvRowsStatistics<cpu>(nColumns);
+        if (!statistics || !statistics->isValid())
+        {
+            safeStat.add(services::ErrorMemoryAllocationFailed);
+            delete statistics;
+            return (CsvRowsStatistics<cpu> *)NULL;
+        }
+        return statistics;
+    });
+
+    daal::static_threader_for(nChunks, [&](size_t iChunk, size_t tid) {
+        const size_t nChunkRows = rowOffsets[iChunk + 1] - rowOffsets[iChunk];
+        if (nChunkRows == 0)
+        {
+            return;
+        }
+
+        CsvRowsStatistics<cpu> * statistics = tlsStatistics.local(tid);
+        DAAL_CHECK_MALLOC_THR(statistics);
+
+        daal::internal::WriteOnlyRows<FPType, cpu> rows(nt, rowOffset + rowOffsets[iChunk], nChunkRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(rows);
+        FPType * row = rows.get();
+
+        const char * begin = text + byteOffsets[iChunk];
+        const char * end   = text + byteOffsets[iChunk + 1];
+        for (size_t iRow = 0; iRow < nChunkRows; iRow++)
+        {
+            const char * lineEnd = findCsvLineEnd<cpu>(begin, end);
+            for (size_t j = 0; j < nColumns; j++)
+            {
+                row[j] = FPType(0);
+            }
+            parseCsvLine<FPType, cpu>(begin, trimCsvLine(begin, lineEnd), delimiter, tokenColumn, nTokens, row);
+            statistics->update(row);
+
+            row += nColumns;
+            begin = lineEnd + 1;
+        }
+    });
+
+    CsvRowsStatistics<cpu> * total = NULL;
+    tlsStatistics.reduce([&](CsvRowsStatistics<cpu> * statistics) {
+        if (!total)
+        {
+            total = statistics;
+            return;
+        }
+        total->combine(*statistics);
+        delete statistics;
+    });
+
+    services::Status status = safeStat.detach();
+    if (status && total)
+    {
+        status |= storeCsvStatistics<cpu>(nt, NumericTable::minimum, total->minimum(), nColumns);
+        status |= storeCsvStatistics<cpu>(nt, NumericTable::maximum, total->maximum(), nColumns);
+        status |= storeCsvStatistics<cpu>(nt, NumericTable::sum, total->sum(), nColumns);
+        status |= storeCsvStatistics<cpu>(nt, NumericTable::sumSquares, total->sumSquares(), nColumns);
+    }
+    delete total;
+
+    return status;
+}
+
+services::Status splitCsvIntoChunks(const char * text, size_t size, size_t maxRows, CsvChunks & chunks, size_t & nBytes)
+{
+    DAAL_CHECK(text || size == 0, services::ErrorNullPtr);
+#define DAAL_SPLIT_CSV_INTO_CHUNKS(cpuId, ...) splitCsvIntoChunksImpl<cpuId>(__VA_ARGS__);
+    DAAL_DISPATCH_FUNCTION_BY_CPU_SAFE(DAAL_SPLIT_CSV_INTO_CHUNKS, text, size, maxRows, chunks, nBytes);
+#undef DAAL_SPLIT_CSV_INTO_CHUNKS
+    return st;
+}
+
+services::Status parseCsvChunks(const char * text, const CsvChunks & chunks, char delimiter, const services::Collection<size_t> & columnIndices,
+                                NumericTable & nt, size_t rowOffset)
+{
+    DAAL_CHECK(text || chunks.getNumberOfRows() == 0, services::ErrorNullPtr);
+#define DAAL_PARSE_CSV_CHUNKS(cpuId, ...) parseCsvChunksImpl<cpuId>(__VA_ARGS__);
+    DAAL_DISPATCH_FUNCTION_BY_CPU_SAFE(DAAL_PARSE_CSV_CHUNKS, text, chunks, delimiter, columnIndices, nt, rowOffset);
+#undef DAAL_PARSE_CSV_CHUNKS
+    return st;
+}
+
+void parseCsvRow(const char * text, size_t size, char delimiter, const functionT * funcList, const FeatureAuxData * auxVect, size_t nTokens,
+                 functionT contFunc, DAAL_DATA_TYPE * row)
+{
+    const CsvFeatureColumns columns = { funcList, auxVect, contFunc };
+#define DAAL_PARSE_CSV_ROW(cpuId, ...) parseCsvLine<DAAL_DATA_TYPE, cpuId>(__VA_ARGS__);
+    DAAL_DISPATCH_FUNCTION_BY_CPU(DAAL_PARSE_CSV_ROW, text, text + size, delimiter, columns, nTokens, row);
+#undef DAAL_PARSE_CSV_ROW
+}
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
@@ -0,0 +1,50 @@
+/* file: csv_parser_avx512_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+ * Contains optimizations for AVX512.
+ * The avx512 CPU type implies AVX512BW, but the file may be compiled with flags of an older
+ * instruction set, so the instructions are enabled for the function explicitly
+*/
+
+#if defined(__AVX512BW__) || !defined(__GNUC__)
+    #define DAAL_CSV_AVX512BW_TARGET
+#else
+    #define DAAL_CSV_AVX512BW_TARGET __attribute__((target("avx512f,avx512bw")))
+#endif
+
+template <>
+DAAL_CSV_AVX512BW_TARGET const char * findCsvSymbol<avx512>(const char * begin, const char * end, char symbol)
+{
+    const __m512i pattern = _mm512_set1_epi8(symbol);
+    for (; begin + 64 <= end; begin += 64)
+    {
+        const DAAL_UINT64 mask = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512((const void *)begin), pattern);
+        if (mask)
+        {
+            const unsigned int lowMask = (unsigned int)mask;
+            return begin + (lowMask ? lowestSetBit<avx512>(lowMask) : 32 + lowestSetBit<avx512>((unsigned int)(mask >> 32)));
+        }
+    }
+    while (begin < end && *begin != symbol)
+    {
+        ++begin;
+    }
+    return begin;
+}
+
+#undef DAAL_CSV_AVX512BW_TARGET
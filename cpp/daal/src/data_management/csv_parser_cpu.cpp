@@ -0,0 +1,229 @@
+/** file csv_parser_cpu.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Tokenization of CSV lines and conversion of the tokens to numbers.
+//  The file is compiled for every CPU, so the width of the symbol search
+//  is selected by the instruction set enabled for the current compilation.
+//  The AVX-512 search is the specialization for the avx512 CPU type.
+//--
+*/
+
+#include "src/data_management/csv_parser_cpu.h"
+#include "data_management/data_source/internal/csv_parallel_parser.h"
+#include "services/daal_memory.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <immintrin.h>
+#endif
+#if defined(_WIN32) || defined(_WIN64)
+    #include <intrin.h>
+#endif
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+/* Maximal length of a token that is converted to a number by the generic routine */
+const size_t maxCsvNumericTokenLength = 255;
+
+/* Maximal mantissa and decimal exponent for which a float is computed exactly with one rounding */
+const DAAL_UINT64 maxExactFloatMantissa = (DAAL_UINT64)1 << 24;
+const int maxExactFloatExponent         = 10;
+
+/* Maximal number of mantissa digits accumulated without overflow */
+const int maxCsvMantissaDigits = 19;
+
+const float exactFloatPowersOf10[maxExactFloatExponent + 1] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+
+/* Returns the index of the lowest set bit of the non-zero mask */
+template <CpuType cpu>
+DAAL_FORCEINLINE size_t lowestSetBit(unsigned int mask)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return index;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+template <CpuType cpu>
+const char * findCsvSymbol(const char * begin, const char * end, char symbol)
+{
+#if defined(__AVX2__)
+    const __m256i pattern = _mm256_set1_epi8(symbol);
+    for (; begin + 32 <= end; begin += 32)
+    {
+        const unsigned int mask = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)begin), pattern));
+        if (mask)
+        {
+            return begin + lowestSetBit<cpu>(mask);
+        }
+    }
+#elif defined(__SSE2__) || defined(_M_X64)
+    const __m128i pattern = _mm_set1_epi8(symbol);
+    for (; begin + 16 <= end; begin += 16)
+    {
+        const unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)begin), pattern));
+        if (mask)
+        {
+            return begin + lowestSetBit<cpu>(mask);
+        }
+    }
+#endif
+    while (begin < end && *begin != symbol)
+    {
+        ++begin;
+    }
+    return begin;
+}
+
+#if (__CPUID__(DAAL_CPU) == __avx512__) && (defined(_M_AMD64) || defined(__amd64) || defined(__x86_64) || defined(__x86_64__))
+    #include "src/data_management/csv_parser_avx512_impl.i"
+#endif
+
+/*
+ * Converts the token to float if it is a plain decimal number whose mantissa and exponent are small enough
+ * for the result to be computed with one correctly rounded operation. Returns false otherwise
+ */
+template <CpuType cpu>
+DAAL_FORCEINLINE bool convertCsvTokenFast(const char * begin, const char * end, float & value)
+{
+    const char * pos    = begin;
+    const bool negative = (pos < end && *pos == '-');
+    if (pos < end && (*pos == '-' || *pos == '+'))
+    {
+        ++pos;
+    }
+
+    DAAL_UINT64 mantissa = 0;
+    int nDigits          = 0;
+    int nMantissaDigits  = 0;
+    int exponent         = 0;
+    for (; pos < end && unsigned(*pos - '0') < 10; ++pos, ++nDigits)
+    {
+        mantissa = mantissa * 10 + unsigned(*pos - '0');
+        nMantissaDigits += (mantissa != 0);
+    }
+    if (pos < end && *pos == '.')
+    {
+        for (++pos; pos < end && unsigned(*pos - '0') < 10; ++pos, ++nDigits)
+        {
+            mantissa = mantissa * 10 + unsigned(*pos - '0');
+            nMantissaDigits += (mantissa != 0);
+            --exponent;
+        }
+    }
+    if (nDigits == 0 || nMantissaDigits > maxCsvMantissaDigits)
+    {
+        return false;
+    }
+
+    if (pos < end && (*pos == 'e' || *pos == 'E'))
+    {
+        ++pos;
+        const bool negativeExponent = (pos < end && *pos == '-');
+        if (pos < end && (*pos == '-' || *pos == '+'))
+        {
+            ++pos;
+        }
+        int explicitExponent      = 0;
+        const char * exponentBegin = pos;
+        for (; pos < end && unsigned(*pos - '0') < 10 && pos - exponentBegin < 4; ++pos)
+        {
+            explicitExponent = explicitExponent * 10 + (*pos - '0');
+        }
+        if (pos == exponentBegin)
+        {
+            return false;
+        }
+        exponent += negativeExponent ? -explicitExponent : explicitExponent;
+    }
+
+    if (pos != end || mantissa > maxExactFloatMantissa || exponent > maxExactFloatExponent || exponent < -maxExactFloatExponent)
+    {
+        return false;
+    }
+
+    value = (float)mantissa;
+    value = (exponent < 0) ? value / exactFloatPowersOf10[-exponent] : value * exactFloatPowersOf10[exponent];
+    value = negative ? -value : value;
+    return true;
+}
+
+template <typename FPType, CpuType cpu>
+DAAL_FORCEINLINE FPType convertCsvToken(const char * begin, const char * end)
+{
+    if (begin == end)
+    {
+        return FPType(0);
+    }
+
+    float value;
+    if (convertCsvTokenFast<cpu>(begin, end, value))
+    {
+        return static_cast<FPType>(value);
+    }
+
+    /* The text is not null-terminated, so the token is copied to a local buffer */
+    char buffer[maxCsvNumericTokenLength + 1];
+    const size_t length = ((size_t)(end - begin) < maxCsvNumericTokenLength) ? (size_t)(end - begin) : maxCsvNumericTokenLength;
+    for (size_t i = 0; i < length; i++)
+    {
+        buffer[i] = begin[i];
+    }
+    buffer[length] = '\0';
+    return static_cast<FPType>(services::daal_string_to_float(buffer, 0));
+}
+
+template <typename FPType, CpuType cpu, typename ColumnIndices>
+void parseCsvLine(const char * begin, const char * end, char delimiter, const ColumnIndices & columnIndices, size_t nTokens, FPType * row)
+{
+    for (size_t iToken = 0; iToken < nTokens; iToken++)
+    {
+        const char * tokenEnd = findCsvSymbol<cpu>(begin, end, delimiter);
+
+        const size_t column = columnIndices[iToken];
+        if (column != csvSkippedToken)
+        {
+            row[column] = convertCsvToken<FPType, cpu>(begin, tokenEnd);
+        }
+        /* The line ending with a delimiter has the empty last token */
+        if (tokenEnd == end)
+        {
+            break;
+        }
+        begin = tokenEnd + 1;
+    }
+}
+
+template const char * findCsvSymbol<DAAL_CPU>(const char * begin, const char * end, char symbol);
+template void parseCsvLine<float, DAAL_CPU, const size_t *>(const char * begin, const char * end, char delimiter, const size_t * const & columnIndices,
+                                                           size_t nTokens, float * row);
+template void parseCsvLine<double, DAAL_CPU, const size_t *>(const char * begin, const char * end, char delimiter, const size_t * const & columnIndices,
+                                                            size_t nTokens, double * row);
+template void parseCsvLine<DAAL_DATA_TYPE, DAAL_CPU, CsvFeatureColumns>(const char * begin, const char * end, char delimiter,
+                                                                        const CsvFeatureColumns & columnIndices, size_t nTokens, DAAL_DATA_TYPE * row);
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
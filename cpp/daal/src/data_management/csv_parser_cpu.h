@@ -0,0 +1,53 @@
+/* file: csv_parser_cpu.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef __KERNEL_DATA_MANAGEMENT_CSV_PARSER_CPU_H__
+#define __KERNEL_DATA_MANAGEMENT_CSV_PARSER_CPU_H__
+
+#include "src/services/service_defines.h"
+#include "data_management/data_source/csv_feature_manager.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+/* Returns pointer to the first occurrence of the symbol in [begin, end) or end if there is no such symbol */
+template <CpuType cpu>
+const char * findCsvSymbol(const char * begin, const char * end, char symbol);
+
+/* Columns of the tokens given by the functions of the features of CSVFeatureManager, only the continuous tokens are loaded */
+struct CsvFeatureColumns
+{
+    const functionT * funcList;
+    const FeatureAuxData * auxVect;
+    functionT contFunc;
+
+    size_t operator[](size_t iToken) const { return (funcList[iToken] == contFunc) ? auxVect[iToken].idx : csvSkippedToken; }
+};
+
+/* Converts the tokens of the line [begin, end) and stores them into the row at the positions given by columnIndices,
+   either the array of the column indices or CsvFeatureColumns */
+template <typename FPType, CpuType cpu, typename ColumnIndices>
+void parseCsvLine(const char * begin, const char * end, char delimiter, const ColumnIndices & columnIndices, size_t nTokens, FPType * row);
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
+
+#endif
@@ -0,0 +1,236 @@
+/** file data_block_prefetcher.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "data_management/data_source/data_block_prefetcher.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "src/algorithms/service_threading.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+/*
+ * Blocks are loaded and consumed in the same order, so the tables form a ring:
+ * block i is loaded into the table i % nTables. The loading task runs in the task group of the threading layer
+ * and stops when all tables hold blocks that are not given back by the caller yet, next() restarts it.
+ * The caller waits for the task group only when no loaded block is available, so the waiting thread can execute
+ * the task itself. The sequential threading layer runs the task inline, and the blocks are loaded on demand
+ */
+class DataBlockPrefetcher::Impl
+{
+public:
+    Impl(DataSource & dataSource, size_t blockRows)
+        : _dataSource(dataSource),
+          _blockRows(blockRows),
+          _nLoaded(0),
+          _nTaken(0),
+          _nReleased(0),
+          _loading(false),
+          _finished(false),
+          _stopped(false)
+    {}
+
+    ~Impl()
+    {
+        {
+            AUTOLOCK(_mutex);
+            _stopped = true;
+        }
+        _loader.wait();
+    }
+
+    services::Status setTables(const services::Collection<NumericTablePtr> & tables)
+    {
+        if (_blockRows == 0) return services::Status(services::ErrorIncorrectParameter);
+        if (tables.size() < 2) return services::Status(services::ErrorIncorrectNumberOfElementsInInputCollection);
+        for (size_t i = 0; i < tables.size(); ++i)
+        {
+            if (!tables[i]) return services::Status(services::ErrorNullInputNumericTable);
+        }
+        _tables = tables;
+        return services::Status();
+    }
+
+    services::Status allocateTables(size_t nTables)
+    {
+        services::Status s;
+        const size_t nColumns = _dataSource.getNumericTableNumberOfColumns();
+        s |= _dataSource.status();
+        if (!s) return s;
+
+        services::Collection<NumericTablePtr> tables;
+        for (size_t i = 0; i < nTables; ++i)
+        {
+            NumericTablePtr table = HomogenNumericTable<DAAL_DATA_TYPE>::create(nColumns, 0, NumericTable::notAllocate, &s);
+            if (!s) return s;
+            tables.push_back(table);
+        }
+        return setTables(tables);
+    }
+
+    void start()
+    {
+        {
+            AUTOLOCK(_mutex);
+            _loading = true;
+        }
+        runLoader();
+    }
+
+    NumericTablePtr next()
+    {
+        bool restart = false;
+        {
+            AUTOLOCK(_mutex);
+            if (_nReleased < _nTaken) ++_nReleased;
+            restart  = !_loading && !_finished;
+            _loading = _loading || restart;
+        }
+        if (restart) runLoader();
+
+        for (;;)
+        {
+            {
+                AUTOLOCK(_mutex);
+                if (_nTaken < _nLoaded) return _tables[_nTaken++ % _tables.size()];
+                if (_finished) return NumericTablePtr();
+            }
+            /* The loading task stops only when a block is available or loading is finished */
+            _loader.wait();
+        }
+    }
+
+    services::Status status() const
+    {
+        AUTOLOCK(_mutex);
+        return _status;
+    }
+
+    void setStatus(const services::Status & s)
+    {
+        _status   = s;
+        _finished = !s;
+    }
+
+private:
+    struct LoadTask
+    {
+        LoadTask(Impl & impl) : _impl(impl) {}
+        void operator()() { _impl.load(); }
+        Impl & _impl;
+    };
+
+    void runLoader()
+    {
+        LoadTask task(*this);
+        _loader.run(task);
+    }
+
+    void load()
+    {
+        const size_t nTables = _tables.size();
+        for (;;)
+        {
+            size_t iBlock = 0;
+            {
+                AUTOLOCK(_mutex);
+                if (_stopped || _nLoaded - _nReleased >= nTables)
+                {
+                    _loading = false;
+                    return;
+                }
+                iBlock = _nLoaded;
+            }
+
+            NumericTable * const table = _tables[iBlock % nTables].get();
+            size_t nRows               = 0;
+            services::Status s;
+            try
+            {
+                nRows = _dataSource.loadDataBlock(_blockRows, table);
+                s |= _dataSource.status();
+            }
+            catch (...)
+            {
+                s |= services::Status(services::ErrorOnFileRead);
+            }
+
+            {
+                AUTOLOCK(_mutex);
+                _status |= s;
+                if (!s || nRows == 0)
+                {
+                    _finished = true;
+                    _loading  = false;
+                    return;
+                }
+                ++_nLoaded;
+            }
+        }
+    }
+
+    DataSource & _dataSource;
+    const size_t _blockRows;
+    services::Collection<NumericTablePtr> _tables;
+
+    mutable daal::Mutex _mutex;
+    daal::task_group _loader;
+
+    size_t _nLoaded;   /* Number of blocks loaded by the loading task */
+    size_t _nTaken;    /* Number of blocks returned by next() */
+    size_t _nReleased; /* Number of blocks given back to the ring */
+    bool _loading;     /* The loading task is scheduled or running */
+    bool _finished;
+    bool _stopped;
+    services::Status _status;
+};
+
+DataBlockPrefetcher::DataBlockPrefetcher(DataSource & dataSource, size_t blockRows, const services::Collection<NumericTablePtr> & tables)
+    : _impl(new Impl(dataSource, blockRows))
+{
+    const services::Status s = _impl->setTables(tables);
+    _impl->setStatus(s);
+    if (s) _impl->start();
+}
+
+DataBlockPrefetcher::DataBlockPrefetcher(DataSource & dataSource, size_t blockRows, size_t nTables) : _impl(new Impl(dataSource, blockRows))
+{
+    const services::Status s = _impl->allocateTables(nTables);
+    _impl->setStatus(s);
+    if (s) _impl->start();
+}
+
+DataBlockPrefetcher::~DataBlockPrefetcher()
+{
+    delete _impl;
+}
+
+NumericTablePtr DataBlockPrefetcher::next()
+{
+    return _impl->next();
+}
+
+services::Status DataBlockPrefetcher::status() const
+{
+    return _impl->status();
+}
+
+} // namespace interface1
+} // namespace data_management
+} // namespace daal
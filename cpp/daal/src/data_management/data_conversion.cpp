@@ -25,6 +25,7 @@
 #include "src/externals/service_dispatch.h"
 #include "src/data_management/data_conversion_cpu.h"
 #include "data_management/data/internal/conversion.h"
+#include "src/threading/threading.h"
 
 namespace daal
 {
@@ -177,6 +178,48 @@ DAAL_EXPORT vectorStrideConvertFuncType getVectorStrideDownCast(int idx1, int id
     return table[idx1][idx2];
 }
 
+DAAL_EXPORT void convertColumnChunksToRows(const ColumnChunk * chunks, size_t nChunks, size_t nRows, size_t nColumns, ConversionDataType dstType,
+                                           void * dst)
+{
+    const size_t dstTypeSize  = (dstType == DAAL_DOUBLE ? sizeof(double) : sizeof(float));
+    const size_t dstRowStride = nColumns * dstTypeSize;
+
+    /* Every block of rows looks through all the chunks, so the number of blocks is kept proportional to the number of threads */
+    const size_t nThreads     = threader_get_threads_number();
+    const size_t minBlockSize = 256;
+    const size_t blockSize    = (nRows / (4 * nThreads) > minBlockSize) ? nRows / (4 * nThreads) : minBlockSize;
+    const size_t nBlocks      = nRows / blockSize + !!(nRows % blockSize);
+    const size_t minParallelN = 1 << 16;
+
+    auto convertBlock = [&](size_t iBlock) {
+        const size_t blockBegin = iBlock * blockSize;
+        const size_t blockEnd   = (blockBegin + blockSize < nRows) ? blockBegin + blockSize : nRows;
+        for (size_t i = 0; i < nChunks; ++i)
+        {
+            const ColumnChunk & chunk = chunks[i];
+            const size_t begin        = (chunk.firstRow > blockBegin) ? chunk.firstRow : blockBegin;
+            const size_t end          = (chunk.firstRow + chunk.nRows < blockEnd) ? chunk.firstRow + chunk.nRows : blockEnd;
+            if (begin >= end) continue;
+
+            const char * const src = chunk.ptr + (begin - chunk.firstRow) * chunk.typeSize;
+            char * const dstPtr    = (char *)dst + begin * dstRowStride + chunk.column * dstTypeSize;
+            getVectorStrideUpCast(chunk.indexType, dstType)(end - begin, src, chunk.typeSize, dstPtr, dstRowStride);
+        }
+    };
+
+    if (nRows * nColumns < minParallelN)
+    {
+        for (size_t iBlock = 0; iBlock < nBlocks; ++iBlock)
+        {
+            convertBlock(iBlock);
+        }
+    }
+    else
+    {
+        daal::threader_for(nBlocks, nBlocks, convertBlock);
+    }
+}
+
 } // namespace internal
 namespace data_feature_utils
 {
@@ -0,0 +1,153 @@
+/* file: mapped_file.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "data_management/data_source/internal/csv_parallel_parser.h"
+#include "src/data_management/mapped_file.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <Windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+services::Status MappedFile::open(const char * fileName)
+{
+    close();
+
+    if (!fileName)
+    {
+        return services::Status(services::ErrorNullPtr);
+    }
+
+#if defined(_WIN32) || defined(_WIN64)
+    HANDLE file = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return services::Status(services::ErrorOnFileOpen);
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return services::Status(services::ErrorOnFileRead);
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (!mapping)
+    {
+        return services::Status(services::ErrorOnFileRead);
+    }
+
+    void * data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!data)
+    {
+        CloseHandle(mapping);
+        return services::Status(services::ErrorOnFileRead);
+    }
+
+    _mapping = mapping;
+    _size    = (size_t)fileSize.QuadPart;
+#else
+    const int file = ::open(fileName, O_RDONLY);
+    if (file < 0)
+    {
+        return services::Status(services::ErrorOnFileOpen);
+    }
+
+    /* Empty files and non-regular files such as pipes cannot be mapped */
+    struct stat fileStat;
+    if (fstat(file, &fileStat) != 0 || !S_ISREG(fileStat.st_mode) || fileStat.st_size == 0)
+    {
+        ::close(file);
+        return services::Status(services::ErrorOnFileRead);
+    }
+
+    const size_t size = (size_t)fileStat.st_size;
+    void * data       = mmap(NULL, size, PROT_READ, MAP_PRIVATE, file, 0);
+    ::close(file);
+    if (data == MAP_FAILED)
+    {
+        return services::Status(services::ErrorOnFileRead);
+    }
+    madvise(data, size, MADV_SEQUENTIAL);
+
+    _size = size;
+#endif
+
+    _data = static_cast<const char *>(data);
+    return services::Status();
+}
+
+void MappedFile::close()
+{
+    if (!_data)
+    {
+        return;
+    }
+
+#if defined(_WIN32) || defined(_WIN64)
+    UnmapViewOfFile(_data);
+    CloseHandle(static_cast<HANDLE>(_mapping));
+#else
+    munmap(const_cast<char *>(_data), _size);
+#endif
+
+    _data    = NULL;
+    _size    = 0;
+    _mapping = NULL;
+}
+
+MappedFile * openMappedFile(const char * fileName)
+{
+    MappedFile * file = new MappedFile();
+    if (!file || !file->open(fileName))
+    {
+        delete file;
+        return NULL;
+    }
+    return file;
+}
+
+void closeMappedFile(MappedFile * file)
+{
+    delete file;
+}
+
+const char * getMappedFileData(const MappedFile * file)
+{
+    return file->data();
+}
+
+size_t getMappedFileSize(const MappedFile * file)
+{
+    return file->size();
+}
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
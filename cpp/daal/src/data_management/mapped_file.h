@@ -0,0 +1,60 @@
+/* file: mapped_file.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef __KERNEL_DATA_MANAGEMENT_MAPPED_FILE_H__
+#define __KERNEL_DATA_MANAGEMENT_MAPPED_FILE_H__
+
+#include "services/base.h"
+#include "services/error_handling.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+/* Read-only view of a file mapped into the address space of the process */
+class MappedFile : public Base
+{
+public:
+    MappedFile() : _data(NULL), _size(0), _mapping(NULL) {}
+
+    ~MappedFile() { close(); }
+
+    /* Maps the whole file into memory. The previously mapped file, if any, is unmapped */
+    services::Status open(const char * fileName);
+
+    void close();
+
+    const char * data() const { return _data; }
+
+    size_t size() const { return _size; }
+
+private:
+    const char * _data;
+    size_t _size;
+    void * _mapping;
+
+    MappedFile(const MappedFile &);
+    MappedFile & operator=(const MappedFile &);
+};
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
+
+#endif
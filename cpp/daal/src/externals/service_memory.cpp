@@ -23,6 +23,133 @@
 
 #include "src/externals/service_memory.h"
 #include "src/externals/service_service.h"
+#include "services/daal_atomic_int.h"
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+namespace
+{
+/* Size in bytes starting from which memory is zeroed or copied in parallel */
+const size_t parallelMemoryThreshold = 4 * 1024 * 1024;
+
+/* Size in bytes of the block processed by one task, a multiple of the page size */
+const size_t parallelMemoryBlockSize = 1024 * 1024;
+
+/* Size in bytes of the block copied by one call of the safe copy routine */
+const size_t maxMemcpyBlockSize = 200000000; // approx 200MB
+
+void zeroMemorySeq(char * ptr, size_t size)
+{
+    const size_t misalignment = (size_t)ptr % sizeof(DAAL_UINT64);
+    size_t nHead              = misalignment ? sizeof(DAAL_UINT64) - misalignment : 0;
+    nHead                     = (nHead < size) ? nHead : size;
+    for (size_t i = 0; i < nHead; i++)
+    {
+        ptr[i] = '\0';
+    }
+
+    DAAL_UINT64 * const wptr = (DAAL_UINT64 *)(ptr + nHead);
+    const size_t nWords      = (size - nHead) / sizeof(DAAL_UINT64);
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < nWords; i++)
+    {
+        wptr[i] = 0;
+    }
+
+    for (size_t i = nHead + nWords * sizeof(DAAL_UINT64); i < size; i++)
+    {
+        ptr[i] = '\0';
+    }
+}
+
+int copyMemorySeq(char * dest, const char * src, size_t size)
+{
+    int result = 0;
+    for (size_t offset = 0; offset < size; offset += maxMemcpyBlockSize)
+    {
+        const size_t blockSize = (size - offset < maxMemcpyBlockSize) ? size - offset : maxMemcpyBlockSize;
+        result |= daal::internal::Service<>::serv_memcpy_s(dest + offset, blockSize, src + offset, blockSize);
+    }
+    return result;
+}
+
+bool isParallelMemoryOperation(size_t size)
+{
+    return size >= parallelMemoryThreshold && threader_get_threads_number() > 1;
+}
+
+/* Splits the memory range into blocks with borders at the addresses aligned to parallelMemoryBlockSize,
+   so every page of the range is first touched by a single thread */
+class MemoryBlocks
+{
+public:
+    MemoryBlocks(const void * ptr, size_t size) : _size(size), _alignmentOffset((size_t)ptr % parallelMemoryBlockSize) {}
+
+    size_t getNumberOfBlocks() const { return (_alignmentOffset + _size + parallelMemoryBlockSize - 1) / parallelMemoryBlockSize; }
+
+    size_t getOffset(size_t iBlock) const
+    {
+        const size_t alignedOffset = iBlock * parallelMemoryBlockSize;
+        const size_t offset        = (alignedOffset > _alignmentOffset) ? alignedOffset - _alignmentOffset : 0;
+        return (offset < _size) ? offset : _size;
+    }
+
+    size_t getSize(size_t iBlock) const { return getOffset(iBlock + 1) - getOffset(iBlock); }
+
+private:
+    size_t _size;
+    size_t _alignmentOffset;
+};
+
+int copyMemory(void * dest, size_t destSize, const void * src, size_t srcSize)
+{
+    const size_t copySize = (destSize < srcSize) ? destSize : srcSize;
+    char * dstChar        = (char *)dest;
+    const char * srcChar  = (const char *)src;
+
+    if (!isParallelMemoryOperation(copySize) || dest == NULL || src == NULL)
+    {
+        return copyMemorySeq(dstChar, srcChar, copySize);
+    }
+
+    daal::services::Atomic<int> result(0);
+    const MemoryBlocks blocks(dest, copySize);
+    const size_t nBlocks = blocks.getNumberOfBlocks();
+    threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t offset    = blocks.getOffset(iBlock);
+        const size_t blockSize = blocks.getSize(iBlock);
+
+        const int blockResult = daal::internal::Service<>::serv_memcpy_s(dstChar + offset, blockSize, srcChar + offset, blockSize);
+        if (blockResult)
+        {
+            result.set(blockResult);
+        }
+    });
+    return result.get();
+}
+} // namespace
+
+void daal_memset_zero(void * dest, size_t size)
+{
+    char * const cptr = (char *)dest;
+    if (!isParallelMemoryOperation(size))
+    {
+        zeroMemorySeq(cptr, size);
+        return;
+    }
+
+    const MemoryBlocks blocks(dest, size);
+    const size_t nBlocks = blocks.getNumberOfBlocks();
+    threader_for(nBlocks, nBlocks, [&](size_t iBlock) { zeroMemorySeq(cptr + blocks.getOffset(iBlock), blocks.getSize(iBlock)); });
+}
+} // namespace internal
+} // namespace services
+} // namespace daal
 
 void * daal::services::daal_malloc(size_t size, size_t alignment)
 {
@@ -37,12 +164,7 @@ void * daal::services::daal_calloc(size_t size, size_t alignment)
         return NULL;
     }
 
-    char * cptr = (char *)ptr;
-
-    for (size_t i = 0; i < size; i++)
-    {
-        cptr[i] = '\0';
-    }
+    daal::services::internal::daal_memset_zero(ptr, size);
 
     return ptr;
 }
@@ -70,59 +192,10 @@ void daal_free_buffers()
 
 void daal::services::daal_memcpy_s(void * dest, size_t destSize, const void * src, size_t srcSize)
 {
-    size_t copySize = srcSize;
-    if (destSize < srcSize)
-    {
-        copySize = destSize;
-    }
-
-    size_t BLOCKSIZE       = 200000000; // approx 200MB
-    size_t nBlocks         = copySize / BLOCKSIZE;
-    size_t sizeOfLastBlock = 0;
-    if (nBlocks * BLOCKSIZE != copySize)
-    {
-        sizeOfLastBlock = copySize - (nBlocks * BLOCKSIZE);
-    }
-
-    char * dstChar = (char *)dest;
-    char * srcChar = (char *)src;
-    for (size_t i = 0; i < nBlocks; i++)
-    {
-        daal::internal::Service<>::serv_memcpy_s(&dstChar[i * BLOCKSIZE], BLOCKSIZE, &srcChar[i * BLOCKSIZE], BLOCKSIZE);
-    }
-    if (sizeOfLastBlock != 0)
-    {
-        daal::internal::Service<>::serv_memcpy_s(&dstChar[nBlocks * BLOCKSIZE], sizeOfLastBlock, &srcChar[nBlocks * BLOCKSIZE], sizeOfLastBlock);
-    }
+    daal::services::internal::copyMemory(dest, destSize, src, srcSize);
 }
 
 int daal::services::internal::daal_memcpy_s(void * dest, size_t destSize, const void * src, size_t srcSize)
 {
-    size_t copySize = srcSize;
-    if (destSize < srcSize)
-    {
-        copySize = destSize;
-    }
-
-    size_t BLOCKSIZE       = 200000000; // approx 200MB
-    size_t nBlocks         = copySize / BLOCKSIZE;
-    size_t sizeOfLastBlock = 0;
-    int result             = 0;
-    if (nBlocks * BLOCKSIZE != copySize)
-    {
-        sizeOfLastBlock = copySize - (nBlocks * BLOCKSIZE);
-    }
-
-    char * dstChar = (char *)dest;
-    char * srcChar = (char *)src;
-    for (size_t i = 0; i < nBlocks; i++)
-    {
-        result |= daal::internal::Service<>::serv_memcpy_s(&dstChar[i * BLOCKSIZE], BLOCKSIZE, &srcChar[i * BLOCKSIZE], BLOCKSIZE);
-    }
-    if (sizeOfLastBlock != 0)
-    {
-        result |=
-            daal::internal::Service<>::serv_memcpy_s(&dstChar[nBlocks * BLOCKSIZE], sizeOfLastBlock, &srcChar[nBlocks * BLOCKSIZE], sizeOfLastBlock);
-    }
-    return result;
+    return daal::services::internal::copyMemory(dest, destSize, src, srcSize);
 }
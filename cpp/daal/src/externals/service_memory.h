@@ -35,6 +35,9 @@ namespace services
 {
 namespace internal
 {
+/* Fills the block of memory with zeros. Large blocks are filled in parallel */
+void daal_memset_zero(void * dest, size_t size);
+
 template <typename T, CpuType cpu>
 T * service_calloc(size_t size, size_t alignment = 64)
 {
@@ -44,13 +47,7 @@ T * service_calloc(size_t size, size_t alignment = 64)
         return NULL;
     }
 
-    char * const cptr        = (char *)ptr;
-    const size_t sizeInBytes = size * sizeof(T);
-
-    for (size_t i = 0; i < sizeInBytes; i++)
-    {
-        cptr[i] = '\0';
-    }
+    daal::services::internal::daal_memset_zero(ptr, size * sizeof(T));
 
     return ptr;
 }
@@ -77,13 +74,7 @@ T * service_scalable_calloc(size_t size, size_t alignment = 64)
         return NULL;
     }
 
-    char * const cptr        = (char *)ptr;
-    const size_t sizeInBytes = size * sizeof(T);
-
-    for (size_t i = 0; i < sizeInBytes; i++)
-    {
-        cptr[i] = '\0';
-    }
+    daal::services::internal::daal_memset_zero(ptr, size * sizeof(T));
 
     return ptr;
 }
@@ -16,17 +16,392 @@
 *******************************************************************************/
 
 #include "src/externals/service_profiler.h"
+#include "src/algorithms/service_threading.h"
+#include "services/collection.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 
 namespace daal
 {
 namespace internal
 {
+namespace
+{
+enum ProfilerMode
+{
+    profilerDisabled,
+    profilerSummary,
+    profilerTrace
+};
+
+/* Maximal number of trace events recorded by one thread */
+const size_t maxProfilerEventsPerThread = 1 << 22;
+/* Maximal nesting of tasks in one thread */
+const size_t maxProfilerDepth = 256;
+
+/* Task in the tree of nested tasks. Node 0 is the root of the tree */
+struct ProfilerNode
+{
+    const char * name;
+    size_t firstChild;
+    size_t nextSibling;
+    size_t nCalls;
+    size_t nThreads;
+    DAAL_UINT64 totalTime;
+    DAAL_UINT64 minTime;
+    DAAL_UINT64 maxTime;
+};
+
+struct ProfilerEvent
+{
+    const char * name;
+    DAAL_UINT64 start;
+    DAAL_UINT64 duration;
+};
+
+struct ProfilerOpenTask
+{
+    size_t node;
+    DAAL_UINT64 start;
+};
+
+DAAL_UINT64 getProfilerTime()
+{
+    return (DAAL_UINT64)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool isSameTaskName(const char * lhs, const char * rhs)
+{
+    return lhs == rhs || std::strcmp(lhs, rhs) == 0;
+}
+
+/* Returns the child of the parent node with the given name, adds it if there is no such child */
+size_t findOrAddChild(services::Collection<ProfilerNode> & nodes, size_t parent, const char * name)
+{
+    size_t child = nodes[parent].firstChild;
+    for (; child != 0; child = nodes[child].nextSibling)
+    {
+        if (isSameTaskName(nodes[child].name, name))
+        {
+            return child;
+        }
+    }
+
+    ProfilerNode node = { name, 0, nodes[parent].firstChild, 0, 0, 0, 0, 0 };
+    if (!nodes.safe_push_back(node))
+    {
+        return 0;
+    }
+    child                    = nodes.size() - 1;
+    nodes[parent].firstChild = child;
+    return child;
+}
+
+bool addRootNode(services::Collection<ProfilerNode> & nodes)
+{
+    ProfilerNode root = { "", 0, 0, 0, 0, 0, 0, 0 };
+    return nodes.safe_push_back(root);
+}
+
+/* Profiling data collected by one thread */
+class ThreadProfile
+{
+public:
+    DAAL_NEW_DELETE();
+
+    explicit ThreadProfile(size_t threadId) : _threadId(threadId) { addRootNode(_nodes); }
+
+    void startTask(const char * name, DAAL_UINT64 time)
+    {
+        const size_t parent = _stack.size() ? _stack[_stack.size() - 1].node : 0;
+        if (_stack.size() >= maxProfilerDepth || !_nodes.size())
+        {
+            return;
+        }
+        ProfilerOpenTask task = { findOrAddChild(_nodes, parent, name), time };
+        _stack.safe_push_back(task);
+    }
+
+    void endTask(const char * name, DAAL_UINT64 time, bool recordEvent)
+    {
+        if (!_stack.size())
+        {
+            return;
+        }
+        const ProfilerOpenTask task = _stack[_stack.size() - 1];
+        _stack.erase(_stack.size() - 1);
+        if (task.node == 0)
+        {
+            return;
+        }
+
+        const DAAL_UINT64 duration = time - task.start;
+        ProfilerNode & node        = _nodes[task.node];
+        node.minTime               = (node.nCalls == 0 || duration < node.minTime) ? duration : node.minTime;
+        node.maxTime               = (duration > node.maxTime) ? duration : node.maxTime;
+        node.totalTime += duration;
+        node.nCalls++;
+
+        if (recordEvent && _events.size() < maxProfilerEventsPerThread)
+        {
+            ProfilerEvent event = { name, task.start, duration };
+            _events.safe_push_back(event);
+        }
+    }
+
+    size_t getThreadId() const { return _threadId; }
+    const services::Collection<ProfilerNode> & getNodes() const { return _nodes; }
+    const services::Collection<ProfilerEvent> & getEvents() const { return _events; }
+
+private:
+    size_t _threadId;
+    services::Collection<ProfilerNode> _nodes;
+    services::Collection<ProfilerOpenTask> _stack;
+    services::Collection<ProfilerEvent> _events;
+};
+
+class ProfilerBackend
+{
+public:
+    /* The backend is never destroyed, so the thread profiles stay valid in the threads that outlive the static objects.
+       The profile is written at exit by the handler registered on the first use of the enabled profiler */
+    static ProfilerBackend & instance()
+    {
+        static ProfilerBackend * backend = create();
+        return *backend;
+    }
+
+    bool isEnabled() const { return _mode != profilerDisabled; }
+    bool isTraceMode() const { return _mode == profilerTrace; }
+
+    ThreadProfile * getLocalProfile()
+    {
+        static thread_local ThreadProfile * localProfile = NULL;
+        if (!localProfile)
+        {
+            AUTOLOCK(_mutex);
+            localProfile = new ThreadProfile(_threads.size());
+            if (localProfile && !_threads.safe_push_back(localProfile))
+            {
+                delete localProfile;
+                localProfile = NULL;
+            }
+        }
+        return localProfile;
+    }
+
+private:
+    static ProfilerBackend * create()
+    {
+        ProfilerBackend * backend = new ProfilerBackend();
+        if (backend && backend->isEnabled())
+        {
+            std::atexit(&ProfilerBackend::writeAtExit);
+        }
+        return backend;
+    }
+
+    static void writeAtExit() { instance().write(); }
+
+    void write()
+    {
+        AUTOLOCK(_mutex);
+        if (!isEnabled())
+        {
+            return;
+        }
+        const bool traceMode = isTraceMode();
+        /* The tasks that end after this point are not recorded */
+        _mode = profilerDisabled;
+
+        FILE * file = std::fopen(_fileName, "w");
+        if (file)
+        {
+            if (traceMode)
+            {
+                writeTrace(file);
+            }
+            else
+            {
+                writeSummary(file);
+            }
+            std::fclose(file);
+        }
+        else
+        {
+            std::fprintf(stderr, "DAAL profiler: cannot open file %s\n", _fileName);
+        }
+    }
+
+    ProfilerBackend() : _mode(profilerDisabled), _fileName("daal_profile.json"), _startTime(getProfilerTime())
+    {
+        const char * mode = std::getenv("DAAL_PROFILER");
+        if (mode && std::strcmp(mode, "json") == 0)
+        {
+            _mode = profilerSummary;
+        }
+        else if (mode && std::strcmp(mode, "trace") == 0)
+        {
+            _mode = profilerTrace;
+        }
+
+        const char * fileName = std::getenv("DAAL_PROFILER_FILE");
+        if (fileName && fileName[0] != '\0')
+        {
+            _fileName = fileName;
+        }
+    }
+
+    static void writeName(FILE * file, const char * name)
+    {
+        std::fputc('"', file);
+        for (; *name; ++name)
+        {
+            if (*name == '"' || *name == '\\')
+            {
+                std::fputc('\\', file);
+            }
+            std::fputc(*name, file);
+        }
+        std::fputc('"', file);
+    }
+
+    /* Adds the subtree of the thread's node to the subtree of the merged node */
+    static void mergeNode(services::Collection<ProfilerNode> & merged, size_t mergedNode, const services::Collection<ProfilerNode> & nodes,
+                          size_t node)
+    {
+        for (size_t child = nodes[node].firstChild; child != 0; child = nodes[child].nextSibling)
+        {
+            const size_t mergedChild = findOrAddChild(merged, mergedNode, nodes[child].name);
+            if (mergedChild == 0)
+            {
+                return;
+            }
+            ProfilerNode & target     = merged[mergedChild];
+            const ProfilerNode & from = nodes[child];
+            target.minTime            = (target.nCalls == 0 || from.minTime < target.minTime) ? from.minTime : target.minTime;
+            target.maxTime            = (from.maxTime > target.maxTime) ? from.maxTime : target.maxTime;
+            target.totalTime += from.totalTime;
+            target.nCalls += from.nCalls;
+            target.nThreads += (from.nCalls > 0);
+            mergeNode(merged, mergedChild, nodes, child);
+        }
+    }
+
+    static void writeSummaryNode(FILE * file, const services::Collection<ProfilerNode> & nodes, size_t node, size_t depth)
+    {
+        const ProfilerNode & n = nodes[node];
+
+        DAAL_UINT64 childrenTime = 0;
+        for (size_t child = n.firstChild; child != 0; child = nodes[child].nextSibling)
+        {
+            childrenTime += nodes[child].totalTime;
+        }
+        const DAAL_UINT64 selfTime = (n.totalTime > childrenTime) ? n.totalTime - childrenTime : 0;
+
+        std::fprintf(file, "%*s{\"name\": ", (int)(2 * depth), "");
+        writeName(file, n.name);
+        std::fprintf(file, ", \"calls\": %lu, \"threads\": %lu, \"total_ms\": %.6f, \"self_ms\": %.6f, \"min_ms\": %.6f, \"max_ms\": %.6f",
+                     (unsigned long)n.nCalls, (unsigned long)n.nThreads, n.totalTime * 1e-6, selfTime * 1e-6, n.minTime * 1e-6, n.maxTime * 1e-6);
+        writeSummaryChildren(file, nodes, node, depth);
+        std::fprintf(file, "}");
+    }
+
+    static void writeSummaryChildren(FILE * file, const services::Collection<ProfilerNode> & nodes, size_t node, size_t depth)
+    {
+        if (nodes[node].firstChild == 0)
+        {
+            return;
+        }
+        std::fprintf(file, ", \"children\": [\n");
+        for (size_t child = nodes[node].firstChild; child != 0; child = nodes[child].nextSibling)
+        {
+            writeSummaryNode(file, nodes, child, depth + 1);
+            std::fprintf(file, nodes[child].nextSibling ? ",\n" : "\n");
+        }
+        std::fprintf(file, "%*s]", (int)(2 * depth), "");
+    }
+
+    /* Writes the tree of tasks merged over all threads. Siblings are listed from the last started to the first started one */
+    void writeSummary(FILE * file) const
+    {
+        services::Collection<ProfilerNode> merged;
+        if (!addRootNode(merged))
+        {
+            return;
+        }
+        for (size_t i = 0; i < _threads.size(); i++)
+        {
+            mergeNode(merged, 0, _threads[i]->getNodes(), 0);
+        }
+
+        std::fprintf(file, "{\"threads\": %lu, \"tasks\": [\n", (unsigned long)_threads.size());
+        for (size_t child = merged[0].firstChild; child != 0; child = merged[child].nextSibling)
+        {
+            writeSummaryNode(file, merged, child, 1);
+            std::fprintf(file, merged[child].nextSibling ? ",\n" : "\n");
+        }
+        std::fprintf(file, "]}\n");
+    }
+
+    void writeTrace(FILE * file) const
+    {
+        std::fprintf(file, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [");
+        bool first = true;
+        for (size_t i = 0; i < _threads.size(); i++)
+        {
+            const services::Collection<ProfilerEvent> & events = _threads[i]->getEvents();
+            for (size_t j = 0; j < events.size(); j++)
+            {
+                const DAAL_UINT64 start = (events[j].start > _startTime) ? events[j].start - _startTime : 0;
+                std::fprintf(file, first ? "\n{\"name\": " : ",\n{\"name\": ");
+                writeName(file, events[j].name);
+                std::fprintf(file, ", \"ph\": \"X\", \"pid\": 0, \"tid\": %lu, \"ts\": %.3f, \"dur\": %.3f}", (unsigned long)_threads[i]->getThreadId(),
+                             start * 1e-3, events[j].duration * 1e-3);
+                first = false;
+            }
+        }
+        std::fprintf(file, "\n]}\n");
+    }
+
+    ProfilerMode _mode;
+    const char * _fileName;
+    DAAL_UINT64 _startTime;
+    Mutex _mutex;
+    services::Collection<ThreadProfile *> _threads;
+};
+
+} // namespace
+
 ProfilerTask Profiler::startTask(const char * taskName)
 {
+    ProfilerBackend & backend = ProfilerBackend::instance();
+    if (backend.isEnabled())
+    {
+        ThreadProfile * profile = backend.getLocalProfile();
+        if (profile)
+        {
+            profile->startTask(taskName, getProfilerTime());
+        }
+    }
     return ProfilerTask(taskName);
 }
 
-void Profiler::endTask(const char * taskName) {}
+void Profiler::endTask(const char * taskName)
+{
+    ProfilerBackend & backend = ProfilerBackend::instance();
+    if (backend.isEnabled())
+    {
+        ThreadProfile * profile = backend.getLocalProfile();
+        if (profile)
+        {
+            profile->endTask(taskName, getProfilerTime(), backend.isTraceMode());
+        }
+    }
+}
 
 ProfilerTask::ProfilerTask(const char * taskName) : _taskName(taskName) {}
 
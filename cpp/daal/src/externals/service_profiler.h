@@ -21,6 +21,9 @@
 //--
 */
 
+#ifndef __SERVICE_PROFILER_H__
+#define __SERVICE_PROFILER_H__
+
 namespace daal
 {
 namespace internal
@@ -35,7 +38,12 @@ private:
     const char * _taskName;
 };
 
-// This class is a stub in the library. Its redefinition will be in Bechmarks
+// Built-in profiler backend. It is disabled unless the DAAL_PROFILER environment variable is set at process start:
+//   DAAL_PROFILER=json   - nested wall-clock time, call counts and number of threads of every task are written as JSON
+//   DAAL_PROFILER=trace  - every task is written as an event in the Chrome trace format
+// The output is written at process exit to the file given by DAAL_PROFILER_FILE, daal_profile.json by default.
+// Tasks are nested per thread, so the tasks started in worker threads are at the top level of the thread they run in.
+// Benchmarks may still link their own definitions of Profiler and ProfilerTask instead of this one.
 class Profiler
 {
 public:
@@ -45,3 +53,5 @@ public:
 
 } // namespace internal
 } // namespace daal
+
+#endif
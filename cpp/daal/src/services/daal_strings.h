@@ -378,7 +378,19 @@
     DECLARE_DAAL_STRING_CONST(step13Assignments)                 \
     DECLARE_DAAL_STRING_CONST(step13AssignmentQueries)           \
     DECLARE_DAAL_STRING_CONST(gramMatrix)                        \
-    DECLARE_DAAL_STRING_CONST(lassoParameters)
+    DECLARE_DAAL_STRING_CONST(lassoParameters)                   \
+    DECLARE_DAAL_STRING_CONST(nProbes)                           \
+    DECLARE_DAAL_STRING_CONST(distanceType)                      \
+    DECLARE_DAAL_STRING_CONST(minkowskiPower)                    \
+    DECLARE_DAAL_STRING_CONST(voteWeights)                       \
+    DECLARE_DAAL_STRING_CONST(gradientBits)                      \
+    DECLARE_DAAL_STRING_CONST(earlyStoppingRounds)               \
+    DECLARE_DAAL_STRING_CONST(validationMetric)                  \
+    DECLARE_DAAL_STRING_CONST(validationData)                    \
+    DECLARE_DAAL_STRING_CONST(validationDependentVariable)       \
+    DECLARE_DAAL_STRING_CONST(validationLabels)                  \
+    DECLARE_DAAL_STRING_CONST(initialModel)                      \
+    DECLARE_DAAL_STRING_CONST(featureContributions)
 
 /**
  *  Intel(R) oneAPI Data Analytics Library namespace
@@ -921,6 +921,7 @@ void ErrorMessageCollection::parseResourceFile()
 
     // K-Nearest Neighbors errors: -21000..21999
     add(ErrorKNNInternal, "K-Nearest Neighbors internal error");
+    add(ErrorKNNIncompatibleModelMethod, "Prediction method is not compatible with the training method of the model");
 
     // GBT error: -30000..-30099
     add(ErrorGbtIncorrectNumberOfTrees, "Number of trees in the model is not consistent with the number of classes");
@@ -21,6 +21,7 @@
 #include "src/services/service_utils.h"
 #include "src/externals/service_memory.h"
 #include "src/services/service_type_traits.h"
+#include "src/services/service_scratch_pool.h"
 
 namespace daal
 {
@@ -95,6 +96,28 @@ struct ScalableCalloc
     static void deallocate(T * ptr) { service_scalable_free<T, cpu>(ptr); }
 };
 
+template <typename T, CpuType cpu>
+struct ScratchMalloc
+{
+    static T * allocate(size_t n) { return (n <= ((size_t)-1) / sizeof(T)) ? (T *)scratchPoolAllocate(n * sizeof(T)) : nullptr; }
+    static void deallocate(T * ptr) { scratchPoolDeallocate(ptr); }
+};
+
+template <typename T, CpuType cpu>
+struct ScratchCalloc
+{
+    static T * allocate(size_t n)
+    {
+        T * ptr = ScratchMalloc<T, cpu>::allocate(n);
+        if (ptr)
+        {
+            daal::services::internal::daal_memset_zero(ptr, n * sizeof(T));
+        }
+        return ptr;
+    }
+    static void deallocate(T * ptr) { scratchPoolDeallocate(ptr); }
+};
+
 /* CPU specific deleters */
 
 template <typename T, CpuType cpu>
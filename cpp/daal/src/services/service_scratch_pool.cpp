@@ -0,0 +1,338 @@
+/** file service_scratch_pool.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the pool of scratch buffers.
+//  The buffers are grouped into size classes, four classes per power of two,
+//  so the memory overhead of rounding the size up does not exceed 25%.
+//  Every thread keeps the released buffers in its own cache. A buffer released
+//  by another thread, e.g. the buffer of a thread local storage released
+//  by the main thread in reduce(), is returned to the cache of the thread
+//  that allocated it, so that thread gets it back on the next iteration.
+//--
+*/
+
+#include "src/services/service_scratch_pool.h"
+#include "src/algorithms/service_threading.h"
+#include "services/daal_atomic_int.h"
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+namespace
+{
+/* Size of the header stored before every buffer; keeps the buffers 64-byte aligned */
+const size_t scratchHeaderSize = 64;
+
+const size_t minSizeClassLog        = 6;
+const size_t maxSizeClassLog        = 26;
+const size_t subClassBits           = 2;
+const size_t sizeClassesPerPowerOf2 = (size_t)1 << subClassBits;
+const size_t nSizeClasses           = (maxSizeClassLog - minSizeClassLog) * sizeClassesPerPowerOf2 + 1;
+
+/* Size class of the buffers that are larger than the largest size class and never kept in the pool */
+const size_t unpooledSizeClass = nSizeClasses;
+
+/* Maximal total size in bytes of the buffers kept in the cache of one thread */
+const size_t maxCachedBytesPerThread = (size_t)64 * 1024 * 1024;
+
+class ThreadCache;
+
+struct ScratchBlockHeader
+{
+    size_t sizeClass;
+    size_t size;
+    ScratchBlockHeader * next;
+    ThreadCache * owner;
+};
+
+size_t getSizeClass(size_t size)
+{
+    if (size <= ((size_t)1 << minSizeClassLog))
+    {
+        return 0;
+    }
+
+    /* 2^log < size <= 2^(log + 1) */
+    size_t log = 0;
+    for (size_t value = size - 1; value > 1; value >>= 1)
+    {
+        ++log;
+    }
+    if (log >= maxSizeClassLog)
+    {
+        return unpooledSizeClass;
+    }
+
+    const size_t step     = (size_t)1 << (log - subClassBits);
+    const size_t subClass = (size - ((size_t)1 << log) + step - 1) / step;
+    return (log - minSizeClassLog) * sizeClassesPerPowerOf2 + subClass;
+}
+
+size_t getSizeClassBytes(size_t sizeClass)
+{
+    if (sizeClass == 0)
+    {
+        return (size_t)1 << minSizeClassLog;
+    }
+
+    const size_t log      = (sizeClass - 1) / sizeClassesPerPowerOf2 + minSizeClassLog;
+    const size_t subClass = (sizeClass - 1) % sizeClassesPerPowerOf2 + 1;
+    return ((size_t)1 << log) + subClass * ((size_t)1 << (log - subClassBits));
+}
+
+void freeBlocks(ScratchBlockHeader * header)
+{
+    while (header)
+    {
+        ScratchBlockHeader * next = header->next;
+        threaded_scalable_free(header);
+        header = next;
+    }
+}
+
+/* Released buffers of one thread. The mutex is taken by the owner thread on every call,
+   by other threads only when they return the buffers of the owner or when the pool is emptied */
+class ThreadCache
+{
+public:
+    ThreadCache() : isOwned(true), nextCache(nullptr), _cachedBytes(0)
+    {
+        for (size_t i = 0; i < nSizeClasses; i++)
+        {
+            _freeBlocks[i] = nullptr;
+        }
+    }
+
+    ScratchBlockHeader * pop(size_t sizeClass)
+    {
+        AUTOLOCK(_mutex);
+        ScratchBlockHeader * header = _freeBlocks[sizeClass];
+        if (header)
+        {
+            _freeBlocks[sizeClass] = header->next;
+            _cachedBytes -= header->size;
+        }
+        return header;
+    }
+
+    bool push(ScratchBlockHeader * header)
+    {
+        AUTOLOCK(_mutex);
+        if (_cachedBytes + header->size > maxCachedBytesPerThread)
+        {
+            return false;
+        }
+        header->next                   = _freeBlocks[header->sizeClass];
+        _freeBlocks[header->sizeClass] = header;
+        _cachedBytes += header->size;
+        return true;
+    }
+
+    void clear()
+    {
+        ScratchBlockHeader * blocks[nSizeClasses];
+        {
+            AUTOLOCK(_mutex);
+            for (size_t i = 0; i < nSizeClasses; i++)
+            {
+                blocks[i]      = _freeBlocks[i];
+                _freeBlocks[i] = nullptr;
+            }
+            _cachedBytes = 0;
+        }
+
+        for (size_t i = 0; i < nSizeClasses; i++)
+        {
+            freeBlocks(blocks[i]);
+        }
+    }
+
+    /* Fields guarded by the mutex of the pool */
+    bool isOwned;
+    ThreadCache * nextCache;
+
+private:
+    Mutex _mutex;
+    size_t _cachedBytes;
+    ScratchBlockHeader * _freeBlocks[nSizeClasses];
+};
+
+class ScratchPool
+{
+public:
+    static ScratchPool & instance()
+    {
+        /* Never destroyed: the buffers may be released after the static objects are destroyed */
+        static ScratchPool * pool = new ScratchPool();
+        return *pool;
+    }
+
+    void * allocate(size_t size)
+    {
+        const size_t sizeClass = getSizeClass(size);
+        ThreadCache * cache    = (sizeClass != unpooledSizeClass) ? getLocalCache() : nullptr;
+        if (cache && _nScopes.get() > 0)
+        {
+            ScratchBlockHeader * header = cache->pop(sizeClass);
+            if (header)
+            {
+                return (byte *)header + scratchHeaderSize;
+            }
+        }
+
+        const size_t blockSize = (sizeClass != unpooledSizeClass) ? getSizeClassBytes(sizeClass) : size;
+        if (blockSize > ((size_t)-1) - scratchHeaderSize)
+        {
+            return nullptr;
+        }
+
+        ScratchBlockHeader * header = (ScratchBlockHeader *)threaded_scalable_malloc(blockSize + scratchHeaderSize, scratchHeaderSize);
+        if (!header)
+        {
+            return nullptr;
+        }
+        header->sizeClass = sizeClass;
+        header->size      = blockSize;
+        header->next      = nullptr;
+        header->owner     = cache;
+        return (byte *)header + scratchHeaderSize;
+    }
+
+    void deallocate(void * ptr)
+    {
+        if (!ptr)
+        {
+            return;
+        }
+
+        ScratchBlockHeader * header = (ScratchBlockHeader *)((byte *)ptr - scratchHeaderSize);
+        if (header->owner && _nScopes.get() > 0 && header->owner->push(header))
+        {
+            return;
+        }
+        threaded_scalable_free(header);
+    }
+
+    void enable() { _nScopes.inc(); }
+
+    void disable()
+    {
+        if (_nScopes.dec() > 0)
+        {
+            return;
+        }
+
+        AUTOLOCK(_mutex);
+        for (ThreadCache * cache = _caches; cache; cache = cache->nextCache)
+        {
+            cache->clear();
+        }
+    }
+
+private:
+    /* Returns the cache of the thread to its pool when the thread exits */
+    class LocalCacheHolder
+    {
+    public:
+        LocalCacheHolder() : cache(nullptr) {}
+        ~LocalCacheHolder()
+        {
+            if (cache)
+            {
+                ScratchPool::instance().releaseCache(cache);
+            }
+        }
+
+        ThreadCache * cache;
+    };
+
+    ScratchPool() : _caches(nullptr) {}
+
+    ThreadCache * getLocalCache()
+    {
+        static thread_local LocalCacheHolder holder;
+        if (!holder.cache)
+        {
+            holder.cache = acquireCache();
+        }
+        return holder.cache;
+    }
+
+    /* The caches are never destroyed: the buffers allocated by a thread may be released after the thread exits.
+       The cache of the exited thread is given to the next new thread */
+    ThreadCache * acquireCache()
+    {
+        AUTOLOCK(_mutex);
+        for (ThreadCache * cache = _caches; cache; cache = cache->nextCache)
+        {
+            if (!cache->isOwned)
+            {
+                cache->isOwned = true;
+                return cache;
+            }
+        }
+
+        ThreadCache * cache = new ThreadCache();
+        if (cache)
+        {
+            cache->nextCache = _caches;
+            _caches          = cache;
+        }
+        return cache;
+    }
+
+    void releaseCache(ThreadCache * cache)
+    {
+        cache->clear();
+        AUTOLOCK(_mutex);
+        cache->isOwned = false;
+    }
+
+    Atomic<int> _nScopes;
+    Mutex _mutex;
+    ThreadCache * _caches;
+};
+} // namespace
+
+void * scratchPoolAllocate(size_t size)
+{
+    return ScratchPool::instance().allocate(size);
+}
+
+void scratchPoolDeallocate(void * ptr)
+{
+    ScratchPool::instance().deallocate(ptr);
+}
+
+ScratchPoolScope::ScratchPoolScope()
+{
+    ScratchPool::instance().enable();
+}
+
+ScratchPoolScope::~ScratchPoolScope()
+{
+    ScratchPool::instance().disable();
+}
+
+} // namespace internal
+} // namespace services
+} // namespace daal
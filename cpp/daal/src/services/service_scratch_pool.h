@@ -0,0 +1,67 @@
+/* file: service_scratch_pool.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the pool of scratch buffers that are reused
+//  across iterations of the algorithms
+//--
+*/
+#ifndef __SERVICE_SCRATCH_POOL_H__
+#define __SERVICE_SCRATCH_POOL_H__
+
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+/**
+ * Allocates a 64-byte aligned scratch buffer of the given size in bytes.
+ * While a ScratchPoolScope is alive, the buffer is taken from the buffers
+ * of the same size class cached by the calling thread, if there are any
+ */
+void * scratchPoolAllocate(size_t size);
+
+/**
+ * Deallocates the buffer allocated by scratchPoolAllocate.
+ * While a ScratchPoolScope is alive, the buffer is kept for reuse in the cache
+ * of the thread that allocated it
+ */
+void scratchPoolDeallocate(void * ptr);
+
+/**
+ * Enables reuse of scratch buffers for the lifetime of the object.
+ * The buffers kept in the pool are released when the last scope is destroyed
+ */
+class ScratchPoolScope
+{
+public:
+    ScratchPoolScope();
+    ~ScratchPoolScope();
+
+    ScratchPoolScope(const ScratchPoolScope &) = delete;
+    ScratchPoolScope & operator=(const ScratchPoolScope &) = delete;
+};
+
+} // namespace internal
+} // namespace services
+} // namespace daal
+
+#endif
@@ -0,0 +1,225 @@
+/* file: bf_knn_classification.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "daal.h"
+#include "services/internal/status_to_error_id.h"
+#include "oneapi/dal/test/engine/common.hpp"
+#include "test/test_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace bf_knn_classification
+{
+namespace test
+{
+using namespace daal::data_management;
+
+const size_t nClasses  = 3;
+const size_t nFeatures = 4;
+const size_t nRows     = 600;
+
+/* Generates the observations around the centers of the classes */
+void generateData(NumericTablePtr & x, NumericTablePtr & y)
+{
+    std::mt19937 engine(2021);
+    std::normal_distribution<double> noise(0.0, 0.5);
+    std::vector<double> xValues(nRows * nFeatures);
+    std::vector<double> yValues(nRows);
+    for (size_t i = 0; i < nRows; i++)
+    {
+        const size_t label = i % nClasses;
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            xValues[i * nFeatures + j] = 4.0 * double((label + j) % nClasses) + noise(engine);
+        }
+        yValues[i] = double(label);
+    }
+    x = daal::test::createTable(xValues, nFeatures);
+    y = daal::test::createTable(yValues, 1);
+}
+
+template <training::Method method>
+ModelPtr train(const NumericTablePtr & x, const NumericTablePtr & y)
+{
+    training::Batch<double, method> algorithm(nClasses);
+    algorithm.parameter().k = 5;
+    algorithm.input.set(classifier::training::data, x);
+    algorithm.input.set(classifier::training::labels, y);
+    REQUIRE(algorithm.compute().ok());
+    return algorithm.getResult()->get(classifier::training::model);
+}
+
+template <prediction::Method method>
+services::Status predict(const NumericTablePtr & x, const ModelPtr & model, NumericTablePtr & labels)
+{
+    prediction::Batch<double, method> algorithm(nClasses);
+    algorithm.parameter().k = 5;
+    algorithm.input.set(classifier::prediction::data, x);
+    algorithm.input.set(classifier::prediction::model, model);
+    const services::Status status = algorithm.computeNoThrow();
+    if (status) labels = algorithm.getResult()->get(prediction::prediction);
+    return status;
+}
+
+TEST("knn prediction rejects the model trained by another method", "[knn][ivf]")
+{
+    NumericTablePtr x, y, labels;
+    generateData(x, y);
+
+    const services::Status denseOnIvf = predict<prediction::defaultDense>(x, train<training::ivfFlat>(x, y), labels);
+    REQUIRE(!denseOnIvf);
+    REQUIRE(services::internal::get_error_id(denseOnIvf) == services::ErrorKNNIncompatibleModelMethod);
+
+    const services::Status ivfOnDense = predict<prediction::ivfFlat>(x, train<training::defaultDense>(x, y), labels);
+    REQUIRE(!ivfOnDense);
+    REQUIRE(services::internal::get_error_id(ivfOnDense) == services::ErrorKNNIncompatibleModelMethod);
+}
+
+TEST("knn parameters reject distance weighted voting with inner product", "[knn][distance]")
+{
+    Parameter parameter(nClasses);
+    parameter.distanceType = innerProduct;
+    parameter.voteWeights  = voteDistance;
+    REQUIRE(!parameter.check());
+
+    parameter.voteWeights = voteUniform;
+    REQUIRE(parameter.check());
+}
+
+TEST("knn ivfFlat model keeps the inverted lists after serialization", "[knn][ivf]")
+{
+    NumericTablePtr x, y;
+    generateData(x, y);
+    const ModelPtr model = train<training::ivfFlat>(x, y);
+
+    InputDataArchive inputArchive;
+    model->serialize(inputArchive);
+    const size_t size = inputArchive.getSizeOfArchive();
+    std::vector<byte> buffer(size);
+    inputArchive.copyArchiveToArray(buffer.data(), size);
+
+    OutputDataArchive outputArchive(buffer.data(), size);
+    const ModelPtr restored(new Model());
+    restored->deserialize(outputArchive);
+
+    NumericTablePtr expected, actual;
+    REQUIRE(predict<prediction::ivfFlat>(x, model, expected));
+    REQUIRE(predict<prediction::ivfFlat>(x, restored, actual));
+    daal::test::checkTablesEqual(*expected, *actual);
+}
+
+/* The archive of 2021.2 ends with the labels, the four null inverted lists written by the current version are cut off */
+TEST("knn model is restored from the archive written by 2021.2", "[knn][brute_force]")
+{
+    NumericTablePtr x, y;
+    generateData(x, y);
+    const ModelPtr model = train<training::defaultDense>(x, y);
+
+    InputDataArchive inputArchive;
+    model->serialize(inputArchive);
+    const size_t size = inputArchive.getSizeOfArchive();
+    std::vector<byte> buffer(size);
+    inputArchive.copyArchiveToArray(buffer.data(), size);
+
+    const size_t nLists  = 4;
+    const size_t oldSize = size - nLists * sizeof(int);
+    for (size_t i = 0; i < nLists; i++)
+    {
+        int isNull = 0;
+        std::copy(buffer.data() + oldSize + i * sizeof(int), buffer.data() + oldSize + (i + 1) * sizeof(int), (byte *)&isNull);
+        REQUIRE(isNull == 1);
+    }
+    const int version[3] = { 2021, 2, 0 };
+    std::copy((const byte *)version, (const byte *)(version + 3), buffer.data() + sizeof(int));
+
+    OutputDataArchive outputArchive(buffer.data(), oldSize);
+    const ModelPtr restored(new Model());
+    restored->deserialize(outputArchive);
+    REQUIRE(outputArchive.getErrors()->size() == 0);
+    REQUIRE(restored->getNumberOfFeatures() == nFeatures);
+
+    NumericTablePtr expected, actual;
+    REQUIRE(predict<prediction::defaultDense>(x, model, expected));
+    REQUIRE(predict<prediction::defaultDense>(x, restored, actual));
+    daal::test::checkTablesEqual(*expected, *actual);
+}
+
+/* The neighbors up to 16 are selected by the sorted array, the larger numbers of neighbors by the heap */
+TEST("brute force knn search finds the nearest neighbors", "[knn][brute_force]")
+{
+    const size_t k     = GENERATE(1, 5, 16, 17, 40);
+    const size_t nTest = GENERATE(1, 300);
+    CAPTURE(k, nTest);
+
+    NumericTablePtr x, y;
+    generateData(x, y);
+    std::mt19937 engine(3333);
+    std::uniform_real_distribution<double> uniform(-2.0, 10.0);
+    std::vector<double> testValues(nTest * nFeatures);
+    for (size_t i = 0; i < testValues.size(); i++) testValues[i] = uniform(engine);
+
+    training::Batch<double> training(nClasses);
+    training.input.set(classifier::training::data, x);
+    training.input.set(classifier::training::labels, y);
+    REQUIRE(training.compute().ok());
+
+    prediction::Batch<double> algorithm(nClasses);
+    algorithm.parameter().k                = k;
+    algorithm.parameter().resultsToCompute = computeIndicesOfNeighbors | computeDistances;
+    algorithm.input.set(classifier::prediction::data, daal::test::createTable(testValues, nFeatures));
+    algorithm.input.set(classifier::prediction::model, training.getResult()->get(classifier::training::model));
+    REQUIRE(algorithm.compute().ok());
+    const std::vector<double> indices   = daal::test::getTableValues(*algorithm.getResult()->get(prediction::indices));
+    const std::vector<double> distances = daal::test::getTableValues(*algorithm.getResult()->get(prediction::distances));
+    REQUIRE(indices.size() == nTest * k);
+    REQUIRE(distances.size() == nTest * k);
+
+    const std::vector<double> trainValues = daal::test::getTableValues(*x);
+    std::vector<std::pair<double, size_t> > expected(nRows);
+    for (size_t i = 0; i < nTest; i++)
+    {
+        for (size_t j = 0; j < nRows; j++)
+        {
+            double distance = 0.0;
+            for (size_t f = 0; f < nFeatures; f++)
+            {
+                const double diff = testValues[i * nFeatures + f] - trainValues[j * nFeatures + f];
+                distance += diff * diff;
+            }
+            expected[j] = std::make_pair(std::sqrt(distance), j);
+        }
+        std::partial_sort(expected.begin(), expected.begin() + k, expected.end());
+        for (size_t j = 0; j < k; j++)
+        {
+            CAPTURE(i, j);
+            REQUIRE(size_t(indices[i * k + j]) == expected[j].second);
+            REQUIRE(std::abs(distances[i * k + j] - expected[j].first) < 1e-6);
+        }
+    }
+}
+
+} // namespace test
+} // namespace bf_knn_classification
+} // namespace algorithms
+} // namespace daal
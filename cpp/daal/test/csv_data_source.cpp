@@ -0,0 +1,188 @@
+/* file: csv_data_source.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "daal.h"
+#include "oneapi/dal/test/engine/common.hpp"
+#include "test/test_utils.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace test
+{
+typedef FileDataSource<CSVFeatureManager> CsvFileDataSource;
+typedef ParallelFileDataSource<CSVFeatureManager> ParallelCsvFileDataSource;
+
+/* Generates rows of numbers in different notations and the values the tokens are read as by the sequential parser */
+std::string generateCsv(size_t nRows, size_t nColumns, bool crlf, std::vector<double> & values)
+{
+    std::mt19937 engine(7777);
+    std::uniform_real_distribution<double> distribution(-1000.0, 1000.0);
+    std::string text;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        for (size_t j = 0; j < nColumns; j++)
+        {
+            char token[64];
+            const double value = distribution(engine);
+            switch ((i + j) % 4)
+            {
+            case 0: std::snprintf(token, sizeof(token), "%.6f", value); break;
+            case 1: std::snprintf(token, sizeof(token), "%.8e", value); break;
+            case 2: std::snprintf(token, sizeof(token), "%d", static_cast<int>(value)); break;
+            default: std::snprintf(token, sizeof(token), " %.3f", value); break;
+            }
+            values.push_back(services::daal_string_to_float(token, 0));
+            text += token;
+            text += (j + 1 < nColumns) ? "," : "";
+        }
+        text += crlf ? "\r\n" : "\n";
+    }
+    return text;
+}
+
+CsvFileDataSource * createDataSource(const std::string & path, bool parallel)
+{
+    const CsvDataSourceOptions::Value options = CsvDataSourceOptions::allocateNumericTable | CsvDataSourceOptions::createDictionaryFromContext;
+    if (parallel)
+    {
+        return new ParallelCsvFileDataSource(path, options);
+    }
+    return new CsvFileDataSource(path, options);
+}
+
+TEST("CSV loading reads the values of the generated tokens", "[csv][parallel]")
+{
+    const bool parallel   = GENERATE(false, true);
+    const bool crlf       = GENERATE(false, true);
+    const size_t nColumns = GENERATE(1, 7);
+    CAPTURE(parallel, crlf, nColumns);
+
+    std::vector<double> values;
+    const daal::test::TemporaryFile file("daal_parallel_csv_test.csv", generateCsv(40000, nColumns, crlf, values));
+
+    std::unique_ptr<CsvFileDataSource> dataSource(createDataSource(file.getPath(), parallel));
+
+    REQUIRE(dataSource->loadDataBlock() == 40000);
+    REQUIRE(dataSource->status().ok());
+
+    daal::test::checkTablesEqual(*daal::test::createTable(values, nColumns), *dataSource->getNumericTable());
+}
+
+TEST("CSV loading by blocks reads the values of the generated tokens", "[csv][parallel]")
+{
+    const bool parallel    = GENERATE(false, true);
+    const size_t blockSize = GENERATE(7, 1000, 30000);
+    CAPTURE(parallel, blockSize);
+
+    const size_t nColumns = 3;
+    std::vector<double> values;
+    const daal::test::TemporaryFile file("daal_parallel_csv_blocks_test.csv", generateCsv(40000, nColumns, false, values));
+
+    std::unique_ptr<CsvFileDataSource> dataSource(createDataSource(file.getPath(), parallel));
+
+    size_t nRows = 0;
+    while (dataSource->getStatus() != DataSourceIface::endOfData)
+    {
+        const size_t nBlockRows = dataSource->loadDataBlock(blockSize);
+        REQUIRE(nBlockRows == std::min(blockSize, 40000 - nRows));
+
+        const std::vector<double> blockValues(values.begin() + nRows * nColumns, values.begin() + (nRows + nBlockRows) * nColumns);
+        daal::test::checkTablesEqual(*daal::test::createTable(blockValues, nColumns), *dataSource->getNumericTable());
+        nRows += nBlockRows;
+    }
+    REQUIRE(nRows == 40000);
+}
+
+TEST("CSV loading reads empty and quoted fields as zeros", "[csv][parallel]")
+{
+    /* CRLF line endings and no newline after the last row, the values are those of the sequential parser before the fast path */
+    const bool parallel = GENERATE(false, true);
+    CAPTURE(parallel);
+
+    const daal::test::TemporaryFile file("daal_parallel_csv_fields_test.csv", "1.5,2,3\r\n4,,6\r\n\"7\",8e1,\r\n-1, 0.25,125e-3");
+
+    std::unique_ptr<CsvFileDataSource> dataSource(createDataSource(file.getPath(), parallel));
+
+    REQUIRE(dataSource->loadDataBlock() == 4);
+    REQUIRE(dataSource->status().ok());
+
+    const std::vector<double> expected = { 1.5, 2, 3, 4, 0, 6, 0, 80, 0, -1, 0.25, 0.125 };
+    daal::test::checkTablesEqual(*daal::test::createTable(expected, 3), *dataSource->getNumericTable());
+}
+
+TEST("CSV loading stops at the first empty line", "[csv][parallel]")
+{
+    const bool parallel = GENERATE(false, true);
+    CAPTURE(parallel);
+
+    const daal::test::TemporaryFile file("daal_parallel_csv_empty_line_test.csv", "1,2\n3,4\n\n5,6\n");
+
+    std::unique_ptr<CsvFileDataSource> dataSource(createDataSource(file.getPath(), parallel));
+
+    REQUIRE(dataSource->loadDataBlock() == 2);
+
+    const std::vector<double> expected = { 1, 2, 3, 4 };
+    daal::test::checkTablesEqual(*daal::test::createTable(expected, 2), *dataSource->getNumericTable());
+}
+
+TEST("CSV row parsing finds delimiters at every position of a long line", "[csv][tokenizer]")
+{
+    /* Tokens of growing lengths put the delimiters at every offset within the vector registers */
+    const size_t nTokens = 40;
+    std::string line;
+    std::vector<double> expected(nTokens);
+    for (size_t i = 0; i < nTokens; i++)
+    {
+        const std::string token = std::to_string(i + 1) + "." + std::string(i % 6, '5');
+        expected[i]             = std::strtod(token.c_str(), NULL);
+        line += token + (i + 1 < nTokens ? ";" : "");
+    }
+
+    std::vector<functionT> funcList(nTokens);
+    std::vector<FeatureAuxData> auxVect(nTokens);
+    for (size_t i = 0; i < nTokens; i++)
+    {
+        funcList[i]    = (i % 5 == 3) ? ModifierIface::nullFunc : ModifierIface::contFunc;
+        auxVect[i].idx = i;
+    }
+
+    std::vector<DAAL_DATA_TYPE> row(nTokens, -1);
+    internal::parseCsvRow(line.c_str(), line.size(), ';', funcList.data(), auxVect.data(), nTokens, &ModifierIface::contFunc, row.data());
+
+    for (size_t i = 0; i < nTokens; i++)
+    {
+        CAPTURE(i);
+        if (i % 5 == 3)
+        {
+            REQUIRE(row[i] == -1);
+        }
+        else
+        {
+            REQUIRE(row[i] == static_cast<DAAL_DATA_TYPE>(expected[i]));
+        }
+    }
+}
+
+} // namespace test
+} // namespace data_management
+} // namespace daal
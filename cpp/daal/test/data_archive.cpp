@@ -0,0 +1,139 @@
+/* file: data_archive.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <random>
+#include <vector>
+
+#include "daal.h"
+#include "oneapi/dal/test/engine/common.hpp"
+#include "test/test_utils.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace test
+{
+const size_t nRows     = 100;
+const size_t nFeatures = 7;
+
+std::vector<double> generateValues()
+{
+    std::mt19937 engine(2021);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    std::vector<double> values(nRows * nFeatures);
+    for (size_t i = 0; i < values.size(); i++) values[i] = uniform(engine);
+    return values;
+}
+
+/* Serializes the object into the buffer allocated by the library, so the buffer is aligned to DAAL_MALLOC_DEFAULT_ALIGNMENT */
+services::SharedPtr<byte> serialize(SerializationIface & object, size_t & size)
+{
+    InputDataArchive archive;
+    object.serialize(archive);
+    size = archive.getSizeOfArchive();
+    services::SharedPtr<byte> buffer((byte *)services::daal_malloc(size), services::ServiceDeleter());
+    REQUIRE(buffer);
+    REQUIRE(archive.copyArchiveToArray(buffer.get(), size) == size);
+    return buffer;
+}
+
+bool isInBuffer(const void * ptr, const byte * buffer, size_t size)
+{
+    return (const byte *)ptr >= buffer && (const byte *)ptr < buffer + size;
+}
+
+TEST("numeric table restored from the archive over a shared buffer refers to the buffer", "[data_archive]")
+{
+    const std::vector<double> values = generateValues();
+    const NumericTablePtr table      = daal::test::createTable(values, nFeatures);
+
+    size_t size                                                = 0;
+    services::SharedPtr<byte> buffer                           = serialize(*table, size);
+    const byte * const bufferStart                             = buffer.get();
+    const services::SharedPtr<HomogenNumericTable<double> > restored = HomogenNumericTable<double>::create();
+    {
+        OutputDataArchive archive(buffer, size);
+        restored->deserialize(archive);
+        REQUIRE(archive.getErrors()->size() == 0);
+    }
+    REQUIRE(isInBuffer(restored->getArray(), bufferStart, size));
+
+    /* The table keeps the buffer alive */
+    buffer.reset();
+    daal::test::checkTablesEqual(*table, *restored);
+}
+
+TEST("numeric table restored from the archive over an unaligned buffer copies the data", "[data_archive]")
+{
+    const std::vector<double> values = generateValues();
+    const NumericTablePtr table      = daal::test::createTable(values, nFeatures);
+
+    size_t size                            = 0;
+    const services::SharedPtr<byte> buffer = serialize(*table, size);
+    std::vector<byte> storage(size + 1);
+    for (size_t i = 0; i < size; i++) storage[i + 1] = buffer.get()[i];
+
+    const services::SharedPtr<HomogenNumericTable<double> > restored = HomogenNumericTable<double>::create();
+    {
+        OutputDataArchive archive(services::SharedPtr<byte>(storage.data() + 1, services::EmptyDeleter()), size);
+        restored->deserialize(archive);
+    }
+    REQUIRE(!isInBuffer(restored->getArray(), storage.data(), storage.size()));
+    daal::test::checkTablesEqual(*table, *restored);
+}
+
+TEST("model restored from the archive over a shared buffer predicts as the original one", "[data_archive]")
+{
+    const std::vector<double> values = generateValues();
+    std::vector<double> responses(nRows);
+    for (size_t i = 0; i < nRows; i++) responses[i] = values[i * nFeatures] - 2.0 * values[i * nFeatures + 1];
+    const NumericTablePtr x = daal::test::createTable(values, nFeatures);
+    const NumericTablePtr y = daal::test::createTable(responses, 1);
+
+    algorithms::gbt::regression::training::Batch<double> training;
+    training.parameter().maxIterations = 10;
+    training.input.set(algorithms::gbt::regression::training::data, x);
+    training.input.set(algorithms::gbt::regression::training::dependentVariable, y);
+    REQUIRE(training.compute().ok());
+    const algorithms::gbt::regression::ModelPtr model = training.getResult()->get(algorithms::gbt::regression::training::model);
+
+    size_t size                                          = 0;
+    const services::SharedPtr<byte> buffer               = serialize(*model, size);
+    const algorithms::gbt::regression::ModelPtr restored = algorithms::gbt::regression::Model::create(nFeatures);
+    {
+        OutputDataArchive archive(buffer, size);
+        restored->deserialize(archive);
+    }
+    REQUIRE(restored->getNumberOfTrees() == model->getNumberOfTrees());
+
+    NumericTablePtr predictions[2];
+    const algorithms::gbt::regression::ModelPtr models[2] = { model, restored };
+    for (size_t i = 0; i < 2; i++)
+    {
+        algorithms::gbt::regression::prediction::Batch<double> prediction;
+        prediction.input.set(algorithms::gbt::regression::prediction::data, x);
+        prediction.input.set(algorithms::gbt::regression::prediction::model, models[i]);
+        REQUIRE(prediction.compute().ok());
+        predictions[i] = prediction.getResult()->get(algorithms::gbt::regression::prediction::prediction);
+    }
+    daal::test::checkTablesEqual(*predictions[0], *predictions[1]);
+}
+
+} // namespace test
+} // namespace data_management
+} // namespace daal
@@ -0,0 +1,149 @@
+/* file: data_block_prefetcher.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "daal.h"
+#include "oneapi/dal/test/engine/common.hpp"
+#include "test/test_utils.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace test
+{
+typedef FileDataSource<CSVFeatureManager> CsvFileDataSource;
+
+const size_t nRows     = 1000;
+const size_t nFeatures = 3;
+
+/* Generates the CSV text of random integers and stores the same values by rows */
+std::string generateCsv(std::vector<double> & values)
+{
+    std::mt19937 engine(2021);
+    std::uniform_int_distribution<int> distribution(-1000, 1000);
+    std::string text;
+    values.resize(nRows * nFeatures);
+    for (size_t i = 0; i < nRows; i++)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            const int value           = distribution(engine);
+            values[i * nFeatures + j] = double(value);
+            text += std::to_string(value) + ((j + 1 < nFeatures) ? "," : "\n");
+        }
+    }
+    return text;
+}
+
+CsvFileDataSource * createDataSource(const std::string & path)
+{
+    return new CsvFileDataSource(path, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+}
+
+/* Sets the block of the data set as the input of the covariance algorithm */
+struct SetCovarianceInput
+{
+    SetCovarianceInput(algorithms::covariance::Online<> & algorithm) : _algorithm(algorithm) {}
+
+    void operator()(const NumericTablePtr & block) const { _algorithm.input.set(algorithms::covariance::data, block); }
+
+    algorithms::covariance::Online<> & _algorithm;
+};
+
+TEST("prefetched blocks contain all rows of the data source in order", "[prefetcher]")
+{
+    const size_t nTables   = GENERATE(2, 3);
+    const size_t blockRows = GENERATE(7, 1000, 3000);
+    CAPTURE(nTables, blockRows);
+
+    std::vector<double> expected;
+    const daal::test::TemporaryFile file("daal_prefetcher_test.csv", generateCsv(expected));
+    std::unique_ptr<CsvFileDataSource> dataSource(createDataSource(file.getPath()));
+
+    DataBlockPrefetcher prefetcher(*dataSource, blockRows, nTables);
+    std::vector<double> actual;
+    for (NumericTablePtr block = prefetcher.next(); block; block = prefetcher.next())
+    {
+        REQUIRE(block->getNumberOfRows() <= blockRows);
+        const std::vector<double> values = daal::test::getTableValues(*block);
+        actual.insert(actual.end(), values.begin(), values.end());
+    }
+    REQUIRE(prefetcher.status().ok());
+    REQUIRE(actual == expected);
+}
+
+TEST("online covariance over prefetched blocks matches batch covariance", "[prefetcher]")
+{
+    std::vector<double> values;
+    const daal::test::TemporaryFile file("daal_prefetcher_covariance_test.csv", generateCsv(values));
+    std::unique_ptr<CsvFileDataSource> dataSource(createDataSource(file.getPath()));
+
+    DataBlockPrefetcher prefetcher(*dataSource, 64, 3);
+    algorithms::covariance::Online<> online;
+    REQUIRE(computeOnline(prefetcher, online, SetCovarianceInput(online)).ok());
+    REQUIRE(online.finalizeCompute().ok());
+
+    algorithms::covariance::Batch<> batch;
+    batch.input.set(algorithms::covariance::data, daal::test::createTable(values, nFeatures));
+    REQUIRE(batch.compute().ok());
+
+    daal::test::checkTablesEqual(*batch.getResult()->get(algorithms::covariance::covariance),
+                                 *online.getResult()->get(algorithms::covariance::covariance), 1e-8);
+    daal::test::checkTablesEqual(*batch.getResult()->get(algorithms::covariance::mean), *online.getResult()->get(algorithms::covariance::mean),
+                                 1e-10);
+}
+
+TEST("prefetcher can be destroyed before the data source is exhausted", "[prefetcher]")
+{
+    std::vector<double> values;
+    const daal::test::TemporaryFile file("daal_prefetcher_early_stop_test.csv", generateCsv(values));
+    std::unique_ptr<CsvFileDataSource> dataSource(createDataSource(file.getPath()));
+
+    DataBlockPrefetcher prefetcher(*dataSource, 10, 4);
+    const NumericTablePtr block = prefetcher.next();
+    REQUIRE(block);
+    REQUIRE(block->getNumberOfRows() == 10);
+}
+
+TEST("prefetcher rejects incorrect parameters", "[prefetcher]")
+{
+    std::vector<double> values;
+    const daal::test::TemporaryFile file("daal_prefetcher_parameters_test.csv", generateCsv(values));
+    std::unique_ptr<CsvFileDataSource> dataSource(createDataSource(file.getPath()));
+
+    SECTION("single table")
+    {
+        DataBlockPrefetcher prefetcher(*dataSource, 10, 1);
+        REQUIRE(!prefetcher.status());
+        REQUIRE(!prefetcher.next());
+    }
+
+    SECTION("empty block")
+    {
+        DataBlockPrefetcher prefetcher(*dataSource, 0, 2);
+        REQUIRE(!prefetcher.status());
+        REQUIRE(!prefetcher.next());
+    }
+}
+
+} // namespace test
+} // namespace data_management
+} // namespace daal
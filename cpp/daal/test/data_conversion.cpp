@@ -0,0 +1,94 @@
+/* file: data_conversion.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdint>
+#include <vector>
+
+#include "daal.h"
+#include "data_management/data/internal/conversion.h"
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace daal
+{
+namespace data_management
+{
+namespace test
+{
+using internal::ColumnChunk;
+
+/* Columns of different types split into chunks at different rows, as the chunked arrays of Arrow tables */
+struct Columns
+{
+    Columns(size_t nRows) : nRows(nRows), ints(nRows), floats(nRows), doubles(nRows)
+    {
+        for (size_t i = 0; i < nRows; i++)
+        {
+            ints[i]    = int32_t(i) - 1000;
+            floats[i]  = float(i) * 0.5f;
+            doubles[i] = double(i) * 0.25 - 7.0;
+        }
+        addChunks(0, (const char *)ints.data(), features::DAAL_INT32_S, sizeof(int32_t), nRows / 3 + 1);
+        addChunks(1, (const char *)floats.data(), features::DAAL_FLOAT32, sizeof(float), nRows);
+        addChunks(2, (const char *)doubles.data(), features::DAAL_FLOAT64, sizeof(double), 1000);
+    }
+
+    void addChunks(size_t column, const char * ptr, int indexType, size_t typeSize, size_t chunkSize)
+    {
+        for (size_t first = 0; first < nRows; first += chunkSize)
+        {
+            const ColumnChunk chunk = { ptr + first * typeSize, first, (first + chunkSize < nRows) ? chunkSize : nRows - first, column, indexType,
+                                        typeSize };
+            chunks.push_back(chunk);
+        }
+    }
+
+    template <typename T>
+    void check(internal::ConversionDataType dstType)
+    {
+        std::vector<T> rows(nRows * nColumns);
+        internal::convertColumnChunksToRows(chunks.data(), chunks.size(), nRows, nColumns, dstType, rows.data());
+        for (size_t i = 0; i < nRows; i++)
+        {
+            CAPTURE(i);
+            REQUIRE(rows[i * nColumns] == T(ints[i]));
+            REQUIRE(rows[i * nColumns + 1] == T(floats[i]));
+            REQUIRE(rows[i * nColumns + 2] == T(doubles[i]));
+        }
+    }
+
+    static const size_t nColumns = 3;
+    size_t nRows;
+    std::vector<int32_t> ints;
+    std::vector<float> floats;
+    std::vector<double> doubles;
+    std::vector<ColumnChunk> chunks;
+};
+
+/* The large blocks are converted in parallel by the blocks of rows that cross the boundaries of the chunks */
+TEST("column chunks are converted into the block of rows", "[data_conversion]")
+{
+    const size_t nRows = GENERATE(1, 10, 2500, 100001);
+    CAPTURE(nRows);
+
+    Columns columns(nRows);
+    columns.check<double>(internal::DAAL_DOUBLE);
+    columns.check<float>(internal::DAAL_SINGLE);
+}
+
+} // namespace test
+} // namespace data_management
+} // namespace daal
@@ -0,0 +1,99 @@
+/* file: dbscan.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <random>
+#include <vector>
+
+#include "daal.h"
+#include "oneapi/dal/test/engine/common.hpp"
+#include "test/test_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace dbscan
+{
+namespace test
+{
+using namespace daal::data_management;
+
+const size_t nFeatures = 2;
+
+/* Generates the well separated blobs with the uniform noise around them */
+NumericTablePtr generateBlobs(size_t nBlobs, size_t nBlobRows, size_t nNoiseRows)
+{
+    std::mt19937 engine(2021);
+    std::normal_distribution<double> blob(0.0, 0.2);
+    std::uniform_real_distribution<double> noise(-5.0, 5.0 + 10.0 * double(nBlobs));
+    std::vector<double> values;
+    for (size_t i = 0; i < nBlobs * nBlobRows; i++)
+    {
+        const double center = 10.0 * double(i % nBlobs);
+        for (size_t j = 0; j < nFeatures; j++) values.push_back(center + blob(engine));
+    }
+    for (size_t i = 0; i < nNoiseRows * nFeatures; i++) values.push_back(noise(engine));
+    return daal::test::createTable(values, nFeatures);
+}
+
+/* Generates the observations with a few distinct values, so the most of them are duplicates */
+NumericTablePtr generateDuplicates(size_t nRows)
+{
+    std::mt19937 engine(7);
+    std::uniform_int_distribution<int> value(0, 5);
+    std::vector<double> values(nRows * nFeatures);
+    for (size_t i = 0; i < values.size(); i++) values[i] = 0.5 * double(value(engine));
+    return daal::test::createTable(values, nFeatures);
+}
+
+template <Method method>
+ResultPtr cluster(const NumericTablePtr & x, double epsilon, size_t minObservations, DistanceType distanceType)
+{
+    Batch<double, method> algorithm(epsilon, minObservations);
+    algorithm.parameter().distanceType = distanceType;
+    algorithm.input.set(data, x);
+    REQUIRE(algorithm.compute().ok());
+    return algorithm.getResult();
+}
+
+void checkResultsEqual(const NumericTablePtr & x, double epsilon, size_t minObservations, DistanceType distanceType)
+{
+    const ResultPtr expected = cluster<defaultDense>(x, epsilon, minObservations, distanceType);
+    const ResultPtr actual   = cluster<gridDense>(x, epsilon, minObservations, distanceType);
+    daal::test::checkTablesEqual(*expected->get(nClusters), *actual->get(nClusters));
+    daal::test::checkTablesEqual(*expected->get(assignments), *actual->get(assignments));
+}
+
+TEST("dbscan grid method matches the default method", "[dbscan][grid]")
+{
+    const DistanceType distanceType = GENERATE(euclidean, manhattan);
+    CAPTURE(distanceType);
+    checkResultsEqual(generateBlobs(4, 300, 100), 0.3, 5, distanceType);
+}
+
+TEST("dbscan grid method accepts zero epsilon", "[dbscan][grid]")
+{
+    const NumericTablePtr x      = generateDuplicates(200);
+    const size_t minObservations = GENERATE(1, 6);
+    CAPTURE(minObservations);
+    checkResultsEqual(x, 0.0, minObservations, euclidean);
+}
+
+} // namespace test
+} // namespace dbscan
+} // namespace algorithms
+} // namespace daal
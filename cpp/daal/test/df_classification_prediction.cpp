@@ -0,0 +1,172 @@
+/* file: df_classification_prediction.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "daal.h"
+#include "oneapi/dal/test/engine/common.hpp"
+#include "test/test_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace test
+{
+using namespace daal::data_management;
+
+typedef classification::prediction::Batch<double> Prediction;
+
+const size_t nFeatures = 5;
+
+/* Generates the observations which labels depend on the first three features */
+NumericTablePtr generateData(size_t nRows, size_t nClasses, unsigned seed, NumericTablePtr & labels)
+{
+    std::mt19937 engine(seed);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    std::vector<double> values(nRows * nFeatures);
+    std::vector<double> y(nRows);
+    for (size_t i = 0; i < nRows; i++)
+    {
+        for (size_t j = 0; j < nFeatures; j++) values[i * nFeatures + j] = uniform(engine);
+        const double * row = &values[i * nFeatures];
+        y[i]               = double(size_t(std::abs(3.0 * row[0] + row[1] * row[2] + 0.3 * uniform(engine)) * 2.0) % nClasses);
+    }
+    labels = daal::test::createTable(y, 1);
+    return daal::test::createTable(values, nFeatures);
+}
+
+classification::ModelPtr train(size_t nClasses, size_t nTrees, unsigned seed)
+{
+    NumericTablePtr labels;
+    const NumericTablePtr x = generateData(2000, nClasses, seed, labels);
+
+    classification::training::Batch<double> training(nClasses);
+    training.parameter().nTrees = nTrees;
+    training.input.set(classifier::training::data, x);
+    training.input.set(classifier::training::labels, labels);
+    REQUIRE(training.compute().ok());
+    return training.getResult()->get(classifier::training::model);
+}
+
+void setUp(Prediction & algorithm, classification::prediction::VotingMethod votingMethod, const NumericTablePtr & x,
+           const classification::ModelPtr & model)
+{
+    algorithm.parameter().votingMethod      = votingMethod;
+    algorithm.parameter().resultsToEvaluate = classifier::computeClassLabels | classifier::computeClassProbabilities;
+    algorithm.input.set(classifier::prediction::data, x);
+    algorithm.input.set(classifier::prediction::model, model);
+}
+
+/* Predicts the observations one by one, the single row is evaluated by the trees of the model without the node arena */
+void predictByRows(size_t nClasses, classification::prediction::VotingMethod votingMethod, const NumericTablePtr & x,
+                   const classification::ModelPtr & model, std::vector<double> & labels, std::vector<double> & probabilities)
+{
+    const std::vector<double> values = daal::test::getTableValues(*x);
+    const size_t nRows               = x->getNumberOfRows();
+    labels.clear();
+    probabilities.clear();
+    for (size_t i = 0; i < nRows; i++)
+    {
+        Prediction algorithm(nClasses);
+        setUp(algorithm, votingMethod, daal::test::createTable(std::vector<double>(&values[i * nFeatures], &values[(i + 1) * nFeatures]), nFeatures),
+              model);
+        REQUIRE(algorithm.compute().ok());
+        const std::vector<double> rowProbabilities =
+            daal::test::getTableValues(*algorithm.getResult()->get(classifier::prediction::probabilities));
+        labels.push_back(daal::test::getTableValues(*algorithm.getResult()->get(classifier::prediction::prediction))[0]);
+        probabilities.insert(probabilities.end(), rowProbabilities.begin(), rowProbabilities.end());
+    }
+}
+
+void checkPrediction(Prediction & algorithm, size_t nClasses, classification::prediction::VotingMethod votingMethod, const NumericTablePtr & x,
+                     const classification::ModelPtr & model)
+{
+    REQUIRE(algorithm.compute().ok());
+    std::vector<double> labels, probabilities;
+    predictByRows(nClasses, votingMethod, x, model, labels, probabilities);
+
+    const std::vector<double> actualProbabilities = daal::test::getTableValues(*algorithm.getResult()->get(classifier::prediction::probabilities));
+    REQUIRE(actualProbabilities.size() == probabilities.size());
+    for (size_t i = 0; i < probabilities.size(); i++)
+    {
+        CAPTURE(i);
+        REQUIRE(std::abs(actualProbabilities[i] - probabilities[i]) < 1e-10);
+    }
+    daal::test::checkTablesEqual(*daal::test::createTable(labels, 1), *algorithm.getResult()->get(classifier::prediction::prediction), 0.0);
+}
+
+TEST("decision forest classification prediction of many rows matches the prediction of single rows", "[decision_forest][classification]")
+{
+    const size_t nClasses  = GENERATE(2, 5);
+    const bool weighted    = GENERATE(true, false);
+    const size_t nTestRows = GENERATE(100, 1001);
+    CAPTURE(nClasses, weighted, nTestRows);
+    const classification::prediction::VotingMethod votingMethod = weighted ? classification::prediction::weighted : classification::prediction::unweighted;
+
+    const classification::ModelPtr model = train(nClasses, 30, 2021);
+    NumericTablePtr labels;
+    const NumericTablePtr x = generateData(nTestRows, nClasses, 3333, labels);
+
+    Prediction algorithm(nClasses);
+    setUp(algorithm, votingMethod, x, model);
+    checkPrediction(algorithm, nClasses, votingMethod, x, model);
+}
+
+/* The trees packed for the first model must not be used for the second one */
+TEST("repeated decision forest classification prediction follows the change of the model", "[decision_forest][classification]")
+{
+    const size_t nClasses = 3;
+    const classification::ModelPtr model      = train(nClasses, 30, 2021);
+    const classification::ModelPtr otherModel = train(nClasses, 40, 2022);
+    NumericTablePtr labels;
+    const NumericTablePtr x = generateData(1001, nClasses, 3333, labels);
+
+    Prediction algorithm(nClasses);
+    setUp(algorithm, classification::prediction::weighted, x, model);
+    checkPrediction(algorithm, nClasses, classification::prediction::weighted, x, model);
+    checkPrediction(algorithm, nClasses, classification::prediction::weighted, x, model);
+
+    algorithm.input.set(classifier::prediction::model, otherModel);
+    checkPrediction(algorithm, nClasses, classification::prediction::weighted, x, otherModel);
+}
+
+/* The models are released after the prediction, so the new ones may be allocated at the same addresses */
+TEST("decision forest classification prediction follows the models trained in place of the released ones", "[decision_forest][classification]")
+{
+    const size_t nClasses = 3;
+    NumericTablePtr labels;
+    const NumericTablePtr x = generateData(1001, nClasses, 3333, labels);
+
+    Prediction algorithm(nClasses);
+    for (size_t i = 0; i < 4; i++)
+    {
+        const classification::ModelPtr model = train(nClasses, 10 + 20 * (i % 2), 2021 + unsigned(i));
+        setUp(algorithm, classification::prediction::weighted, x, model);
+        checkPrediction(algorithm, nClasses, classification::prediction::weighted, x, model);
+        algorithm.input.set(classifier::prediction::model, classification::ModelPtr());
+    }
+}
+
+} // namespace test
+} // namespace decision_forest
+} // namespace algorithms
+} // namespace daal
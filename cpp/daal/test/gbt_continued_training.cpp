@@ -0,0 +1,191 @@
+/* file: gbt_continued_training.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "daal.h"
+#include "oneapi/dal/test/engine/common.hpp"
+#include "test/test_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace test
+{
+using namespace daal::data_management;
+
+const size_t nRows = 1000;
+
+/* The responses and the labels depend on all features */
+struct Data
+{
+    Data(size_t nFeatures, size_t nClasses)
+    {
+        std::mt19937 engine(2021);
+        std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+        std::vector<double> values(nRows * nFeatures);
+        std::vector<double> responses, labels;
+        for (size_t i = 0; i < nRows; i++)
+        {
+            double sum = 0.0;
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                values[i * nFeatures + j] = uniform(engine);
+                sum += double(j + 1) * values[i * nFeatures + j];
+            }
+            responses.push_back(std::sin(sum) + 0.1 * uniform(engine));
+            labels.push_back(double(size_t(std::abs(sum) * 2.0) % nClasses));
+        }
+        x = daal::test::createTable(values, nFeatures);
+        y = daal::test::createTable(responses, 1);
+        l = daal::test::createTable(labels, 1);
+    }
+
+    NumericTablePtr x;
+    NumericTablePtr y;
+    NumericTablePtr l;
+};
+
+void checkValuesEqual(const std::vector<double> & expected, const std::vector<double> & actual, double tolerance)
+{
+    REQUIRE(expected.size() == actual.size());
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        CAPTURE(i);
+        REQUIRE(std::abs(expected[i] - actual[i]) <= tolerance);
+    }
+}
+
+regression::ModelPtr trainRegression(const Data & data, size_t maxIterations, const regression::ModelPtr & initialModel)
+{
+    regression::training::Batch<double> training;
+    training.parameter().maxIterations = maxIterations;
+    training.input.set(regression::training::data, data.x);
+    training.input.set(regression::training::dependentVariable, data.y);
+    if (initialModel) training.input.set(regression::training::initialModel, initialModel);
+    REQUIRE(training.compute().ok());
+    return training.getResult()->get(regression::training::model);
+}
+
+std::vector<double> predictRegression(const regression::ModelPtr & model, const NumericTablePtr & x, size_t nIterations)
+{
+    regression::prediction::Batch<double> prediction;
+    prediction.parameter().nIterations = nIterations;
+    prediction.input.set(regression::prediction::data, x);
+    prediction.input.set(regression::prediction::model, model);
+    REQUIRE(prediction.compute().ok());
+    return daal::test::getTableValues(*prediction.getResult()->get(regression::prediction::prediction));
+}
+
+double meanSquaredError(const std::vector<double> & expected, const std::vector<double> & actual)
+{
+    double sum = 0.0;
+    for (size_t i = 0; i < expected.size(); i++) sum += (expected[i] - actual[i]) * (expected[i] - actual[i]);
+    return sum / double(expected.size());
+}
+
+/* The trees of the initial model are kept in front of the new ones, so the first iterations predict as the initial model */
+TEST("gbt regression training continued from the initial model appends the new trees", "[gbt][training]")
+{
+    const Data data(5, 2);
+    const regression::ModelPtr initialModel = trainRegression(data, 10, regression::ModelPtr());
+    const size_t nInitialTrees              = initialModel->getNumberOfTrees();
+    const regression::ModelPtr model        = trainRegression(data, 10, initialModel);
+    REQUIRE(model->getNumberOfTrees() == nInitialTrees + 10);
+    REQUIRE(initialModel->getNumberOfTrees() == nInitialTrees);
+
+    const std::vector<double> initialPrediction = predictRegression(initialModel, data.x, 0);
+    checkValuesEqual(initialPrediction, predictRegression(model, data.x, nInitialTrees), 1e-10);
+
+    const std::vector<double> responses = daal::test::getTableValues(*data.y);
+    REQUIRE(meanSquaredError(responses, predictRegression(model, data.x, 0)) < meanSquaredError(responses, initialPrediction));
+}
+
+TEST("gbt regression training rejects the initial model of another number of features", "[gbt][training]")
+{
+    const regression::ModelPtr initialModel = trainRegression(Data(5, 2), 5, regression::ModelPtr());
+    const Data data(4, 2);
+
+    regression::training::Batch<double> training;
+    training.parameter().maxIterations = 5;
+    training.input.set(regression::training::data, data.x);
+    training.input.set(regression::training::dependentVariable, data.y);
+    training.input.set(regression::training::initialModel, initialModel);
+    REQUIRE(!training.computeNoThrow().ok());
+}
+
+classification::ModelPtr trainClassification(const Data & data, size_t nClasses, size_t maxIterations, const classification::ModelPtr & initialModel)
+{
+    classification::training::Batch<double> training(nClasses);
+    training.parameter().maxIterations = maxIterations;
+    training.input.set(classifier::training::data, data.x);
+    training.input.set(classifier::training::labels, data.l);
+    if (initialModel) training.input.set(classification::training::initialModel, initialModel);
+    REQUIRE(training.compute().ok());
+    return training.getResult()->get(classifier::training::model);
+}
+
+std::vector<double> predictProbabilities(const classification::ModelPtr & model, const NumericTablePtr & x, size_t nClasses, size_t nIterations)
+{
+    classification::prediction::Batch<double> prediction(nClasses);
+    prediction.parameter().nIterations       = nIterations;
+    prediction.parameter().resultsToEvaluate = classifier::computeClassProbabilities;
+    prediction.input.set(classifier::prediction::data, x);
+    prediction.input.set(classifier::prediction::model, model);
+    REQUIRE(prediction.compute().ok());
+    return daal::test::getTableValues(*prediction.getResult()->get(classifier::prediction::probabilities));
+}
+
+/* The multi-class model has a tree per class at each iteration */
+TEST("gbt classification training continued from the initial model appends the new iterations", "[gbt][training]")
+{
+    const size_t nClasses = GENERATE(2, 3);
+    CAPTURE(nClasses);
+    const size_t nTreesPerIteration = (nClasses > 2) ? nClasses : 1;
+
+    const Data data(5, nClasses);
+    const classification::ModelPtr initialModel = trainClassification(data, nClasses, 10, classification::ModelPtr());
+    const size_t nInitialIterations             = initialModel->getNumberOfTrees() / nTreesPerIteration;
+    const classification::ModelPtr model        = trainClassification(data, nClasses, 10, initialModel);
+    REQUIRE(model->getNumberOfTrees() == (nInitialIterations + 10) * nTreesPerIteration);
+
+    checkValuesEqual(predictProbabilities(initialModel, data.x, nClasses, 0), predictProbabilities(model, data.x, nClasses, nInitialIterations),
+                     1e-10);
+}
+
+TEST("gbt classification training rejects the initial model of another number of classes", "[gbt][training]")
+{
+    const classification::ModelPtr initialModel = trainClassification(Data(5, 2), 2, 5, classification::ModelPtr());
+    const Data data(5, 3);
+
+    classification::training::Batch<double> training(3);
+    training.parameter().maxIterations = 5;
+    training.input.set(classifier::training::data, data.x);
+    training.input.set(classifier::training::labels, data.l);
+    training.input.set(classification::training::initialModel, initialModel);
+    REQUIRE(!training.computeNoThrow().ok());
+}
+
+} // namespace test
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
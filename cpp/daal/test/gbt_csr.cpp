@@ -0,0 +1,184 @@
+/* file: gbt_csr.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "daal.h"
+#include "oneapi/dal/test/engine/common.hpp"
+#include "test/test_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace test
+{
+using namespace daal::data_management;
+
+const size_t nRows     = 600;
+const size_t nFeatures = 20;
+
+/* Sparse data with about 10% of non-zero entries, the same values are kept in CSR and dense layouts */
+struct SparseData
+{
+    SparseData()
+    {
+        std::mt19937 engine(2021);
+        std::bernoulli_distribution nonZero(0.1);
+        std::uniform_int_distribution<int> value(1, 5);
+        std::normal_distribution<double> noise(0.0, 0.1);
+        std::vector<double> dense(nRows * nFeatures, 0.0);
+        rowOffsets.push_back(1);
+        for (size_t i = 0; i < nRows; i++)
+        {
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                if (!nonZero(engine)) continue;
+                const double v           = double(value(engine));
+                dense[i * nFeatures + j] = v;
+                values.push_back(v);
+                colIndices.push_back(j + 1);
+            }
+            rowOffsets.push_back(values.size() + 1);
+            const double * x = &dense[i * nFeatures];
+            responses.push_back(2.0 * x[0] - x[1] + ((x[2] > 2.5) ? 3.0 : 0.0) + noise(engine));
+            labels.push_back((x[0] + x[3] > x[1] + 1.0) ? 1.0 : 0.0);
+        }
+        csr = CSRNumericTable::create(values.data(), colIndices.data(), rowOffsets.data(), nFeatures, nRows);
+        x   = daal::test::createTable(dense, nFeatures);
+        y   = daal::test::createTable(responses, 1);
+        l   = daal::test::createTable(labels, 1);
+    }
+
+    std::vector<double> values;
+    std::vector<size_t> colIndices;
+    std::vector<size_t> rowOffsets;
+    std::vector<double> responses;
+    std::vector<double> labels;
+    NumericTablePtr csr;
+    NumericTablePtr x;
+    NumericTablePtr y;
+    NumericTablePtr l;
+};
+
+void checkValuesEqual(const std::vector<double> & expected, const std::vector<double> & actual, double tolerance)
+{
+    REQUIRE(expected.size() == actual.size());
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        CAPTURE(i);
+        REQUIRE(std::abs(expected[i] - actual[i]) <= tolerance);
+    }
+}
+
+regression::ModelPtr trainRegression(const NumericTablePtr & x, const NumericTablePtr & y)
+{
+    regression::training::Batch<double> training;
+    training.parameter().maxIterations = 30;
+    training.input.set(regression::training::data, x);
+    training.input.set(regression::training::dependentVariable, y);
+    REQUIRE(training.compute().ok());
+    return training.getResult()->get(regression::training::model);
+}
+
+std::vector<double> predictRegression(const regression::ModelPtr & model, const NumericTablePtr & x)
+{
+    regression::prediction::Batch<double> prediction;
+    prediction.input.set(regression::prediction::data, x);
+    prediction.input.set(regression::prediction::model, model);
+    REQUIRE(prediction.compute().ok());
+    return daal::test::getTableValues(*prediction.getResult()->get(regression::prediction::prediction));
+}
+
+TEST("gbt regression trained on CSR data fits the responses", "[gbt][csr]")
+{
+    const SparseData data;
+    const std::vector<double> predicted = predictRegression(trainRegression(data.csr, data.y), data.csr);
+
+    double mean = 0.0;
+    for (size_t i = 0; i < nRows; i++) mean += data.responses[i] / double(nRows);
+    double variance = 0.0, mse = 0.0;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        variance += (data.responses[i] - mean) * (data.responses[i] - mean) / double(nRows);
+        mse += (data.responses[i] - predicted[i]) * (data.responses[i] - predicted[i]) / double(nRows);
+    }
+    REQUIRE(mse < 0.1 * variance);
+}
+
+TEST("gbt regression prediction on CSR data matches prediction on dense data", "[gbt][csr]")
+{
+    const SparseData data;
+    const regression::ModelPtr model = trainRegression(data.csr, data.y);
+    checkValuesEqual(predictRegression(model, data.x), predictRegression(model, data.csr), 1e-10);
+}
+
+TEST("gbt classification prediction on CSR data matches prediction on dense data", "[gbt][csr]")
+{
+    const SparseData data;
+
+    classification::training::Batch<double> training(2);
+    training.parameter().maxIterations = 30;
+    training.input.set(classifier::training::data, data.csr);
+    training.input.set(classifier::training::labels, data.l);
+    REQUIRE(training.compute().ok());
+    const classification::ModelPtr model = training.getResult()->get(classifier::training::model);
+
+    std::vector<double> labels[2], probabilities[2];
+    const NumericTablePtr inputs[2] = { data.x, data.csr };
+    for (size_t i = 0; i < 2; i++)
+    {
+        classification::prediction::Batch<double> prediction(2);
+        prediction.parameter().resultsToEvaluate = classifier::computeClassLabels | classifier::computeClassProbabilities;
+        prediction.input.set(classifier::prediction::data, inputs[i]);
+        prediction.input.set(classifier::prediction::model, model);
+        REQUIRE(prediction.compute().ok());
+        labels[i]        = daal::test::getTableValues(*prediction.getResult()->get(classifier::prediction::prediction));
+        probabilities[i] = daal::test::getTableValues(*prediction.getResult()->get(classifier::prediction::probabilities));
+    }
+    checkValuesEqual(labels[0], labels[1], 0.0);
+    checkValuesEqual(probabilities[0], probabilities[1], 1e-10);
+
+    size_t nErrors = 0;
+    for (size_t i = 0; i < nRows; i++) nErrors += (labels[1][i] != data.labels[i]);
+    REQUIRE(nErrors < nRows / 10);
+}
+
+TEST("gbt training rejects the settings not supported for CSR data", "[gbt][csr]")
+{
+    const SparseData data;
+    const int setting = GENERATE(0, 1, 2);
+    CAPTURE(setting);
+
+    regression::training::Batch<double> algorithm;
+    algorithm.parameter().maxIterations = 5;
+    if (setting == 0) algorithm.parameter().splitMethod = training::exact;
+    if (setting == 1) algorithm.parameter().memorySavingMode = true;
+    if (setting == 2) algorithm.parameter().featuresPerNode = nFeatures / 2;
+    algorithm.input.set(regression::training::data, data.csr);
+    algorithm.input.set(regression::training::dependentVariable, data.y);
+    REQUIRE(!algorithm.computeNoThrow());
+}
+
+} // namespace test
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,104 @@
+/* file: gbt_early_stopping.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <random>
+#include <vector>
+
+#include "daal.h"
+#include "oneapi/dal/test/engine/common.hpp"
+#include "test/test_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace test
+{
+using namespace daal::data_management;
+
+const size_t nRows     = 500;
+const size_t nFeatures = 3;
+
+/* The labels depend on the first feature only, the responses are pure noise */
+struct Data
+{
+    Data(size_t seed)
+    {
+        std::mt19937 engine(seed);
+        std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+        std::vector<double> values(nRows * nFeatures);
+        for (size_t i = 0; i < nRows; i++)
+        {
+            for (size_t j = 0; j < nFeatures; j++) values[i * nFeatures + j] = uniform(engine);
+            labels.push_back((values[i * nFeatures] > 0.0) ? 1.0 : 0.0);
+            responses.push_back(uniform(engine));
+        }
+        x = daal::test::createTable(values, nFeatures);
+        l = daal::test::createTable(labels, 1);
+        y = daal::test::createTable(responses, 1);
+    }
+
+    std::vector<double> labels;
+    std::vector<double> responses;
+    NumericTablePtr x;
+    NumericTablePtr l;
+    NumericTablePtr y;
+};
+
+TEST("gbt regression stops early when the validation metric does not improve", "[gbt][early_stopping]")
+{
+    const Data train(2021), validation(2022);
+
+    regression::training::Batch<double> algorithm;
+    algorithm.parameter().maxIterations       = 100;
+    algorithm.parameter().earlyStoppingRounds = 3;
+    algorithm.input.set(regression::training::data, train.x);
+    algorithm.input.set(regression::training::dependentVariable, train.y);
+    algorithm.input.set(regression::training::validationData, validation.x);
+    algorithm.input.set(regression::training::validationDependentVariable, validation.y);
+    REQUIRE(algorithm.compute().ok());
+    REQUIRE(algorithm.getResult()->get(regression::training::model)->getNumberOfTrees() < 100);
+}
+
+TEST("gbt classification rejects the validation labels out of the class range", "[gbt][early_stopping]")
+{
+    const Data train(2021), validation(2022);
+    const double badLabel = GENERATE(-1.0, 2.0);
+    CAPTURE(badLabel);
+
+    std::vector<double> labels = validation.labels;
+    labels[nRows / 2]          = badLabel;
+
+    classification::training::Batch<double> algorithm(2);
+    algorithm.parameter().maxIterations       = 10;
+    algorithm.parameter().earlyStoppingRounds = 3;
+    algorithm.input.set(classifier::training::data, train.x);
+    algorithm.input.set(classifier::training::labels, train.l);
+    algorithm.input.set(classification::training::validationData, validation.x);
+    algorithm.input.set(classification::training::validationLabels, daal::test::createTable(labels, 1));
+    REQUIRE(!algorithm.computeNoThrow());
+
+    algorithm.input.set(classification::training::validationLabels, validation.l);
+    REQUIRE(algorithm.compute().ok());
+}
+
+} // namespace test
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
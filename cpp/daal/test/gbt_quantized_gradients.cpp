@@ -0,0 +1,104 @@
+/* file: gbt_quantized_gradients.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <random>
+#include <vector>
+
+#include "daal.h"
+#include "oneapi/dal/test/engine/common.hpp"
+#include "test/test_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace test
+{
+using namespace daal::data_management;
+
+const size_t nFeatures = 4;
+
+/* Generates the responses that depend on the first two features only */
+void generateData(size_t nRows, NumericTablePtr & x, NumericTablePtr & y, std::vector<double> & responses)
+{
+    std::mt19937 engine(2021);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    std::normal_distribution<double> noise(0.0, 0.05);
+    std::vector<double> values(nRows * nFeatures);
+    responses.resize(nRows);
+    for (size_t i = 0; i < nRows; i++)
+    {
+        for (size_t j = 0; j < nFeatures; j++) values[i * nFeatures + j] = uniform(engine);
+        responses[i] = ((values[i * nFeatures] > 0.0) ? 2.0 : -1.0) + values[i * nFeatures + 1] + noise(engine);
+    }
+    x = daal::test::createTable(values, nFeatures);
+    y = daal::test::createTable(responses, 1);
+}
+
+/* Returns the mean squared error of the model trained and evaluated on the same data */
+double trainingError(size_t nRows, size_t gradientBits)
+{
+    NumericTablePtr x, y;
+    std::vector<double> responses;
+    generateData(nRows, x, y, responses);
+
+    regression::training::Batch<double> training;
+    training.parameter().maxIterations = 20;
+    training.parameter().splitMethod   = gbt::training::inexact;
+    training.parameter().gradientBits  = gradientBits;
+    training.input.set(regression::training::data, x);
+    training.input.set(regression::training::dependentVariable, y);
+    REQUIRE(training.compute().ok());
+
+    regression::prediction::Batch<double> prediction;
+    prediction.input.set(regression::prediction::data, x);
+    prediction.input.set(regression::prediction::model, training.getResult()->get(regression::training::model));
+    REQUIRE(prediction.compute().ok());
+    const std::vector<double> predicted = daal::test::getTableValues(*prediction.getResult()->get(regression::prediction::prediction));
+
+    double mse = 0.0;
+    for (size_t i = 0; i < nRows; i++) mse += (responses[i] - predicted[i]) * (responses[i] - predicted[i]) / double(nRows);
+    return mse;
+}
+
+/* The nodes of the large data sets use the bins of all integer widths: 16 bits for the small nodes,
+   32 bits for the middle ones, and 64 bits for the root with 16-bit gradients */
+TEST("gbt regression with quantized gradients fits as the exact gradients", "[gbt][quantization]")
+{
+    const size_t nRows        = GENERATE(1000, 70000);
+    const size_t gradientBits = GENERATE(8, 16);
+    CAPTURE(nRows, gradientBits);
+
+    const double exactError     = trainingError(nRows, 0);
+    const double quantizedError = trainingError(nRows, gradientBits);
+    REQUIRE(quantizedError < 1.5 * exactError + 1e-3);
+}
+
+TEST("gbt training rejects the unsupported number of gradient bits", "[gbt][quantization]")
+{
+    regression::training::Parameter parameter;
+    parameter.splitMethod  = training::inexact;
+    parameter.gradientBits = 12;
+    REQUIRE(!parameter.check());
+}
+
+} // namespace test
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
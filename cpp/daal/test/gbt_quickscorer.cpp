@@ -0,0 +1,190 @@
+/* file: gbt_quickscorer.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "daal.h"
+#include "oneapi/dal/test/engine/common.hpp"
+#include "test/test_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace test
+{
+using namespace daal::data_management;
+
+const size_t nFeatures = 6;
+
+/* The number of rows is not a multiple of the row blocks, the responses and the labels depend on all features */
+struct Data
+{
+    Data(size_t nRows, size_t nClasses)
+    {
+        std::mt19937 engine(2021);
+        std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+        std::vector<double> values(nRows * nFeatures);
+        std::vector<double> responses, labels;
+        for (size_t i = 0; i < nRows; i++)
+        {
+            double sum = 0.0;
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                values[i * nFeatures + j] = uniform(engine);
+                sum += double(j + 1) * values[i * nFeatures + j];
+            }
+            responses.push_back(std::sin(sum) + 0.1 * uniform(engine));
+            labels.push_back(double(size_t(std::abs(sum) * 2.0) % nClasses));
+        }
+        x = daal::test::createTable(values, nFeatures);
+        y = daal::test::createTable(responses, 1);
+        l = daal::test::createTable(labels, 1);
+    }
+
+    NumericTablePtr x;
+    NumericTablePtr y;
+    NumericTablePtr l;
+};
+
+void checkValuesEqual(const std::vector<double> & expected, const std::vector<double> & actual, double tolerance)
+{
+    REQUIRE(expected.size() == actual.size());
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        CAPTURE(i);
+        REQUIRE(std::abs(expected[i] - actual[i]) <= tolerance);
+    }
+}
+
+template <regression::prediction::Method method>
+std::vector<double> predictRegression(const regression::ModelPtr & model, const NumericTablePtr & x, size_t nIterations)
+{
+    regression::prediction::Batch<double, method> prediction;
+    prediction.parameter().nIterations = nIterations;
+    prediction.input.set(regression::prediction::data, x);
+    prediction.input.set(regression::prediction::model, model);
+    REQUIRE(prediction.compute().ok());
+    return daal::test::getTableValues(*prediction.getResult()->get(regression::prediction::prediction));
+}
+
+template <classification::prediction::Method method>
+void predictClassification(const classification::ModelPtr & model, const NumericTablePtr & x, size_t nClasses, size_t nIterations,
+                           std::vector<double> & labels, std::vector<double> & probabilities)
+{
+    classification::prediction::Batch<double, method> prediction(nClasses);
+    prediction.parameter().nIterations       = nIterations;
+    prediction.parameter().resultsToEvaluate = classifier::computeClassLabels | classifier::computeClassProbabilities;
+    prediction.input.set(classifier::prediction::data, x);
+    prediction.input.set(classifier::prediction::model, model);
+    REQUIRE(prediction.compute().ok());
+    labels        = daal::test::getTableValues(*prediction.getResult()->get(classifier::prediction::prediction));
+    probabilities = daal::test::getTableValues(*prediction.getResult()->get(classifier::prediction::probabilities));
+}
+
+/* The trees of 12 levels need several words of the leaf bit vectors, the trees deeper than 16 levels are evaluated by the default method */
+TEST("gbt regression prediction by QuickScorer matches the default method", "[gbt][quickscorer]")
+{
+    const size_t maxTreeDepth = GENERATE(3, 6, 12, 24);
+    const size_t nIterations  = GENERATE(0, 7);
+    const size_t nRows        = GENERATE(1, 2003);
+    CAPTURE(maxTreeDepth, nIterations, nRows);
+
+    const Data train(3000, 2);
+    regression::training::Batch<double> training;
+    training.parameter().maxIterations             = 20;
+    training.parameter().maxTreeDepth              = maxTreeDepth;
+    training.parameter().minObservationsInLeafNode = 1;
+    training.input.set(regression::training::data, train.x);
+    training.input.set(regression::training::dependentVariable, train.y);
+    REQUIRE(training.compute().ok());
+    const regression::ModelPtr model = training.getResult()->get(regression::training::model);
+
+    const Data test(nRows, 2);
+    checkValuesEqual(predictRegression<regression::prediction::defaultDense>(model, test.x, nIterations),
+                     predictRegression<regression::prediction::quickScorer>(model, test.x, nIterations), 1e-10);
+}
+
+TEST("gbt classification prediction by QuickScorer matches the default method", "[gbt][quickscorer]")
+{
+    const size_t nClasses = GENERATE(2, 3);
+    const size_t nRows    = GENERATE(1, 2003);
+    CAPTURE(nClasses, nRows);
+
+    const Data train(3000, nClasses);
+    classification::training::Batch<double> training(nClasses);
+    training.parameter().maxIterations = 20;
+    training.input.set(classifier::training::data, train.x);
+    training.input.set(classifier::training::labels, train.l);
+    REQUIRE(training.compute().ok());
+    const classification::ModelPtr model = training.getResult()->get(classifier::training::model);
+
+    const Data test(nRows, nClasses);
+    std::vector<double> labels[2], probabilities[2];
+    predictClassification<classification::prediction::defaultDense>(model, test.x, nClasses, 0, labels[0], probabilities[0]);
+    predictClassification<classification::prediction::quickScorer>(model, test.x, nClasses, 0, labels[1], probabilities[1]);
+    checkValuesEqual(probabilities[0], probabilities[1], 1e-10);
+    checkValuesEqual(labels[0], labels[1], 0.0);
+}
+
+regression::ModelPtr trainRegression(const Data & data, size_t maxIterations)
+{
+    regression::training::Batch<double> training;
+    training.parameter().maxIterations = maxIterations;
+    training.input.set(regression::training::data, data.x);
+    training.input.set(regression::training::dependentVariable, data.y);
+    REQUIRE(training.compute().ok());
+    return training.getResult()->get(regression::training::model);
+}
+
+/* The representation of the trees is kept by the algorithm between the calls, it must follow the model and the number of iterations */
+TEST("repeated gbt regression prediction by QuickScorer follows the changes of the model", "[gbt][quickscorer]")
+{
+    const Data train(3000, 2);
+    const Data test(3, 2);
+
+    regression::prediction::Batch<double, regression::prediction::quickScorer> prediction;
+    prediction.input.set(regression::prediction::data, test.x);
+    for (size_t i = 0; i < 4; i++)
+    {
+        CAPTURE(i);
+        const regression::ModelPtr model = trainRegression(train, 10 + 5 * i);
+        prediction.input.set(regression::prediction::model, model);
+        for (size_t nIterations = 0; nIterations < 3; nIterations++)
+        {
+            CAPTURE(nIterations);
+            prediction.parameter().nIterations = nIterations;
+            for (size_t iRepeat = 0; iRepeat < 2; iRepeat++)
+            {
+                REQUIRE(prediction.compute().ok());
+                checkValuesEqual(predictRegression<regression::prediction::defaultDense>(model, test.x, nIterations),
+                                 daal::test::getTableValues(*prediction.getResult()->get(regression::prediction::prediction)), 1e-10);
+            }
+        }
+        /* The model is released, so the next one may be allocated at the same address */
+        prediction.input.set(regression::prediction::model, regression::ModelPtr());
+    }
+}
+
+} // namespace test
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
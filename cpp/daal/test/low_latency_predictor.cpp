@@ -0,0 +1,201 @@
+/* file: low_latency_predictor.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "daal.h"
+#include "oneapi/dal/test/engine/common.hpp"
+#include "test/test_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace test
+{
+using namespace daal::data_management;
+
+const size_t nRows       = 500;
+const size_t nFeatures   = 3;
+const size_t nCategories = 5;
+
+/* Generates the data with the categorical first feature, the responses are not monotonic in the category */
+void generateData(bool categorical, NumericTablePtr & x, NumericTablePtr & y, NumericTablePtr & labels)
+{
+    const double categoryEffect[nCategories] = { 3.0, -2.0, 5.0, 0.0, -4.0 };
+    std::mt19937 engine(777);
+    std::uniform_int_distribution<int> category(0, nCategories - 1);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    std::vector<double> xValues(nRows * nFeatures);
+    std::vector<double> yValues(nRows);
+    std::vector<double> labelValues(nRows);
+    for (size_t i = 0; i < nRows; i++)
+    {
+        const int c                = category(engine);
+        xValues[i * nFeatures]     = double(c);
+        xValues[i * nFeatures + 1] = uniform(engine);
+        xValues[i * nFeatures + 2] = uniform(engine);
+        yValues[i]                 = categoryEffect[c] + xValues[i * nFeatures + 1];
+        labelValues[i]             = (yValues[i] > 0.5) ? 1.0 : 0.0;
+    }
+    x      = daal::test::createTable(xValues, nFeatures);
+    y      = daal::test::createTable(yValues, 1);
+    labels = daal::test::createTable(labelValues, 1);
+    if (categorical)
+    {
+        (*x->getDictionarySharedPtr())[0].featureType = features::DAAL_CATEGORICAL;
+    }
+}
+
+void checkValuesEqual(const std::vector<double> & expected, const std::vector<double> & actual, double tolerance)
+{
+    REQUIRE(expected.size() == actual.size());
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        CAPTURE(i);
+        REQUIRE(std::abs(expected[i] - actual[i]) <= tolerance);
+    }
+}
+
+TEST("gbt regression low latency predictor matches batch prediction", "[gbt][low_latency]")
+{
+    const bool categorical = GENERATE(false, true);
+    CAPTURE(categorical);
+    NumericTablePtr x, y, labels;
+    generateData(categorical, x, y, labels);
+
+    gbt::regression::training::Batch<double> training;
+    training.parameter().maxIterations = 20;
+    training.input.set(gbt::regression::training::data, x);
+    training.input.set(gbt::regression::training::dependentVariable, y);
+    REQUIRE(training.compute().ok());
+    const gbt::regression::ModelPtr model = training.getResult()->get(gbt::regression::training::model);
+
+    gbt::regression::prediction::Batch<double> prediction;
+    prediction.input.set(gbt::regression::prediction::data, x);
+    prediction.input.set(gbt::regression::prediction::model, model);
+    REQUIRE(prediction.compute().ok());
+    const std::vector<double> expected = daal::test::getTableValues(*prediction.getResult()->get(gbt::regression::prediction::prediction));
+
+    const gbt::regression::prediction::LowLatencyPredictor predictor(model, x);
+    REQUIRE(predictor.getStatus().ok());
+    const std::vector<double> xValues = daal::test::getTableValues(*x);
+    std::vector<double> actual(nRows);
+    REQUIRE(predictor.predict(xValues.data(), nRows, actual.data()).ok());
+    checkValuesEqual(expected, actual, 1e-10);
+}
+
+TEST("gbt classification low latency predictor matches batch prediction", "[gbt][low_latency]")
+{
+    const bool categorical = GENERATE(false, true);
+    CAPTURE(categorical);
+    NumericTablePtr x, y, labels;
+    generateData(categorical, x, y, labels);
+
+    gbt::classification::training::Batch<double> training(2);
+    training.parameter().maxIterations = 20;
+    training.input.set(classifier::training::data, x);
+    training.input.set(classifier::training::labels, labels);
+    REQUIRE(training.compute().ok());
+    const gbt::classification::ModelPtr model = training.getResult()->get(classifier::training::model);
+
+    gbt::classification::prediction::Batch<double> prediction(2);
+    prediction.parameter().resultsToEvaluate = classifier::computeClassLabels | classifier::computeClassProbabilities;
+    prediction.input.set(classifier::prediction::data, x);
+    prediction.input.set(classifier::prediction::model, model);
+    REQUIRE(prediction.compute().ok());
+    const std::vector<double> expectedLabels = daal::test::getTableValues(*prediction.getResult()->get(classifier::prediction::prediction));
+    const std::vector<double> expectedProbabilities =
+        daal::test::getTableValues(*prediction.getResult()->get(classifier::prediction::probabilities));
+
+    gbt::classification::prediction::LowLatencyPredictor predictor(model, 2, x);
+    REQUIRE(predictor.getStatus().ok());
+    const std::vector<double> xValues = daal::test::getTableValues(*x);
+    std::vector<double> actualLabels(nRows);
+    std::vector<double> actualProbabilities(nRows * 2);
+    REQUIRE(predictor.predict(xValues.data(), nRows, actualLabels.data(), actualProbabilities.data()).ok());
+    checkValuesEqual(expectedLabels, actualLabels, 0.0);
+    checkValuesEqual(expectedProbabilities, actualProbabilities, 1e-10);
+}
+
+TEST("decision forest regression low latency predictor matches batch prediction", "[df][low_latency]")
+{
+    const bool categorical = GENERATE(false, true);
+    CAPTURE(categorical);
+    NumericTablePtr x, y, labels;
+    generateData(categorical, x, y, labels);
+
+    decision_forest::regression::training::Batch<double> training;
+    training.parameter().nTrees = 10;
+    training.input.set(decision_forest::regression::training::data, x);
+    training.input.set(decision_forest::regression::training::dependentVariable, y);
+    REQUIRE(training.compute().ok());
+    const decision_forest::regression::ModelPtr model = training.getResult()->get(decision_forest::regression::training::model);
+
+    decision_forest::regression::prediction::Batch<double> prediction;
+    prediction.input.set(decision_forest::regression::prediction::data, x);
+    prediction.input.set(decision_forest::regression::prediction::model, model);
+    REQUIRE(prediction.compute().ok());
+    const std::vector<double> expected =
+        daal::test::getTableValues(*prediction.getResult()->get(decision_forest::regression::prediction::prediction));
+
+    const decision_forest::regression::prediction::LowLatencyPredictor predictor(model, x);
+    REQUIRE(predictor.getStatus().ok());
+    const std::vector<double> xValues = daal::test::getTableValues(*x);
+    std::vector<double> actual(nRows);
+    REQUIRE(predictor.predict(xValues.data(), nRows, actual.data()).ok());
+    checkValuesEqual(expected, actual, 1e-10);
+}
+
+TEST("decision forest classification low latency predictor matches batch prediction", "[df][low_latency]")
+{
+    const bool categorical = GENERATE(false, true);
+    CAPTURE(categorical);
+    NumericTablePtr x, y, labels;
+    generateData(categorical, x, y, labels);
+
+    decision_forest::classification::training::Batch<double> training(2);
+    training.parameter().nTrees = 10;
+    training.input.set(classifier::training::data, x);
+    training.input.set(classifier::training::labels, labels);
+    REQUIRE(training.compute().ok());
+    const decision_forest::classification::ModelPtr model = training.getResult()->get(classifier::training::model);
+
+    decision_forest::classification::prediction::Batch<double> prediction(2);
+    prediction.parameter().resultsToEvaluate = classifier::computeClassLabels | classifier::computeClassProbabilities;
+    prediction.input.set(classifier::prediction::data, x);
+    prediction.input.set(classifier::prediction::model, model);
+    REQUIRE(prediction.compute().ok());
+    const std::vector<double> expectedLabels = daal::test::getTableValues(*prediction.getResult()->get(classifier::prediction::prediction));
+    const std::vector<double> expectedProbabilities =
+        daal::test::getTableValues(*prediction.getResult()->get(classifier::prediction::probabilities));
+
+    decision_forest::classification::prediction::LowLatencyPredictor predictor(model, x, 2);
+    REQUIRE(predictor.getStatus().ok());
+    const std::vector<double> xValues = daal::test::getTableValues(*x);
+    std::vector<double> actualLabels(nRows);
+    std::vector<double> actualProbabilities(nRows * 2);
+    REQUIRE(predictor.predict(xValues.data(), nRows, actualLabels.data(), actualProbabilities.data()).ok());
+    checkValuesEqual(expectedLabels, actualLabels, 0.0);
+    checkValuesEqual(expectedProbabilities, actualProbabilities, 1e-10);
+}
+
+} // namespace test
+} // namespace algorithms
+} // namespace daal
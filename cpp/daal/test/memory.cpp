@@ -0,0 +1,79 @@
+/* file: memory.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "daal.h"
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace daal
+{
+namespace services
+{
+namespace test
+{
+/* Size exceeding the threshold of parallel memory operations, not a multiple of the block size */
+const size_t largeSize = 9 * 1024 * 1024 + 123;
+
+TEST("large copy at an unaligned address copies every byte", "[memory][parallel]")
+{
+    const size_t destOffset = GENERATE(0, 1, 4095, 4096 + 17);
+    const size_t srcOffset  = GENERATE(0, 3);
+    CAPTURE(destOffset, srcOffset);
+
+    std::vector<char> src(largeSize + srcOffset);
+    for (size_t i = 0; i < src.size(); i++)
+    {
+        src[i] = static_cast<char>((i * 31) % 251);
+    }
+    std::vector<char> dest(largeSize + destOffset + 1, 0);
+
+    REQUIRE(internal::daal_memcpy_s(&dest[destOffset], largeSize, &src[srcOffset], largeSize) == 0);
+
+    for (size_t i = 0; i < destOffset; i++)
+    {
+        REQUIRE(dest[i] == 0);
+    }
+    for (size_t i = 0; i < largeSize; i++)
+    {
+        if (dest[destOffset + i] != src[srcOffset + i])
+        {
+            FAIL("mismatch at byte " << i);
+        }
+    }
+    REQUIRE(dest[destOffset + largeSize] == 0);
+}
+
+TEST("large calloc returns zeroed memory", "[memory][parallel]")
+{
+    const size_t size = GENERATE(largeSize, 64 * 1024 * 1024);
+    CAPTURE(size);
+
+    char * ptr = static_cast<char *>(daal_calloc(size));
+    REQUIRE(ptr != NULL);
+    size_t nNonZero = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        nNonZero += (ptr[i] != 0);
+    }
+    daal_free(ptr);
+    REQUIRE(nNonZero == 0);
+}
+
+} // namespace test
+} // namespace services
+} // namespace daal
@@ -0,0 +1,251 @@
+/* file: multi_class_svm.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "daal.h"
+#include "oneapi/dal/test/engine/common.hpp"
+#include "test/test_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multi_class_classifier
+{
+namespace test
+{
+using namespace daal::data_management;
+
+typedef svm::training::Batch<double, svm::training::thunder> SvmTraining;
+typedef svm::prediction::Batch<double> SvmPrediction;
+typedef prediction::Batch<double, prediction::voteBased> MultiClassPrediction;
+
+const size_t nClasses  = 5;
+const size_t nFeatures = 4;
+
+/* Generates the observations around the centers of the classes */
+void generateData(size_t nRows, unsigned seed, NumericTablePtr & x, NumericTablePtr & y)
+{
+    std::mt19937 engine(seed);
+    std::normal_distribution<double> noise(0.0, 1.0);
+    std::vector<double> xValues(nRows * nFeatures);
+    std::vector<double> yValues(nRows);
+    for (size_t i = 0; i < nRows; i++)
+    {
+        const size_t label = i % nClasses;
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            xValues[i * nFeatures + j] = double((label + j) % nClasses) + noise(engine);
+        }
+        yValues[i] = double(label);
+    }
+    x = daal::test::createTable(xValues, nFeatures);
+    y = daal::test::createTable(yValues, 1);
+}
+
+struct MultiClassSvm
+{
+    MultiClassSvm() : training(new SvmTraining()), prediction(new SvmPrediction())
+    {
+        kernel_function::KernelIfacePtr kernel(new kernel_function::rbf::Batch<double>());
+        training->parameter.kernel   = kernel;
+        prediction->parameter.kernel = kernel;
+    }
+
+    ModelPtr train(const NumericTablePtr & x, const NumericTablePtr & y)
+    {
+        training::Batch<double> algorithm(nClasses);
+        algorithm.parameter.training   = training;
+        algorithm.parameter.prediction = prediction;
+        algorithm.input.set(classifier::training::data, x);
+        algorithm.input.set(classifier::training::labels, y);
+        REQUIRE(algorithm.compute().ok());
+        return algorithm.getResult()->get(classifier::training::model);
+    }
+
+    void setUp(MultiClassPrediction & algorithm)
+    {
+        algorithm.parameter.training          = training;
+        algorithm.parameter.prediction        = prediction;
+        algorithm.parameter.resultsToEvaluate = computeClassLabels | computeDecisionFunction;
+    }
+
+    services::SharedPtr<SvmTraining> training;
+    services::SharedPtr<SvmPrediction> prediction;
+};
+
+/* Computes the decision functions of the two-class models one by one */
+std::vector<double> computeDecisionFunctions(MultiClassSvm & svm, const Model & model, const NumericTablePtr & x)
+{
+    const size_t nRows   = x->getNumberOfRows();
+    const size_t nModels = nClasses * (nClasses - 1) / 2;
+    std::vector<double> result(nRows * nModels);
+    for (size_t iClass = 1, imodel = 0; iClass < nClasses; ++iClass)
+    {
+        for (size_t jClass = 0; jClass < iClass; ++jClass, ++imodel)
+        {
+            SvmPrediction algorithm;
+            algorithm.parameter.kernel = svm.prediction->parameter.kernel;
+            algorithm.input.set(classifier::prediction::data, x);
+            algorithm.input.set(classifier::prediction::model, model.getTwoClassClassifierModel(imodel));
+            REQUIRE(algorithm.compute().ok());
+            const std::vector<double> y = daal::test::getTableValues(*algorithm.getResult()->get(classifier::prediction::prediction));
+
+            const size_t column = (jClass * (2 * nClasses - jClass - 1)) / 2 + (iClass - jClass - 1);
+            for (size_t i = 0; i < nRows; i++)
+            {
+                result[i * nModels + column] = y[i];
+            }
+        }
+    }
+    return result;
+}
+
+void checkDecisionFunctions(MultiClassSvm & svm, MultiClassPrediction & algorithm, const Model & model, const NumericTablePtr & x)
+{
+    REQUIRE(algorithm.compute().ok());
+    const NumericTablePtr decisionFunction = algorithm.getResult()->get(prediction::decisionFunction);
+    const NumericTablePtr expected         = daal::test::createTable(computeDecisionFunctions(svm, model, x), decisionFunction->getNumberOfColumns());
+    daal::test::checkTablesEqual(*expected, *decisionFunction, 1e-9);
+}
+
+TEST("multi-class SVM prediction with shared support vectors matches two-class models", "[multi_class_classifier][svm]")
+{
+    const size_t nRows = GENERATE(1, 300, 1000);
+    CAPTURE(nRows);
+
+    MultiClassSvm svm;
+    NumericTablePtr x, y;
+    generateData(600, 7777, x, y);
+    const ModelPtr model = svm.train(x, y);
+
+    NumericTablePtr xTest, yTest;
+    generateData(nRows, 3333, xTest, yTest);
+
+    MultiClassPrediction algorithm(nClasses);
+    svm.setUp(algorithm);
+    algorithm.input.set(classifier::prediction::data, xTest);
+    algorithm.input.set(classifier::prediction::model, model);
+    checkDecisionFunctions(svm, algorithm, *model, xTest);
+}
+
+TEST("repeated multi-class SVM prediction follows the changes of the model", "[multi_class_classifier][svm]")
+{
+    MultiClassSvm svm;
+    NumericTablePtr x, y;
+    generateData(600, 7777, x, y);
+    const ModelPtr model      = svm.train(x, y);
+    const ModelPtr otherModel = svm.train(x, y);
+
+    NumericTablePtr xTest, yTest;
+    generateData(200, 3333, xTest, yTest);
+
+    MultiClassPrediction algorithm(nClasses);
+    svm.setUp(algorithm);
+    algorithm.input.set(classifier::prediction::data, xTest);
+    algorithm.input.set(classifier::prediction::model, model);
+    checkDecisionFunctions(svm, algorithm, *model, xTest);
+    checkDecisionFunctions(svm, algorithm, *model, xTest);
+
+    /* The two-class models are swapped, so the support vectors of the pairs of classes change */
+    const classifier::ModelPtr first = model->getTwoClassClassifierModel(0);
+    model->setTwoClassClassifierModel(0, model->getTwoClassClassifierModel(1));
+    model->setTwoClassClassifierModel(1, first);
+    checkDecisionFunctions(svm, algorithm, *model, xTest);
+
+    /* Another model */
+    otherModel->setTwoClassClassifierModel(2, model->getTwoClassClassifierModel(5));
+    algorithm.input.set(classifier::prediction::model, otherModel);
+    checkDecisionFunctions(svm, algorithm, *otherModel, xTest);
+}
+
+/* Scales the values of the table in place */
+void scaleTable(NumericTable & table, double factor)
+{
+    BlockDescriptor<double> block;
+    REQUIRE(table.getBlockOfRows(0, table.getNumberOfRows(), readWrite, block).ok());
+    double * const values = block.getBlockPtr();
+    for (size_t i = 0; i < table.getNumberOfRows() * table.getNumberOfColumns(); i++) values[i] *= factor;
+    REQUIRE(table.releaseBlockOfRows(block).ok());
+}
+
+TEST("repeated multi-class SVM prediction follows the changes of the tables of the model", "[multi_class_classifier][svm]")
+{
+    MultiClassSvm svm;
+    NumericTablePtr x, y;
+    generateData(600, 7777, x, y);
+    const ModelPtr model = svm.train(x, y);
+
+    NumericTablePtr xTest, yTest;
+    generateData(200, 3333, xTest, yTest);
+
+    MultiClassPrediction algorithm(nClasses);
+    svm.setUp(algorithm);
+    algorithm.input.set(classifier::prediction::data, xTest);
+    algorithm.input.set(classifier::prediction::model, model);
+    checkDecisionFunctions(svm, algorithm, *model, xTest);
+
+    /* The support vectors of one model and the coefficients of another one are changed in place */
+    svm::Model * const first  = static_cast<svm::Model *>(model->getTwoClassClassifierModel(0).get());
+    svm::Model * const second = static_cast<svm::Model *>(model->getTwoClassClassifierModel(3).get());
+    scaleTable(*first->getSupportVectors(), 1.5);
+    checkDecisionFunctions(svm, algorithm, *model, xTest);
+    scaleTable(*second->getClassificationCoefficients(), -2.0);
+    checkDecisionFunctions(svm, algorithm, *model, xTest);
+}
+
+/* The cache of one byte holds no kernel rows, so the two-class models are trained with their own caches */
+TEST("multi-class SVM training with the shared kernel cache matches the training without it", "[multi_class_classifier][svm]")
+{
+    NumericTablePtr x, y;
+    generateData(600, 7777, x, y);
+    NumericTablePtr xTest, yTest;
+    generateData(200, 3333, xTest, yTest);
+
+    MultiClassSvm sharedSvm, localSvm;
+    localSvm.training->parameter.cacheSize = 1;
+    const ModelPtr sharedModel             = sharedSvm.train(x, y);
+    const ModelPtr localModel              = localSvm.train(x, y);
+
+    std::vector<double> decisionFunctions[2];
+    MultiClassSvm * svms[2]  = { &sharedSvm, &localSvm };
+    const ModelPtr models[2] = { sharedModel, localModel };
+    for (size_t i = 0; i < 2; i++)
+    {
+        MultiClassPrediction algorithm(nClasses);
+        svms[i]->setUp(algorithm);
+        algorithm.input.set(classifier::prediction::data, xTest);
+        algorithm.input.set(classifier::prediction::model, models[i]);
+        REQUIRE(algorithm.compute().ok());
+        decisionFunctions[i] = daal::test::getTableValues(*algorithm.getResult()->get(prediction::decisionFunction));
+    }
+
+    REQUIRE(decisionFunctions[0].size() == decisionFunctions[1].size());
+    for (size_t i = 0; i < decisionFunctions[0].size(); i++)
+    {
+        CAPTURE(i);
+        REQUIRE(std::abs(decisionFunctions[0][i] - decisionFunctions[1][i]) < 1e-3);
+    }
+}
+
+} // namespace test
+} // namespace multi_class_classifier
+} // namespace algorithms
+} // namespace daal
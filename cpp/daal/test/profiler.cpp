@@ -0,0 +1,115 @@
+/* file: profiler.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "src/externals/service_profiler.h"
+
+#if !defined(_WIN32) && !defined(_WIN64)
+    #include <sys/wait.h>
+    #include <unistd.h>
+
+namespace daal
+{
+namespace internal
+{
+namespace test
+{
+/* Runs the profiled tasks in a child process, since the profile is written at exit and
+   the profiler mode is read once per process. Returns the content of the written profile */
+std::string runProfiledProcess(const char * mode, const std::string & fileName, bool detachedThread)
+{
+    std::remove(fileName.c_str());
+
+    const pid_t pid = fork();
+    REQUIRE(pid >= 0);
+    if (pid == 0)
+    {
+        setenv("DAAL_PROFILER", mode, 1);
+        setenv("DAAL_PROFILER_FILE", fileName.c_str(), 1);
+        {
+            ProfilerTask outer = Profiler::startTask("outer_task");
+            {
+                ProfilerTask inner = Profiler::startTask("inner_task");
+            }
+        }
+        if (detachedThread)
+        {
+            /* The thread that recorded tasks is still alive when the process exits */
+            static std::atomic<bool> recorded(false);
+            std::thread([]() {
+                {
+                    ProfilerTask task = Profiler::startTask("thread_task");
+                }
+                recorded = true;
+                std::this_thread::sleep_for(std::chrono::hours(1));
+            }).detach();
+            while (!recorded)
+            {
+                std::this_thread::yield();
+            }
+        }
+        std::exit(0);
+    }
+
+    int status = 0;
+    REQUIRE(waitpid(pid, &status, 0) == pid);
+    REQUIRE(WIFEXITED(status));
+    REQUIRE(WEXITSTATUS(status) == 0);
+
+    std::ifstream file(fileName);
+    std::stringstream content;
+    content << file.rdbuf();
+    std::remove(fileName.c_str());
+    return content.str();
+}
+
+TEST("profiler writes nested tasks at exit", "[profiler]")
+{
+    const std::string fileName = (std::filesystem::temp_directory_path() / "daal_profiler_summary_test.json").string();
+    const std::string profile  = runProfiledProcess("json", fileName, false);
+    REQUIRE(profile.find("\"outer_task\"") != std::string::npos);
+    REQUIRE(profile.find("\"inner_task\"") != std::string::npos);
+}
+
+TEST("profiler writes trace events at exit", "[profiler]")
+{
+    const std::string fileName = (std::filesystem::temp_directory_path() / "daal_profiler_trace_test.json").string();
+    const std::string profile  = runProfiledProcess("trace", fileName, false);
+    REQUIRE(profile.find("\"traceEvents\"") != std::string::npos);
+    REQUIRE(profile.find("\"inner_task\"") != std::string::npos);
+}
+
+TEST("profiler exits cleanly while a thread that recorded tasks is alive", "[profiler]")
+{
+    const std::string fileName = (std::filesystem::temp_directory_path() / "daal_profiler_thread_test.json").string();
+    const std::string profile  = runProfiledProcess("json", fileName, true);
+    REQUIRE(profile.find("\"outer_task\"") != std::string::npos);
+    REQUIRE(profile.find("\"thread_task\"") != std::string::npos);
+}
+
+} // namespace test
+} // namespace internal
+} // namespace daal
+
+#endif
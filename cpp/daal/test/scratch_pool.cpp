@@ -0,0 +1,126 @@
+/* file: scratch_pool.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <thread>
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "src/services/service_arrays.h"
+#include "src/services/service_scratch_pool.h"
+
+namespace daal
+{
+namespace services
+{
+namespace test
+{
+using internal::scratchPoolAllocate;
+using internal::scratchPoolDeallocate;
+using internal::ScratchPoolScope;
+
+TEST("scratch buffer is reused inside the scope", "[scratch_pool]")
+{
+    ScratchPoolScope scope;
+
+    void * first = scratchPoolAllocate(1000);
+    REQUIRE(first != nullptr);
+    REQUIRE((size_t)first % 64 == 0);
+    scratchPoolDeallocate(first);
+
+    /* The same size class */
+    void * second = scratchPoolAllocate(1010);
+    REQUIRE(second == first);
+
+    /* Another size class */
+    void * third = scratchPoolAllocate(4000);
+    REQUIRE(third != first);
+
+    scratchPoolDeallocate(second);
+    scratchPoolDeallocate(third);
+}
+
+TEST("scratch buffer released by another thread returns to the allocating thread", "[scratch_pool]")
+{
+    ScratchPoolScope scope;
+
+    void * allocated = nullptr;
+    std::thread([&]() { allocated = scratchPoolAllocate(5000); }).join();
+    REQUIRE(allocated != nullptr);
+    scratchPoolDeallocate(allocated);
+
+    void * local = scratchPoolAllocate(5000);
+    REQUIRE(local != allocated);
+
+    void * reallocated = nullptr;
+    std::thread([&]() { reallocated = scratchPoolAllocate(5000); }).join();
+    REQUIRE(reallocated == allocated);
+
+    scratchPoolDeallocate(local);
+    scratchPoolDeallocate(reallocated);
+}
+
+TEST("scratch buffers are kept until the outermost scope ends", "[scratch_pool]")
+{
+    ScratchPoolScope outer;
+    void * ptr = nullptr;
+    {
+        ScratchPoolScope inner;
+        ptr = scratchPoolAllocate(300);
+        scratchPoolDeallocate(ptr);
+    }
+    void * reused = scratchPoolAllocate(300);
+    REQUIRE(reused == ptr);
+    scratchPoolDeallocate(reused);
+}
+
+TEST("scratch buffers are allocated and released outside the scope", "[scratch_pool]")
+{
+    const size_t size = GENERATE(1, 64, 65, 100000, 100 * 1024 * 1024);
+    CAPTURE(size);
+
+    char * ptr = static_cast<char *>(scratchPoolAllocate(size));
+    REQUIRE(ptr != nullptr);
+    ptr[0]        = 1;
+    ptr[size - 1] = 1;
+    scratchPoolDeallocate(ptr);
+}
+
+TEST("reused scratch array with zero initialization is zeroed", "[scratch_pool]")
+{
+    ScratchPoolScope scope;
+    const size_t n = 777;
+
+    int * first = nullptr;
+    {
+        internal::TArrayScratchCalloc<int, sse2> arr(n);
+        first = arr.get();
+        for (size_t i = 0; i < n; i++)
+        {
+            arr[i] = 1;
+        }
+    }
+
+    internal::TArrayScratchCalloc<int, sse2> arr(n);
+    REQUIRE(arr.get() == first);
+    for (size_t i = 0; i < n; i++)
+    {
+        REQUIRE(arr[i] == 0);
+    }
+}
+
+} // namespace test
+} // namespace services
+} // namespace daal
@@ -0,0 +1,116 @@
+/* file: test_utils.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Auxiliary functions used in the tests of the DAAL interfaces
+//--
+*/
+
+#ifndef __DAAL_TEST_UTILS_H__
+#define __DAAL_TEST_UTILS_H__
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "daal.h"
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace daal
+{
+namespace test
+{
+/* File in the temporary directory that is removed when the object is destroyed */
+class TemporaryFile
+{
+public:
+    TemporaryFile(const std::string & name, const std::string & content) : _path((std::filesystem::temp_directory_path() / name).string())
+    {
+        std::ofstream file(_path, std::ios::binary);
+        file << content;
+    }
+
+    ~TemporaryFile() { std::remove(_path.c_str()); }
+
+    const std::string & getPath() const { return _path; }
+
+private:
+    std::string _path;
+};
+
+/* Creates the table of doubles with a copy of the values stored by rows */
+inline data_management::NumericTablePtr createTable(const std::vector<double> & values, size_t nColumns)
+{
+    const size_t nRows = values.size() / nColumns;
+    data_management::NumericTablePtr table =
+        data_management::HomogenNumericTable<double>::create(nColumns, nRows, data_management::NumericTable::doAllocate);
+    REQUIRE(table);
+    data_management::BlockDescriptor<double> block;
+    table->getBlockOfRows(0, nRows, data_management::writeOnly, block);
+    std::copy(values.begin(), values.end(), block.getBlockPtr());
+    table->releaseBlockOfRows(block);
+    return table;
+}
+
+/* Returns the values of the table stored by rows */
+inline std::vector<double> getTableValues(data_management::NumericTable & table)
+{
+    const size_t nRows = table.getNumberOfRows();
+    data_management::BlockDescriptor<double> block;
+    table.getBlockOfRows(0, nRows, data_management::readOnly, block);
+    std::vector<double> values(block.getBlockPtr(), block.getBlockPtr() + nRows * table.getNumberOfColumns());
+    table.releaseBlockOfRows(block);
+    return values;
+}
+
+/* Checks that the tables have the same sizes and the elements are equal up to the tolerance */
+inline void checkTablesEqual(data_management::NumericTable & expected, data_management::NumericTable & actual, double tolerance = 0.0)
+{
+    REQUIRE(expected.getNumberOfRows() == actual.getNumberOfRows());
+    REQUIRE(expected.getNumberOfColumns() == actual.getNumberOfColumns());
+
+    const size_t nRows = expected.getNumberOfRows();
+    data_management::BlockDescriptor<double> expectedBlock;
+    data_management::BlockDescriptor<double> actualBlock;
+    expected.getBlockOfRows(0, nRows, data_management::readOnly, expectedBlock);
+    actual.getBlockOfRows(0, nRows, data_management::readOnly, actualBlock);
+
+    const double * expectedPtr = expectedBlock.getBlockPtr();
+    const double * actualPtr   = actualBlock.getBlockPtr();
+    const size_t size          = nRows * expected.getNumberOfColumns();
+    for (size_t i = 0; i < size; i++)
+    {
+        const double difference = expectedPtr[i] > actualPtr[i] ? expectedPtr[i] - actualPtr[i] : actualPtr[i] - expectedPtr[i];
+        if (difference > tolerance)
+        {
+            CAPTURE(i, expectedPtr[i], actualPtr[i]);
+            FAIL();
+        }
+    }
+
+    expected.releaseBlockOfRows(expectedBlock);
+    actual.releaseBlockOfRows(actualBlock);
+}
+
+} // namespace test
+} // namespace daal
+
+#endif
@@ -0,0 +1,386 @@
+/* file: tree_shap.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "daal.h"
+#include "oneapi/dal/test/engine/common.hpp"
+#include "test/test_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace dtrees
+{
+namespace test
+{
+using namespace daal::data_management;
+
+const size_t nRows     = 300;
+const size_t nFeatures = 4;
+const double tolerance = 1e-6;
+
+/* The responses and the labels depend on the first three features, the last one is noise */
+struct Data
+{
+    Data(size_t nClasses)
+    {
+        std::mt19937 engine(2021);
+        std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+        std::vector<double> values(nRows * nFeatures);
+        std::vector<double> responses, labels;
+        for (size_t i = 0; i < nRows; i++)
+        {
+            for (size_t j = 0; j < nFeatures; j++) values[i * nFeatures + j] = uniform(engine);
+            const double * row = &values[i * nFeatures];
+            responses.push_back(2.0 * row[0] - row[1] + ((row[2] > 0.5) ? 1.0 : 0.0));
+            const double score = row[0] + 0.5 * row[1] * row[2] + 0.2 * uniform(engine);
+            labels.push_back((nClasses == 2) ? double(score > 0.0) : double((score > -0.4) + (score > 0.4)));
+        }
+        x = daal::test::createTable(values, nFeatures);
+        y = daal::test::createTable(responses, 1);
+        l = daal::test::createTable(labels, 1);
+    }
+
+    NumericTablePtr x;
+    NumericTablePtr y;
+    NumericTablePtr l;
+};
+
+/* Returns the sums of the blocks of nFeatures + 1 contributions in each row */
+std::vector<double> sumContributions(NumericTable & contributions)
+{
+    const std::vector<double> values = daal::test::getTableValues(contributions);
+    REQUIRE(contributions.getNumberOfRows() == nRows);
+    REQUIRE(contributions.getNumberOfColumns() % (nFeatures + 1) == 0);
+    std::vector<double> sums(values.size() / (nFeatures + 1), 0.0);
+    for (size_t i = 0; i < values.size(); i++) sums[i / (nFeatures + 1)] += values[i];
+    return sums;
+}
+
+void checkValuesEqual(const std::vector<double> & expected, const std::vector<double> & actual)
+{
+    REQUIRE(expected.size() == actual.size());
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        CAPTURE(i);
+        REQUIRE(std::abs(expected[i] - actual[i]) <= tolerance);
+    }
+}
+
+/* The mean absolute contribution of the noise feature is small compared with the one of the first feature */
+void checkNoiseAttribution(NumericTable & contributions)
+{
+    const std::vector<double> values = daal::test::getTableValues(contributions);
+    const size_t nColumns            = contributions.getNumberOfColumns();
+    for (size_t iGroup = 0; iGroup < nColumns / (nFeatures + 1); iGroup++)
+    {
+        double signal = 0.0, noise = 0.0;
+        for (size_t i = 0; i < nRows; i++)
+        {
+            signal += std::abs(values[i * nColumns + iGroup * (nFeatures + 1)]);
+            noise += std::abs(values[i * nColumns + iGroup * (nFeatures + 1) + nFeatures - 1]);
+        }
+        CAPTURE(iGroup, signal, noise);
+        REQUIRE(noise < 0.1 * signal);
+    }
+}
+
+/* The regression tree collected by the depth-first traversal of the model, the sons of a split node follow it */
+class Tree : public tree_utils::regression::TreeNodeVisitor
+{
+public:
+    struct Node
+    {
+        bool isLeaf;
+        size_t featureIndex;
+        double value;
+        double cover;
+        size_t left;
+        size_t right;
+    };
+
+    template <typename ModelType>
+    Tree(const ModelType & model, size_t iTree)
+    {
+        model.traverseDFS(iTree, *this);
+        REQUIRE(link(0) == _nodes.size());
+    }
+
+    bool onSplitNode(const tree_utils::SplitNodeDescriptor & desc) DAAL_C11_OVERRIDE
+    {
+        _nodes.push_back({ false, desc.featureIndex, desc.featureValue, double(desc.nNodeSampleCount), 0, 0 });
+        return true;
+    }
+
+    bool onLeafNode(const tree_utils::regression::LeafNodeDescriptor & desc) DAAL_C11_OVERRIDE
+    {
+        _nodes.push_back({ true, 0, desc.response, double(desc.nNodeSampleCount), 0, 0 });
+        return true;
+    }
+
+    /* Expected response of the subtree given the features of the subset, the other features follow the training data */
+    double expectation(const double * x, unsigned subset, size_t iNode = 0) const
+    {
+        const Node & n = _nodes[iNode];
+        if (n.isLeaf) return n.value;
+        if (subset & (1u << n.featureIndex)) return expectation(x, subset, (x[n.featureIndex] > n.value) ? n.right : n.left);
+        const double cover        = _nodes[n.left].cover + _nodes[n.right].cover;
+        const double leftFraction = (cover > 0.0) ? _nodes[n.left].cover / cover : 0.5;
+        return leftFraction * expectation(x, subset, n.left) + (1.0 - leftFraction) * expectation(x, subset, n.right);
+    }
+
+private:
+    /* Sets the sons of the subtree and returns the index of the node next to it */
+    size_t link(size_t iNode)
+    {
+        REQUIRE(iNode < _nodes.size());
+        if (_nodes[iNode].isLeaf) return iNode + 1;
+        _nodes[iNode].left  = iNode + 1;
+        _nodes[iNode].right = link(iNode + 1);
+        return link(_nodes[iNode].right);
+    }
+
+    std::vector<Node> _nodes;
+};
+
+/* Exact Shapley values of the features by the enumeration of all subsets of them, followed by the expected response */
+std::vector<double> computeShapleyValues(const Tree & tree, const double * x)
+{
+    double factorial[nFeatures + 1] = { 1.0 };
+    for (size_t i = 1; i <= nFeatures; i++) factorial[i] = factorial[i - 1] * double(i);
+
+    std::vector<double> phi(nFeatures + 1, 0.0);
+    for (unsigned subset = 0; subset < (1u << nFeatures); subset++)
+    {
+        size_t size = 0;
+        for (size_t j = 0; j < nFeatures; j++) size += (subset >> j) & 1u;
+        const double value = tree.expectation(x, subset);
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            if (subset & (1u << j))
+                phi[j] += factorial[size - 1] * factorial[nFeatures - size] / factorial[nFeatures] * value;
+            else
+                phi[j] -= factorial[size] * factorial[nFeatures - size - 1] / factorial[nFeatures] * value;
+        }
+    }
+    phi[nFeatures] = tree.expectation(x, 0);
+    return phi;
+}
+
+/* Sums the Shapley values of the trees multiplied by the factor for the first rows of the data */
+template <typename ModelType>
+std::vector<double> computeShapleyValues(const ModelType & model, NumericTable & x, size_t nRowsToCheck, double factor)
+{
+    const std::vector<double> values = daal::test::getTableValues(x);
+    std::vector<double> phi(nRowsToCheck * (nFeatures + 1), 0.0);
+    for (size_t iTree = 0; iTree < model.getNumberOfTrees(); iTree++)
+    {
+        const Tree tree(model, iTree);
+        for (size_t i = 0; i < nRowsToCheck; i++)
+        {
+            const std::vector<double> treePhi = computeShapleyValues(tree, &values[i * nFeatures]);
+            for (size_t j = 0; j <= nFeatures; j++) phi[i * (nFeatures + 1) + j] += factor * treePhi[j];
+        }
+    }
+    return phi;
+}
+
+std::vector<double> getFirstRows(NumericTable & table, size_t nRowsToCheck)
+{
+    std::vector<double> values = daal::test::getTableValues(table);
+    values.resize(nRowsToCheck * table.getNumberOfColumns());
+    return values;
+}
+
+TEST("gbt regression contributions sum up to the prediction", "[gbt][shap]")
+{
+    const Data data(2);
+
+    gbt::regression::training::Batch<double> training;
+    training.parameter().maxIterations = 20;
+    training.input.set(gbt::regression::training::data, data.x);
+    training.input.set(gbt::regression::training::dependentVariable, data.y);
+    REQUIRE(training.compute().ok());
+
+    gbt::regression::prediction::Batch<double> prediction;
+    prediction.parameter().resultsToCompute = gbt::regression::prediction::computeFeatureContributions;
+    prediction.input.set(gbt::regression::prediction::data, data.x);
+    prediction.input.set(gbt::regression::prediction::model, training.getResult()->get(gbt::regression::training::model));
+    REQUIRE(prediction.compute().ok());
+
+    checkValuesEqual(daal::test::getTableValues(*prediction.getResult()->get(gbt::regression::prediction::prediction)),
+                     sumContributions(*prediction.getResult()->get(gbt::regression::prediction::featureContributions)));
+    checkNoiseAttribution(*prediction.getResult()->get(gbt::regression::prediction::featureContributions));
+}
+
+TEST("decision forest regression contributions sum up to the prediction", "[df][shap]")
+{
+    const Data data(2);
+
+    decision_forest::regression::training::Batch<double> training;
+    training.parameter().nTrees          = 20;
+    training.parameter().featuresPerNode = nFeatures;
+    training.input.set(decision_forest::regression::training::data, data.x);
+    training.input.set(decision_forest::regression::training::dependentVariable, data.y);
+    REQUIRE(training.compute().ok());
+
+    decision_forest::regression::prediction::Batch<double> prediction;
+    prediction.parameter.resultsToCompute = decision_forest::regression::prediction::computeFeatureContributions;
+    prediction.input.set(decision_forest::regression::prediction::data, data.x);
+    prediction.input.set(decision_forest::regression::prediction::model, training.getResult()->get(decision_forest::regression::training::model));
+    REQUIRE(prediction.compute().ok());
+
+    checkValuesEqual(daal::test::getTableValues(*prediction.getResult()->get(decision_forest::regression::prediction::prediction)),
+                     sumContributions(*prediction.getResult()->get(decision_forest::regression::prediction::featureContributions)));
+    checkNoiseAttribution(*prediction.getResult()->get(decision_forest::regression::prediction::featureContributions));
+}
+
+/* The trees are shallow, so the Shapley values of the first rows can be found by the enumeration of the subsets of the features */
+TEST("gbt regression contributions are the exact Shapley values", "[gbt][shap]")
+{
+    const Data data(2);
+    const size_t nRowsToCheck = 20;
+
+    gbt::regression::training::Batch<double> training;
+    training.parameter().maxIterations = 5;
+    training.parameter().maxTreeDepth  = 4;
+    training.input.set(gbt::regression::training::data, data.x);
+    training.input.set(gbt::regression::training::dependentVariable, data.y);
+    REQUIRE(training.compute().ok());
+    const gbt::regression::ModelPtr model = training.getResult()->get(gbt::regression::training::model);
+
+    gbt::regression::prediction::Batch<double> prediction;
+    prediction.parameter().resultsToCompute = gbt::regression::prediction::computeFeatureContributions;
+    prediction.input.set(gbt::regression::prediction::data, data.x);
+    prediction.input.set(gbt::regression::prediction::model, model);
+    REQUIRE(prediction.compute().ok());
+
+    checkValuesEqual(computeShapleyValues(*model, *data.x, nRowsToCheck, 1.0),
+                     getFirstRows(*prediction.getResult()->get(gbt::regression::prediction::featureContributions), nRowsToCheck));
+}
+
+TEST("decision forest regression contributions are the exact Shapley values", "[df][shap]")
+{
+    const Data data(2);
+    const size_t nRowsToCheck = 20;
+
+    decision_forest::regression::training::Batch<double> training;
+    training.parameter().nTrees       = 5;
+    training.parameter().maxTreeDepth = 4;
+    training.input.set(decision_forest::regression::training::data, data.x);
+    training.input.set(decision_forest::regression::training::dependentVariable, data.y);
+    REQUIRE(training.compute().ok());
+    const decision_forest::regression::ModelPtr model = training.getResult()->get(decision_forest::regression::training::model);
+
+    decision_forest::regression::prediction::Batch<double> prediction;
+    prediction.parameter.resultsToCompute = decision_forest::regression::prediction::computeFeatureContributions;
+    prediction.input.set(decision_forest::regression::prediction::data, data.x);
+    prediction.input.set(decision_forest::regression::prediction::model, model);
+    REQUIRE(prediction.compute().ok());
+
+    checkValuesEqual(computeShapleyValues(*model, *data.x, nRowsToCheck, 1.0 / double(model->getNumberOfTrees())),
+                     getFirstRows(*prediction.getResult()->get(decision_forest::regression::prediction::featureContributions), nRowsToCheck));
+}
+
+/* The binary contributions explain the raw boosted value of the second class, the multiclass ones explain
+   the raw boosted value of each class, the probabilities are the softmax of them */
+TEST("gbt classification contributions sum up to the raw boosted values", "[gbt][shap]")
+{
+    const size_t nClasses = GENERATE(2, 3);
+    CAPTURE(nClasses);
+    const Data data(nClasses);
+
+    gbt::classification::training::Batch<double> training(nClasses);
+    training.parameter().maxIterations = 20;
+    training.input.set(classifier::training::data, data.x);
+    training.input.set(classifier::training::labels, data.l);
+    REQUIRE(training.compute().ok());
+
+    gbt::classification::prediction::Batch<double> prediction(nClasses);
+    prediction.parameter().resultsToEvaluate = classifier::computeClassLabels | classifier::computeClassProbabilities;
+    prediction.parameter().resultsToCompute  = gbt::classification::prediction::computeFeatureContributions;
+    prediction.input.set(classifier::prediction::data, data.x);
+    prediction.input.set(classifier::prediction::model, training.getResult()->get(classifier::training::model));
+    REQUIRE(prediction.compute().ok());
+
+    const std::vector<double> probabilities = daal::test::getTableValues(*prediction.getResult()->get(classifier::prediction::probabilities));
+    const std::vector<double> margins = sumContributions(*prediction.getResult()->get(gbt::classification::prediction::featureContributions));
+    std::vector<double> expected(probabilities.size());
+    if (nClasses == 2)
+    {
+        REQUIRE(margins.size() == nRows);
+        for (size_t i = 0; i < nRows; i++) expected[2 * i + 1] = 1.0 / (1.0 + std::exp(-margins[i]));
+        for (size_t i = 0; i < nRows; i++) expected[2 * i] = 1.0 - expected[2 * i + 1];
+    }
+    else
+    {
+        REQUIRE(margins.size() == nRows * nClasses);
+        for (size_t i = 0; i < nRows; i++)
+        {
+            double sum = 0.0;
+            for (size_t j = 0; j < nClasses; j++) sum += std::exp(margins[i * nClasses + j]);
+            for (size_t j = 0; j < nClasses; j++) expected[i * nClasses + j] = std::exp(margins[i * nClasses + j]) / sum;
+        }
+    }
+    checkValuesEqual(expected, probabilities);
+    checkNoiseAttribution(*prediction.getResult()->get(gbt::classification::prediction::featureContributions));
+}
+
+/* The binary contributions explain the probability of the second class, the multiclass ones explain
+   the probability of each class */
+TEST("decision forest classification contributions sum up to the probabilities", "[df][shap]")
+{
+    const size_t nClasses = GENERATE(2, 3);
+    const bool weighted   = GENERATE(true, false);
+    CAPTURE(nClasses, weighted);
+    const Data data(nClasses);
+
+    decision_forest::classification::training::Batch<double> training(nClasses);
+    training.parameter().nTrees          = 20;
+    training.parameter().featuresPerNode = nFeatures;
+    training.input.set(classifier::training::data, data.x);
+    training.input.set(classifier::training::labels, data.l);
+    REQUIRE(training.compute().ok());
+
+    decision_forest::classification::prediction::Batch<double> prediction(nClasses);
+    prediction.parameter().votingMethod =
+        weighted ? decision_forest::classification::prediction::weighted : decision_forest::classification::prediction::unweighted;
+    prediction.parameter().resultsToEvaluate = classifier::computeClassLabels | classifier::computeClassProbabilities;
+    prediction.parameter().resultsToCompute  = decision_forest::classification::prediction::computeFeatureContributions;
+    prediction.input.set(classifier::prediction::data, data.x);
+    prediction.input.set(classifier::prediction::model, training.getResult()->get(classifier::training::model));
+    REQUIRE(prediction.compute().ok());
+
+    std::vector<double> probabilities = daal::test::getTableValues(*prediction.getResult()->get(classifier::prediction::probabilities));
+    if (nClasses == 2)
+    {
+        for (size_t i = 0; i < nRows; i++) probabilities[i] = probabilities[2 * i + 1];
+        probabilities.resize(nRows);
+    }
+    checkValuesEqual(probabilities,
+                     sumContributions(*prediction.getResult()->get(decision_forest::classification::prediction::featureContributions)));
+    checkNoiseAttribution(*prediction.getResult()->get(decision_forest::classification::prediction::featureContributions));
+}
+
+} // namespace test
+} // namespace dtrees
+} // namespace algorithms
+} // namespace daal
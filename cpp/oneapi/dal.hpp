@@ -39,6 +39,7 @@
 /* I/O */
 #include "oneapi/dal/io/csv.hpp"
 #include "oneapi/dal/io/load_graph.hpp"
+#include "oneapi/dal/io/save_graph.hpp"
 
 /* Algos */
 #include "oneapi/dal/algo/decision_forest.hpp"
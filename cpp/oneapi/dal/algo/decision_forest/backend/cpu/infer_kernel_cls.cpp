@@ -80,14 +80,14 @@ static result_t call_daal_kernel(const context_cpu& ctx,
             interop::allocate_daal_homogen_table<Float>(row_count, desc.get_class_count());
     }
 
-    const daal_df::classification::Model* const daal_model_ptr = daal_model.get();
     interop::status_to_exception(interop::call_daal_kernel<Float, cls_dense_predict_kernel_t>(
         ctx,
         daal::services::internal::hostApp(daal_input),
         daal_data.get(),
-        daal_model_ptr,
+        daal_model,
         daal_labels_res.get(),
         daal_labels_prob_res.get(),
+        nullptr,
         desc.get_class_count(),
         daal_voting_mode));
 
@@ -75,7 +75,8 @@ static result_t call_daal_kernel(const context_cpu& ctx,
         daal::services::internal::hostApp(daal_input),
         daal_data.get(),
         daal_model_ptr,
-        daal_labels_res.get()));
+        daal_labels_res.get(),
+        nullptr));
 
     return result_t{}.set_labels(interop::convert_from_daal_homogen_table<Float>(daal_labels_res));
 }
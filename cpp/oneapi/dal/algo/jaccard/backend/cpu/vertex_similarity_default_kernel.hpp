@@ -35,19 +35,33 @@ vertex_similarity_result call_jaccard_default_kernel_int32(
     const dal::preview::detail::topology<int32_t> &data,
     void *result_ptr);
 
+template <typename Cpu>
+vertex_similarity_result call_jaccard_default_kernel_int64(
+    const descriptor_base &desc,
+    const dal::preview::detail::topology<int64_t> &data,
+    void *result_ptr);
+
 ONEDAL_FORCEINLINE std::int32_t min(const std::int32_t &a, const std::int32_t &b) {
     return (a >= b) ? b : a;
 }
 
+ONEDAL_FORCEINLINE std::int64_t min(const std::int64_t &a, const std::int64_t &b) {
+    return (a >= b) ? b : a;
+}
+
 ONEDAL_FORCEINLINE std::int32_t max(const std::int32_t &a, const std::int32_t &b) {
     return (a <= b) ? b : a;
 }
 
+ONEDAL_FORCEINLINE std::int64_t max(const std::int64_t &a, const std::int64_t &b) {
+    return (a <= b) ? b : a;
+}
+
 ONEDAL_FORCEINLINE std::int64_t compute_number_elements_in_block(
-    const std::int32_t &row_range_begin,
-    const std::int32_t &row_range_end,
-    const std::int32_t &column_range_begin,
-    const std::int32_t &column_range_end) {
+    const std::int64_t &row_range_begin,
+    const std::int64_t &row_range_end,
+    const std::int64_t &column_range_begin,
+    const std::int64_t &column_range_end) {
     ONEDAL_ASSERT(row_range_end >= row_range_begin, "Negative interval found");
     const std::int64_t row_count = row_range_end - row_range_begin;
     ONEDAL_ASSERT(column_range_end >= column_range_begin, "Negative interval found");
@@ -262,6 +262,72 @@ ONEDAL_FORCEINLINE std::int64_t intersection(const std::int32_t *neigh_u,
     return total;
 }
 
+ONEDAL_FORCEINLINE std::int64_t intersection_int64(const std::int64_t *neigh_u,
+                                                   const std::int64_t *neigh_v,
+                                                   std::int64_t n_u,
+                                                   std::int64_t n_v) {
+    std::int64_t total = 0;
+    std::int64_t i_u = 0, i_v = 0;
+
+    const std::int64_t n_u_4_end = n_u - 4;
+    const std::int64_t n_v_4_end = n_v - 4;
+    while (i_u <= n_u_4_end && i_v <= n_v_4_end) {
+        // assumes neighbor list is ordered
+        const std::int64_t max_neigh_u = neigh_u[i_u + 3];
+        const std::int64_t max_neigh_v = neigh_v[i_v + 3];
+
+        if (neigh_u[i_u] > max_neigh_v) {
+            if (neigh_u[i_u] > neigh_v[n_v - 1]) {
+                return total;
+            }
+            i_v += 4;
+            continue;
+        }
+        if (neigh_v[i_v] > max_neigh_u) {
+            if (neigh_v[i_v] > neigh_u[n_u - 1]) {
+                return total;
+            }
+            i_u += 4;
+            continue;
+        }
+
+        __m256i v_u = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i *>(neigh_u + i_u)); // load 4 neighbors of u
+        __m256i v_v = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i *>(neigh_v + i_v)); // load 4 neighbors of v
+
+        i_v = (max_neigh_u >= max_neigh_v) ? i_v + 4 : i_v;
+        i_u = (max_neigh_u <= max_neigh_v) ? i_u + 4 : i_u;
+
+        // compare with all circular shifts of the neighbors of v
+        __m256i match = _mm256_cmpeq_epi64(v_u, v_v);
+        match = _mm256_or_si256(
+            match,
+            _mm256_cmpeq_epi64(v_u, _mm256_permute4x64_epi64(v_v, _MM_SHUFFLE(0, 3, 2, 1))));
+        match = _mm256_or_si256(
+            match,
+            _mm256_cmpeq_epi64(v_u, _mm256_permute4x64_epi64(v_v, _MM_SHUFFLE(1, 0, 3, 2))));
+        match = _mm256_or_si256(
+            match,
+            _mm256_cmpeq_epi64(v_u, _mm256_permute4x64_epi64(v_v, _MM_SHUFFLE(2, 1, 0, 3))));
+
+        total += _popcnt32_redef(_mm256_movemask_pd(_mm256_castsi256_pd(match)));
+    }
+
+    while (i_u < n_u && i_v < n_v) {
+        if ((neigh_u[i_u] > neigh_v[n_v - 1]) || (neigh_v[i_v] > neigh_u[n_u - 1])) {
+            return total;
+        }
+        if (neigh_u[i_u] == neigh_v[i_v])
+            total++, i_u++, i_v++;
+        else if (neigh_u[i_u] < neigh_v[i_v])
+            i_u++;
+        else if (neigh_u[i_u] > neigh_v[i_v])
+            i_v++;
+    }
+    return total;
+}
+
 template <typename Cpu>
 vertex_similarity_result call_jaccard_default_kernel_avx2(
     const descriptor_base &desc,
@@ -343,6 +343,68 @@ ONEDAL_FORCEINLINE std::int64_t intersection(const std::int32_t *neigh_u,
     return total;
 }
 
+ONEDAL_FORCEINLINE std::int64_t intersection_int64(const std::int64_t *neigh_u,
+                                                   const std::int64_t *neigh_v,
+                                                   std::int64_t n_u,
+                                                   std::int64_t n_v) {
+    std::int64_t total = 0;
+    std::int64_t i_u = 0, i_v = 0;
+
+    const std::int64_t n_u_8_end = n_u - 8;
+    const std::int64_t n_v_8_end = n_v - 8;
+    while (i_u <= n_u_8_end && i_v <= n_v_8_end) {
+        // assumes neighbor list is ordered
+        const std::int64_t max_neigh_u = neigh_u[i_u + 7];
+        const std::int64_t max_neigh_v = neigh_v[i_v + 7];
+
+        if (neigh_u[i_u] > max_neigh_v) {
+            if (neigh_u[i_u] > neigh_v[n_v - 1]) {
+                return total;
+            }
+            i_v += 8;
+            continue;
+        }
+        if (neigh_v[i_v] > max_neigh_u) {
+            if (neigh_v[i_v] > neigh_u[n_u - 1]) {
+                return total;
+            }
+            i_u += 8;
+            continue;
+        }
+
+        __m512i v_u = _mm512_loadu_si512((void *)(neigh_u + i_u)); // load 8 neighbors of u
+        __m512i v_v = _mm512_loadu_si512((void *)(neigh_v + i_v)); // load 8 neighbors of v
+
+        i_v = (max_neigh_u >= max_neigh_v) ? i_v + 8 : i_v;
+        i_u = (max_neigh_u <= max_neigh_v) ? i_u + 8 : i_u;
+
+        // compare with all circular shifts of the neighbors of v
+        __mmask8 match = _mm512_cmpeq_epi64_mask(v_u, v_v);
+        match |= _mm512_cmpeq_epi64_mask(v_u, _mm512_alignr_epi64(v_v, v_v, 1));
+        match |= _mm512_cmpeq_epi64_mask(v_u, _mm512_alignr_epi64(v_v, v_v, 2));
+        match |= _mm512_cmpeq_epi64_mask(v_u, _mm512_alignr_epi64(v_v, v_v, 3));
+        match |= _mm512_cmpeq_epi64_mask(v_u, _mm512_alignr_epi64(v_v, v_v, 4));
+        match |= _mm512_cmpeq_epi64_mask(v_u, _mm512_alignr_epi64(v_v, v_v, 5));
+        match |= _mm512_cmpeq_epi64_mask(v_u, _mm512_alignr_epi64(v_v, v_v, 6));
+        match |= _mm512_cmpeq_epi64_mask(v_u, _mm512_alignr_epi64(v_v, v_v, 7));
+
+        total += _popcnt32_redef(static_cast<std::int32_t>(match));
+    }
+
+    while (i_u < n_u && i_v < n_v) {
+        if ((neigh_u[i_u] > neigh_v[n_v - 1]) || (neigh_v[i_v] > neigh_u[n_u - 1])) {
+            return total;
+        }
+        if (neigh_u[i_u] == neigh_v[i_v])
+            total++, i_u++, i_v++;
+        else if (neigh_u[i_u] < neigh_v[i_v])
+            i_u++;
+        else if (neigh_u[i_u] > neigh_v[i_v])
+            i_v++;
+    }
+    return total;
+}
+
 template <typename Cpu>
 vertex_similarity_result call_jaccard_default_kernel_avx512(
     const descriptor_base &desc,
@@ -46,6 +46,14 @@ vertex_similarity_result call_jaccard_default_kernel_int32<__CPU_TAG__>(
     return call_jaccard_default_kernel_scalar<__CPU_TAG__>(desc, data, result_ptr);
 }
 
+template <>
+vertex_similarity_result call_jaccard_default_kernel_int64<__CPU_TAG__>(
+    const descriptor_base &desc,
+    const dal::preview::detail::topology<std::int64_t> &data,
+    void *result_ptr) {
+    return call_jaccard_default_kernel_scalar<__CPU_TAG__>(desc, data, result_ptr);
+}
+
 } // namespace detail
 } // namespace jaccard
 } // namespace oneapi::dal::preview
@@ -18,6 +18,7 @@
 
 #include "oneapi/dal/algo/jaccard/backend/cpu/vertex_similarity_default_kernel.hpp"
 #include "oneapi/dal/algo/jaccard/backend/cpu/vertex_similarity_default_kernel_avx2.hpp"
+#include "oneapi/dal/algo/jaccard/backend/cpu/vertex_similarity_default_kernel_scalar.hpp"
 #include "oneapi/dal/algo/jaccard/common.hpp"
 #include "oneapi/dal/backend/dispatcher.hpp"
 #include "oneapi/dal/detail/policy.hpp"
@@ -38,10 +39,33 @@ vertex_similarity_result call_jaccard_default_kernel_int32<dal::backend::cpu_dis
     const descriptor_base &desc,
     const dal::preview::detail::topology<std::int32_t> &data,
     void *result_ptr) {
+    // The vectorized kernel addresses the neighbors with 32-bit offsets
+    if (data._rows_vertex.get_count() == 0) {
+        return call_jaccard_default_kernel_scalar<dal::backend::cpu_dispatch_avx2>(desc,
+                                                                                   data,
+                                                                                   result_ptr);
+    }
     return call_jaccard_default_kernel_avx2<dal::backend::cpu_dispatch_avx2>(desc,
                                                                              data,
                                                                              result_ptr);
 }
+
+template <>
+vertex_similarity_result call_jaccard_default_kernel_int64<dal::backend::cpu_dispatch_avx2>(
+    const descriptor_base &desc,
+    const dal::preview::detail::topology<std::int64_t> &data,
+    void *result_ptr) {
+    return call_jaccard_default_kernel_general<dal::backend::cpu_dispatch_avx2>(
+        desc,
+        data,
+        result_ptr,
+        [](const std::int64_t *neigh_u,
+           const std::int64_t *neigh_v,
+           std::int64_t n_u,
+           std::int64_t n_v) {
+            return intersection_int64(neigh_u, neigh_v, n_u, n_v);
+        });
+}
 } // namespace detail
 } // namespace jaccard
 } // namespace oneapi::dal::preview
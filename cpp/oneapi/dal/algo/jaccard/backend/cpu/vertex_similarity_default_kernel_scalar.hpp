@@ -49,12 +49,13 @@ ONEDAL_FORCEINLINE std::size_t intersection(const Index *neigh_u,
     return total;
 }
 
-template <typename Cpu, typename Index>
-vertex_similarity_result call_jaccard_default_kernel_scalar(
+template <typename Cpu, typename Index, typename Intersection>
+vertex_similarity_result call_jaccard_default_kernel_general(
     const descriptor_base &desc,
     const dal::preview::detail::topology<Index> &data,
-    void *result_ptr) {
-    const auto g_edge_offsets = data._rows_vertex.get_data();
+    void *result_ptr,
+    const Intersection &intersection) {
+    const auto g_edge_offsets = data._rows.get_data();
     const auto g_vertex_neighbors = data._cols.get_data();
     const auto g_degrees = data._degrees.get_data();
     const auto row_begin = dal::detail::integral_cast<Index>(desc.get_row_range_begin());
@@ -122,6 +123,20 @@ vertex_similarity_result call_jaccard_default_kernel_scalar(
         nnz);
     return res;
 }
+
+template <typename Cpu, typename Index>
+vertex_similarity_result call_jaccard_default_kernel_scalar(
+    const descriptor_base &desc,
+    const dal::preview::detail::topology<Index> &data,
+    void *result_ptr) {
+    return call_jaccard_default_kernel_general<Cpu>(
+        desc,
+        data,
+        result_ptr,
+        [](const Index *neigh_u, const Index *neigh_v, Index n_u, Index n_v) {
+            return intersection(neigh_u, neigh_v, n_u, n_v);
+        });
+}
 } // namespace detail
 } // namespace jaccard
 } // namespace oneapi::dal::preview
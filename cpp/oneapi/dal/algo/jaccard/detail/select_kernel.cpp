@@ -40,4 +40,23 @@ template struct ONEDAL_EXPORT backend_default<dal::detail::host_policy,
                                               dal::preview::jaccard::method::fast,
                                               dal::preview::detail::topology<std::int32_t>>;
 
+template <typename Float, typename Method>
+vertex_similarity_result backend_default<dal::detail::host_policy,
+                                         Float,
+                                         Method,
+                                         dal::preview::detail::topology<std::int64_t>>::
+operator()(const dal::detail::host_policy &policy,
+           const descriptor_base &desc,
+           const dal::preview::detail::topology<std::int64_t> &data,
+           void *result_ptr) {
+    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+        return call_jaccard_default_kernel_int64<decltype(cpu)>(desc, data, result_ptr);
+    });
+}
+
+template struct ONEDAL_EXPORT backend_default<dal::detail::host_policy,
+                                              float,
+                                              dal::preview::jaccard::method::fast,
+                                              dal::preview::detail::topology<std::int64_t>>;
+
 } // namespace oneapi::dal::preview::jaccard::detail
@@ -58,6 +58,21 @@ struct backend_default<dal::detail::host_policy,
     virtual ~backend_default() {}
 };
 
+template <typename Float, typename Method>
+struct backend_default<dal::detail::host_policy,
+                       Float,
+                       Method,
+                       dal::preview::detail::topology<std::int64_t>>
+        : public backend_base<dal::detail::host_policy,
+                              dal::preview::detail::topology<std::int64_t>> {
+    virtual vertex_similarity_result operator()(
+        const dal::detail::host_policy &ctx,
+        const descriptor_base &descriptor,
+        const dal::preview::detail::topology<std::int64_t> &data,
+        void *result_ptr);
+    virtual ~backend_default() {}
+};
+
 template <typename Policy, typename Float, class Method, typename Topology>
 dal::detail::pimpl<backend_base<Policy, Topology>> get_backend(const descriptor_base &desc,
                                                                const Topology &data) {
@@ -63,9 +63,14 @@ struct vertex_similarity_ops {
         if (row_end > vertex_count || column_end > vertex_count) {
             throw out_of_range(msg::interval_gt_vertex_count());
         }
-        if (row_end >= dal::detail::limits<std::int32_t>::max() ||
-            column_end >= dal::detail::limits<std::int32_t>::max()) {
-            throw invalid_argument(msg::range_idx_gt_max_int32());
+        if (row_end >= dal::detail::limits<vertex_type<Graph>>::max() ||
+            column_end >= dal::detail::limits<vertex_type<Graph>>::max()) {
+            if constexpr (std::is_same_v<vertex_type<Graph>, std::int32_t>) {
+                throw invalid_argument(msg::range_idx_gt_max_int32());
+            }
+            else {
+                throw invalid_argument(msg::range_idx_gt_max_int64());
+            }
         }
     }
 
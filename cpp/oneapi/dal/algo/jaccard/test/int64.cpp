@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <set>
+
+#include "oneapi/dal/algo/jaccard.hpp"
+#include "oneapi/dal/io/load_graph.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::preview::jaccard::test {
+
+constexpr std::int64_t vertex_count = 100;
+
+using graph32_t = undirected_adjacency_vector_graph<>;
+using graph64_t =
+    undirected_adjacency_vector_graph<empty_value, empty_value, empty_value, std::int64_t>;
+
+template <typename Graph>
+Graph load_random_graph() {
+    const std::string path = "onedal_jaccard_int64_test.csv";
+    {
+        // The vertices of the different degrees make the neighbor lists both longer
+        // and shorter than the vector registers
+        std::mt19937 engine(2021);
+        std::uniform_real_distribution<double> uniform(0.0, 1.0);
+        std::ofstream file(path);
+        for (std::int64_t u = 0; u < vertex_count; ++u) {
+            for (std::int64_t v = 0; v < u; ++v) {
+                if (uniform(engine) < ((u + v) % 5 == 0 ? 0.6 : 0.05)) {
+                    file << u << " " << v << "\n";
+                }
+            }
+        }
+    }
+    using input_t = edge_list<typename graph_traits<Graph>::vertex_type>;
+    Graph graph = load_graph::load(load_graph::descriptor<input_t, Graph>{},
+                                   graph_csv_data_source(path));
+    std::remove(path.c_str());
+    return graph;
+}
+
+template <typename Graph>
+std::vector<std::tuple<std::int64_t, std::int64_t, float>> compute_jaccard(const Graph &graph) {
+    caching_builder builder;
+    const auto desc = descriptor<>().set_block({ 0, vertex_count }, { 0, vertex_count });
+    const auto result = vertex_similarity(desc, graph, builder);
+    const std::int64_t nnz = result.get_nonzero_coeff_count();
+    const table pairs_table = result.get_vertex_pairs();
+    // The vertex pairs are in the column-major layout and have the vertex index type
+    const auto pairs = static_cast<const homogen_table &>(pairs_table)
+                           .get_data<typename graph_traits<Graph>::vertex_type>();
+    const table coeffs_table = result.get_coeffs();
+    const auto coeffs = static_cast<const homogen_table &>(coeffs_table).get_data<float>();
+    const std::int64_t row_count = pairs_table.get_row_count();
+    std::vector<std::tuple<std::int64_t, std::int64_t, float>> values;
+    for (std::int64_t i = 0; i < nnz; ++i) {
+        values.emplace_back(pairs[i], pairs[row_count + i], coeffs[i]);
+    }
+    return values;
+}
+
+TEST("jaccard for 64-bit vertex indices matches 32-bit vertex indices", "[jaccard][int64]") {
+    const auto expected = compute_jaccard(load_random_graph<graph32_t>());
+    const auto actual = compute_jaccard(load_random_graph<graph64_t>());
+    REQUIRE(expected.size() > static_cast<std::size_t>(vertex_count));
+    REQUIRE(actual == expected);
+}
+
+} // namespace oneapi::dal::preview::jaccard::test
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "oneapi/dal/algo/triangle_counting/common.hpp"
 #include "oneapi/dal/algo/triangle_counting/vertex_ranking_types.hpp"
 #include "oneapi/dal/backend/common.hpp"
@@ -52,15 +54,45 @@ array<std::int64_t> triangle_counting_local(
     const dal::preview::detail::topology<std::int32_t>& data,
     int64_t* triangles_local);
 
+template <typename Cpu>
+std::int64_t triangle_counting_global_scalar(const std::int64_t* vertex_neighbors,
+                                             const std::int64_t* edge_offsets,
+                                             const std::int64_t* degrees,
+                                             std::int64_t vertex_count,
+                                             std::int64_t edge_count);
+
+template <typename Cpu>
+std::int64_t triangle_counting_global_vector(const std::int64_t* vertex_neighbors,
+                                             const std::int64_t* edge_offsets,
+                                             const std::int64_t* degrees,
+                                             std::int64_t vertex_count,
+                                             std::int64_t edge_count);
+
+template <typename Cpu>
+array<std::int64_t> triangle_counting_local(
+    const dal::preview::detail::topology<std::int64_t>& data,
+    int64_t* triangles_local);
+
+// The vertices are processed by blocks to keep the number of the parallel tasks within int32
+constexpr std::int64_t vertex_block_size = 1 << 10;
+
+inline std::int32_t get_vertex_block_count(std::int64_t vertex_count) {
+    return dal::detail::integral_cast<std::int32_t>((vertex_count + vertex_block_size - 1) /
+                                                    vertex_block_size);
+}
+
 template <typename Cpu>
 std::int64_t compute_global_triangles(const array<std::int64_t>& local_triangles,
                                       std::int64_t vertex_count) {
+    const std::int64_t* local_triangles_ptr = local_triangles.get_data();
     std::int64_t total_s = oneapi::dal::detail::parallel_reduce_int32_int64_t(
-        vertex_count,
+        get_vertex_block_count(vertex_count),
         (std::int64_t)0,
-        [&](std::int32_t begin_u, std::int32_t end_u, std::int64_t tc) -> std::int64_t {
+        [&](std::int32_t begin_block, std::int32_t end_block, std::int64_t tc) -> std::int64_t {
+            const std::int64_t begin_u = begin_block * vertex_block_size;
+            const std::int64_t end_u = std::min(end_block * vertex_block_size, vertex_count);
             for (auto u = begin_u; u != end_u; ++u) {
-                tc += local_triangles[u];
+                tc += local_triangles_ptr[u];
             }
             return tc;
         },
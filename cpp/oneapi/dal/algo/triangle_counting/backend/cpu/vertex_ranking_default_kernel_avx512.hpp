@@ -923,4 +923,97 @@ ONEDAL_FORCEINLINE std::int64_t triangle_counting_global_vector_relabel_(
     return total_s;
 }
 
+ONEDAL_FORCEINLINE std::int64_t intersection(const std::int64_t* neigh_u,
+                                             const std::int64_t* neigh_v,
+                                             std::int64_t n_u,
+                                             std::int64_t n_v) {
+    std::int64_t total = 0;
+    std::int64_t i_u = 0, i_v = 0;
+    while (i_u + 8 <= n_u && i_v + 8 <= n_v) { // not in last n%8 elements
+        // assumes neighbor list is ordered
+        const std::int64_t max_neigh_u = neigh_u[i_u + 7];
+        const std::int64_t max_neigh_v = neigh_v[i_v + 7];
+        if (neigh_u[i_u] > max_neigh_v) {
+            i_v += 8;
+            continue;
+        }
+        if (neigh_v[i_v] > max_neigh_u) {
+            i_u += 8;
+            continue;
+        }
+        __m512i v_u = _mm512_loadu_si512((void*)(neigh_u + i_u)); // load 8 neighbors of u
+        __m512i v_v = _mm512_loadu_si512((void*)(neigh_v + i_v)); // load 8 neighbors of v
+
+        // compare with all circular shifts of the neighbors of v
+        __mmask8 match = _mm512_cmpeq_epi64_mask(v_u, v_v);
+        match |= _mm512_cmpeq_epi64_mask(v_u, _mm512_alignr_epi64(v_v, v_v, 1));
+        match |= _mm512_cmpeq_epi64_mask(v_u, _mm512_alignr_epi64(v_v, v_v, 2));
+        match |= _mm512_cmpeq_epi64_mask(v_u, _mm512_alignr_epi64(v_v, v_v, 3));
+        match |= _mm512_cmpeq_epi64_mask(v_u, _mm512_alignr_epi64(v_v, v_v, 4));
+        match |= _mm512_cmpeq_epi64_mask(v_u, _mm512_alignr_epi64(v_v, v_v, 5));
+        match |= _mm512_cmpeq_epi64_mask(v_u, _mm512_alignr_epi64(v_v, v_v, 6));
+        match |= _mm512_cmpeq_epi64_mask(v_u, _mm512_alignr_epi64(v_v, v_v, 7));
+        total += _popcnt32_redef(static_cast<std::int32_t>(match)); //count number of matches
+
+        if (max_neigh_u >= max_neigh_v)
+            i_v += 8;
+        if (max_neigh_u <= max_neigh_v)
+            i_u += 8;
+    }
+
+    while (i_u < n_u && i_v < n_v) {
+        if ((neigh_u[i_u] > neigh_v[n_v - 1]) || (neigh_v[i_v] > neigh_u[n_u - 1])) {
+            return total;
+        }
+        if (neigh_u[i_u] == neigh_v[i_v])
+            total++, i_u++, i_v++;
+        else if (neigh_u[i_u] < neigh_v[i_v])
+            i_u++;
+        else if (neigh_u[i_u] > neigh_v[i_v])
+            i_v++;
+    }
+    return total;
+}
+
+template <typename Cpu>
+ONEDAL_FORCEINLINE std::int64_t triangle_counting_global_vector_int64_(
+    const std::int64_t* vertex_neighbors,
+    const std::int64_t* edge_offsets,
+    const std::int64_t* degrees,
+    std::int64_t vertex_count,
+    std::int64_t edge_count) {
+    const std::int32_t block_count = get_vertex_block_count(vertex_count);
+    std::int64_t total_s = oneapi::dal::detail::parallel_reduce_int32_int64_t(
+        block_count,
+        (std::int64_t)0,
+        [&](std::int32_t begin_block, std::int32_t end_block, std::int64_t tc_u) -> std::int64_t {
+            const std::int64_t begin_u = begin_block * vertex_block_size;
+            const std::int64_t end_u = std::min(end_block * vertex_block_size, vertex_count);
+            for (auto u = begin_u; u != end_u; ++u) {
+                if (degrees[u] < 2) {
+                    continue;
+                }
+                const std::int64_t* neigh_u = vertex_neighbors + edge_offsets[u];
+                const std::int64_t size_neigh_u = degrees[u];
+                for (auto v_ = neigh_u; v_ != neigh_u + size_neigh_u; ++v_) {
+                    const std::int64_t v = *v_;
+                    if (v > u) {
+                        break;
+                    }
+                    const std::int64_t* neigh_v = vertex_neighbors + edge_offsets[v];
+                    std::int64_t new_size_neigh_v = 0;
+                    while (new_size_neigh_v < degrees[v] && neigh_v[new_size_neigh_v] <= v) {
+                        new_size_neigh_v++;
+                    }
+                    tc_u += intersection(neigh_u, neigh_v, size_neigh_u, new_size_neigh_v);
+                }
+            }
+            return tc_u;
+        },
+        [&](std::int64_t x, std::int64_t y) -> std::int64_t {
+            return x + y;
+        });
+    return total_s;
+}
+
 } // namespace oneapi::dal::preview::triangle_counting::backend
@@ -0,0 +1,132 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/triangle_counting/backend/cpu/vertex_ranking_default_kernel.hpp"
+
+namespace oneapi::dal::preview::triangle_counting::backend {
+
+template <typename Cpu>
+ONEDAL_FORCEINLINE std::int64_t triangle_counting_global_scalar_int64_(
+    const std::int64_t* vertex_neighbors,
+    const std::int64_t* edge_offsets,
+    const std::int64_t* degrees,
+    std::int64_t vertex_count,
+    std::int64_t edge_count) {
+    const std::int32_t block_count = get_vertex_block_count(vertex_count);
+    std::int64_t total_s = oneapi::dal::detail::parallel_reduce_int32_int64_t(
+        block_count,
+        (std::int64_t)0,
+        [&](std::int32_t begin_block, std::int32_t end_block, std::int64_t tc_u) -> std::int64_t {
+            const std::int64_t begin_u = begin_block * vertex_block_size;
+            const std::int64_t end_u = std::min(end_block * vertex_block_size, vertex_count);
+            for (auto u = begin_u; u != end_u; ++u) {
+                for (auto v_ = vertex_neighbors + edge_offsets[u];
+                     v_ != vertex_neighbors + edge_offsets[u + 1];
+                     ++v_) {
+                    std::int64_t v = *v_;
+                    if (v > u) {
+                        break;
+                    }
+                    auto u_neighbors_ptr = vertex_neighbors + edge_offsets[u];
+                    for (auto w_ = vertex_neighbors + edge_offsets[v];
+                         w_ != vertex_neighbors + edge_offsets[v + 1];
+                         ++w_) {
+                        std::int64_t w = *w_;
+                        if (w > v) {
+                            break;
+                        }
+                        while (*u_neighbors_ptr < w) {
+                            u_neighbors_ptr++;
+                        }
+                        if (w == *u_neighbors_ptr) {
+                            tc_u++;
+                        }
+                    }
+                }
+            }
+            return tc_u;
+        },
+        [&](std::int64_t x, std::int64_t y) -> std::int64_t {
+            return x + y;
+        });
+    return total_s;
+}
+
+template <typename Cpu>
+ONEDAL_FORCEINLINE array<std::int64_t> triangle_counting_local_int64_(
+    const dal::preview::detail::topology<std::int64_t>& data,
+    int64_t* triangles_local) {
+    const auto g_edge_offsets = data._rows.get_data();
+    const auto g_vertex_neighbors = data._cols.get_data();
+    const auto g_vertex_count = data._vertex_count;
+    const int thread_cnt = dal::detail::threader_get_max_threads();
+
+    dal::detail::threader_for_int64((int64_t)thread_cnt * g_vertex_count, [&](std::int64_t i) {
+        triangles_local[i] = 0;
+    });
+
+    const std::int32_t block_count = get_vertex_block_count(g_vertex_count);
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t block) {
+        const int thread_id = dal::detail::threader_get_current_thread_index();
+        int64_t* const thread_triangles = triangles_local + (int64_t)thread_id * g_vertex_count;
+        const std::int64_t begin_u = block * vertex_block_size;
+        const std::int64_t end_u = std::min(begin_u + vertex_block_size, g_vertex_count);
+        for (auto u = begin_u; u != end_u; ++u) {
+            std::int64_t tc_u = 0;
+            for (auto v_ = g_vertex_neighbors + g_edge_offsets[u];
+                 v_ != g_vertex_neighbors + g_edge_offsets[u + 1];
+                 ++v_) {
+                std::int64_t v = *v_;
+                if (v > u) {
+                    break;
+                }
+                auto u_neighbors_ptr = g_vertex_neighbors + g_edge_offsets[u];
+                for (auto w_ = g_vertex_neighbors + g_edge_offsets[v];
+                     w_ != g_vertex_neighbors + g_edge_offsets[v + 1];
+                     ++w_) {
+                    std::int64_t w = *w_;
+                    if (w > v) {
+                        break;
+                    }
+                    while (*u_neighbors_ptr < w) {
+                        u_neighbors_ptr++;
+                    }
+                    if (w == *u_neighbors_ptr) {
+                        tc_u++;
+                        thread_triangles[v]++;
+                        thread_triangles[w]++;
+                    }
+                }
+            }
+            thread_triangles[u] += tc_u;
+        }
+    });
+
+    auto arr_triangles = array<std::int64_t>::empty(g_vertex_count);
+    int64_t* triangles_ptr = arr_triangles.get_mutable_data();
+    dal::detail::threader_for_int64(g_vertex_count, [&](std::int64_t u) {
+        std::int64_t tc = 0;
+        for (int j = 0; j < thread_cnt; j++) {
+            tc += triangles_local[(int64_t)j * g_vertex_count + u];
+        }
+        triangles_ptr[u] = tc;
+    });
+    return arr_triangles;
+}
+
+} // namespace oneapi::dal::preview::triangle_counting::backend
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include "oneapi/dal/algo/triangle_counting/backend/cpu/vertex_ranking_default_kernel_avx512.hpp"
+#include "oneapi/dal/algo/triangle_counting/backend/cpu/vertex_ranking_default_kernel_int64.hpp"
 
 namespace oneapi::dal::preview::triangle_counting::backend {
 
@@ -68,6 +69,43 @@ std::int64_t triangle_counting_global_vector_relabel<dal::backend::cpu_dispatch_
         edge_count);
 }
 
+template <>
+array<std::int64_t> triangle_counting_local<dal::backend::cpu_dispatch_avx512>(
+    const dal::preview::detail::topology<std::int64_t>& data,
+    int64_t* triangles_local) {
+    return triangle_counting_local_int64_<dal::backend::cpu_dispatch_avx512>(data, triangles_local);
+}
+
+template <>
+std::int64_t triangle_counting_global_scalar<dal::backend::cpu_dispatch_avx512>(
+    const std::int64_t* vertex_neighbors,
+    const std::int64_t* edge_offsets,
+    const std::int64_t* degrees,
+    std::int64_t vertex_count,
+    std::int64_t edge_count) {
+    return triangle_counting_global_scalar_int64_<dal::backend::cpu_dispatch_avx512>(
+        vertex_neighbors,
+        edge_offsets,
+        degrees,
+        vertex_count,
+        edge_count);
+}
+
+template <>
+std::int64_t triangle_counting_global_vector<dal::backend::cpu_dispatch_avx512>(
+    const std::int64_t* vertex_neighbors,
+    const std::int64_t* edge_offsets,
+    const std::int64_t* degrees,
+    std::int64_t vertex_count,
+    std::int64_t edge_count) {
+    return triangle_counting_global_vector_int64_<dal::backend::cpu_dispatch_avx512>(
+        vertex_neighbors,
+        edge_offsets,
+        degrees,
+        vertex_count,
+        edge_count);
+}
+
 template std::int64_t compute_global_triangles<dal::backend::cpu_dispatch_avx512>(
     const array<std::int64_t>& local_triangles,
     std::int64_t vertex_count);
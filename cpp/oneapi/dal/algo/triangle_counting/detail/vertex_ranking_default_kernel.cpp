@@ -82,6 +82,50 @@ ONEDAL_EXPORT array<std::int64_t> triangle_counting_local<std::int32_t>(
     });
 }
 
+template <>
+ONEDAL_EXPORT std::int64_t triangle_counting_global_scalar<std::int64_t>(
+    const dal::detail::host_policy& policy,
+    const std::int64_t* vertex_neighbors,
+    const std::int64_t* edge_offsets,
+    const std::int64_t* degrees,
+    std::int64_t vertex_count,
+    std::int64_t edge_count) {
+    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+        return backend::triangle_counting_global_scalar<decltype(cpu)>(vertex_neighbors,
+                                                                       edge_offsets,
+                                                                       degrees,
+                                                                       vertex_count,
+                                                                       edge_count);
+    });
+}
+
+template <>
+ONEDAL_EXPORT std::int64_t triangle_counting_global_vector<std::int64_t>(
+    const dal::detail::host_policy& policy,
+    const std::int64_t* vertex_neighbors,
+    const std::int64_t* edge_offsets,
+    const std::int64_t* degrees,
+    std::int64_t vertex_count,
+    std::int64_t edge_count) {
+    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+        return backend::triangle_counting_global_vector<decltype(cpu)>(vertex_neighbors,
+                                                                       edge_offsets,
+                                                                       degrees,
+                                                                       vertex_count,
+                                                                       edge_count);
+    });
+}
+
+template <>
+ONEDAL_EXPORT array<std::int64_t> triangle_counting_local<std::int64_t>(
+    const dal::detail::host_policy& policy,
+    const dal::preview::detail::topology<std::int64_t>& data,
+    int64_t* triangles_local) {
+    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+        return backend::triangle_counting_local<decltype(cpu)>(data, triangles_local);
+    });
+}
+
 std::int64_t compute_global_triangles(const dal::detail::host_policy& policy,
                                       const array<std::int64_t>& local_triangles,
                                       std::int64_t vertex_count) {
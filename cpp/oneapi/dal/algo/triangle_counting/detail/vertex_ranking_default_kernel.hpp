@@ -264,14 +264,15 @@ inline vertex_ranking_result<task::global> triangle_counting_default_kernel(
     return res;
 }
 
-template <typename Allocator>
+template <typename Allocator, typename Index>
 inline array<std::int64_t> triangle_counting_local_default_kernel(
     const dal::detail::host_policy& ctx,
     const Allocator& alloc,
-    const dal::preview::detail::topology<std::int32_t>& data) {
+    const dal::preview::detail::topology<Index>& data) {
     const auto g_vertex_count = data._vertex_count;
 
     int thread_cnt = dal::detail::threader_get_max_threads();
+    dal::detail::check_mul_overflow((int64_t)thread_cnt, (int64_t)g_vertex_count);
 
     using int64_allocator_type =
         typename std::allocator_traits<Allocator>::template rebind_alloc<std::int64_t>;
@@ -321,4 +322,53 @@ inline vertex_ranking_result<task::local_and_global> triangle_counting_default_k
         .set_global_rank(total_s);
 }
 
+template <typename Allocator>
+inline vertex_ranking_result<task::global> triangle_counting_default_kernel(
+    const dal::detail::host_policy& ctx,
+    const detail::descriptor_base<task::global>& desc,
+    const Allocator& alloc,
+    const dal::preview::detail::topology<std::int64_t>& data) {
+    // The relabeling is available for 32-bit vertex indices only
+    const std::int64_t triangles = triangle_counting_global_vector(ctx,
+                                                                   data._cols.get_data(),
+                                                                   data._rows.get_data(),
+                                                                   data._degrees.get_data(),
+                                                                   data._vertex_count,
+                                                                   data._edge_count);
+
+    vertex_ranking_result<task::global> res;
+    res.set_global_rank(triangles);
+    return res;
+}
+
+template <typename Allocator>
+inline vertex_ranking_result<task::local> triangle_counting_default_kernel(
+    const dal::detail::host_policy& ctx,
+    const detail::descriptor_base<task::local>& desc,
+    const Allocator& alloc,
+    const dal::preview::detail::topology<std::int64_t>& data) {
+    auto local_triangles = triangle_counting_local_default_kernel(ctx, alloc, data);
+
+    return vertex_ranking_result<task::local>().set_ranks(
+        dal::detail::homogen_table_builder{}.reset(local_triangles, data._vertex_count, 1).build());
+}
+
+template <typename Allocator>
+inline vertex_ranking_result<task::local_and_global> triangle_counting_default_kernel(
+    const dal::detail::host_policy& ctx,
+    const detail::descriptor_base<task::local_and_global>& desc,
+    const Allocator& alloc,
+    const dal::preview::detail::topology<std::int64_t>& data) {
+    const auto vertex_count = data._vertex_count;
+
+    auto local_triangles = triangle_counting_local_default_kernel(ctx, alloc, data);
+
+    std::int64_t total_s = compute_global_triangles(ctx, local_triangles, vertex_count);
+
+    return vertex_ranking_result<task::local_and_global>()
+        .set_ranks(
+            dal::detail::homogen_table_builder{}.reset(local_triangles, vertex_count, 1).build())
+        .set_global_rank(total_s);
+}
+
 } // namespace oneapi::dal::preview::triangle_counting::detail
@@ -0,0 +1,107 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <set>
+
+#include "oneapi/dal/algo/triangle_counting.hpp"
+#include "oneapi/dal/io/load_graph.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::preview::triangle_counting::test {
+
+constexpr std::int64_t vertex_count = 200;
+
+using graph32_t = undirected_adjacency_vector_graph<>;
+using graph64_t =
+    undirected_adjacency_vector_graph<empty_value, empty_value, empty_value, std::int64_t>;
+
+/// Generates the random graph with the dense and the sparse vertices, so the neighbor lists
+/// are both longer and shorter than the vector registers
+std::set<std::pair<std::int64_t, std::int64_t>> generate_edges() {
+    std::mt19937 engine(2021);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::set<std::pair<std::int64_t, std::int64_t>> edges;
+    for (std::int64_t u = 0; u < vertex_count; ++u) {
+        for (std::int64_t v = 0; v < u; ++v) {
+            const double probability = (u % 4 == 0 && v % 3 == 0) ? 0.5 : 0.05;
+            if (uniform(engine) < probability) {
+                edges.emplace(u, v);
+            }
+        }
+    }
+    return edges;
+}
+
+template <typename Graph>
+Graph load_graph(const std::set<std::pair<std::int64_t, std::int64_t>> &edges) {
+    const std::string path = "onedal_triangle_counting_int64_test.csv";
+    {
+        std::ofstream file(path);
+        for (const auto &edge : edges) {
+            file << edge.first << " " << edge.second << "\n";
+        }
+    }
+    using input_t = edge_list<typename graph_traits<Graph>::vertex_type>;
+    Graph graph = load_graph::load(load_graph::descriptor<input_t, Graph>{},
+                                   graph_csv_data_source(path));
+    std::remove(path.c_str());
+    return graph;
+}
+
+std::vector<std::int64_t> get_ranks(const table &ranks) {
+    const auto data = static_cast<const homogen_table &>(ranks).get_data<std::int64_t>();
+    return std::vector<std::int64_t>(data, data + ranks.get_row_count());
+}
+
+TEST("triangle counting for 64-bit vertex indices matches the brute force", "[tc][int64]") {
+    const auto edges = generate_edges();
+
+    std::int64_t expected_global = 0;
+    std::vector<std::int64_t> expected_local(vertex_count, 0);
+    for (const auto &[u, v] : edges) {
+        for (std::int64_t w = 0; w < v; ++w) {
+            if (edges.count({ u, w }) && edges.count({ v, w })) {
+                ++expected_global;
+                ++expected_local[u];
+                ++expected_local[v];
+                ++expected_local[w];
+            }
+        }
+    }
+
+    const auto graph32 = load_graph<graph32_t>(edges);
+    const auto graph64 = load_graph<graph64_t>(edges);
+    std::allocator<char> alloc;
+
+    const auto global_desc = descriptor<float, method::ordered_count, task::global>(alloc);
+    REQUIRE(vertex_ranking(global_desc, graph32).get_global_rank() == expected_global);
+    REQUIRE(vertex_ranking(global_desc, graph64).get_global_rank() == expected_global);
+
+    const auto local_desc = descriptor<float, method::ordered_count, task::local_and_global>(alloc);
+    const auto result32 = vertex_ranking(local_desc, graph32);
+    const auto result64 = vertex_ranking(local_desc, graph64);
+    REQUIRE(result32.get_global_rank() == expected_global);
+    REQUIRE(result64.get_global_rank() == expected_global);
+    REQUIRE(get_ranks(result32.get_ranks()) == expected_local);
+    REQUIRE(get_ranks(result64.get_ranks()) == expected_local);
+}
+
+} // namespace oneapi::dal::preview::triangle_counting::test
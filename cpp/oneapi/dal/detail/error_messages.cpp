@@ -92,6 +92,10 @@ MSG(max_iteration_count_lt_zero, "Max iteration count lower than zero")
 
 /* IO */
 MSG(file_not_found, "File not found")
+MSG(file_write_failed, "Failed to write file")
+MSG(invalid_graph_snapshot, "Graph snapshot is corrupted or does not match the graph type")
+MSG(invalid_edge_list_file,
+    "Edge list file contains a token that is not a vertex index of the graph type or an incomplete edge")
 
 /* K-Means */
 MSG(cluster_count_leq_zero, "Cluster count is lower than or equal to zero")
@@ -125,6 +129,7 @@ MSG(interval_gt_vertex_count, "Interval is greater than vertex count")
 MSG(negative_interval, "Negative interval")
 MSG(row_begin_gt_row_end, "Row begin is greater than row end")
 MSG(range_idx_gt_max_int32, "Range indexes are greater than max of int32")
+MSG(range_idx_gt_max_int64, "Range indexes are greater than max of int64")
 
 /* PCA */
 MSG(component_count_lt_zero, "Component count is lower than zero")
@@ -120,6 +120,9 @@ public:
 
     /* I/O */
     MSG(file_not_found);
+    MSG(file_write_failed);
+    MSG(invalid_graph_snapshot);
+    MSG(invalid_edge_list_file);
 
     /* Decision Forest */
     MSG(bootstrap_is_incompatible_with_error_metric);
@@ -134,6 +137,7 @@ public:
     MSG(negative_interval);
     MSG(row_begin_gt_row_end);
     MSG(range_idx_gt_max_int32);
+    MSG(range_idx_gt_max_int64);
 
     /* K-Means and K-Means Init */
     MSG(cluster_count_leq_zero);
@@ -24,7 +24,7 @@
 namespace oneapi::dal::preview::detail {
 
 template <typename IndexType>
-constexpr bool is_valid_index_v = dal::detail::is_one_of_v<IndexType, std::int32_t>;
+constexpr bool is_valid_index_v = dal::detail::is_one_of_v<IndexType, std::int32_t, std::int64_t>;
 
 template <typename IndexType>
 class topology {
@@ -55,6 +55,8 @@ public:
     vertex_set _cols;
     vertex_set _degrees;
     edge_set _rows;
+    // Copy of _rows narrowed to vertex_edge_type, only present for 32-bit vertex indices
+    // when the number of the neighbors fits into it
     vertex_edge_set _rows_vertex;
 
     std::int64_t _vertex_count = 0;
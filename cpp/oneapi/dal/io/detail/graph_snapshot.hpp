@@ -0,0 +1,251 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstring>
+#include <fstream>
+
+#include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/graph/detail/undirected_adjacency_vector_graph_impl.hpp"
+#include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
+#include "oneapi/dal/io/detail/load_graph_service.hpp"
+
+namespace oneapi::dal::preview::load_graph::detail {
+
+/// The graph snapshot is the header followed by the arrays of the topology:
+/// offsets, degrees, neighbors and, optionally, 32-bit offsets. Every array starts at the offset
+/// aligned to graph_snapshot_alignment, so the arrays are used in place when the file is mapped
+constexpr std::uint64_t graph_snapshot_magic = 0x50414e5347414455; // "UDAGSNAP"
+constexpr std::uint32_t graph_snapshot_version = 1;
+constexpr std::int64_t graph_snapshot_alignment = 64;
+
+struct graph_snapshot_header {
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t vertex_size;
+    std::uint32_t edge_size;
+    std::uint32_t vertex_edge_size;
+    std::int64_t vertex_count;
+    std::int64_t edge_count;
+    std::int64_t neighbor_count;
+    std::int64_t has_vertex_edge_offsets;
+};
+
+inline std::int64_t align_graph_snapshot_offset(std::int64_t offset) {
+    return (offset + graph_snapshot_alignment - 1) / graph_snapshot_alignment *
+           graph_snapshot_alignment;
+}
+
+/// Computes the aligned offset of the array that follows the array of count elements
+/// at the given offset. Returns false if the offset overflows
+inline bool get_next_graph_snapshot_offset(std::int64_t offset,
+                                           std::int64_t count,
+                                           std::int64_t element_size,
+                                           std::int64_t &next) {
+    dal::detail::integer_overflow_ops<std::int64_t> ops;
+    std::int64_t size, end, aligned_end;
+    if (!ops.is_safe_mul(count, element_size, size) || !ops.is_safe_sum(offset, size, end) ||
+        !ops.is_safe_sum(end, graph_snapshot_alignment - 1, aligned_end)) {
+        return false;
+    }
+    next = aligned_end / graph_snapshot_alignment * graph_snapshot_alignment;
+    return true;
+}
+
+/// Offsets of the arrays in the snapshot with the given header, the last one is the snapshot size.
+/// The layout is invalid if the counts of the header are negative or the offsets overflow
+struct graph_snapshot_layout {
+    explicit graph_snapshot_layout(const graph_snapshot_header &header) {
+        const std::int64_t row_count = header.vertex_count + 1;
+        offsets = align_graph_snapshot_offset(sizeof(graph_snapshot_header));
+        is_valid = header.vertex_count >= 0 && header.neighbor_count >= 0 &&
+                   header.vertex_count < dal::detail::limits<std::int64_t>::max() &&
+                   get_next_graph_snapshot_offset(offsets, row_count, header.edge_size, degrees) &&
+                   get_next_graph_snapshot_offset(degrees,
+                                                  header.vertex_count,
+                                                  header.vertex_size,
+                                                  neighbors) &&
+                   get_next_graph_snapshot_offset(neighbors,
+                                                  header.neighbor_count,
+                                                  header.vertex_size,
+                                                  vertex_edge_offsets);
+        end = vertex_edge_offsets;
+        if (is_valid && header.has_vertex_edge_offsets) {
+            is_valid = get_next_graph_snapshot_offset(vertex_edge_offsets,
+                                                      row_count,
+                                                      header.vertex_edge_size,
+                                                      end);
+        }
+    }
+
+    bool is_valid;
+    std::int64_t offsets = 0;
+    std::int64_t degrees = 0;
+    std::int64_t neighbors = 0;
+    std::int64_t vertex_edge_offsets = 0;
+    std::int64_t end = 0;
+};
+
+inline void write_graph_snapshot_array(std::ofstream &file,
+                                       std::int64_t &position,
+                                       std::int64_t offset,
+                                       const void *data,
+                                       std::int64_t size) {
+    const char zeros[graph_snapshot_alignment] = {};
+    file.write(zeros, offset - position);
+    file.write(static_cast<const char *>(data), size);
+    position = offset + size;
+}
+
+template <typename Graph>
+void save_snapshot_impl(const Graph &graph, const std::string &name) {
+    using vertex_t = typename graph_traits<Graph>::vertex_type;
+    using edge_t = typename graph_traits<Graph>::edge_type;
+    using vertex_edge_t = typename graph_traits<Graph>::impl_type::vertex_edge_type;
+
+    const auto &topology = oneapi::dal::detail::get_impl(graph).get_topology();
+
+    graph_snapshot_header header;
+    std::memset(&header, 0, sizeof(header));
+    header.magic = graph_snapshot_magic;
+    header.version = graph_snapshot_version;
+    header.vertex_size = sizeof(vertex_t);
+    header.edge_size = sizeof(edge_t);
+    header.vertex_edge_size = sizeof(vertex_edge_t);
+    header.vertex_count = topology._vertex_count;
+    header.edge_count = topology._edge_count;
+    header.neighbor_count = topology._cols.get_count();
+    header.has_vertex_edge_offsets = (topology._rows_vertex.get_count() > 0);
+    const graph_snapshot_layout layout(header);
+
+    std::ofstream file(name, std::ios::binary | std::ios::trunc);
+    if (!layout.is_valid || !file.is_open()) {
+        throw invalid_argument(dal::detail::error_messages::file_write_failed());
+    }
+
+    std::int64_t position = 0;
+    write_graph_snapshot_array(file, position, 0, &header, sizeof(header));
+    write_graph_snapshot_array(file,
+                               position,
+                               layout.offsets,
+                               topology._rows.get_data(),
+                               topology._rows.get_count() * sizeof(edge_t));
+    write_graph_snapshot_array(file,
+                               position,
+                               layout.degrees,
+                               topology._degrees.get_data(),
+                               topology._degrees.get_count() * sizeof(vertex_t));
+    write_graph_snapshot_array(file,
+                               position,
+                               layout.neighbors,
+                               topology._cols.get_data(),
+                               topology._cols.get_count() * sizeof(vertex_t));
+    if (header.has_vertex_edge_offsets) {
+        write_graph_snapshot_array(file,
+                                   position,
+                                   layout.vertex_edge_offsets,
+                                   topology._rows_vertex.get_data(),
+                                   topology._rows_vertex.get_count() * sizeof(vertex_edge_t));
+    }
+    write_graph_snapshot_array(file, position, layout.end, nullptr, 0);
+
+    file.close();
+    if (file.fail()) {
+        throw invalid_argument(dal::detail::error_messages::file_write_failed());
+    }
+}
+
+template <typename Graph>
+void load_snapshot_impl(const std::string &name, Graph &graph) {
+    using vertex_t = typename graph_traits<Graph>::vertex_type;
+    using edge_t = typename graph_traits<Graph>::edge_type;
+    using vertex_edge_t = typename graph_traits<Graph>::impl_type::vertex_edge_type;
+    using vertex_set = typename graph_traits<Graph>::impl_type::vertex_set;
+    using edge_set = typename graph_traits<Graph>::impl_type::edge_set;
+    using vertex_edge_set = typename graph_traits<Graph>::impl_type::vertex_edge_set;
+
+    const auto file = map_file(name);
+    const std::int64_t file_size = file.get_count();
+    if (file_size < static_cast<std::int64_t>(sizeof(graph_snapshot_header))) {
+        throw invalid_argument(dal::detail::error_messages::invalid_graph_snapshot());
+    }
+
+    graph_snapshot_header header;
+    std::memcpy(&header, file.get_data(), sizeof(header));
+    if (header.magic != graph_snapshot_magic || header.version != graph_snapshot_version ||
+        header.vertex_size != sizeof(vertex_t) || header.edge_size != sizeof(edge_t) ||
+        header.vertex_edge_size != sizeof(vertex_edge_t) || header.edge_count < 0) {
+        throw invalid_argument(dal::detail::error_messages::invalid_graph_snapshot());
+    }
+    const graph_snapshot_layout layout(header);
+    if (!layout.is_valid || layout.end > file_size) {
+        throw invalid_argument(dal::detail::error_messages::invalid_graph_snapshot());
+    }
+
+    // The arrays of the topology are immutable views of the file that share its ownership,
+    // so the graph neither copies nor deallocates them
+    const byte_t *data = file.get_data();
+    const std::int64_t vertex_count = header.vertex_count;
+    const std::int64_t neighbor_count = header.neighbor_count;
+    const edge_t *offsets = reinterpret_cast<const edge_t *>(data + layout.offsets);
+    const vertex_t *degrees = reinterpret_cast<const vertex_t *>(data + layout.degrees);
+    const vertex_t *neighbors = reinterpret_cast<const vertex_t *>(data + layout.neighbors);
+    const vertex_edge_t *vertex_edge_offsets =
+        header.has_vertex_edge_offsets
+            ? reinterpret_cast<const vertex_edge_t *>(data + layout.vertex_edge_offsets)
+            : nullptr;
+
+    // The algorithms index the arrays by the offsets and the neighbors without checks,
+    // so the topology is validated before it is used
+    std::atomic<bool> is_valid = (offsets[0] == 0 && offsets[vertex_count] == neighbor_count);
+    if (vertex_edge_offsets && vertex_edge_offsets[vertex_count] != offsets[vertex_count]) {
+        is_valid = false;
+    }
+    dal::detail::threader_for_int64(vertex_count, [&](std::int64_t u) {
+        const edge_t begin = offsets[u];
+        const edge_t end = offsets[u + 1];
+        if (begin < 0 || begin > end || end > neighbor_count || degrees[u] != end - begin ||
+            (vertex_edge_offsets && vertex_edge_offsets[u] != begin)) {
+            is_valid.store(false, std::memory_order_relaxed);
+            return;
+        }
+        for (edge_t e = begin; e < end; ++e) {
+            if (neighbors[e] < 0 || neighbors[e] >= vertex_count) {
+                is_valid.store(false, std::memory_order_relaxed);
+                return;
+            }
+        }
+    });
+    if (!is_valid) {
+        throw invalid_argument(dal::detail::error_messages::invalid_graph_snapshot());
+    }
+
+    auto &topology = oneapi::dal::detail::get_impl(graph).get_topology();
+    topology._vertex_count = vertex_count;
+    topology._edge_count = header.edge_count;
+    topology._rows = edge_set(file, offsets, vertex_count + 1);
+    topology._degrees = vertex_set(file, degrees, vertex_count);
+    topology._cols = vertex_set(file, neighbors, neighbor_count);
+    if (vertex_edge_offsets) {
+        topology._rows_vertex = vertex_edge_set(file, vertex_edge_offsets, vertex_count + 1);
+    }
+}
+
+} // namespace oneapi::dal::preview::load_graph::detail
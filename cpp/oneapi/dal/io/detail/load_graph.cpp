@@ -14,12 +14,189 @@
 * limitations under the License.
 *******************************************************************************/
 
+#if defined(_WIN32) || defined(_WIN64)
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
 #include "oneapi/dal/io/detail/load_graph.hpp"
 #include "oneapi/dal/io/backend/cpu/load_graph.hpp"
 #include "oneapi/dal/backend/dispatcher.hpp"
 
 namespace oneapi::dal::preview::load_graph::detail {
 
+ONEDAL_EXPORT dal::array<byte_t> map_file(const std::string &name) {
+#if defined(_WIN32) || defined(_WIN64)
+    std::ifstream file(name, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        throw invalid_argument(dal::detail::error_messages::file_not_found());
+    }
+    const std::int64_t size = static_cast<std::int64_t>(file.tellg());
+    if (size == 0) {
+        return dal::array<byte_t>();
+    }
+    auto buffer = dal::array<byte_t>::empty(size);
+    file.seekg(0);
+    file.read(reinterpret_cast<char *>(buffer.get_mutable_data()), size);
+    return buffer;
+#else
+    const int fd = open(name.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw invalid_argument(dal::detail::error_messages::file_not_found());
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0) {
+        close(fd);
+        throw invalid_argument(dal::detail::error_messages::file_not_found());
+    }
+    const std::int64_t size = static_cast<std::int64_t>(file_stat.st_size);
+    if (size == 0) {
+        close(fd);
+        return dal::array<byte_t>();
+    }
+    void *mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        throw invalid_argument(dal::detail::error_messages::file_not_found());
+    }
+    return dal::array<byte_t>(static_cast<const byte_t *>(mapped), size, [size](const byte_t *ptr) {
+        munmap(const_cast<byte_t *>(ptr), size);
+    });
+#endif
+}
+
+inline bool is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+}
+
+enum class parse_status { ok, end_of_data, invalid_token };
+
+/// Parses the next integer token in [begin, end) and moves begin past it.
+/// The token is invalid if it has no digits, contains other characters
+/// or does not fit into the Index type
+template <typename Index>
+inline parse_status parse_next_index(const char *&begin, const char *end, Index &value) {
+    while (begin < end && is_space(*begin)) {
+        ++begin;
+    }
+    if (begin == end) {
+        return parse_status::end_of_data;
+    }
+
+    bool negative = false;
+    if (*begin == '-' || *begin == '+') {
+        negative = (*begin == '-');
+        ++begin;
+    }
+    const std::uint64_t limit = static_cast<std::uint64_t>(std::numeric_limits<Index>::max()) +
+                                (negative ? 1 : 0);
+    const char *const digits_begin = begin;
+    std::uint64_t result = 0;
+    while (begin < end && *begin >= '0' && *begin <= '9') {
+        const std::uint64_t digit = static_cast<std::uint64_t>(*begin - '0');
+        if (result > (limit - digit) / 10) {
+            return parse_status::invalid_token;
+        }
+        result = result * 10 + digit;
+        ++begin;
+    }
+    if (begin == digits_begin || (begin < end && !is_space(*begin))) {
+        return parse_status::invalid_token;
+    }
+
+    value = static_cast<Index>(static_cast<std::int64_t>(negative ? 0 - result : result));
+    return parse_status::ok;
+}
+
+template <typename Index>
+edge_list<Index> load_edge_list_parallel(const std::string &name) {
+    using int_t = Index;
+    using edge_t = std::pair<int_t, int_t>;
+
+    const auto file = map_file(name);
+    const char *const data = reinterpret_cast<const char *>(file.get_data());
+    const std::int64_t size = file.get_count();
+
+    // Several chunks per thread balance the load when the lines differ in length
+    constexpr std::int64_t min_chunk_size = 1 << 20;
+    const std::int64_t max_chunk_count = dal::detail::threader_get_max_threads() * 4;
+    const std::int64_t chunk_count =
+        std::max<std::int64_t>(1, std::min(max_chunk_count, size / min_chunk_size));
+
+    // The chunk boundaries are moved to the beginnings of the lines
+    std::vector<std::int64_t> bounds(chunk_count + 1);
+    bounds[0] = 0;
+    bounds[chunk_count] = size;
+    for (std::int64_t i = 1; i < chunk_count; ++i) {
+        std::int64_t pos = std::max(bounds[i - 1], size / chunk_count * i);
+        while (pos > 0 && pos < size && data[pos - 1] != '\n') {
+            ++pos;
+        }
+        bounds[i] = pos;
+    }
+
+    std::vector<std::vector<edge_t>> chunk_edges(chunk_count);
+    std::vector<char> chunk_is_valid(chunk_count, 1);
+    dal::detail::threader_for_int64(chunk_count, [&](std::int64_t i) {
+        const char *begin = data + bounds[i];
+        const char *const end = data + bounds[i + 1];
+        auto &edges = chunk_edges[i];
+        // Every edge is on its own line
+        edges.reserve(std::count(begin, end, '\n') + 1);
+        int_t source, destination;
+        for (;;) {
+            const parse_status source_status = parse_next_index(begin, end, source);
+            if (source_status == parse_status::end_of_data) {
+                break;
+            }
+            if (source_status != parse_status::ok ||
+                parse_next_index(begin, end, destination) != parse_status::ok) {
+                chunk_is_valid[i] = 0;
+                break;
+            }
+            edges.emplace_back(source, destination);
+        }
+    });
+    if (std::find(chunk_is_valid.begin(), chunk_is_valid.end(), 0) != chunk_is_valid.end()) {
+        throw invalid_argument(dal::detail::error_messages::invalid_edge_list_file());
+    }
+
+    std::vector<std::int64_t> chunk_offsets(chunk_count + 1);
+    chunk_offsets[0] = 0;
+    for (std::int64_t i = 0; i < chunk_count; ++i) {
+        chunk_offsets[i + 1] = chunk_offsets[i] + static_cast<std::int64_t>(chunk_edges[i].size());
+    }
+
+    edge_list<int_t> elist;
+    elist.reserve(chunk_offsets[chunk_count]);
+    elist.resize(chunk_offsets[chunk_count]);
+    edge_t *const elist_data = elist.get_mutable_data();
+    dal::detail::threader_for_int64(chunk_count, [&](std::int64_t i) {
+        std::copy(chunk_edges[i].begin(), chunk_edges[i].end(), elist_data + chunk_offsets[i]);
+        std::vector<edge_t>().swap(chunk_edges[i]);
+    });
+
+    return elist;
+}
+
+template <>
+ONEDAL_EXPORT edge_list<std::int32_t> load_edge_list(const std::string &name) {
+    return load_edge_list_parallel<std::int32_t>(name);
+}
+
+template <>
+ONEDAL_EXPORT edge_list<std::int64_t> load_edge_list(const std::string &name) {
+    return load_edge_list_parallel<std::int64_t>(name);
+}
+
 template <>
 ONEDAL_EXPORT std::int64_t get_vertex_count_from_edge_list(const edge_list<std::int32_t> &edges) {
     return dal::backend::dispatch_by_cpu(
@@ -18,7 +18,7 @@
 
 #include <algorithm>
 #include <atomic>
-#include <fstream>
+#include <string>
 
 #include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/exceptions.hpp"
@@ -27,6 +27,8 @@
 #include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
 #include "oneapi/dal/io/detail/load_graph_service.hpp"
 #include "oneapi/dal/io/common.hpp"
+#include "oneapi/dal/io/detail/graph_snapshot.hpp"
+#include "oneapi/dal/io/graph_binary_data_source.hpp"
 #include "oneapi/dal/io/graph_csv_data_source.hpp"
 #include "oneapi/dal/io/load_graph_descriptor.hpp"
 
@@ -35,26 +37,13 @@ namespace oneapi::dal::preview::load_graph::detail {
 template <typename Vertex>
 inline edge_list<Vertex> load_edge_list(const std::string &name);
 
+/// Reads the edge list from the text file with one pair of vertex identifiers per line.
+/// The file is memory mapped and its chunks split by the line boundaries are parsed in parallel.
 template <>
-inline edge_list<std::int32_t> load_edge_list(const std::string &name) {
-    using int_t = std::int32_t;
+ONEDAL_EXPORT edge_list<std::int32_t> load_edge_list(const std::string &name);
 
-    std::ifstream file(name);
-    if (!file.is_open()) {
-        throw invalid_argument(dal::detail::error_messages::file_not_found());
-    }
-    edge_list<int_t> elist;
-    elist.reserve(1024);
-    char source_vertex[32], destination_vertex[32];
-    while (file >> source_vertex >> destination_vertex) {
-        auto edge = std::make_pair(daal_string_to_int(&source_vertex[0], 0),
-                                   daal_string_to_int(&destination_vertex[0], 0));
-        elist.push_back(edge);
-    }
-
-    file.close();
-    return elist;
-}
+template <>
+ONEDAL_EXPORT edge_list<std::int64_t> load_edge_list(const std::string &name);
 
 template <typename Index>
 std::int64_t get_vertex_count_from_edge_list(const edge_list<Index> &edges) {
@@ -256,8 +245,9 @@ void convert_to_csr_impl(const edge_list<typename graph_traits<Graph>::vertex_ty
                             vertex_neighbors,
                             degrees_data);
 
-    if (filtered_total_sum_degrees < oneapi::dal::detail::limits<std::int32_t>::max()) {
-        using vertex_edge_t = typename graph_traits<Graph>::impl_type::vertex_edge_type;
+    using vertex_edge_t = typename graph_traits<Graph>::impl_type::vertex_edge_type;
+    if (sizeof(vertex_edge_t) < sizeof(edge_t) &&
+        filtered_total_sum_degrees < oneapi::dal::detail::limits<vertex_edge_t>::max()) {
         using vertex_edge_set = typename graph_traits<Graph>::impl_type::vertex_edge_set;
         using vertex_edge_allocator_type =
             typename graph_traits<Graph>::impl_type::vertex_edge_allocator_type;
@@ -286,4 +276,13 @@ output_type<Descriptor> load_impl(const Descriptor &desc, const DataSource &data
     convert_to_csr_impl(el, graph);
     return graph;
 }
+
+template <typename Descriptor>
+output_type<Descriptor> load_impl(const Descriptor &desc,
+                                  const graph_binary_data_source &data_source) {
+    using graph_type = output_type<Descriptor>;
+    graph_type graph;
+    load_snapshot_impl(data_source.get_filename(), graph);
+    return graph;
+}
 } // namespace oneapi::dal::preview::load_graph::detail
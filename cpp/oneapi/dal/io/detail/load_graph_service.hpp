@@ -16,8 +16,15 @@
 
 #pragma once
 
+#include <string>
+
+#include "oneapi/dal/array.hpp"
 #include "oneapi/dal/detail/common.hpp"
 
 namespace oneapi::dal::preview::load_graph::detail {
 ONEDAL_EXPORT std::int32_t daal_string_to_int(const char *nptr, char **endptr);
+
+/// Returns the read-only contents of the file. The file is memory mapped where it is supported
+/// and read into memory otherwise, the mapping is released together with the array
+ONEDAL_EXPORT dal::array<byte_t> map_file(const std::string &name);
 } // namespace oneapi::dal::preview::load_graph::detail
@@ -0,0 +1,39 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/// @file
+/// Contains the definition of the graph saving functionality
+
+#pragma once
+
+#include "oneapi/dal/io/detail/graph_snapshot.hpp"
+#include "oneapi/dal/io/graph_binary_data_source.hpp"
+
+namespace oneapi::dal::preview::save_graph {
+
+/// Writes the topology of the graph into the binary snapshot that is loaded back by
+/// the load_graph::load() function with the graph_binary_data_source. The snapshot is
+/// only valid for the graph type with the same vertex and edge index types
+///
+/// @tparam Graph      Type of the graph
+/// @param [in] graph       The graph to save
+/// @param [in] data_source The data source that specifies the snapshot file
+template <typename Graph>
+ONEDAL_EXPORT void save(const Graph &graph, const graph_binary_data_source &data_source) {
+    load_graph::detail::save_snapshot_impl(graph, data_source.get_filename());
+}
+
+} // namespace oneapi::dal::preview::save_graph
@@ -0,0 +1,162 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include "oneapi/dal/graph/service_functions.hpp"
+#include "oneapi/dal/io/load_graph.hpp"
+#include "oneapi/dal/io/save_graph.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::preview::load_graph::test {
+
+/// Writes the text into the file that is removed on destruction
+class temporary_file {
+public:
+    temporary_file(const std::string &name, const std::string &text) : path_(name) {
+        std::ofstream(path_, std::ios::binary) << text;
+    }
+    ~temporary_file() {
+        std::remove(path_.c_str());
+    }
+    const std::string &get_path() const {
+        return path_;
+    }
+
+private:
+    std::string path_;
+};
+
+template <typename Index>
+void check_edges(const edge_list<Index> &edges,
+                 const std::vector<std::pair<Index, Index>> &expected) {
+    REQUIRE(edges.size() == static_cast<std::int64_t>(expected.size()));
+    for (std::int64_t i = 0; i < edges.size(); ++i) {
+        CAPTURE(i);
+        REQUIRE(edges[i] == expected[i]);
+    }
+}
+
+TEST("edge list is parsed from the lines of any format", "[load_graph]") {
+    const temporary_file file("onedal_load_graph_test.csv", "0 1\n1\t2\r\n  +2 3 \n\n3 0");
+    check_edges(detail::load_edge_list<std::int32_t>(file.get_path()),
+                { { 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 0 } });
+}
+
+TEST("edge list accepts the largest vertex index of the type", "[load_graph]") {
+    const temporary_file file("onedal_load_graph_max_test.csv",
+                              "0 2147483647\n0 9223372036854775807\n");
+    check_edges(detail::load_edge_list<std::int64_t>(file.get_path()),
+                { { 0, 2147483647 }, { 0, 9223372036854775807 } });
+}
+
+TEST("edge list rejects the invalid tokens", "[load_graph][badarg]") {
+    const std::string text = GENERATE(std::string("0 1\n1 2x\n"),
+                                      std::string("0 1\n1 -\n"),
+                                      std::string("0 2147483648\n"),
+                                      std::string("0 99999999999999999999\n"),
+                                      std::string("0 1\n2\n"));
+    CAPTURE(text);
+    const temporary_file file("onedal_load_graph_badarg_test.csv", text);
+    REQUIRE_THROWS_AS(detail::load_edge_list<std::int32_t>(file.get_path()), invalid_argument);
+}
+
+TEST("edge list of int64 indices rejects the overflow", "[load_graph][badarg]") {
+    const temporary_file file("onedal_load_graph_overflow_test.csv", "0 9223372036854775808\n");
+    REQUIRE_THROWS_AS(detail::load_edge_list<std::int64_t>(file.get_path()), invalid_argument);
+}
+
+using graph_t = undirected_adjacency_vector_graph<>;
+
+graph_t load_graph_from_edge_list(const std::string &text) {
+    const temporary_file file("onedal_graph_snapshot_test.csv", text);
+    return load(descriptor<>{}, graph_csv_data_source(file.get_path()));
+}
+
+std::string read_file(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+/// Saves the graph and returns the snapshot file content
+std::string save_graph_snapshot(const graph_t &graph) {
+    const temporary_file file("onedal_graph_snapshot_test.bin", "");
+    save_graph::save(graph, graph_binary_data_source(file.get_path()));
+    return read_file(file.get_path());
+}
+
+graph_t load_graph_snapshot(const std::string &snapshot) {
+    const temporary_file file("onedal_graph_snapshot_test.bin", snapshot);
+    return load(descriptor<>{}, graph_binary_data_source(file.get_path()));
+}
+
+/// Overwrites the element of the array at the given offset of the snapshot
+template <typename T>
+void set_snapshot_value(std::string &snapshot, std::int64_t offset, std::int64_t index, T value) {
+    std::memcpy(&snapshot[offset + index * sizeof(T)], &value, sizeof(T));
+}
+
+TEST("graph snapshot round trip keeps the topology", "[graph_snapshot]") {
+    const graph_t expected = load_graph_from_edge_list("0 1\n0 2\n1 2\n2 3\n3 3\n5 4\n1 0\n");
+    const graph_t actual = load_graph_snapshot(save_graph_snapshot(expected));
+
+    REQUIRE(get_vertex_count(actual) == get_vertex_count(expected));
+    REQUIRE(get_edge_count(actual) == get_edge_count(expected));
+    for (std::int32_t u = 0; u < get_vertex_count(expected); ++u) {
+        CAPTURE(u);
+        REQUIRE(get_vertex_degree(actual, u) == get_vertex_degree(expected, u));
+        const auto [expected_begin, expected_end] = get_vertex_neighbors(expected, u);
+        const auto [actual_begin, actual_end] = get_vertex_neighbors(actual, u);
+        REQUIRE(std::equal(expected_begin, expected_end, actual_begin, actual_end));
+    }
+}
+
+TEST("graph snapshot with corrupted topology is rejected", "[graph_snapshot][badarg]") {
+    const std::string snapshot =
+        save_graph_snapshot(load_graph_from_edge_list("0 1\n0 2\n1 2\n2 3\n"));
+    detail::graph_snapshot_header header;
+    std::memcpy(&header, snapshot.data(), sizeof(header));
+    const detail::graph_snapshot_layout layout(header);
+    REQUIRE(layout.is_valid);
+
+    std::string non_monotonic_offsets = snapshot;
+    set_snapshot_value<std::int64_t>(non_monotonic_offsets, layout.offsets, 1, header.neighbor_count);
+    REQUIRE_THROWS_AS(load_graph_snapshot(non_monotonic_offsets), invalid_argument);
+
+    std::string neighbor_out_of_range = snapshot;
+    set_snapshot_value<std::int32_t>(neighbor_out_of_range, layout.neighbors, 0, header.vertex_count);
+    REQUIRE_THROWS_AS(load_graph_snapshot(neighbor_out_of_range), invalid_argument);
+
+    std::string negative_neighbor = snapshot;
+    set_snapshot_value<std::int32_t>(negative_neighbor, layout.neighbors, 0, -1);
+    REQUIRE_THROWS_AS(load_graph_snapshot(negative_neighbor), invalid_argument);
+}
+
+TEST("graph snapshot with overflowing layout is rejected", "[graph_snapshot][badarg]") {
+    std::string snapshot = save_graph_snapshot(load_graph_from_edge_list("0 1\n"));
+    detail::graph_snapshot_header header;
+    std::memcpy(&header, snapshot.data(), sizeof(header));
+    header.neighbor_count = dal::detail::limits<std::int64_t>::max() / 2;
+    std::memcpy(&snapshot[0], &header, sizeof(header));
+    REQUIRE_FALSE(detail::graph_snapshot_layout(header).is_valid);
+    REQUIRE_THROWS_AS(load_graph_snapshot(snapshot), invalid_argument);
+}
+
+} // namespace oneapi::dal::preview::load_graph::test
@@ -0,0 +1,85 @@
+/* file: cov_dense_online_prefetch.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of dense variance-covariance matrix computation in the online
+!    processing mode with the blocks of the data set loaded in the background
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-COVARIANCE_DENSE_ONLINE_PREFETCH"></a>
+ * \example cov_dense_online_prefetch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+const string datasetFileName = "../data/batch/covcormoments_dense.csv";
+const size_t nObservations   = 50;
+
+/* Number of blocks kept in memory: one is processed while the others are loaded */
+const size_t nBlocksInMemory = 3;
+
+/* Sets the block of the data set as the input of the algorithm */
+struct SetCovarianceInput
+{
+    SetCovarianceInput(covariance::Online<> & algorithm) : _algorithm(algorithm) {}
+
+    void operator()(const NumericTablePtr & block) const { _algorithm.input.set(covariance::data, block); }
+
+    covariance::Online<> & _algorithm;
+};
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Start loading the blocks of the data set in the background */
+    DataBlockPrefetcher prefetcher(dataSource, nObservations, nBlocksInMemory);
+
+    /* Create an algorithm to compute a dense variance-covariance matrix in the online processing mode using the default method */
+    covariance::Online<> algorithm;
+
+    /* Compute partial estimates for every block while the next blocks are loaded */
+    services::Status status = computeOnline(prefetcher, algorithm, SetCovarianceInput(algorithm));
+    if (!status)
+    {
+        std::cout << status.getDescription() << std::endl;
+        return -1;
+    }
+
+    /* Finalize the result in the online processing mode */
+    algorithm.finalizeCompute();
+
+    /* Get the computed dense variance-covariance matrix */
+    covariance::ResultPtr res = algorithm.getResult();
+
+    printNumericTable(res->get(covariance::covariance), "Covariance matrix:");
+    printNumericTable(res->get(covariance::mean), "Mean vector:");
+
+    return 0;
+}
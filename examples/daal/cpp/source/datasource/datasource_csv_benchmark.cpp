@@ -0,0 +1,111 @@
+/* file: datasource_csv_benchmark.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example that measures the throughput of loading CSV files
+!    with sequential and parallel reading
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DATASOURCE_CSV_BENCHMARK"></a>
+ * \example datasource_csv_benchmark.cpp
+ */
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "daal.h"
+#include "service.h"
+#include "timer.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+
+/* Synthetic data set parameters */
+const size_t datasetSize = 256 * 1024 * 1024;
+const size_t nRepeats    = 3;
+
+/* Writes a CSV file of approximately datasetSize bytes with nFeatures random continuous features */
+size_t generateDataset(const string & fileName, size_t nFeatures)
+{
+    FILE * file = fopen(fileName.c_str(), "w");
+    if (!file)
+    {
+        cout << "Cannot create file " << fileName << endl;
+        exit(-1);
+    }
+
+    srand(777);
+    size_t fileSize = 0;
+    while (fileSize < datasetSize)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            const double value = (double)rand() / RAND_MAX * 2000.0 - 1000.0;
+            const int length   = fprintf(file, (j + 1 < nFeatures) ? "%.6g," : "%.6g\n", value);
+            fileSize += (length > 0 ? (size_t)length : 0);
+        }
+    }
+    fclose(file);
+    return fileSize;
+}
+
+/* Returns the best throughput of loading the file in GB/s */
+template <typename DataSourceType>
+double measureThroughput(const string & fileName, size_t fileSize, size_t & nRows)
+{
+    const CsvDataSourceOptions::Value options = CsvDataSourceOptions::allocateNumericTable | CsvDataSourceOptions::createDictionaryFromContext;
+
+    double bestTime = 0.0;
+    for (size_t i = 0; i < nRepeats; i++)
+    {
+        const double start = getTimeInSeconds();
+
+        DataSourceType dataSource(fileName, options);
+        nRows = dataSource.loadDataBlock();
+
+        const double time = getTimeInSeconds() - start;
+        bestTime          = (i == 0 || time < bestTime) ? time : bestTime;
+    }
+    return (double)fileSize / bestTime * 1e-9;
+}
+
+void runBenchmark(const string & name, size_t nFeatures)
+{
+    const string fileName = "datasource_csv_benchmark_" + name + ".csv";
+    const size_t fileSize = generateDataset(fileName, nFeatures);
+
+    size_t nRows                    = 0;
+    const double sequentialGbPerSec = measureThroughput<FileDataSource<CSVFeatureManager> >(fileName, fileSize, nRows);
+    const double parallelGbPerSec   = measureThroughput<ParallelFileDataSource<CSVFeatureManager> >(fileName, fileSize, nRows);
+
+    cout << name << " data set: " << nRows << " rows, " << nFeatures << " features, " << fileSize / (1024 * 1024) << " MB" << endl;
+    cout << "    Sequential load: " << sequentialGbPerSec << " GB/s" << endl;
+    cout << "    Parallel load:   " << parallelGbPerSec << " GB/s" << endl;
+
+    remove(fileName.c_str());
+}
+
+int main()
+{
+    runBenchmark("Narrow", 8);
+    runBenchmark("Wide", 512);
+
+    return 0;
+}
@@ -0,0 +1,151 @@
+/* file: gbt_reg_latency_benchmark.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example that measures the p50 and p99 latencies of gradient boosted trees
+!    regression prediction of single rows and small batches with prediction::Batch
+!    and with the low latency predictor
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_REG_LATENCY_BENCHMARK"></a>
+ * \example gbt_reg_latency_benchmark.cpp
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include "daal.h"
+#include "service.h"
+#include "timer.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+using namespace daal::algorithms::gbt::regression;
+
+/* Synthetic data set parameters */
+const size_t nFeatures     = 32;
+const size_t nTrainVectors = 20000;
+const size_t nTestVectors  = 4096;
+const size_t nRequests     = 2000; /* Number of timed prediction requests per configuration */
+
+/* Gradient boosted trees training parameters */
+const size_t maxIterations = 200;
+const size_t maxTreeDepth  = 6;
+
+/* Creates the table of nRows observations with random features and the responses that depend on them non-linearly */
+void generateData(size_t nRows, NumericTablePtr & data, NumericTablePtr & responses)
+{
+    data.reset(new HomogenNumericTable<float>(nFeatures, nRows, NumericTable::doAllocate));
+    responses.reset(new HomogenNumericTable<float>(1, nRows, NumericTable::doAllocate));
+    float * x = static_cast<HomogenNumericTable<float> *>(data.get())->getArray();
+    float * y = static_cast<HomogenNumericTable<float> *>(responses.get())->getArray();
+
+    for (size_t i = 0; i < nRows; i++)
+    {
+        float * row = x + i * nFeatures;
+        for (size_t j = 0; j < nFeatures; j++) row[j] = (float)rand() / RAND_MAX * 2.0f - 1.0f;
+        y[i] = sinf(3.0f * row[0]) + row[1] * row[2] + (row[3] > 0.0f ? row[4] : -row[5]);
+    }
+}
+
+ModelPtr trainModel()
+{
+    NumericTablePtr trainData;
+    NumericTablePtr trainResponses;
+    generateData(nTrainVectors, trainData, trainResponses);
+
+    training::Batch<float> algorithm;
+    algorithm.input.set(training::data, trainData);
+    algorithm.input.set(training::dependentVariable, trainResponses);
+    algorithm.parameter().maxIterations = maxIterations;
+    algorithm.parameter().maxTreeDepth  = maxTreeDepth;
+    algorithm.compute();
+
+    return algorithm.getResult()->get(training::model);
+}
+
+/* Prints the median and the 99th percentile of the latencies given in seconds */
+void printLatencies(const char * name, size_t nRows, vector<double> & latencies)
+{
+    sort(latencies.begin(), latencies.end());
+    const double p50 = latencies[latencies.size() / 2] * 1e6;
+    const double p99 = latencies[latencies.size() * 99 / 100] * 1e6;
+    cout << "    " << name << ", " << nRows << " rows: p50 = " << p50 << " us, p99 = " << p99 << " us" << endl;
+}
+
+/* Measures the latency of prediction::Batch, including the creation of the table that wraps the request rows */
+void measureBatch(const ModelPtr & model, float * x, size_t nRows)
+{
+    vector<double> latencies(nRequests);
+    for (size_t i = 0; i < nRequests; i++)
+    {
+        float * request = x + ((i * nRows) % (nTestVectors - nRows + 1)) * nFeatures;
+
+        const double start = getTimeInSeconds();
+        NumericTablePtr requestData(new HomogenNumericTable<float>(request, nFeatures, nRows));
+        prediction::Batch<float> algorithm;
+        algorithm.input.set(prediction::data, requestData);
+        algorithm.input.set(prediction::model, model);
+        algorithm.compute();
+        latencies[i] = getTimeInSeconds() - start;
+    }
+    printLatencies("prediction::Batch              ", nRows, latencies);
+}
+
+void measureLowLatencyPredictor(const prediction::LowLatencyPredictor & predictor, const float * x, size_t nRows)
+{
+    vector<double> latencies(nRequests);
+    vector<float> predictions(nRows);
+    for (size_t i = 0; i < nRequests; i++)
+    {
+        const float * request = x + ((i * nRows) % (nTestVectors - nRows + 1)) * nFeatures;
+
+        const double start = getTimeInSeconds();
+        predictor.predict(request, nRows, &predictions[0]);
+        latencies[i] = getTimeInSeconds() - start;
+    }
+    printLatencies("prediction::LowLatencyPredictor", nRows, latencies);
+}
+
+int main()
+{
+    srand(777);
+    ModelPtr model = trainModel();
+
+    NumericTablePtr testData;
+    NumericTablePtr testResponses;
+    generateData(nTestVectors, testData, testResponses);
+    float * x = static_cast<HomogenNumericTable<float> *>(testData.get())->getArray();
+
+    /* The predictor is created once per model and then reused for all the requests */
+    prediction::LowLatencyPredictor predictor(model);
+
+    cout << model->getNumberOfTrees() << " trees of depth " << maxTreeDepth << ", " << nFeatures << " features" << endl;
+    const size_t batchSizes[] = { 1, 16 };
+    for (size_t i = 0; i < sizeof(batchSizes) / sizeof(batchSizes[0]); i++)
+    {
+        measureBatch(model, x, batchSizes[i]);
+        measureLowLatencyPredictor(predictor, x, batchSizes[i]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,138 @@
+/* file: gbt_reg_predict_benchmark.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example that measures the throughput of gradient boosted trees regression
+!    prediction with the default and QuickScorer methods
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_REG_PREDICT_BENCHMARK"></a>
+ * \example gbt_reg_predict_benchmark.cpp
+ */
+
+#include <cmath>
+#include <cstdlib>
+
+#include "daal.h"
+#include "service.h"
+#include "timer.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+using namespace daal::algorithms::gbt::regression;
+
+/* Synthetic data set parameters */
+const size_t nFeatures     = 32;
+const size_t nTrainVectors = 20000;
+const size_t nTestVectors  = 100000;
+const size_t nRepeats      = 5;
+
+/* Gradient boosted trees training parameters */
+const size_t maxIterations = 500;
+const size_t maxTreeDepth  = 6;
+
+/* Creates the table of nRows observations with random features and the responses that depend on them non-linearly */
+void generateData(size_t nRows, NumericTablePtr & data, NumericTablePtr & responses)
+{
+    data.reset(new HomogenNumericTable<float>(nFeatures, nRows, NumericTable::doAllocate));
+    responses.reset(new HomogenNumericTable<float>(1, nRows, NumericTable::doAllocate));
+    float * x = static_cast<HomogenNumericTable<float> *>(data.get())->getArray();
+    float * y = static_cast<HomogenNumericTable<float> *>(responses.get())->getArray();
+
+    for (size_t i = 0; i < nRows; i++)
+    {
+        float * row = x + i * nFeatures;
+        for (size_t j = 0; j < nFeatures; j++) row[j] = (float)rand() / RAND_MAX * 2.0f - 1.0f;
+        y[i] = sinf(3.0f * row[0]) + row[1] * row[2] + (row[3] > 0.0f ? row[4] : -row[5]);
+    }
+}
+
+training::ResultPtr trainModel()
+{
+    NumericTablePtr trainData;
+    NumericTablePtr trainResponses;
+    generateData(nTrainVectors, trainData, trainResponses);
+
+    training::Batch<float> algorithm;
+    algorithm.input.set(training::data, trainData);
+    algorithm.input.set(training::dependentVariable, trainResponses);
+    algorithm.parameter().maxIterations = maxIterations;
+    algorithm.parameter().maxTreeDepth  = maxTreeDepth;
+    algorithm.compute();
+
+    return algorithm.getResult();
+}
+
+/* Returns the best time of prediction in seconds */
+template <prediction::Method method>
+double measurePrediction(const ModelPtr & model, const NumericTablePtr & testData, NumericTablePtr & predictions)
+{
+    double bestTime = 0.0;
+    for (size_t i = 0; i < nRepeats; i++)
+    {
+        prediction::Batch<float, method> algorithm;
+        algorithm.input.set(prediction::data, testData);
+        algorithm.input.set(prediction::model, model);
+
+        const double start = getTimeInSeconds();
+        algorithm.compute();
+        const double time = getTimeInSeconds() - start;
+
+        bestTime    = (i == 0 || time < bestTime) ? time : bestTime;
+        predictions = algorithm.getResult()->get(prediction::prediction);
+    }
+    return bestTime;
+}
+
+int main()
+{
+    srand(777);
+    training::ResultPtr trainingResult = trainModel();
+    ModelPtr model                     = trainingResult->get(training::model);
+
+    NumericTablePtr testData;
+    NumericTablePtr testResponses;
+    generateData(nTestVectors, testData, testResponses);
+
+    NumericTablePtr defaultPredictions;
+    NumericTablePtr quickScorerPredictions;
+    const double defaultTime     = measurePrediction<prediction::defaultDense>(model, testData, defaultPredictions);
+    const double quickScorerTime = measurePrediction<prediction::quickScorer>(model, testData, quickScorerPredictions);
+
+    /* Both methods must give the same predictions up to the order of summation of the trees */
+    BlockDescriptor<float> block1;
+    BlockDescriptor<float> block2;
+    defaultPredictions->getBlockOfRows(0, nTestVectors, readOnly, block1);
+    quickScorerPredictions->getBlockOfRows(0, nTestVectors, readOnly, block2);
+    const float * y1 = block1.getBlockPtr();
+    const float * y2 = block2.getBlockPtr();
+    float maxDiff    = 0.0f;
+    for (size_t i = 0; i < nTestVectors; i++) maxDiff = fabsf(y1[i] - y2[i]) > maxDiff ? fabsf(y1[i] - y2[i]) : maxDiff;
+    defaultPredictions->releaseBlockOfRows(block1);
+    quickScorerPredictions->releaseBlockOfRows(block2);
+
+    cout << model->getNumberOfTrees() << " trees of depth " << maxTreeDepth << ", " << nTestVectors << " rows, " << nFeatures << " features"
+         << endl;
+    cout << "    Default method:     " << nTestVectors / defaultTime * 1e-6 << " M rows/s" << endl;
+    cout << "    QuickScorer method: " << nTestVectors / quickScorerTime * 1e-6 << " M rows/s" << endl;
+    cout << "    Maximal difference of predictions: " << maxDiff << endl;
+
+    return 0;
+}
@@ -0,0 +1,179 @@
+/* file: serialization_mapped_model.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of gradient boosted trees model serialization into a file
+!    and its deserialization from the memory mapped file without copying
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-SERIALIZATION_MAPPED_MODEL"></a>
+ * \example serialization_mapped_model.cpp
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstdio>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+using namespace daal::algorithms::gbt::regression;
+
+/* Input data set parameters */
+const string trainDatasetFileName         = "../data/batch/df_regression_train.csv";
+const string testDatasetFileName          = "../data/batch/df_regression_test.csv";
+const string modelFileName                = "gbt_regression_model.bin";
+const size_t categoricalFeaturesIndices[] = { 3 };
+const size_t nFeatures                    = 13; /* Number of features in training and testing data sets */
+
+/* Gradient boosted trees training parameters */
+const size_t maxIterations = 40;
+
+ModelPtr trainModel();
+void saveModel(const ModelPtr & model);
+ModelPtr loadMappedModel();
+void testModel(const ModelPtr & model);
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar);
+
+/* Unmaps the file when the last object that refers to its contents is destroyed */
+struct UnmapDeleter : public services::DeleterIface
+{
+    UnmapDeleter(size_t size) : _size(size) {}
+    void operator()(const void * ptr) DAAL_C11_OVERRIDE { munmap(const_cast<void *>(ptr), _size); }
+    size_t _size;
+};
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    saveModel(trainModel());
+
+    /* The trees of the restored model refer to the mapped file instead of the copies of its contents */
+    ModelPtr model = loadMappedModel();
+    if (!model)
+    {
+        return -1;
+    }
+    testModel(model);
+
+    remove(modelFileName.c_str());
+    return 0;
+}
+
+ModelPtr trainModel()
+{
+    NumericTablePtr trainData;
+    NumericTablePtr trainDependentVariable;
+
+    loadData(trainDatasetFileName, trainData, trainDependentVariable);
+
+    training::Batch<> algorithm;
+    algorithm.input.set(training::data, trainData);
+    algorithm.input.set(training::dependentVariable, trainDependentVariable);
+    algorithm.parameter().maxIterations = maxIterations;
+    algorithm.compute();
+
+    return algorithm.getResult()->get(training::model);
+}
+
+void saveModel(const ModelPtr & model)
+{
+    /* Serialize the model into the data archive */
+    InputDataArchive dataArch;
+    model->serialize(dataArch);
+
+    /* Write the serialized data into the file */
+    const size_t length = dataArch.getSizeOfArchive();
+    byte * buffer       = new byte[length];
+    dataArch.copyArchiveToArray(buffer, length);
+
+    FILE * file = fopen(modelFileName.c_str(), "wb");
+    fwrite(buffer, 1, length, file);
+    fclose(file);
+
+    delete[] buffer;
+}
+
+ModelPtr loadMappedModel()
+{
+    const int fd = open(modelFileName.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return ModelPtr();
+    }
+
+    struct stat fileStat;
+    fstat(fd, &fileStat);
+    const size_t length = (size_t)fileStat.st_size;
+
+    /* The mapping is page aligned, so the arrays of the archive keep their alignment */
+    void * mapped = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED)
+    {
+        return ModelPtr();
+    }
+    services::SharedPtr<byte> buffer((byte *)mapped, UnmapDeleter(length));
+
+    /* Create a data archive over the mapped file and deserialize the model from it */
+    OutputDataArchive dataArch(buffer, length);
+    return services::dynamicPointerCast<Model, SerializationIface>(dataArch.getAsSharedPtr());
+}
+
+void testModel(const ModelPtr & model)
+{
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    prediction::Batch<> algorithm;
+    algorithm.input.set(prediction::data, testData);
+    algorithm.input.set(prediction::model, model);
+    algorithm.compute();
+
+    prediction::ResultPtr predictionResult = algorithm.getResult();
+    printNumericTable(predictionResult->get(prediction::prediction), "Gradient boosted trees prediction results (first 10 rows):", 10);
+    printNumericTable(testGroundTruth, "Ground truth (first 10 rows):", 10);
+}
+
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    NumericTableDictionaryPtr pDictionary = pData->getDictionarySharedPtr();
+    for (size_t i = 0, n = sizeof(categoricalFeaturesIndices) / sizeof(categoricalFeaturesIndices[0]); i < n; ++i)
+        (*pDictionary)[categoricalFeaturesIndices[i]].featureType = data_feature_utils::DAAL_CATEGORICAL;
+}
@@ -0,0 +1,52 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <cstdio>
+#include <iostream>
+
+#include "example_util/utils.hpp"
+#include "oneapi/dal/graph/service_functions.hpp"
+#include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
+#include "oneapi/dal/io/graph_binary_data_source.hpp"
+#include "oneapi/dal/io/graph_csv_data_source.hpp"
+#include "oneapi/dal/io/load_graph.hpp"
+#include "oneapi/dal/io/save_graph.hpp"
+
+namespace dal = oneapi::dal;
+
+int main(int argc, char **argv) {
+    const auto filename = get_data_path("graph.csv");
+    const std::string snapshot_filename = "graph_snapshot.bin";
+
+    const dal::preview::graph_csv_data_source csv_ds(filename);
+    const dal::preview::graph_binary_data_source binary_ds(snapshot_filename);
+    const dal::preview::load_graph::descriptor<> d;
+
+    // Build the graph from the edge list once and save its topology
+    const auto csv_graph = dal::preview::load_graph::load(d, csv_ds);
+    dal::preview::save_graph::save(csv_graph, binary_ds);
+
+    // Later runs map the snapshot instead of rebuilding the graph
+    const auto my_graph = dal::preview::load_graph::load(d, binary_ds);
+
+    std::cout << "Graph is read from snapshot: " << snapshot_filename << std::endl;
+    std::cout << "Number of vertices: " << dal::preview::get_vertex_count(my_graph) << std::endl;
+    std::cout << "Number of edges: " << dal::preview::get_edge_count(my_graph) << std::endl;
+
+    std::remove(snapshot_filename.c_str());
+    return 0;
+}